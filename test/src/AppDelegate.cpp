@@ -79,10 +79,21 @@ void AppDelegate::setPreferredPresentMode(gl::PresentMode mode) {
 	_preferredPresentMode = mode;
 }
 
+void AppDelegate::setPreferredExtent(Extent2 extent) {
+	std::unique_lock<Mutex> lock(_configMutex);
+	_preferredExtent = extent;
+}
+
 gl::SwapchainConfig AppDelegate::selectConfig(const gl::SurfaceInfo &info) {
 	std::unique_lock<Mutex> lock(_configMutex);
 	gl::SwapchainConfig ret;
 	ret.extent = info.currentExtent;
+	if (_preferredExtent.width > 0 && _preferredExtent.height > 0) {
+		// surface limits are respected, most window systems allow only window's extent
+		ret.extent = Extent2(
+				std::clamp(_preferredExtent.width, info.minImageExtent.width, info.maxImageExtent.width),
+				std::clamp(_preferredExtent.height, info.minImageExtent.height, info.maxImageExtent.height));
+	}
 	ret.imageCount = std::max(uint32_t(2), info.minImageCount);
 
 	ret.presentMode = info.presentModes.front();
@@ -43,6 +43,9 @@ public:
 
 	void setPreferredPresentMode(gl::PresentMode);
 
+	// swapchain extent instead of window's one (0 - use window's extent)
+	void setPreferredExtent(Extent2);
+
 	Rc<renderqueue::Queue> getShadowQueue() const { return _shadowQueueLoaded ? _shadowQueue : nullptr; }
 
 protected:
@@ -51,6 +54,7 @@ protected:
 
 	Mutex _configMutex;
 	gl::PresentMode _preferredPresentMode = gl::PresentMode::Unsupported;
+	Extent2 _preferredExtent = Extent2(0, 0);
 
 	gl::SurfaceInfo _surfaceInfo;
 	gl::SwapchainConfig _swapchainConfig;
@@ -33,6 +33,10 @@
 #include "general/AppGeneralAutofitTest.cc"
 #include "general/AppGeneralTemporaryResourceTest.cc"
 #include "general/AppGeneralScissorTest.cc"
+#include "general/AppGeneralMemoryBudgetTest.cc"
+#include "general/AppGeneralKtxTranscodeTest.cc"
+#include "general/AppGeneralDamageTest.cc"
+#include "general/AppGeneralRasterCacheTest.cc"
 #include "input/AppInputTouchTest.cc"
 #include "input/AppInputKeyboardTest.cc"
 #include "input/AppInputTapPressTest.cc"
@@ -59,6 +63,10 @@
 #include "material/AppMaterialToolbarTest.cc"
 #include "config/AppConfigMenu.cc"
 #include "config/AppConfigPresentModeSwitcher.cc"
+#include "config/AppConfigAsyncComputeTest.cc"
+#include "config/AppConfigResizeTest.cc"
+#include "config/AppConfigPassTimeTest.cc"
+#include "config/AppConfigPacingTest.cc"
 
 namespace stappler::xenolith::app {
 
@@ -72,6 +80,7 @@ static Vector<MenuData> s_layouts {
 			LayoutName::UtilsTests,
 			LayoutName::MaterialTests,
 			LayoutName::Config,
+			LayoutName::ConfigTests,
 		}); }},
 	MenuData{LayoutName::GeneralTests, LayoutName::Root, "org.stappler.xenolith.test.GeneralTests", "General tests",
 		[] (LayoutName name) { return Rc<LayoutMenu>::create(name, Vector<LayoutName>{
@@ -82,6 +91,10 @@ static Vector<MenuData> s_layouts {
 			LayoutName::GeneralAutofitTest,
 			LayoutName::GeneralTemporaryResourceTest,
 			LayoutName::GeneralScissorTest,
+			LayoutName::GeneralMemoryBudgetTest,
+			LayoutName::GeneralKtxTranscodeTest,
+			LayoutName::GeneralDamageTest,
+			LayoutName::GeneralRasterCacheTest,
 		}); }},
 	MenuData{LayoutName::InputTests, LayoutName::Root, "org.stappler.xenolith.test.InputTests", "Input tests",
 		[] (LayoutName name) { return Rc<LayoutMenu>::create(name, Vector<LayoutName>{
@@ -124,6 +137,13 @@ static Vector<MenuData> s_layouts {
 
 	MenuData{LayoutName::Config, LayoutName::Root, "org.stappler.xenolith.test.Config", "Config",
 		[] (LayoutName name) { return Rc<ConfigMenu>::create(); }},
+	MenuData{LayoutName::ConfigTests, LayoutName::Root, "org.stappler.xenolith.test.ConfigTests", "Config tests",
+		[] (LayoutName name) { return Rc<LayoutMenu>::create(name, Vector<LayoutName>{
+			LayoutName::ConfigAsyncComputeTest,
+			LayoutName::ConfigResizeTest,
+			LayoutName::ConfigPassTimeTest,
+			LayoutName::ConfigPacingTest,
+		}); }},
 	MenuData{LayoutName::GeneralUpdateTest, LayoutName::GeneralTests, "org.stappler.xenolith.test.GeneralUpdateTest", "Update test",
 		[] (LayoutName name) { return Rc<GeneralUpdateTest>::create(); }},
 	MenuData{LayoutName::GeneralZOrderTest, LayoutName::GeneralTests, "org.stappler.xenolith.test.GeneralZOrderTest", "Z Order test",
@@ -138,6 +158,14 @@ static Vector<MenuData> s_layouts {
 		[] (LayoutName name) { return Rc<GeneralTemporaryResourceTest>::create(); }},
 	MenuData{LayoutName::GeneralScissorTest, LayoutName::GeneralTests, "org.stappler.xenolith.test.GeneralScissorTest", "Scissor Test",
 		[] (LayoutName name) { return Rc<GeneralScissorTest>::create(); }},
+	MenuData{LayoutName::GeneralMemoryBudgetTest, LayoutName::GeneralTests, "org.stappler.xenolith.test.GeneralMemoryBudgetTest", "Memory Budget Test",
+		[] (LayoutName name) { return Rc<GeneralMemoryBudgetTest>::create(); }},
+	MenuData{LayoutName::GeneralKtxTranscodeTest, LayoutName::GeneralTests, "org.stappler.xenolith.test.GeneralKtxTranscodeTest", "KTX Transcode Test",
+		[] (LayoutName name) { return Rc<GeneralKtxTranscodeTest>::create(); }},
+	MenuData{LayoutName::GeneralDamageTest, LayoutName::GeneralTests, "org.stappler.xenolith.test.GeneralDamageTest", "Damage Test",
+		[] (LayoutName name) { return Rc<GeneralDamageTest>::create(); }},
+	MenuData{LayoutName::GeneralRasterCacheTest, LayoutName::GeneralTests, "org.stappler.xenolith.test.GeneralRasterCacheTest", "Raster Cache Test",
+		[] (LayoutName name) { return Rc<GeneralRasterCacheTest>::create(); }},
 
 	MenuData{LayoutName::InputTouchTest, LayoutName::InputTests, "org.stappler.xenolith.test.InputTouchTest", "Touch test",
 		[] (LayoutName name) { return Rc<InputTouchTest>::create(); }},
@@ -189,6 +217,15 @@ static Vector<MenuData> s_layouts {
 		[] (LayoutName name) { return Rc<MaterialInputFieldTest>::create(); }},
 	MenuData{LayoutName::MaterialToolbarTest, LayoutName::MaterialTests, "org.stappler.xenolith.test.MaterialToolbarTest", "Toolbar test",
 		[] (LayoutName name) { return Rc<MaterialToolbarTest>::create(); }},
+
+	MenuData{LayoutName::ConfigAsyncComputeTest, LayoutName::ConfigTests, "org.stappler.xenolith.test.ConfigAsyncComputeTest", "Async compute test",
+		[] (LayoutName name) { return Rc<ConfigAsyncComputeTest>::create(); }},
+	MenuData{LayoutName::ConfigResizeTest, LayoutName::ConfigTests, "org.stappler.xenolith.test.ConfigResizeTest", "Resize test",
+		[] (LayoutName name) { return Rc<ConfigResizeTest>::create(); }},
+	MenuData{LayoutName::ConfigPassTimeTest, LayoutName::ConfigTests, "org.stappler.xenolith.test.ConfigPassTimeTest", "Pass time test",
+		[] (LayoutName name) { return Rc<ConfigPassTimeTest>::create(); }},
+	MenuData{LayoutName::ConfigPacingTest, LayoutName::ConfigTests, "org.stappler.xenolith.test.ConfigPacingTest", "Pacing test",
+		[] (LayoutName name) { return Rc<ConfigPacingTest>::create(); }},
 };
 
 LayoutName getRootLayoutForLayout(LayoutName name) {
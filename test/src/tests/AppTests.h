@@ -37,6 +37,7 @@ enum class LayoutName {
 	UtilsTests,
 	MaterialTests,
 	Config,
+	ConfigTests,
 
 	GeneralUpdateTest = 256 * 1,
 	GeneralZOrderTest,
@@ -45,6 +46,10 @@ enum class LayoutName {
 	GeneralAutofitTest,
 	GeneralTemporaryResourceTest,
 	GeneralScissorTest,
+	GeneralMemoryBudgetTest,
+	GeneralKtxTranscodeTest,
+	GeneralDamageTest,
+	GeneralRasterCacheTest,
 
 	InputTouchTest = 256 * 2,
 	InputKeyboardTest,
@@ -73,6 +78,11 @@ enum class LayoutName {
 	MaterialButtonTest,
 	MaterialInputFieldTest,
 	MaterialToolbarTest,
+
+	ConfigAsyncComputeTest = 256 * 7,
+	ConfigResizeTest,
+	ConfigPassTimeTest,
+	ConfigPacingTest,
 };
 
 struct MenuData {
@@ -0,0 +1,362 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "AppConfigAsyncComputeTest.h"
+#include "XLDirector.h"
+#include "XLApplication.h"
+#include "XLScene.h"
+#include "XLSceneLight.h"
+#include "XLRenderQueueFrameCache.h"
+#include "XLRenderQueueImageStorage.h"
+#include "XLVkLoop.h"
+#include "XLVkDevice.h"
+
+namespace stappler::xenolith::app {
+
+// frames to render in each mode
+static constexpr uint32_t AsyncComputeTestFrames = 120;
+
+// node rotation for captured frames
+static constexpr float AsyncComputeTestCaptureRotation = 0.5f;
+
+// max difference for color component between captured frames
+static constexpr uint8_t AsyncComputeTestTolerance = 8;
+
+bool ConfigAsyncComputeTest::init() {
+	if (!LayoutTest::init(LayoutName::ConfigAsyncComputeTest, "Shadow should be rendered with async compute and with graphics queue")) {
+		return false;
+	}
+
+	_label = addChild(Rc<Label>::create(), ZOrder(1));
+	_label->setAnchorPoint(Anchor::Middle);
+	_label->setFontSize(20);
+	_label->setFontWeight(Label::FontWeight::Bold);
+
+	_stat = addChild(Rc<Label>::create(), ZOrder(1));
+	_stat->setAnchorPoint(Anchor::Middle);
+	_stat->setFontSize(16);
+	_stat->setColor(Color::Grey_600);
+
+	// shadow index forces shadow compute pass for every frame
+	_layer = addChild(Rc<Layer>::create(Color::Grey_100), ZOrder(1));
+	_layer->setAnchorPoint(Anchor::Middle);
+	_layer->setContentSize(Size2(128.0f, 128.0f));
+	_layer->setShadowIndex(8.0f);
+
+	setStage(Stage::Switching);
+	scheduleUpdate();
+
+	return true;
+}
+
+void ConfigAsyncComputeTest::onContentSizeDirty() {
+	LayoutTest::onContentSizeDirty();
+
+	_label->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height - 64.0f));
+	_stat->setPosition(Vec2(_contentSize.width / 2.0f, 32.0f));
+	_layer->setPosition(_contentSize / 2.0f);
+}
+
+void ConfigAsyncComputeTest::onEnter(Scene *scene) {
+	LayoutTest::onEnter(scene);
+
+	auto light = Rc<SceneLight>::create(SceneLightType::Ambient, Vec2(0.0f, 0.3f), 1.5f, Color::White);
+	auto ambient = Rc<SceneLight>::create(SceneLightType::Ambient, Vec2(0.0f, 0.0f), 1.5f, Color::White);
+
+	_scene->removeAllLights();
+	_scene->addLight(move(light));
+	_scene->addLight(move(ambient));
+
+	setAsyncComputeEnabled(true);
+}
+
+void ConfigAsyncComputeTest::onExit() {
+	restoreDeviceState();
+
+	LayoutTest::onExit();
+}
+
+void ConfigAsyncComputeTest::update(const UpdateTime &time) {
+	LayoutTest::update(time);
+
+	if (_stage != Stage::AsyncCompute && _stage != Stage::GraphicsQueue) {
+		return;
+	}
+
+	_layer->setRotation(_layer->getRotation() + float(time.delta) / 1'000'000.0f);
+
+	++ _frames;
+	_stat->setString(toString("Frames: ", _frames, " / ", AsyncComputeTestFrames));
+
+	if (_frames >= AsyncComputeTestFrames) {
+		// same node state is captured in both modes
+		setStage(Stage::Capturing);
+		_layer->setRotation(AsyncComputeTestCaptureRotation);
+		captureFrame();
+	}
+}
+
+void ConfigAsyncComputeTest::setAsyncComputeEnabled(bool enabled) {
+	Rc<vk::Loop> loop = dynamic_cast<vk::Loop *>(_director->getApplication()->getGlLoop().get());
+	if (!loop) {
+		setStage(Stage::Failed, "Vulkan loop is not available");
+		return;
+	}
+
+	// device is owned by gl thread
+	loop->performOnGlThread([this, loop, enabled] {
+		bool available = false;
+		bool async = false;
+		bool forced = false;
+		uint64_t semaphores = 0;
+		if (auto dev = loop->getDevice()) {
+			dev->setAsyncComputeEnabled(enabled);
+			available = true;
+			async = dev->hasAsyncCompute();
+
+			// without separate compute family, semaphore path is checked within graphics family
+			forced = enabled && !async;
+			dev->setQueueSemaphoresForced(forced);
+			semaphores = dev->getQueueSemaphoresCount();
+		}
+
+		Application::getInstance()->performOnMainThread([this, available, enabled, async, forced, semaphores] {
+			handleModeChanged(available, enabled, async, forced, semaphores);
+		}, this, false);
+	}, this);
+}
+
+void ConfigAsyncComputeTest::restoreDeviceState() {
+	Rc<vk::Loop> loop = dynamic_cast<vk::Loop *>(_director->getApplication()->getGlLoop().get());
+	if (!loop) {
+		return;
+	}
+
+	loop->performOnGlThread([loop] {
+		if (auto dev = loop->getDevice()) {
+			dev->setQueueSemaphoresForced(false);
+			dev->setAsyncComputeEnabled(true);
+		}
+	}, this);
+}
+
+void ConfigAsyncComputeTest::handleModeChanged(bool available, bool enabled, bool async, bool forced, uint64_t semaphores) {
+	if (_stage != Stage::Switching) {
+		return;
+	}
+
+	if (!available) {
+		setStage(Stage::Failed, "Device is not available");
+	} else if (enabled) {
+		_asyncAvailable = async;
+		_semaphoresForced = forced;
+		_semaphores = semaphores;
+		_async = true;
+		setStage(Stage::AsyncCompute);
+	} else if (async) {
+		setStage(Stage::Failed, "Compute passes still use separate queue family");
+	} else if ((_asyncAvailable || _semaphoresForced) && semaphores == _semaphores) {
+		setStage(Stage::Failed, "No semaphores were signaled between compute and graphics passes");
+	} else {
+		_async = false;
+		setStage(Stage::GraphicsQueue);
+	}
+}
+
+void ConfigAsyncComputeTest::captureFrame() {
+	auto &queue = _scene->getRenderQueue();
+
+	const renderqueue::AttachmentData *output = nullptr;
+	for (auto &it : queue->getOutputAttachments()) {
+		if (auto a = dynamic_cast<renderqueue::ImageAttachment *>(it->attachment.get())) {
+			if ((a->getImageInfo().usage & gl::ImageUsage::ColorAttachment) != gl::ImageUsage::None) {
+				output = it;
+				break;
+			}
+		}
+	}
+
+	if (!output) {
+		setStage(Stage::Failed, "Scene's render queue has no color output");
+		return;
+	}
+
+	// swapchain images can not be read, so current scene state is rendered once more into readable image
+	auto &constraints = _scene->getFrameConstraints();
+	auto req = Rc<renderqueue::FrameRequest>::create(queue, constraints);
+	_scene->specializeRequest(req);
+	_scene->renderRequest(req);
+
+	Rc<gl::Loop> loop = _director->getView()->getLoop();
+	loop->performOnGlThread([this, self = Rc<ConfigAsyncComputeTest>(this), loop, req, output,
+			extent = constraints.extent, view = Rc<gl::View>(_director->getView())] () mutable {
+		auto a = static_cast<renderqueue::ImageAttachment *>(output->attachment.get());
+
+		gl::ImageInfo imageInfo(extent, gl::ImageUsage::ColorAttachment | gl::ImageUsage::TransferSrc,
+				gl::RenderPassType::Graphics, a->getImageInfo().format);
+
+		auto target = loop->getFrameCache()->acquireImage(imageInfo, a->getImageViews(imageInfo));
+		if (!target) {
+			Application::getInstance()->performOnMainThread([this, self] {
+				handleCapture(gl::ImageInfo(), Bytes());
+			}, this, false);
+			return;
+		}
+
+		req->setRenderTarget(output, move(target));
+		req->setOutput(output, move(view), [this, self, loop] (const Rc<gl::View> &view, renderqueue::FrameAttachmentData &data, bool success) {
+			if (!success || !data.image) {
+				Application::getInstance()->performOnMainThread([this, self] {
+					handleCapture(gl::ImageInfo(), Bytes());
+				}, this, false);
+				return true;
+			}
+
+			// image should not be returned into cache until it's data was read
+			Rc<renderqueue::ImageStorage> storage = move(data.image);
+			auto image = storage->getImage();
+			auto layout = storage->getLayout();
+			view->captureImage([this, self, loop, storage = move(storage)] (const gl::ImageInfo &info, BytesView bytes) mutable {
+				loop->releaseImage(move(storage));
+				Application::getInstance()->performOnMainThread([this, self, info, data = bytes.bytes<Interface>()] () mutable {
+					handleCapture(info, move(data));
+				}, this, false);
+			}, image, layout);
+			return true;
+		});
+
+		loop->runRenderQueue(move(req));
+	}, this);
+}
+
+void ConfigAsyncComputeTest::handleCapture(const gl::ImageInfo &info, Bytes &&data) {
+	if (_stage != Stage::Capturing) {
+		return;
+	}
+
+	if (data.empty()) {
+		setStage(Stage::Failed, "Fail to capture frame");
+		return;
+	}
+
+	_captureInfo = info;
+	_captures[_async ? 0 : 1] = move(data);
+
+	if (_async) {
+		setStage(Stage::Switching);
+		setAsyncComputeEnabled(false);
+	} else {
+		compareCaptures();
+	}
+}
+
+void ConfigAsyncComputeTest::compareCaptures() {
+	auto &async = _captures[0];
+	auto &graphics = _captures[1];
+
+	if (async.size() != graphics.size()) {
+		setStage(Stage::Failed, toString("Captured frames have different size: ", async.size(), " and ", graphics.size()));
+		return;
+	}
+
+	auto blockSize = gl::getFormatBlockSize(_captureInfo.format);
+	if (blockSize == 0) {
+		setStage(Stage::Failed, "Captured frame has unknown format");
+		return;
+	}
+
+	size_t mismatched = 0;
+	uint8_t maxDiff = 0;
+	for (size_t i = 0; i < async.size(); i += blockSize) {
+		bool match = true;
+		for (size_t j = i; j < i + blockSize && j < async.size(); ++ j) {
+			auto diff = uint8_t(std::abs(int(async[j]) - int(graphics[j])));
+			maxDiff = std::max(maxDiff, diff);
+			if (diff > AsyncComputeTestTolerance) {
+				match = false;
+			}
+		}
+		if (!match) {
+			++ mismatched;
+		}
+	}
+
+	if (mismatched > 0) {
+		setStage(Stage::Failed, toString("Shadow output differs between modes in ", mismatched,
+				" pixels, max difference: ", uint32_t(maxDiff)));
+		return;
+	}
+
+	StringStream stream;
+	if (_asyncAvailable) {
+		stream << "Async compute: separate queue family";
+	} else {
+		stream << "Async compute: semaphores forced within single queue family, ownership transfer skipped";
+	}
+	stream << "; output matches, max difference: " << uint32_t(maxDiff);
+	setStage(Stage::Done, stream.str());
+}
+
+void ConfigAsyncComputeTest::setStage(Stage stage, StringView message) {
+	_stage = stage;
+	_frames = 0;
+
+	// labels are hidden for captured frames, so both frames have same content
+	_label->setVisible(_stage != Stage::Capturing);
+	_stat->setVisible(_stage != Stage::Capturing);
+
+	switch (_stage) {
+	case Stage::Switching:
+		_label->setString("Switching compute queue");
+		_label->setColor(Color::Grey_500);
+		break;
+	case Stage::AsyncCompute:
+		_label->setString(_asyncAvailable ? "Rendering with async compute"
+				: "Rendering with forced semaphores (single queue family)");
+		_label->setColor(Color::Orange_600);
+		break;
+	case Stage::GraphicsQueue:
+		_label->setString("Rendering with compute in graphics queue");
+		_label->setColor(Color::Orange_600);
+		break;
+	case Stage::Capturing:
+		break;
+	case Stage::Done:
+		_label->setString(message);
+		_label->setColor(Color::Green_600);
+		if (!_asyncAvailable) {
+			log::vtext("ConfigAsyncComputeTest", "Queue family ownership transfer was not checked: device has single queue family");
+		}
+		break;
+	case Stage::Failed:
+		_label->setString(toString("Failed: ", message));
+		_label->setColor(Color::Red_600);
+		log::vtext("ConfigAsyncComputeTest", message);
+		break;
+	}
+
+	if (_stage == Stage::Done || _stage == Stage::Failed) {
+		restoreDeviceState();
+	}
+}
+
+}
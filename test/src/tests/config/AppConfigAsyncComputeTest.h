@@ -0,0 +1,87 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef TEST_SRC_TESTS_CONFIG_APPCONFIGASYNCCOMPUTETEST_H_
+#define TEST_SRC_TESTS_CONFIG_APPCONFIGASYNCCOMPUTETEST_H_
+
+#include "AppLayoutTest.h"
+
+namespace stappler::xenolith::app {
+
+// Renders shadowed node with async compute enabled, then with compute passes forced into graphics queue,
+// then compares shadowed node, rendered offscreen in both modes
+//
+// On devices with single queue family semaphores between compute and graphics passes are forced in first mode,
+// so semaphore path is still executed; queue family ownership transfers can not be checked there and reported as skipped
+class ConfigAsyncComputeTest : public LayoutTest {
+public:
+	enum class Stage {
+		Switching,
+		AsyncCompute,
+		GraphicsQueue,
+		Capturing,
+		Done,
+		Failed,
+	};
+
+	virtual ~ConfigAsyncComputeTest() { }
+
+	virtual bool init() override;
+
+	virtual void onContentSizeDirty() override;
+
+	virtual void onEnter(Scene *) override;
+	virtual void onExit() override;
+
+	virtual void update(const UpdateTime &) override;
+
+protected:
+	using LayoutTest::init;
+
+	void setAsyncComputeEnabled(bool);
+	void restoreDeviceState();
+	void handleModeChanged(bool available, bool enabled, bool async, bool forced, uint64_t semaphores);
+
+	void captureFrame();
+	void handleCapture(const gl::ImageInfo &, Bytes &&);
+	void compareCaptures();
+
+	void setStage(Stage, StringView = StringView());
+
+	Stage _stage = Stage::Switching;
+	uint32_t _frames = 0;
+	bool _asyncAvailable = false;
+	bool _semaphoresForced = false;
+	bool _async = true; // mode of current or last rendering stage
+	uint64_t _semaphores = 0; // device semaphores counter on async stage start
+
+	gl::ImageInfo _captureInfo;
+	Bytes _captures[2];
+
+	Layer *_layer = nullptr;
+	Label *_label = nullptr;
+	Label *_stat = nullptr;
+};
+
+}
+
+#endif /* TEST_SRC_TESTS_CONFIG_APPCONFIGASYNCCOMPUTETEST_H_ */
@@ -0,0 +1,224 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "AppConfigPacingTest.h"
+#include "XLDirector.h"
+#include "XLApplication.h"
+
+namespace stappler::xenolith::app {
+
+// time to measure each pacing mode, in microseconds
+static constexpr uint64_t PacingTestModeTime = 2'000'000;
+
+// interval between synthetic input events, in microseconds
+static constexpr uint64_t PacingTestInputInterval = 100'000;
+
+// frame interval for Fixed mode, in microseconds; greater than common vsync period, so limit is observable
+static constexpr uint64_t PacingTestFixedInterval = 50'000;
+
+static constexpr vk::View::FramePacing PacingTestModes[] = {
+	vk::View::FramePacing::Throughput,
+	vk::View::FramePacing::LowLatency,
+	vk::View::FramePacing::Fixed,
+};
+
+static StringView getFramePacingName(vk::View::FramePacing pacing) {
+	switch (pacing) {
+	case vk::View::FramePacing::Throughput: return "Throughput";
+	case vk::View::FramePacing::LowLatency: return "LowLatency";
+	case vk::View::FramePacing::Fixed: return "Fixed";
+	}
+	return StringView();
+}
+
+bool ConfigPacingTest::init() {
+	if (!LayoutTest::init(LayoutName::ConfigPacingTest, "Input latency should be measured in every pacing mode, Fixed mode should limit frame rate")) {
+		return false;
+	}
+
+	_label = addChild(Rc<Label>::create(), ZOrder(1));
+	_label->setAnchorPoint(Anchor::Middle);
+	_label->setFontSize(20);
+	_label->setFontWeight(Label::FontWeight::Bold);
+
+	_stat = addChild(Rc<Label>::create(), ZOrder(1));
+	_stat->setAnchorPoint(Anchor::MiddleTop);
+	_stat->setFontSize(16);
+	_stat->setColor(Color::Grey_600);
+
+	// animated node keeps frames coming
+	_layer = addChild(Rc<Layer>::create(Color::Grey_300), ZOrder(1));
+	_layer->setAnchorPoint(Anchor::Middle);
+	_layer->setContentSize(Size2(64.0f, 64.0f));
+
+	setStage(Stage::Switching);
+	scheduleUpdate();
+
+	return true;
+}
+
+void ConfigPacingTest::onContentSizeDirty() {
+	LayoutTest::onContentSizeDirty();
+
+	_label->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height - 64.0f));
+	_stat->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height - 96.0f));
+	_layer->setPosition(Vec2(_contentSize.width / 2.0f, 96.0f));
+}
+
+void ConfigPacingTest::onEnter(Scene *scene) {
+	LayoutTest::onEnter(scene);
+
+	auto view = dynamic_cast<vk::View *>(_director->getView());
+	if (!view) {
+		setStage(Stage::Failed, "Vulkan view is not available");
+		return;
+	}
+
+	_pacing = view->getFramePacing();
+	_pacingInterval = view->getFramePacingInterval();
+	_pacingChanged = true;
+	_mode = 0;
+
+	setFramePacing(PacingTestModes[_mode], PacingTestFixedInterval);
+}
+
+void ConfigPacingTest::onExit() {
+	if (_pacingChanged) {
+		if (auto view = dynamic_cast<vk::View *>(_director->getView())) {
+			Rc<vk::View> v = view;
+			auto pacing = _pacing;
+			auto interval = _pacingInterval;
+			view->performOnThread([v, pacing, interval] {
+				v->setFramePacing(pacing, interval);
+			}, view, true);
+		}
+		_pacingChanged = false;
+	}
+
+	LayoutTest::onExit();
+}
+
+void ConfigPacingTest::update(const UpdateTime &time) {
+	LayoutTest::update(time);
+
+	_layer->setRotation(_layer->getRotation() + float(time.delta) / 1'000'000.0f);
+
+	if (_stage != Stage::Measuring) {
+		return;
+	}
+
+	_stageTime += time.delta;
+	_inputTime += time.delta;
+
+	if (_inputTime > PacingTestInputInterval) {
+		_inputTime = 0;
+		// synthetic pointer movement, latency is measured from this event to the next presented frame
+		auto pos = _layer->getPosition();
+		_director->getView()->handleInputEvent(InputEventData{maxOf<uint32_t>(),
+			InputEventName::MouseMove, InputMouseButton::None, InputModifier::None, pos.x, pos.y});
+	}
+
+	auto view = _director->getView();
+	_stat->setString(toString(_results.str(), getFramePacingName(PacingTestModes[_mode]),
+			": interval: ", view->getAvgFrameInterval(), " us; input latency: ", _director->getInputLatency(),
+			" ms (avg: ", _director->getAvgInputLatency(), " ms)\n"));
+
+	if (_stageTime > PacingTestModeTime) {
+		handleModeResult();
+	}
+}
+
+void ConfigPacingTest::setFramePacing(vk::View::FramePacing pacing, uint64_t interval) {
+	setStage(Stage::Switching);
+
+	auto view = dynamic_cast<vk::View *>(_director->getView());
+	Rc<vk::View> v = view;
+
+	// pacing options are owned by view's thread
+	view->performOnThread([this, v, pacing, interval] {
+		v->setFramePacing(pacing, interval);
+
+		Application::getInstance()->performOnMainThread([this] {
+			if (_stage == Stage::Switching) {
+				setStage(Stage::Measuring);
+			}
+		}, this, false);
+	}, this, true);
+}
+
+void ConfigPacingTest::handleModeResult() {
+	auto pacing = PacingTestModes[_mode];
+	auto view = _director->getView();
+	auto frameInterval = view->getAvgFrameInterval();
+	auto latency = _director->getInputLatency();
+	auto avgLatency = _director->getAvgInputLatency();
+
+	_results << getFramePacingName(pacing) << ": interval: " << frameInterval << " us; input latency: "
+			<< latency << " ms (avg: " << avgLatency << " ms)\n";
+	_stat->setString(_results.str());
+
+	if (latency == 0.0f || avgLatency == 0.0f) {
+		setStage(Stage::Failed, toString(getFramePacingName(pacing), ": input latency was not measured"));
+		return;
+	}
+
+	// average is taken from the last presented frames, allow small timer jitter
+	if (pacing == vk::View::FramePacing::Fixed && frameInterval < PacingTestFixedInterval * 95 / 100) {
+		setStage(Stage::Failed, toString("Fixed: frame interval ", frameInterval, " us is less than ",
+				PacingTestFixedInterval, " us"));
+		return;
+	}
+
+	++ _mode;
+	if (_mode < sizeof(PacingTestModes) / sizeof(PacingTestModes[0])) {
+		setFramePacing(PacingTestModes[_mode], PacingTestFixedInterval);
+	} else {
+		setStage(Stage::Done);
+	}
+}
+
+void ConfigPacingTest::setStage(Stage stage, StringView message) {
+	_stage = stage;
+	_stageTime = 0;
+	_inputTime = 0;
+	switch (_stage) {
+	case Stage::Switching:
+		_label->setString(toString("Switching to ", getFramePacingName(PacingTestModes[_mode])));
+		_label->setColor(Color::Grey_500);
+		break;
+	case Stage::Measuring:
+		_label->setString(toString("Measuring ", getFramePacingName(PacingTestModes[_mode])));
+		_label->setColor(Color::Orange_600);
+		break;
+	case Stage::Done:
+		_label->setString("All pacing modes measured");
+		_label->setColor(Color::Green_600);
+		break;
+	case Stage::Failed:
+		_label->setString(toString("Failed: ", message));
+		_label->setColor(Color::Red_600);
+		log::vtext("ConfigPacingTest", message);
+		break;
+	}
+}
+
+}
@@ -0,0 +1,77 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef TEST_SRC_TESTS_CONFIG_APPCONFIGPACINGTEST_H_
+#define TEST_SRC_TESTS_CONFIG_APPCONFIGPACINGTEST_H_
+
+#include "AppLayoutTest.h"
+#include "XLVkView.h"
+
+namespace stappler::xenolith::app {
+
+// Switches view through Throughput, LowLatency and Fixed frame pacing while sending synthetic input events,
+// checks input-to-present latency in every mode and frame interval limit in Fixed mode
+class ConfigPacingTest : public LayoutTest {
+public:
+	enum class Stage {
+		Switching,
+		Measuring,
+		Done,
+		Failed,
+	};
+
+	virtual ~ConfigPacingTest() { }
+
+	virtual bool init() override;
+
+	virtual void onContentSizeDirty() override;
+
+	virtual void onEnter(Scene *) override;
+	virtual void onExit() override;
+
+	virtual void update(const UpdateTime &) override;
+
+protected:
+	using LayoutTest::init;
+
+	void setFramePacing(vk::View::FramePacing, uint64_t interval);
+	void handleModeResult();
+	void setStage(Stage, StringView = StringView());
+
+	Stage _stage = Stage::Switching;
+	uint32_t _mode = 0; // index in pacing modes list
+	uint64_t _stageTime = 0; // since stage start, in microseconds
+	uint64_t _inputTime = 0; // since last synthetic input event
+
+	vk::View::FramePacing _pacing = vk::View::FramePacing::Throughput; // to restore on exit
+	uint64_t _pacingInterval = 0;
+	bool _pacingChanged = false;
+
+	StringStream _results;
+	Layer *_layer = nullptr;
+	Label *_label = nullptr;
+	Label *_stat = nullptr;
+};
+
+}
+
+#endif /* TEST_SRC_TESTS_CONFIG_APPCONFIGPACINGTEST_H_ */
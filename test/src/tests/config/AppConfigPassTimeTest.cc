@@ -0,0 +1,182 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "AppConfigPassTimeTest.h"
+#include "XLDirector.h"
+#include "XLApplication.h"
+#include "XLVkLoop.h"
+#include "XLVkDevice.h"
+
+namespace stappler::xenolith::app {
+
+// time to wait for non-zero pass time, in microseconds
+static constexpr uint64_t PassTimeTestTimeout = 3'000'000;
+
+bool ConfigPassTimeTest::init() {
+	if (!LayoutTest::init(LayoutName::ConfigPassTimeTest, "GPU time of each render pass should be measured with timestamp queries")) {
+		return false;
+	}
+
+	_label = addChild(Rc<Label>::create(), ZOrder(1));
+	_label->setAnchorPoint(Anchor::Middle);
+	_label->setFontSize(20);
+	_label->setFontWeight(Label::FontWeight::Bold);
+
+	_stat = addChild(Rc<Label>::create(), ZOrder(1));
+	_stat->setAnchorPoint(Anchor::MiddleTop);
+	_stat->setFontSize(16);
+	_stat->setColor(Color::Grey_600);
+
+	// animated node keeps frames coming
+	_layer = addChild(Rc<Layer>::create(Color::Grey_300), ZOrder(1));
+	_layer->setAnchorPoint(Anchor::Middle);
+	_layer->setContentSize(Size2(64.0f, 64.0f));
+
+	setStage(Stage::Checking);
+	scheduleUpdate();
+
+	return true;
+}
+
+void ConfigPassTimeTest::onContentSizeDirty() {
+	LayoutTest::onContentSizeDirty();
+
+	_label->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height - 64.0f));
+	_stat->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height - 96.0f));
+	_layer->setPosition(Vec2(_contentSize.width / 2.0f, 96.0f));
+}
+
+void ConfigPassTimeTest::onEnter(Scene *scene) {
+	LayoutTest::onEnter(scene);
+
+	Rc<vk::Loop> loop = dynamic_cast<vk::Loop *>(_director->getApplication()->getGlLoop().get());
+	if (!loop) {
+		setStage(Stage::Failed, "Vulkan loop is not available");
+		return;
+	}
+
+	_timestampsEnabled = loop->isGpuTimestampsEnabled();
+
+	// device is owned by gl thread
+	loop->performOnGlThread([this, loop] {
+		bool available = false;
+		bool supported = false;
+		if (auto dev = loop->getDevice()) {
+			available = true;
+			if (dev->getTimestampPeriod() > 0.0f) {
+				for (auto &it : dev->getQueueFamilies()) {
+					if (it.timestampValidBits > 0) {
+						supported = true;
+						break;
+					}
+				}
+			}
+		}
+
+		Application::getInstance()->performOnMainThread([this, available, supported] {
+			handleTimestampsSupport(available, supported);
+		}, this, false);
+	}, this);
+}
+
+void ConfigPassTimeTest::onExit() {
+	_director->getApplication()->getGlLoop()->setGpuTimestampsEnabled(_timestampsEnabled);
+
+	LayoutTest::onExit();
+}
+
+void ConfigPassTimeTest::update(const UpdateTime &time) {
+	LayoutTest::update(time);
+
+	_layer->setRotation(_layer->getRotation() + float(time.delta) / 1'000'000.0f);
+
+	if (_stage != Stage::Measuring && _stage != Stage::Done) {
+		return;
+	}
+
+	StringStream out;
+	bool measured = false;
+	for (auto &it : _director->getPassTimeStat()) {
+		out << it.name << ": " << it.last / 1000 << " us (avg: " << it.average / 1000 << " us, samples: " << it.samples << ")\n";
+		if (it.samples > 0 && it.average > 0) {
+			measured = true;
+		}
+	}
+	_stat->setString(out.str());
+
+	if (_stage == Stage::Measuring) {
+		if (measured) {
+			setStage(Stage::Done);
+		} else {
+			_waitTime += time.delta;
+			if (_waitTime > PassTimeTestTimeout) {
+				setStage(Stage::Failed, "No pass time was measured");
+			}
+		}
+	}
+}
+
+void ConfigPassTimeTest::handleTimestampsSupport(bool available, bool supported) {
+	if (_stage != Stage::Checking) {
+		return;
+	}
+
+	if (!available) {
+		setStage(Stage::Failed, "Device is not available");
+	} else if (!supported) {
+		setStage(Stage::Skipped);
+	} else {
+		_director->getApplication()->getGlLoop()->setGpuTimestampsEnabled(true);
+		setStage(Stage::Measuring);
+	}
+}
+
+void ConfigPassTimeTest::setStage(Stage stage, StringView message) {
+	_stage = stage;
+	_waitTime = 0;
+	switch (_stage) {
+	case Stage::Checking:
+		_label->setString("Checking timestamp support");
+		_label->setColor(Color::Grey_500);
+		break;
+	case Stage::Measuring:
+		_label->setString("Waiting for pass time");
+		_label->setColor(Color::Orange_600);
+		break;
+	case Stage::Done:
+		_label->setString("Pass time measured");
+		_label->setColor(Color::Green_600);
+		break;
+	case Stage::Skipped:
+		_label->setString("Skipped: device does not support timestamp queries");
+		_label->setColor(Color::Grey_600);
+		log::vtext("ConfigPassTimeTest", "Skipped: device does not support timestamp queries");
+		break;
+	case Stage::Failed:
+		_label->setString(toString("Failed: ", message));
+		_label->setColor(Color::Red_600);
+		log::vtext("ConfigPassTimeTest", message);
+		break;
+	}
+}
+
+}
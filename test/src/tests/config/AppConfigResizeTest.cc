@@ -0,0 +1,186 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "AppConfigResizeTest.h"
+#include "XLDirector.h"
+#include "XLApplication.h"
+#include "XLGlView.h"
+
+#include "../../AppDelegate.h"
+
+namespace stappler::xenolith::app {
+
+// swapchain extents within one cycle, relative to window's extent
+static constexpr float ResizeTestScales[] = { 0.75f, 0.5f, 0.625f, 1.0f };
+
+// cycles after the first one, frame cache should reuse objects from the first cycle
+static constexpr uint32_t ResizeTestCycles = 4;
+
+// time to render frames with each extent, in microseconds (less than frame cache max age)
+static constexpr uint64_t ResizeTestStepTime = 500'000;
+
+bool ConfigResizeTest::init() {
+	if (!LayoutTest::init(LayoutName::ConfigResizeTest, "Frame cache should not grow on repeated resizes")) {
+		return false;
+	}
+
+	_label = addChild(Rc<Label>::create(), ZOrder(1));
+	_label->setAnchorPoint(Anchor::Middle);
+	_label->setFontSize(20);
+	_label->setFontWeight(Label::FontWeight::Bold);
+
+	_stat = addChild(Rc<Label>::create(), ZOrder(1));
+	_stat->setAnchorPoint(Anchor::Middle);
+	_stat->setFontSize(16);
+	_stat->setColor(Color::Grey_600);
+
+	setStage(Stage::Waiting);
+	scheduleUpdate();
+
+	return true;
+}
+
+void ConfigResizeTest::onContentSizeDirty() {
+	LayoutTest::onContentSizeDirty();
+
+	_label->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height / 2.0f));
+	_stat->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height / 2.0f - 32.0f));
+}
+
+void ConfigResizeTest::onEnter(Scene *scene) {
+	LayoutTest::onEnter(scene);
+
+	auto app = (AppDelegate *)_director->getApplication();
+	_baseExtent = app->getSwapchainConfig().extent;
+	if (_baseExtent.width == 0 || _baseExtent.height == 0) {
+		setStage(Stage::Failed, "Swapchain is not defined");
+		return;
+	}
+
+	_step = 0;
+	_cycle = 0;
+	setStage(Stage::Resizing);
+	runStep();
+}
+
+void ConfigResizeTest::onExit() {
+	if (_stage == Stage::Resizing) {
+		restoreExtent();
+	}
+
+	LayoutTest::onExit();
+}
+
+void ConfigResizeTest::update(const UpdateTime &time) {
+	LayoutTest::update(time);
+
+	auto stat = _director->getFrameCacheStat();
+	_stat->setString(toString("Images: ", stat.images, " Framebuffers: ", stat.framebuffers,
+			" Usage: ", stat.usage / 1024, " KiB Hits: ", stat.hits, " Misses: ", stat.misses));
+
+	if (_stage != Stage::Resizing) {
+		return;
+	}
+
+	_cyclePeak.images = std::max(_cyclePeak.images, stat.images);
+	_cyclePeak.framebuffers = std::max(_cyclePeak.framebuffers, stat.framebuffers);
+	_cyclePeak.usage = std::max(_cyclePeak.usage, stat.usage);
+
+	_waitTime += time.delta;
+	if (_waitTime < ResizeTestStepTime) {
+		return;
+	}
+
+	++ _step;
+	if (_step >= sizeof(ResizeTestScales) / sizeof(float)) {
+		_step = 0;
+		finalizeCycle();
+		++ _cycle;
+		if (_stage != Stage::Resizing) {
+			restoreExtent();
+			return;
+		}
+		if (_cycle >= ResizeTestCycles) {
+			setStage(Stage::Done, toString("Done: ", ResizeTestCycles, " cycles, peak images: ", _firstCyclePeak.images,
+					", peak framebuffers: ", _firstCyclePeak.framebuffers));
+			restoreExtent();
+			return;
+		}
+	}
+
+	runStep();
+}
+
+void ConfigResizeTest::runStep() {
+	auto scale = ResizeTestScales[_step];
+	Extent2 extent(std::max(uint32_t(1), uint32_t(_baseExtent.width * scale)),
+			std::max(uint32_t(1), uint32_t(_baseExtent.height * scale)));
+
+	auto app = (AppDelegate *)_director->getApplication();
+	app->setPreferredExtent(extent);
+	_director->getView()->deprecateSwapchain();
+
+	_waitTime = 0;
+	_label->setString(toString("Cycle ", _cycle + 1, " / ", ResizeTestCycles, ": ", extent.width, "x", extent.height));
+}
+
+void ConfigResizeTest::restoreExtent() {
+	auto app = (AppDelegate *)_director->getApplication();
+	app->setPreferredExtent(Extent2(0, 0));
+	_director->getView()->deprecateSwapchain();
+}
+
+void ConfigResizeTest::finalizeCycle() {
+	if (_cycle == 0) {
+		_firstCyclePeak = _cyclePeak;
+	} else if (_cyclePeak.images > _firstCyclePeak.images || _cyclePeak.framebuffers > _firstCyclePeak.framebuffers
+			|| _cyclePeak.usage > _firstCyclePeak.usage) {
+		setStage(Stage::Failed, toString("Frame cache grows: images ", _firstCyclePeak.images, " -> ", _cyclePeak.images,
+				", framebuffers ", _firstCyclePeak.framebuffers, " -> ", _cyclePeak.framebuffers,
+				", usage ", _firstCyclePeak.usage / 1024, " -> ", _cyclePeak.usage / 1024, " KiB"));
+	}
+	_cyclePeak = gl::FrameCacheStat();
+}
+
+void ConfigResizeTest::setStage(Stage stage, StringView message) {
+	_stage = stage;
+	switch (_stage) {
+	case Stage::Waiting:
+		_label->setString("Waiting for swapchain");
+		_label->setColor(Color::Grey_500);
+		break;
+	case Stage::Resizing:
+		_label->setColor(Color::Orange_600);
+		break;
+	case Stage::Done:
+		_label->setString(message);
+		_label->setColor(Color::Green_600);
+		break;
+	case Stage::Failed:
+		_label->setString(toString("Failed: ", message));
+		_label->setColor(Color::Red_600);
+		log::vtext("ConfigResizeTest", message);
+		break;
+	}
+}
+
+}
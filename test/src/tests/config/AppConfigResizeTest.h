@@ -0,0 +1,76 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef TEST_SRC_TESTS_CONFIG_APPCONFIGRESIZETEST_H_
+#define TEST_SRC_TESTS_CONFIG_APPCONFIGRESIZETEST_H_
+
+#include "AppLayoutTest.h"
+
+namespace stappler::xenolith::app {
+
+// Repeatedly recreates swapchain with different extents and checks, that frame cache does not grow
+// after the first cycle of extents
+class ConfigResizeTest : public LayoutTest {
+public:
+	enum class Stage {
+		Waiting,
+		Resizing,
+		Done,
+		Failed,
+	};
+
+	virtual ~ConfigResizeTest() { }
+
+	virtual bool init() override;
+
+	virtual void onContentSizeDirty() override;
+
+	virtual void onEnter(Scene *) override;
+	virtual void onExit() override;
+
+	virtual void update(const UpdateTime &) override;
+
+protected:
+	using LayoutTest::init;
+
+	void runStep();
+	void restoreExtent();
+	void finalizeCycle();
+	void setStage(Stage, StringView = StringView());
+
+	Stage _stage = Stage::Waiting;
+	Extent2 _baseExtent;
+	uint32_t _step = 0;
+	uint32_t _cycle = 0;
+	uint64_t _waitTime = 0;
+
+	// peak frame cache values for current cycle and for the first one
+	gl::FrameCacheStat _cyclePeak;
+	gl::FrameCacheStat _firstCyclePeak;
+
+	Label *_label = nullptr;
+	Label *_stat = nullptr;
+};
+
+}
+
+#endif /* TEST_SRC_TESTS_CONFIG_APPCONFIGRESIZETEST_H_ */
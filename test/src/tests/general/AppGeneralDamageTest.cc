@@ -0,0 +1,190 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "AppGeneralDamageTest.h"
+#include "XLDirector.h"
+#include "XLApplication.h"
+#include "XLVkView.h"
+
+namespace stappler::xenolith::app {
+
+// full pass of animated node across the scene, in seconds
+static constexpr float DamageTestPeriod = 4.0f;
+
+// interval to read damage tracking state from view, in microseconds
+static constexpr uint64_t DamageTestInfoInterval = 250'000;
+
+// time limit to get partially rendered frames, in microseconds
+static constexpr uint64_t DamageTestTimeout = 3'000'000;
+
+// partially rendered frames required to pass test
+static constexpr uint64_t DamageTestFrames = 30;
+
+bool GeneralDamageTest::init() {
+	if (!LayoutTest::init(LayoutName::GeneralDamageTest, "Only the moving square should be redrawn, the rest of image should stay intact")) {
+		return false;
+	}
+
+	// label is static, so it should not be included into damage region after first frame
+	_label = addChild(Rc<Label>::create(), ZOrder(1));
+	_label->setAnchorPoint(Anchor::Middle);
+	_label->setFontSize(20);
+	_label->setFontWeight(Label::FontWeight::Bold);
+
+	_stat = addChild(Rc<Label>::create(), ZOrder(1));
+	_stat->setAnchorPoint(Anchor::Middle);
+	_stat->setFontSize(16);
+	_stat->setColor(Color::Grey_600);
+
+	_layer = addChild(Rc<Layer>::create(Color::Red_500), ZOrder(1));
+	_layer->setAnchorPoint(Anchor::Middle);
+	_layer->setContentSize(Size2(32.0f, 32.0f));
+
+	scheduleUpdate();
+
+	return true;
+}
+
+void GeneralDamageTest::onContentSizeDirty() {
+	LayoutTest::onContentSizeDirty();
+
+	_label->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height - 64.0f));
+	_stat->setPosition(Vec2(_contentSize.width / 2.0f, 32.0f));
+}
+
+void GeneralDamageTest::onEnter(Scene *scene) {
+	LayoutTest::onEnter(scene);
+
+	_time = 0;
+	_infoTime = 0;
+	_finished = false;
+
+	if (setDamageTracking(true)) {
+		_label->setString("Checking damage tracking");
+		_label->setColor(Color::Grey_500);
+	} else {
+		setResult(false, "Damage tracking is not available for this view");
+	}
+}
+
+void GeneralDamageTest::onExit() {
+	if (_damageTracking) {
+		setDamageTracking(false);
+	}
+
+	LayoutTest::onExit();
+}
+
+void GeneralDamageTest::update(const UpdateTime &time) {
+	LayoutTest::update(time);
+
+	_progress += float(time.delta) / 1'000'000.0f / DamageTestPeriod;
+	_progress -= std::floor(_progress);
+
+	// move back and forth along horizontal center line
+	auto t = (_progress < 0.5f) ? (_progress * 2.0f) : (2.0f - _progress * 2.0f);
+	_layer->setPosition(Vec2(32.0f + (_contentSize.width - 64.0f) * t, _contentSize.height / 2.0f));
+
+	_time += time.delta;
+	_infoTime += time.delta;
+	if (_infoTime >= DamageTestInfoInterval) {
+		_infoTime = 0;
+		updateDamageInfo();
+	}
+}
+
+bool GeneralDamageTest::setDamageTracking(bool value) {
+	auto view = dynamic_cast<vk::View *>(_director->getView());
+	if (!view) {
+		return false;
+	}
+
+	// restore view's original configuration on exit
+	if (value) {
+		if (view->isDamageTrackingEnabled()) {
+			return true;
+		}
+		_damageTracking = true;
+	} else {
+		_damageTracking = false;
+	}
+
+	view->setDamageTracking(value);
+	return true;
+}
+
+void GeneralDamageTest::updateDamageInfo() {
+	auto view = dynamic_cast<vk::View *>(_director->getView());
+	if (!view || _finished) {
+		return;
+	}
+
+	view->getDamageTrackingInfo([this, self = Rc<GeneralDamageTest>(this)] (const vk::View::DamageTrackingInfo &info) {
+		Application::getInstance()->performOnMainThread([this, self, info] {
+			if (_finished) {
+				return;
+			}
+
+			if (info.offscreen) {
+				setResult(false, "Damage tracking is not available: view renders images offscreen");
+				return;
+			}
+
+			if (!info.active) {
+				if (_time > DamageTestTimeout) {
+					setResult(false, "Damage tracking is not active for current swapchain");
+				}
+				return;
+			}
+
+			_stat->setString(toString("Partial frames: ", info.partialFrames, " / ", info.frames,
+					"; last render area: ", info.lastArea.x, ":", info.lastArea.y, " ", info.lastArea.width, "x", info.lastArea.height,
+					" of ", info.extent.width, "x", info.extent.height,
+					"; incremental present: ", info.incrementalPresent ? "yes" : "no"));
+
+			if (info.partialFrames >= DamageTestFrames) {
+				// only moving node and it's previous positions should be redrawn
+				if (info.lastArea.width == 0 || info.lastArea.height == 0
+						|| uint64_t(info.lastArea.width) * info.lastArea.height >= uint64_t(info.extent.width) * info.extent.height) {
+					setResult(false, "Partial frame redraws whole image");
+				} else {
+					setResult(true, info.incrementalPresent
+							? StringView("Damage tracking is active, damaged area is passed to presentation engine")
+							: StringView("Damage tracking is active, VK_KHR_incremental_present is not supported"));
+				}
+			} else if (_time > DamageTestTimeout) {
+				setResult(false, toString("Only ", info.partialFrames, " of ", info.frames, " frames were rendered partially"));
+			}
+		}, this, false);
+	});
+}
+
+void GeneralDamageTest::setResult(bool success, StringView message) {
+	_finished = true;
+	_label->setString(message);
+	_label->setColor(success ? Color::Green_600 : Color::Red_600);
+	if (!success) {
+		log::vtext("GeneralDamageTest", message);
+	}
+}
+
+}
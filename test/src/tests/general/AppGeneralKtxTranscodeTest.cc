@@ -0,0 +1,206 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "AppGeneralKtxTranscodeTest.h"
+#include "XLDirector.h"
+#include "XLApplication.h"
+#include "XLResourceCache.h"
+#include "XLEventListener.h"
+#include "XLGlView.h"
+#include "XLGlKtx.h"
+
+namespace stappler::xenolith::app {
+
+static constexpr auto KtxTranscodeTestImage = StringView("org.stappler.xenolith.test.GeneralKtxTranscodeTest.bc1");
+static constexpr uint32_t KtxTranscodeTestSize = 16;
+
+// 16x16 BC1 image: left half is red, right half is blue
+static Bytes GeneralKtxTranscodeTest_makeKtx() {
+	static constexpr uint8_t identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+	auto blocks = (KtxTranscodeTestSize / 4) * (KtxTranscodeTestSize / 4);
+	auto levelSize = uint64_t(blocks * 8);
+	auto dataOffset = uint64_t(gl::KtxInfo::HeaderSize + gl::KtxInfo::LevelIndexSize);
+
+	Bytes ret; ret.resize(dataOffset + levelSize);
+
+	auto ptr = ret.data();
+	auto write = [&] (const void *data, size_t size) {
+		memcpy(ptr, data, size);
+		ptr += size;
+	};
+
+	const uint32_t header[13] = {
+		uint32_t(gl::ImageFormat::BC1_RGB_UNORM_BLOCK), // vkFormat
+		1, // typeSize
+		KtxTranscodeTestSize, KtxTranscodeTestSize, 0, // pixelWidth, pixelHeight, pixelDepth
+		0, 1, 1, // layerCount, faceCount, levelCount
+		0, // supercompressionScheme
+		0, 0, 0, 0 // dfd and kvd, not used by reader
+	};
+	const uint64_t sgd[2] = { 0, 0 };
+	const uint64_t level[3] = { dataOffset, levelSize, 0 };
+
+	write(identifier, sizeof(identifier));
+	write(header, sizeof(header));
+	write(sgd, sizeof(sgd));
+	write(level, sizeof(level));
+
+	for (uint32_t y = 0; y < KtxTranscodeTestSize / 4; ++ y) {
+		for (uint32_t x = 0; x < KtxTranscodeTestSize / 4; ++ x) {
+			// color0 - red, color1 - blue (RGB565), all texels use color0 or color1
+			const uint8_t block[8] = { 0x00, 0xF8, 0x1F, 0x00, 0, 0, 0, 0 };
+			write(block, 4);
+			uint32_t bits = (x < KtxTranscodeTestSize / 8) ? 0x00000000 : 0x55555555;
+			write(&bits, sizeof(bits));
+		}
+	}
+
+	return ret;
+}
+
+bool GeneralKtxTranscodeTest::init() {
+	if (!LayoutTest::init(LayoutName::GeneralKtxTranscodeTest, "BC1 image should be transcoded on CPU: red and blue halves")) {
+		return false;
+	}
+
+	_label = addChild(Rc<Label>::create(), ZOrder(1));
+	_label->setAnchorPoint(Anchor::Middle);
+	_label->setFontSize(20);
+	_label->setFontWeight(Label::FontWeight::Bold);
+	_label->setString("Loading");
+	_label->setColor(Color::Grey_500);
+
+	_sprite = addChild(Rc<Sprite>::create(), ZOrder(1));
+	_sprite->setAutofit(Sprite::Autofit::Contain);
+	_sprite->setAnchorPoint(Anchor::Middle);
+
+	auto l = addComponent(Rc<EventListener>::create());
+	l->onEvent(TemporaryResource::onLoaded, [this] (const Event &ev) {
+		if (ev.getObject() == _resource && ev.getBoolValue()) {
+			checkImage();
+		}
+	});
+
+	return true;
+}
+
+void GeneralKtxTranscodeTest::onContentSizeDirty() {
+	LayoutTest::onContentSizeDirty();
+
+	_label->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height - 64.0f));
+
+	_sprite->setContentSize(_contentSize * 0.5f);
+	_sprite->setPosition(_contentSize / 2.0f);
+}
+
+void GeneralKtxTranscodeTest::onEnter(Scene *scene) {
+	LayoutTest::onEnter(scene);
+
+	if (_texture) {
+		return;
+	}
+
+	auto ktx = GeneralKtxTranscodeTest_makeKtx();
+
+	gl::KtxInfo info;
+	if (!gl::readKtxInfo(ktx, info)) {
+		setResult(false, "Fail to read KTX2 header");
+		return;
+	}
+
+	Bytes data; data.resize(info.getDataSize());
+	if (!gl::readKtxData(ktx, info, data.data(), data.size())) {
+		setResult(false, "Fail to read KTX2 levels");
+		return;
+	}
+
+	// Transcode hint emulates device without BC1 support; TransferSrc is required to read image back
+	auto cache = _director->getResourceCache();
+	_texture = cache->addExternalImage(KtxTranscodeTestImage,
+			info.getImageInfo(gl::ImageInfo(gl::ImageUsage::Sampled | gl::ImageUsage::TransferSrc, gl::ImageHints::Transcode)),
+			BytesView(data));
+	if (!_texture) {
+		setResult(false, "Fail to create texture");
+		return;
+	}
+
+	_sprite->setTexture(Rc<Texture>(_texture));
+
+	_resource = cache->getTemporaryResource(KtxTranscodeTestImage);
+	if (_resource && _resource->isLoaded()) {
+		checkImage();
+	}
+}
+
+void GeneralKtxTranscodeTest::checkImage() {
+	auto data = _texture->getImageData();
+	if (!data || !data->image) {
+		setResult(false, "Image object is not available");
+		return;
+	}
+
+	if (data->format != gl::ImageFormat::BC1_RGB_UNORM_BLOCK) {
+		setResult(false, "Source image data was modified by transfer");
+		return;
+	}
+
+	_director->getView()->captureImage([this, self = Rc<GeneralKtxTranscodeTest>(this)] (const gl::ImageInfo &info, BytesView view) {
+		bool success = true;
+		String message;
+		if (info.format != gl::ImageFormat::R8G8B8A8_UNORM) {
+			success = false;
+			message = toString("Unexpected format: ", gl::getImageFormatName(info.format));
+		} else if (view.size() < KtxTranscodeTestSize * KtxTranscodeTestSize * 4) {
+			success = false;
+			message = toString("Unexpected data size: ", view.size());
+		} else {
+			for (uint32_t y = 0; y < KtxTranscodeTestSize && success; ++ y) {
+				for (uint32_t x = 0; x < KtxTranscodeTestSize; ++ x) {
+					static constexpr uint8_t red[4] = { 255, 0, 0, 255 };
+					static constexpr uint8_t blue[4] = { 0, 0, 255, 255 };
+
+					auto texel = view.data() + (y * KtxTranscodeTestSize + x) * 4;
+					if (memcmp(texel, (x < KtxTranscodeTestSize / 2) ? red : blue, 4) != 0) {
+						success = false;
+						message = toString("Invalid texel at ", x, ":", y);
+						break;
+					}
+				}
+			}
+		}
+
+		Application::getInstance()->performOnMainThread([this, self = move(self), success, message = move(message)] {
+			setResult(success, success ? StringView("Transcoded image is valid") : StringView(message));
+		}, this, false);
+	}, data->image, gl::View::AttachmentLayout::ShaderReadOnlyOptimal);
+}
+
+void GeneralKtxTranscodeTest::setResult(bool success, StringView message) {
+	_label->setString(message);
+	_label->setColor(success ? Color::Green_600 : Color::Red_600);
+	if (!success) {
+		log::vtext("GeneralKtxTranscodeTest", message);
+	}
+}
+
+}
@@ -0,0 +1,55 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef TEST_SRC_TESTS_GENERAL_APPGENERALKTXTRANSCODETEST_H_
+#define TEST_SRC_TESTS_GENERAL_APPGENERALKTXTRANSCODETEST_H_
+
+#include "AppLayoutTest.h"
+
+namespace stappler::xenolith::app {
+
+// Uploads BC1 image from KTX2 container with forced CPU transcoding, then reads image back and checks texels
+class GeneralKtxTranscodeTest : public LayoutTest {
+public:
+	virtual ~GeneralKtxTranscodeTest() { }
+
+	virtual bool init() override;
+
+	virtual void onContentSizeDirty() override;
+
+	virtual void onEnter(Scene *) override;
+
+protected:
+	using LayoutTest::init;
+
+	void checkImage();
+	void setResult(bool, StringView);
+
+	Sprite *_sprite = nullptr;
+	Label *_label = nullptr;
+	Rc<Texture> _texture;
+	Rc<TemporaryResource> _resource;
+};
+
+}
+
+#endif /* TEST_SRC_TESTS_GENERAL_APPGENERALKTXTRANSCODETEST_H_ */
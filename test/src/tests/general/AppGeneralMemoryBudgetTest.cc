@@ -0,0 +1,170 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "AppGeneralMemoryBudgetTest.h"
+#include "XLDirector.h"
+#include "XLApplication.h"
+#include "XLResourceCache.h"
+#include "XLEventListener.h"
+#include "XLGlLoop.h"
+
+namespace stappler::xenolith::app {
+
+static constexpr auto MemoryBudgetTestImage = StringView("external://resources/xenolith-1-480.png");
+
+// time to wait for eviction after budget was pinned, in microseconds
+static constexpr uint64_t MemoryBudgetTestTimeout = 5'000'000;
+
+bool GeneralMemoryBudgetTest::init() {
+	if (!LayoutTest::init(LayoutName::GeneralMemoryBudgetTest, "Unused image should be evicted under pinned budget")) {
+		return false;
+	}
+
+	_label = addChild(Rc<Label>::create(), ZOrder(1));
+	_label->setAnchorPoint(Anchor::Middle);
+	_label->setFontSize(20);
+	_label->setFontWeight(Label::FontWeight::Bold);
+
+	_stat = addChild(Rc<Label>::create(), ZOrder(1));
+	_stat->setAnchorPoint(Anchor::Middle);
+	_stat->setFontSize(16);
+	_stat->setColor(Color::Grey_600);
+
+	_sprite = addChild(Rc<Sprite>::create(), ZOrder(1));
+	_sprite->setAutofit(Sprite::Autofit::Contain);
+	_sprite->setAnchorPoint(Anchor::Middle);
+
+	auto l = addComponent(Rc<EventListener>::create());
+	l->onEvent(TemporaryResource::onLoaded, [this] (const Event &ev) {
+		if (ev.getObject() != _resource) {
+			return;
+		}
+
+		if (ev.getBoolValue()) {
+			if (_stage == Stage::Loading) {
+				pinBudget();
+			}
+		} else if (_stage == Stage::Pinned) {
+			setStage(Stage::Evicted);
+		}
+	});
+
+	setStage(Stage::Loading);
+	scheduleUpdate();
+
+	return true;
+}
+
+void GeneralMemoryBudgetTest::onContentSizeDirty() {
+	LayoutTest::onContentSizeDirty();
+
+	_label->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height - 64.0f));
+	_stat->setPosition(Vec2(_contentSize.width / 2.0f, 32.0f));
+
+	if (_sprite) {
+		_sprite->setContentSize(_contentSize * 0.5f);
+		_sprite->setPosition(_contentSize / 2.0f);
+	}
+}
+
+void GeneralMemoryBudgetTest::onEnter(Scene *scene) {
+	LayoutTest::onEnter(scene);
+
+	auto cache = _director->getResourceCache();
+
+	// long timeout, so resource can only be released by memory pressure
+	auto tex = cache->addExternalImage(MemoryBudgetTestImage,
+			gl::ImageInfo(gl::ImageFormat::R8G8B8A8_UNORM, gl::ImageUsage::Sampled, gl::ImageHints::Opaque),
+			FilePath("resources/xenolith-1-480.png"), TimeInterval::seconds(3600));
+	if (tex) {
+		_sprite->setTexture(move(tex));
+	}
+
+	_resource = cache->getTemporaryResource(MemoryBudgetTestImage);
+	if (_resource && _resource->isLoaded()) {
+		pinBudget();
+	}
+}
+
+void GeneralMemoryBudgetTest::onExit() {
+	_director->getApplication()->getGlLoop()->setMemoryBudgetOverride(0);
+	_resource = nullptr;
+
+	LayoutTest::onExit();
+}
+
+void GeneralMemoryBudgetTest::update(const UpdateTime &time) {
+	LayoutTest::update(time);
+
+	auto stat = _director->getMemoryStat();
+	_stat->setString(toString("Device: ", stat.getDeviceUsage() / 1024, " / ", stat.getDeviceBudget() / 1024, " KiB",
+			stat.hasBudget ? "" : " (allocator usage)"));
+
+	if (_stage == Stage::Pinned) {
+		_waitTime += time.delta;
+		if (_waitTime > MemoryBudgetTestTimeout) {
+			setStage(Stage::Failed);
+		}
+	}
+}
+
+void GeneralMemoryBudgetTest::pinBudget() {
+	if (_sprite) {
+		// drop the only user of resource, so it becomes evictable
+		_sprite->removeFromParent(true);
+		_sprite = nullptr;
+	}
+
+	auto loop = _director->getApplication()->getGlLoop();
+	auto usage = _director->getMemoryStat().getDeviceUsage();
+
+	loop->setMemoryBudgetOverride(std::max(usage / 2, uint64_t(1)));
+	_waitTime = 0;
+	setStage(Stage::Pinned);
+}
+
+void GeneralMemoryBudgetTest::setStage(Stage stage) {
+	_stage = stage;
+	switch (_stage) {
+	case Stage::Loading:
+		_label->setString("Loading");
+		_label->setColor(Color::Grey_500);
+		break;
+	case Stage::Pinned:
+		_label->setString("Budget pinned, waiting for eviction");
+		_label->setColor(Color::Orange_600);
+		break;
+	case Stage::Evicted:
+		_label->setString("Evicted");
+		_label->setColor(Color::Green_600);
+		_director->getApplication()->getGlLoop()->setMemoryBudgetOverride(0);
+		break;
+	case Stage::Failed:
+		_label->setString("Failed: resource was not evicted");
+		_label->setColor(Color::Red_600);
+		_director->getApplication()->getGlLoop()->setMemoryBudgetOverride(0);
+		log::vtext("GeneralMemoryBudgetTest", "Resource was not evicted within ", MemoryBudgetTestTimeout / 1'000'000, "s");
+		break;
+	}
+}
+
+}
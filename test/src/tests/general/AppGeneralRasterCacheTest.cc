@@ -0,0 +1,204 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "AppGeneralRasterCacheTest.h"
+#include "XLScene.h"
+
+namespace stappler::xenolith::app {
+
+// cells in each row and column of rasterized subtree
+static constexpr uint32_t RasterCacheTestGrid = 24;
+
+// frames, drawn with layer, required to pass stage
+static constexpr uint32_t RasterCacheTestFrames = 30;
+
+// time limit for stage, in microseconds
+static constexpr uint64_t RasterCacheTestTimeout = 5'000'000;
+
+bool GeneralRasterCacheTest::init() {
+	if (!LayoutTest::init(LayoutName::GeneralRasterCacheTest, "Static grid should be drawn from cached layer, and updated on changes")) {
+		return false;
+	}
+
+	_label = addChild(Rc<Label>::create(), ZOrder(1));
+	_label->setAnchorPoint(Anchor::Middle);
+	_label->setFontSize(20);
+	_label->setFontWeight(Label::FontWeight::Bold);
+
+	_stat = addChild(Rc<Label>::create(), ZOrder(1));
+	_stat->setAnchorPoint(Anchor::Middle);
+	_stat->setFontSize(16);
+	_stat->setColor(Color::Grey_600);
+
+	// heavy static subtree: every cell is a separate node with it's own draw command
+	_subtree = addChild(Rc<Node>::create(), ZOrder(1));
+	_subtree->setAnchorPoint(Anchor::Middle);
+	_subtree->setContentSize(Size2(RasterCacheTestGrid * 12.0f, RasterCacheTestGrid * 12.0f));
+	_subtree->setRasterized(true);
+
+	auto background = _subtree->addChild(Rc<Layer>::create(Color::Grey_200));
+	background->setContentSize(_subtree->getContentSize());
+
+	for (uint32_t i = 0; i < RasterCacheTestGrid; ++ i) {
+		for (uint32_t j = 0; j < RasterCacheTestGrid; ++ j) {
+			auto cell = _subtree->addChild(Rc<Layer>::create((i + j) % 2 ? Color::Blue_500 : Color::Teal_500), ZOrder(1));
+			cell->setContentSize(Size2(10.0f, 10.0f));
+			cell->setPosition(Vec2(i * 12.0f + 1.0f, j * 12.0f + 1.0f));
+			_cells.emplace_back(cell);
+		}
+	}
+
+	// animated node outside of rasterized subtree keeps frames going
+	_indicator = addChild(Rc<Layer>::create(Color::Red_500), ZOrder(1));
+	_indicator->setAnchorPoint(Anchor::Middle);
+	_indicator->setContentSize(Size2(24.0f, 24.0f));
+
+	scheduleUpdate();
+
+	return true;
+}
+
+void GeneralRasterCacheTest::onContentSizeDirty() {
+	LayoutTest::onContentSizeDirty();
+
+	_label->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height - 64.0f));
+	_stat->setPosition(Vec2(_contentSize.width / 2.0f, 32.0f));
+	_subtree->setPosition(_contentSize / 2.0f);
+	_indicator->setPosition(Vec2(_contentSize.width / 2.0f, _contentSize.height / 2.0f + _subtree->getContentSize().height / 2.0f + 32.0f));
+}
+
+void GeneralRasterCacheTest::onEnter(Scene *scene) {
+	LayoutTest::onEnter(scene);
+
+	_budget = _scene->getRasterCache()->getBudget();
+	setStage(Stage::Caching);
+}
+
+void GeneralRasterCacheTest::onExit() {
+	_scene->getRasterCache()->setBudget(_budget);
+
+	LayoutTest::onExit();
+}
+
+void GeneralRasterCacheTest::update(const UpdateTime &time) {
+	LayoutTest::update(time);
+
+	_indicator->setRotation(_indicator->getRotation() + float(time.delta) / 1'000'000.0f);
+
+	if (!_scene) {
+		return;
+	}
+
+	auto stat = _scene->getRasterCache()->getStat();
+	_stat->setString(toString("Hits: ", stat.hits, "; misses: ", stat.misses, "; evictions: ", stat.evictions,
+			"; layers: ", stat.size, "; usage: ", stat.usage / 1024, " KiB"));
+
+	if (_stage == Stage::Done || _stage == Stage::Failed) {
+		return;
+	}
+
+	_stageTime += time.delta;
+	++ _stageFrames;
+	updateStage(stat);
+}
+
+void GeneralRasterCacheTest::updateStage(const RasterCache::Stat &stat) {
+	switch (_stage) {
+	case Stage::Caching:
+		if (stat.hits >= _stageStat.hits + RasterCacheTestFrames) {
+			setStage(Stage::TransformChanged);
+		} else if (_stageTime > RasterCacheTestTimeout) {
+			setStage(Stage::Failed, "Subtree is not drawn from cached layer");
+		}
+		break;
+	case Stage::TransformChanged:
+	case Stage::ContentChanged:
+		// outdated layer should be rendered again, then reused
+		if (stat.misses > _stageStat.misses && stat.hits >= _stageStat.hits + RasterCacheTestFrames) {
+			setStage(_stage == Stage::TransformChanged ? Stage::ContentChanged : Stage::Eviction);
+		} else if (_stageTime > RasterCacheTestTimeout) {
+			setStage(Stage::Failed, (stat.misses == _stageStat.misses)
+					? StringView("Layer was not invalidated") : StringView("Layer was not reused after invalidation"));
+		}
+		break;
+	case Stage::Eviction: {
+		auto budget = _scene->getRasterCache()->getBudget();
+		if (stat.evictions == _stageStat.evictions) {
+			setStage(Stage::Failed, "Layer was not evicted");
+		} else if (stat.usage > budget) {
+			setStage(Stage::Failed, toString("Cache usage ", stat.usage, " exceeds budget ", budget));
+		} else if (stat.hits != _stageStat.hits) {
+			// layer does not fit into budget, so subtree should be drawn as usual
+			setStage(Stage::Failed, "Subtree is drawn from layer over budget");
+		} else if (_stageFrames >= RasterCacheTestFrames) {
+			setStage(Stage::Done, "Layer was reused, invalidated and evicted");
+		}
+		break;
+	}
+	case Stage::Done:
+	case Stage::Failed:
+		break;
+	}
+}
+
+void GeneralRasterCacheTest::setStage(Stage stage, StringView message) {
+	_stage = stage;
+	_stageTime = 0;
+	_stageFrames = 0;
+	if (_scene) {
+		_stageStat = _scene->getRasterCache()->getStat();
+	}
+
+	switch (_stage) {
+	case Stage::Caching:
+		_label->setString("Caching subtree");
+		_label->setColor(Color::Orange_600);
+		break;
+	case Stage::TransformChanged:
+		_label->setString("Moving one cell");
+		_label->setColor(Color::Orange_600);
+		_cells.front()->setPosition(_cells.front()->getPosition() + Vec2(0.0f, 1.0f));
+		break;
+	case Stage::ContentChanged:
+		_label->setString("Changing color of one cell");
+		_label->setColor(Color::Orange_600);
+		_cells.back()->setColor(Color::Red_500);
+		break;
+	case Stage::Eviction:
+		_label->setString("Reducing cache budget");
+		_label->setColor(Color::Orange_600);
+		// layer should be evicted immediately, and should not be rendered again with smaller budget
+		_scene->getRasterCache()->setBudget(_stageStat.usage / 2);
+		break;
+	case Stage::Done:
+		_label->setString(message);
+		_label->setColor(Color::Green_600);
+		break;
+	case Stage::Failed:
+		_label->setString(toString("Failed: ", message));
+		_label->setColor(Color::Red_600);
+		log::vtext("GeneralRasterCacheTest", message);
+		break;
+	}
+}
+
+}
@@ -0,0 +1,76 @@
+/**
+ Copyright (c) 2022 Roman Katuntsev <sbkarr@stappler.org>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef TEST_SRC_TESTS_GENERAL_APPGENERALRASTERCACHETEST_H_
+#define TEST_SRC_TESTS_GENERAL_APPGENERALRASTERCACHETEST_H_
+
+#include "AppLayoutTest.h"
+#include "XLRasterCache.h"
+
+namespace stappler::xenolith::app {
+
+// Draws heavy static subtree as rasterized node, then checks, that layer is reused (cache hits),
+// rendered again after transform and content changes, and evicted, when it does not fit into budget
+class GeneralRasterCacheTest : public LayoutTest {
+public:
+	enum class Stage {
+		Caching,
+		TransformChanged,
+		ContentChanged,
+		Eviction,
+		Done,
+		Failed,
+	};
+
+	virtual ~GeneralRasterCacheTest() { }
+
+	virtual bool init() override;
+
+	virtual void onContentSizeDirty() override;
+
+	virtual void onEnter(Scene *) override;
+	virtual void onExit() override;
+
+	virtual void update(const UpdateTime &) override;
+
+protected:
+	using LayoutTest::init;
+
+	void setStage(Stage, StringView = StringView());
+	void updateStage(const RasterCache::Stat &);
+
+	Stage _stage = Stage::Caching;
+	uint64_t _stageTime = 0; // time since stage start, in microseconds
+	uint32_t _stageFrames = 0;
+	RasterCache::Stat _stageStat; // cache stat on stage start
+	size_t _budget = 0; // cache budget to restore on exit
+
+	Node *_subtree = nullptr;
+	Vector<Layer *> _cells;
+	Layer *_indicator = nullptr;
+	Label *_label = nullptr;
+	Label *_stat = nullptr;
+};
+
+}
+
+#endif /* TEST_SRC_TESTS_GENERAL_APPGENERALRASTERCACHETEST_H_ */
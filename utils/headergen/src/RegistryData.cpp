@@ -98,6 +98,54 @@ void setDeviceHookThreadContext(
 	tl_deviceHookTable.ctx = c;
 }
 
+// hook context by loader dispatch key of device, has priority over thread-local context
+static Mutex s_deviceHookMutex;
+static Map<const void *, DeviceTableHookInfo> s_deviceHookTables;
+
+// all dispatchable handles of the device (VkDevice, VkQueue, VkCommandBuffer) starts with the same loader dispatch pointer
+template <typename T>
+static const void *DeviceTable_getDispatchKey(T handle) {
+	return *(const void * const *)handle;
+}
+
+template <typename T>
+static DeviceTableHookInfo DeviceTable_getHookInfo(T handle) {
+	std::unique_lock<Mutex> lock(s_deviceHookMutex);
+	auto it = s_deviceHookTables.find(DeviceTable_getDispatchKey(handle));
+	if (it != s_deviceHookTables.end()) {
+		return it->second;
+	}
+	lock.unlock();
+
+	log::vtext("vk::DeviceTable", "Hook is called for unregistered device, thread context table is used");
+	return tl_deviceHookTable;
+}
+
+void registerDeviceHookTable(VkDevice device, const DeviceTable *table) {
+	std::unique_lock<Mutex> lock(s_deviceHookMutex);
+	auto &info = s_deviceHookTables[DeviceTable_getDispatchKey(device)];
+	info = DeviceTableHookInfo{nullptr, nullptr, table, nullptr, nullptr};
+}
+
+void setDeviceHookContext(VkDevice device,
+		void (*pre) (void *ctx, const char *, PFN_vkVoidFunction),
+		void (*post) (void *ctx, const char *, PFN_vkVoidFunction),
+		const DeviceTable *r, void *c) {
+	std::unique_lock<Mutex> lock(s_deviceHookMutex);
+	auto it = s_deviceHookTables.find(DeviceTable_getDispatchKey(device));
+	if (it != s_deviceHookTables.end()) {
+		it->second.preCall = pre;
+		it->second.postCall = post;
+		it->second.replace = r;
+		it->second.ctx = c;
+	}
+}
+
+void unregisterDeviceHookTable(VkDevice device) {
+	std::unique_lock<Mutex> lock(s_deviceHookMutex);
+	s_deviceHookTables.erase(DeviceTable_getDispatchKey(device));
+}
+
 #endif /* VK_HOOK_DEBUG */
 
 static PFN_vkVoidFunction loadInstanceAliased(PFN_vkGetInstanceProcAddr addr, VkInstance instance, const char *name,
@@ -134,6 +182,14 @@ void setDeviceHookThreadContext(
 		void (*preCall) (void *, const char *, PFN_vkVoidFunction),
 		void (*postCall) (void *, const char *, PFN_vkVoidFunction),
 		const DeviceTable *table, const DeviceTable *replace, void *ctx);
+
+// original table and hook callbacks of device, used by device hooks on any thread
+void registerDeviceHookTable(VkDevice, const DeviceTable *);
+void setDeviceHookContext(VkDevice,
+		void (*preCall) (void *, const char *, PFN_vkVoidFunction),
+		void (*postCall) (void *, const char *, PFN_vkVoidFunction),
+		const DeviceTable *replace, void *ctx);
+void unregisterDeviceHookTable(VkDevice);
 #endif
 )SourceString");
 
@@ -563,11 +619,15 @@ void RegistryData::writeDeviceConstructor(std::ostream &out, StringView guard, S
 	out << "#endif /* " << guard << " */\n";
 }
 
-void RegistryData::writeHooks(std::ostream &out, StringView guard, SpanView<StringView> commands, StringView ctx) {
+void RegistryData::writeHooks(std::ostream &out, StringView guard, SpanView<StringView> commands, StringView name,
+		StringView lookup) {
 	if (commands.empty()) {
 		return;
 	}
 
+	// with lookup function, hook context is acquired by first (dispatchable) argument
+	StringView ctx = lookup.empty() ? name : StringView("__info");
+
 	out << "#if " << guard << "\n\n";
 
 	for (auto &it : commands) {
@@ -584,7 +644,7 @@ void RegistryData::writeHooks(std::ostream &out, StringView guard, SpanView<Stri
 		out << "static ";
 		for (auto &v : cmd->proto.strings) {
 			if (v == cmd->name) {
-				out << "xl_hook_" << ctx << "_" << it;
+				out << "xl_hook_" << name << "_" << it;
 				if (v != it) {
 					if (v.size() > it.size()) {
 						tag = StringView(v.data() + it.size(), v.size() - it.size());
@@ -630,8 +690,11 @@ void RegistryData::writeHooks(std::ostream &out, StringView guard, SpanView<Stri
 				}
 			}
 		}
-		out << ") {\n"
-		"\tauto __fn = " << ctx << ".table->" << it << ";\n"
+		out << ") {\n";
+		if (!lookup.empty()) {
+			out << "\tauto __info = " << lookup << "(" << cmd->params.front().name << ");\n";
+		}
+		out << "\tauto __fn = " << ctx << ".table->" << it << ";\n"
 		"\tif (" << ctx << ".replace && " << ctx << ".replace->" << it << ") {\n"
 		"\t\t__fn = " << ctx << ".replace->" << it << ";\n"
 		"\t}\n"
@@ -741,7 +804,7 @@ void RegistryData::write() {
 		writeDeviceConstructor(deviceConstructor, guard, deviceCmds);
 
 		writeHooks(instanceHooks, guard, instanceCmds, "tl_instanceHookTable");
-		writeHooks(deviceHooks, guard, deviceCmds, "tl_deviceHookTable");
+		writeHooks(deviceHooks, guard, deviceCmds, "tl_deviceHookTable", "DeviceTable_getHookInfo");
 		writeHooksAddr(instanceHooksAddr, guard, instanceCmds, "tl_instanceHookTable");
 		writeHooksAddr(deviceHooksAddr, guard, deviceCmds, "tl_deviceHookTable");
 	}
@@ -782,7 +845,7 @@ void RegistryData::write() {
 			auto guard =  makeGuard(ext.name, cmd.first);
 			writeCommandFields(deviceHeader, guard, cmd.second);
 			writeDeviceConstructor(deviceConstructor, guard, cmd.second);
-			writeHooks(deviceHooks, guard, cmd.second, "tl_deviceHookTable");
+			writeHooks(deviceHooks, guard, cmd.second, "tl_deviceHookTable", "DeviceTable_getHookInfo");
 			writeHooksAddr(deviceHooksAddr, guard, cmd.second, "tl_deviceHookTable");
 		}
 		for (auto &cmd : instanceCmds) {
@@ -95,7 +95,8 @@ struct RegistryData {
 	void writeLoaderConstructor(std::ostream &out, StringView guard, SpanView<StringView> commands);
 	void writeInstanceConstructor(std::ostream &out, StringView guard, SpanView<StringView> commands);
 	void writeDeviceConstructor(std::ostream &out, StringView guard, SpanView<StringView> commands);
-	void writeHooks(std::ostream &out, StringView guard, SpanView<StringView> commands, StringView ctx);
+	void writeHooks(std::ostream &out, StringView guard, SpanView<StringView> commands, StringView name,
+			StringView lookup = StringView());
 	void writeHooksAddr(std::ostream &out, StringView guard, SpanView<StringView> commands, StringView ctx);
 	void write();
 
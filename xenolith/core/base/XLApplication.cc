@@ -82,6 +82,20 @@ int Application::parseOptionString(Value &ret, const StringView &str, int argc,
 		ret.setBool(true, "renderdoc");
 	} else if (str == "novalidation") {
 		ret.setBool(true, "novalidation");
+	} else if (str == "headless") {
+		ret.setBool(true, "headless");
+	} else if (str.starts_with("headless-fps=")) {
+		auto s = str.sub(13).readDouble().get(0.0);
+		if (s > 0) {
+			ret.setDouble(s, "headlessFrameRate");
+		}
+	} else if (str.starts_with("capture=")) {
+		ret.setString(str.sub(8), "headlessCapture");
+	} else if (str.starts_with("capture-interval=")) {
+		auto s = str.sub(17).readInteger().get(0);
+		if (s > 0) {
+			ret.setInteger(s, "headlessCaptureInterval");
+		}
 	} else if (str.starts_with("decor=")) {
 		auto values = str.sub(6);
 		float f[4] = { nan(), nan(), nan(), nan() };
@@ -176,6 +190,23 @@ void Application::onMemoryWarning() {
 
 }
 
+void Application::onMemoryPressure(const gl::MemoryStat &stat) {
+	auto usage = stat.getDeviceUsage();
+	auto budget = stat.getDeviceBudget();
+	auto target = uint64_t(budget * _glLoop->getMemoryPressureThreshold());
+
+	uint64_t evicted = 0;
+	if (usage > target) {
+		evicted = getResourceCache()->evict(usage - target);
+	}
+
+	if (_fontController) {
+		_fontController->trim();
+	}
+
+	log::vtext("Application", "Memory pressure: ", usage, "/", budget, ", evicted: ", evicted);
+}
+
 int Application::run(Value &&data, const Callback<void(Application *)> &onStarted) {
 	_updatePool = memory::pool::create(memory::pool::acquire());
 	memory::pool::push(_updatePool);
@@ -223,6 +254,14 @@ int Application::run(Value &&data, const Callback<void(Application *)> &onStarte
 			_data.renderdoc = true;
 		} else if (it.first == "novalidation") {
 			_data.validation = false;
+		} else if (it.first == "headless") {
+			_data.headless = it.second.getBool();
+		} else if (it.first == "headlessFrameRate") {
+			_data.headlessFrameRate = float(it.second.getDouble());
+		} else if (it.first == "headlessCapture") {
+			_data.headlessCapture = it.second.getString();
+		} else if (it.first == "headlessCaptureInterval") {
+			_data.headlessCaptureInterval = uint32_t(it.second.getInteger());
 		} else if (it.first == "decor") {
 			_data.viewDecoration = Padding(
 				it.second.getDouble(0), it.second.getDouble(1),
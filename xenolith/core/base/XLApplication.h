@@ -73,6 +73,16 @@ public:
 
 		bool renderdoc = false;
 		bool validation = true;
+
+		// render views without window system into offscreen surface (for benchmarks and CI)
+		bool headless = false;
+
+		// virtual frame rate for director's clock in headless mode, 0 - use real time
+		float headlessFrameRate = 0.0f;
+
+		// directory to dump presented frames in headless mode, every headlessCaptureInterval frame
+		String headlessCapture;
+		uint32_t headlessCaptureInterval = 1;
 	};
 
 	static Application *getInstance();
@@ -96,6 +106,10 @@ public:
 	// Process global Out-of-memory event
 	virtual void onMemoryWarning();
 
+	// Device memory usage exceeds budget threshold (see gl::Loop::setMemoryPressureThreshold)
+	// Default implementation evicts least recently used GPU resources from caches
+	virtual void onMemoryPressure(const gl::MemoryStat &);
+
 	// Process main loop scheduled updates
 	// - update thread queue
 	// - check for network status
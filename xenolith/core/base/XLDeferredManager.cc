@@ -28,6 +28,102 @@
 
 namespace stappler::xenolith {
 
+class DeferredManager::Job : public Ref {
+public:
+	virtual ~Job() { }
+
+	// called on worker thread
+	virtual void run() = 0;
+
+	// called on main thread with all other jobs from batch
+	virtual void complete() = 0;
+
+	uint64_t time = 0;
+};
+
+struct DeferredManager::Batch : public Ref {
+	virtual ~Batch() { }
+
+	Batch(Vector<Rc<Job>> &&vec) : jobs(move(vec)) { }
+
+	// Workers pull jobs from shared counter, so, faster workers take more jobs from the batch
+	bool runThread() {
+		uint32_t target = current.fetch_add(1);
+		uint32_t c = 0;
+		bool completed = false;
+		while (target < jobs.size()) {
+			jobs[target]->run();
+			c = complete.fetch_add(1);
+			if (c == jobs.size() - 1) {
+				completed = true;
+			}
+			target = current.fetch_add(1);
+		}
+		return completed;
+	}
+
+	std::atomic<uint32_t> current = 0;
+	std::atomic<uint32_t> complete = 0;
+	Vector<Rc<Job>> jobs;
+};
+
+class DeferredVectorCanvasJob : public DeferredManager::Job {
+public:
+	virtual ~DeferredVectorCanvasJob() { }
+
+	virtual void run() override {
+		auto canvas = VectorCanvas::getInstance();
+		canvas->setColor(color);
+		canvas->setQuality(quality);
+		result = canvas->draw(move(image), targetSize);
+		promise.set_value(result);
+	}
+
+	virtual void complete() override {
+		ret->handleReady(move(result));
+	}
+
+	Rc<VectorImageData> image;
+	Size2 targetSize;
+	Color4F color;
+	float quality = 1.0f;
+	std::promise<Rc<VectorCanvasResult>> promise;
+	Rc<VectorCanvasDeferredResult> ret;
+	Rc<VectorCanvasResult> result;
+};
+
+class DeferredLabelJob : public DeferredManager::Job {
+public:
+	virtual ~DeferredLabelJob() { }
+
+	virtual void run() override {
+		if (entry) {
+			auto cached = entry->getResult();
+			if (!cached) {
+				cached = Label::writeResult(entry->getFormat(), color);
+				entry->setResult(cached);
+			}
+
+			// label owns and modifies its own result, so we should not pass cached one
+			result = Label::writeResult(cached, entry->getColor(), color);
+		} else {
+			result = Label::writeResult(format, color);
+		}
+		promise.set_value(result);
+	}
+
+	virtual void complete() override {
+		ret->handleReady(move(result));
+	}
+
+	Rc<Label::FormatSpec> format;
+	Rc<LabelCacheEntry> entry;
+	Color4F color;
+	std::promise<Rc<LabelResult>> promise;
+	Rc<LabelDeferredResult> ret;
+	Rc<LabelResult> result;
+};
+
 DeferredManager::~DeferredManager() {
 
 }
@@ -35,6 +131,7 @@ DeferredManager::~DeferredManager() {
 DeferredManager::DeferredManager(Application *app, StringView name)
 : thread::TaskQueue(name) {
 	_application = app;
+	_labelCache = Rc<LabelCache>::create();
 }
 
 bool DeferredManager::init(uint32_t threadCount) {
@@ -48,45 +145,112 @@ bool DeferredManager::init(uint32_t threadCount) {
 
 void DeferredManager::cancel() {
 	cancelWorkers();
+	_labelCache->clear();
+
+	std::unique_lock<Mutex> lock(_mutex);
+	_pending.clear();
 }
 
 void DeferredManager::update() {
+	flush();
 	thread::TaskQueue::update();
 }
 
+void DeferredManager::flush() {
+	std::unique_lock<Mutex> lock(_mutex);
+	if (_pending.empty()) {
+		return;
+	}
+
+	auto batch = Rc<Batch>::alloc(move(_pending));
+	_pending.clear();
+	lock.unlock();
+
+	auto nthreads = std::min(uint32_t(batch->jobs.size()), uint32_t(getThreadCount()));
+	for (uint32_t i = 0; i < nthreads; ++ i) {
+		perform([this, batch] () {
+			if (batch->runThread()) {
+				_application->performOnMainThread([this, batch] {
+					complete(batch);
+				}, this);
+			}
+		}, batch);
+	}
+}
+
 Rc<VectorCanvasDeferredResult> DeferredManager::runVectorCavas(Rc<VectorImageData> &&image, Size2 targetSize, Color4F color, float quality, bool waitOnReady) {
-	auto result = new std::promise<Rc<VectorCanvasResult>>;
-	Rc<VectorCanvasDeferredResult> ret = Rc<VectorCanvasDeferredResult>::create(result->get_future(), waitOnReady);
-	perform([this, image = move(image), targetSize, color, quality, ret, result] () mutable {
-		auto canvas = VectorCanvas::getInstance();
-		canvas->setColor(color);
-		canvas->setQuality(quality);
-		auto res = canvas->draw(move(image), targetSize);
-		result->set_value(res);
+	auto job = Rc<DeferredVectorCanvasJob>::alloc();
+	job->image = move(image);
+	job->targetSize = targetSize;
+	job->color = color;
+	job->quality = quality;
+	job->ret = Rc<VectorCanvasDeferredResult>::create(job->promise.get_future(), waitOnReady);
 
-		_application->performOnMainThread([ret = move(ret), res = move(res), result] () mutable {
-			ret->handleReady(move(res));
-			delete result;
-		});
-	}, ret);
+	auto ret = job->ret;
+	schedule(move(job));
 	return ret;
 }
 
 Rc<LabelDeferredResult> DeferredManager::runLabel(Label::FormatSpec *format, const Color4F &color) {
-	auto result = new std::promise<Rc<LabelResult>>;
-	Rc<LabelDeferredResult> ret = Rc<LabelDeferredResult>::create(result->get_future());
-	perform([this, format = Rc<Label::FormatSpec>(format), color, ret, result] () mutable {
-		auto res = Label::writeResult(format, color);
-		result->set_value(res);
-
-		_application->performOnMainThread([ret = move(ret), res = move(res), result] () mutable {
-			ret->handleReady(move(res));
-			delete result;
-		});
-	}, ret);
+	auto job = Rc<DeferredLabelJob>::alloc();
+	job->format = format;
+	job->color = color;
+	job->ret = Rc<LabelDeferredResult>::create(job->promise.get_future());
+
+	auto ret = job->ret;
+	schedule(move(job));
 	return ret;
 }
 
+Rc<LabelDeferredResult> DeferredManager::runLabel(LabelCacheEntry *entry, const Color4F &color) {
+	if (auto cached = entry->getResult()) {
+		return Rc<LabelDeferredResult>::create(Label::writeResult(cached, entry->getColor(), color));
+	}
+
+	auto job = Rc<DeferredLabelJob>::alloc();
+	job->entry = entry;
+	job->color = color;
+	job->ret = Rc<LabelDeferredResult>::create(job->promise.get_future());
+
+	auto ret = job->ret;
+	schedule(move(job));
+	return ret;
+}
+
+DeferredManager::Stat DeferredManager::getStat() const {
+	std::unique_lock<Mutex> lock(_mutex);
+	auto ret = _stat;
+	ret.queueDepth = _queueDepth.load();
+	return ret;
+}
+
+void DeferredManager::schedule(Rc<Job> &&job) {
+	job->time = platform::device::_clock(platform::device::ClockType::Monotonic);
+	++ _queueDepth;
+
+	std::unique_lock<Mutex> lock(_mutex);
+	_pending.emplace_back(move(job));
+}
+
+void DeferredManager::complete(Batch *batch) {
+	auto t = platform::device::_clock(platform::device::ClockType::Monotonic);
+	uint64_t maxLatency = 0;
+	for (auto &it : batch->jobs) {
+		it->complete();
+		maxLatency = std::max(maxLatency, t - it->time);
+	}
+
+	_queueDepth -= batch->jobs.size();
+
+	std::unique_lock<Mutex> lock(_mutex);
+	_avgLatency.addValue(maxLatency);
+	_stat.lastBatchSize = batch->jobs.size();
+	_stat.jobs += batch->jobs.size();
+	_stat.avgLatency = _avgLatency.getAverage(true);
+	_stat.maxLatency = std::max(_stat.maxLatency, maxLatency);
+	++ _stat.batches;
+}
+
 struct DeferredFontRequestsData : Ref {
 	virtual ~DeferredFontRequestsData() { }
 
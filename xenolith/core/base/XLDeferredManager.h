@@ -27,11 +27,24 @@
 #include "SPThreadTaskQueue.h"
 #include "XLVectorResult.h"
 #include "XLLabel.h"
+#include "XLLabelCache.h"
 
 namespace stappler::xenolith {
 
 class DeferredManager : protected thread::TaskQueue {
 public:
+	class Job;
+	struct Batch;
+
+	struct Stat {
+		uint32_t queueDepth = 0; // jobs, that was submitted, but not delivered yet
+		uint32_t lastBatchSize = 0;
+		uint64_t batches = 0;
+		uint64_t jobs = 0;
+		uint64_t avgLatency = 0; // time from submission to delivery of the slowest job in batch, in microseconds
+		uint64_t maxLatency = 0; // worst latency since start, in microseconds
+	};
+
 	virtual ~DeferredManager();
 
 	DeferredManager(Application *, StringView);
@@ -41,9 +54,16 @@ public:
 
 	void update();
 
+	// Submit jobs, collected since last flush, as a single batch
+	// Called by Director when frame was composed, and from update() for jobs outside of frames
+	void flush();
+
 	Rc<VectorCanvasDeferredResult> runVectorCavas(Rc<VectorImageData> &&image, Size2 targetSize, Color4F color, float quality, bool waitOnReady);
 	Rc<LabelDeferredResult> runLabel(Label::FormatSpec *format, const Color4F &);
 
+	// Uses prebuilt vertexes from cache entry if any, or writes them into entry for other labels
+	Rc<LabelDeferredResult> runLabel(LabelCacheEntry *, const Color4F &);
+
 	void runFontRenderer(const Rc<font::FontLibrary> &,
 			const Vector<font::FontUpdateRequest> &req,
 			Function<void(uint32_t reqIdx, const font::CharTexture &texData)> &&,
@@ -57,8 +77,22 @@ public:
 
 	using TaskQueue::perform;
 
+	const Rc<LabelCache> &getLabelCache() const { return _labelCache; }
+
+	Stat getStat() const;
+
 protected:
+	void schedule(Rc<Job> &&);
+	void complete(Batch *);
+
 	Application *_application = nullptr;
+	Rc<LabelCache> _labelCache;
+
+	mutable Mutex _mutex;
+	Vector<Rc<Job>> _pending;
+	std::atomic<uint32_t> _queueDepth = 0;
+	Stat _stat;
+	math::MovingAverage<20, uint64_t> _avgLatency;
 };
 
 }
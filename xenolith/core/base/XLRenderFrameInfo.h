@@ -40,6 +40,9 @@ struct RenderFrameInfo {
 
 	gl::StateId currentStateId;
 
+	// frame is rendered into offscreen layer, that keeps coverage in alpha channel (see RasterCache)
+	bool accumulateAlpha = false;
+
 	Rc<Director> director;
 	Rc<Scene> scene;
 
@@ -396,6 +396,23 @@ size_t VertexArray::getIndexCount() const {
 	return _data->indexes.size();
 }
 
+Rect VertexArray::getBounds() const {
+	if (_data->data.empty()) {
+		return Rect::ZERO;
+	}
+
+	Vec2 min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+	Vec2 max(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+	for (auto &it : _data->data) {
+		min.x = std::min(min.x, it.pos.x);
+		min.y = std::min(min.y, it.pos.y);
+		max.x = std::max(max.x, it.pos.x);
+		max.y = std::max(max.y, it.pos.y);
+	}
+
+	return Rect(min.x, min.y, max.x - min.x, max.y - min.y);
+}
+
 void VertexArray::copy() {
 	if (_copyOnWrite) {
 		auto data = Rc<gl::VertexData>::alloc();
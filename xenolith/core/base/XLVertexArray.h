@@ -83,6 +83,9 @@ public:
 	size_t getVertexCount() const;
 	size_t getIndexCount() const;
 
+	// 2d bounding box of vertex positions, Rect::ZERO when empty
+	Rect getBounds() const;
+
 protected:
 	void copy();
 
@@ -23,6 +23,7 @@
 
 #include "XLDirector.h"
 #include "XLGlView.h"
+#include "XLDeferredManager.h"
 #include "XLGlLoop.h"
 #include "XLScene.h"
 #include "XLVertexArray.h"
@@ -78,7 +79,11 @@ bool Director::acquireFrame(const Rc<FrameRequest> &req) {
 		updateGeneralTransform();
 	}
 
-	update(t);
+	if (_fixedFrameInterval) {
+		update(_time.global ? _time.global + _fixedFrameInterval : _startTime);
+	} else {
+		update(t);
+	}
 	if (_scene) {
 		_scene->specializeRequest(req);
 	}
@@ -86,6 +91,9 @@ bool Director::acquireFrame(const Rc<FrameRequest> &req) {
 	_application->performOnMainThread([this, req] {
 		_scene->renderRequest(req);
 
+		// submit deferred jobs, collected while scene was composed, as a single batch
+		_application->getDeferredManager()->flush();
+
 		if (hasActiveInteractions()) {
 			_view->setReadyForNextFrame();
 		}
@@ -173,6 +181,26 @@ void Director::pushDrawStat(const gl::DrawStat &stat) {
 	_drawStat = stat;
 }
 
+gl::MemoryStat Director::getMemoryStat() const {
+	return _application->getGlLoop()->getMemoryStat();
+}
+
+Vector<gl::MemoryPoolStat> Director::getMemoryPoolStat() const {
+	return _application->getGlLoop()->getMemoryPoolStat();
+}
+
+Vector<gl::PassTimeStat> Director::getPassTimeStat() const {
+	return _application->getGlLoop()->getPassTimeStat();
+}
+
+gl::FrameCacheStat Director::getFrameCacheStat() const {
+	return _application->getGlLoop()->getFrameCacheStat();
+}
+
+gl::FrameCacheStat Director::getFrameCacheFrameStat() const {
+	return _application->getGlLoop()->getFrameCacheFrameStat();
+}
+
 float Director::getFps() const {
 	return 1.0f / (_view->getLastFrameInterval() / 1000000.0f);
 }
@@ -189,6 +217,14 @@ float Director::getLocalFrameTime() const {
 	return _view->getAvgFenceTime() / 1000.0f;
 }
 
+float Director::getInputLatency() const {
+	return _view->getLastInputLatency() / 1000.0f;
+}
+
+float Director::getAvgInputLatency() const {
+	return _view->getAvgInputLatency() / 1000.0f;
+}
+
 void Director::autorelease(Ref *ref) {
 	_autorelease.emplace_back(ref);
 }
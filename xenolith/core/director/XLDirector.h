@@ -73,13 +73,35 @@ public:
 
 	const gl::DrawStat &getDrawStat() const { return _drawStat; }
 
+	// device memory budget snapshot, updated by gl loop
+	gl::MemoryStat getMemoryStat() const;
+
+	// per memory type fragmentation of frame memory pools
+	Vector<gl::MemoryPoolStat> getMemoryPoolStat() const;
+
+	// GPU time per render pass, available when timestamps are enabled with gl::Loop::setGpuTimestampsEnabled
+	Vector<gl::PassTimeStat> getPassTimeStat() const;
+
+	// frame cache counters since cache creation, and for last loop iteration with any cache activity
+	gl::FrameCacheStat getFrameCacheStat() const;
+	gl::FrameCacheStat getFrameCacheFrameStat() const;
+
 	float getFps() const;
 	float getAvgFps() const;
 	float getSpf() const; // in milliseconds
 	float getLocalFrameTime() const; // in milliseconds
 
+	// time from first input event, handled within frame, to presentation of this frame, in milliseconds
+	float getInputLatency() const;
+	float getAvgInputLatency() const;
+
 	float getDirectorFrameTime() const { return _avgFrameTimeValue / 1000.0f; }
 
+	// Advance director's clock by fixed interval (in microseconds) on every frame instead of real time
+	// Used for reproducible animations in offscreen benchmarks, 0 - use real time
+	void setFixedFrameInterval(uint64_t value) { _fixedFrameInterval = value; }
+	uint64_t getFixedFrameInterval() const { return _fixedFrameInterval; }
+
 	void autorelease(Ref *);
 
 protected:
@@ -94,6 +116,7 @@ protected:
 	Size2 _screenSize;
 
 	uint64_t _startTime = 0;
+	uint64_t _fixedFrameInterval = 0;
 	UpdateTime _time;
 	gl::DrawStat _drawStat;
 
@@ -249,6 +249,34 @@ void ResourceCache::removeTemporaryResource(StringView str) {
 	}
 }
 
+uint64_t ResourceCache::evict(uint64_t required) {
+	Vector<TemporaryResource *> candidates;
+	for (auto &it : _temporaries) {
+		if (it.second->isLoaded() && it.second->getUsersCount() == 0) {
+			candidates.emplace_back(it.second.get());
+		}
+	}
+
+	std::sort(candidates.begin(), candidates.end(), [] (const TemporaryResource *l, const TemporaryResource *r) {
+		return l->getAccessTime() < r->getAccessTime();
+	});
+
+	uint64_t ret = 0;
+	for (auto &it : candidates) {
+		if (ret >= required) {
+			break;
+		}
+
+		// size is freed only when resource was actually released
+		auto size = it->getDeviceSize();
+		if (it->clear()) {
+			ret += size;
+			_temporaries.erase(it->getName());
+		}
+	}
+	return ret;
+}
+
 void ResourceCache::compileResource(Director *dir, TemporaryResource *res) {
 	res->setRequested(true);
 	dir->getView()->getLoop()->compileResource(Rc<renderqueue::Resource>(res->getResource()),
@@ -75,6 +75,10 @@ public:
 	bool hasTemporaryResource(StringView) const;
 	void removeTemporaryResource(StringView);
 
+	// unloads least recently used temporary resources without users, until
+	// estimated size of unloaded resources is less then required, returns estimated size
+	uint64_t evict(uint64_t required);
+
 protected:
 	void compileResource(Director *, TemporaryResource *);
 	bool clearResource(Director *, TemporaryResource *);
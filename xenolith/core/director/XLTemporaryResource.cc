@@ -24,6 +24,7 @@
 #include "XLApplication.h"
 #include "XLTexture.h"
 #include "XLScene.h"
+#include "XLGlObject.h"
 
 namespace stappler::xenolith {
 
@@ -183,6 +184,19 @@ StringView TemporaryResource::getName() const {
 	return _resource->getName();
 }
 
+uint64_t TemporaryResource::getDeviceSize() const {
+	uint64_t ret = 0;
+	for (auto &it : _resource->getImages()) {
+		// compiled image can be transcoded from compressed source format
+		auto &info = it->image ? it->image->getInfo() : static_cast<const gl::ImageInfo &>(*it);
+		ret += gl::getImageDataSize(info.format, info.extent, info.mipLevels.get(), info.arrayLayers.get());
+	}
+	for (auto &it : _resource->getBuffers()) {
+		ret += it->size;
+	}
+	return ret;
+}
+
 bool TemporaryResource::isDeprecated(const UpdateTime &time) const {
 	if (_users > 0 || !_loaded) {
 		return false;
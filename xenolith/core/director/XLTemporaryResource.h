@@ -77,6 +77,9 @@ public:
 
 	const Rc<renderqueue::Resource> &getResource() const { return _resource; }
 
+	// estimated size of resource in device memory
+	uint64_t getDeviceSize() const;
+
 	bool isDeprecated(const UpdateTime &) const;
 
 protected:
@@ -315,6 +315,8 @@ Rc<FontLayout> FontController::getLayout(FontParameters style) {
 		return nullptr;
 	}
 
+	quantize(style);
+
 	if (style.fontFamily.empty()) {
 		style.fontFamily = StringView(_defaultFontFamily);
 	}
@@ -349,6 +351,7 @@ Rc<FontLayout> FontController::getLayout(FontParameters style) {
 
 	if (face) {
 		face->touch(_clock, style.persistent);
+		++ _hits;
 		return face;
 	}
 
@@ -366,6 +369,7 @@ Rc<FontLayout> FontController::getLayout(FontParameters style) {
 	it = _layouts.find(cfgName);
 	if (it != _layouts.end()) {
 		it->second->touch(_clock, style.persistent);
+		++ _hits;
 		return it->second.get();
 	}
 
@@ -373,6 +377,7 @@ Rc<FontLayout> FontController::getLayout(FontParameters style) {
 	ret = Rc<FontLayout>::create(move(cfgName), style.fontFamily, move(spec), move(data), _library);
 	_layouts.emplace(ret->getName(), ret);
 	ret->touch(_clock, style.persistent);
+	++ _created;
 	return ret;
 }
 
@@ -417,9 +422,42 @@ StringView FontController::getFamilyName(uint32_t idx) const {
 	return StringView();
 }
 
+void FontController::setAxisQuantization(const AxisQuantization &q) {
+	std::unique_lock lock(_layoutSharedMutex);
+	_quantization = q;
+}
+
+FontController::AxisQuantization FontController::getAxisQuantization() const {
+	std::shared_lock lock(_layoutSharedMutex);
+	return _quantization;
+}
+
+void FontController::setUnusedCapacity(size_t value) {
+	do {
+		std::unique_lock lock(_layoutSharedMutex);
+		_unusedCapacity = value;
+	} while (0);
+	removeUnusedLayouts(value);
+}
+
+FontController::Stat FontController::getStat() const {
+	std::shared_lock lock(_layoutSharedMutex);
+	Stat ret;
+	ret.hits = _hits.load();
+	ret.created = _created;
+	ret.evicted = _evicted;
+	ret.layouts = _layouts.size();
+	ret.unused = _unused;
+	return ret;
+}
+
+void FontController::trim() {
+	removeUnusedLayouts(0);
+}
+
 void FontController::update(uint64_t clock) {
 	_clock = clock;
-	removeUnusedLayouts();
+	removeUnusedLayouts(_unusedCapacity);
 	if (_dirty && _loaded) {
 		Vector<FontUpdateRequest> objects;
 		std::shared_lock lock(_layoutSharedMutex);
@@ -555,21 +593,45 @@ FontSpecializationVector FontController::findSpecialization(const FamilySpec &fa
 	return ret;
 }
 
-void FontController::removeUnusedLayouts() {
+void FontController::quantize(FontParameters &style) const {
+	auto snap = [] (auto value, uint16_t step) -> decltype(value) {
+		if (step <= 1) {
+			return value;
+		}
+		return decltype(value)(std::round(float(value) / float(step)) * float(step));
+	};
+
+	style.fontWeight = FontWeight(snap(style.fontWeight.get(), _quantization.weight));
+	style.fontStretch = FontStretch(snap(style.fontStretch.get(), _quantization.stretch));
+	style.fontGrade = FontGrade(snap(style.fontGrade.get(), _quantization.grade));
+}
+
+void FontController::removeUnusedLayouts(size_t capacity) {
 	std::unique_lock lock(_layoutSharedMutex);
-	auto it = _layouts.begin();
-	while (it != _layouts.end()) {
-		if (it->second->isPersistent()) {
-			++ it;
-			continue;
+
+	// unused layouts are retained in LRU order, so, animated or frequently switched
+	// font parameters can reuse recent instances
+	Vector<Pair<uint64_t, StringView>> unused;
+	for (auto &it : _layouts) {
+		if (!it.second->isPersistent() && it.second->getReferenceCount() == 1) {
+			unused.emplace_back(it.second->getAccessTime(), it.first);
 		}
+	}
 
-		if (/*_clock - it->second->getAccessTime() > _unusedInterval.toMicros() &&*/ it->second->getReferenceCount() == 1) {
-			it = _layouts.erase(it);
-			_dirty = true;
-		} else {
-			++ it;
+	if (unused.size() > capacity) {
+		auto nth = unused.begin() + (unused.size() - capacity);
+		std::nth_element(unused.begin(), nth, unused.end(), [] (const Pair<uint64_t, StringView> &l, const Pair<uint64_t, StringView> &r) {
+			return l.first < r.first;
+		});
+
+		for (auto it = unused.begin(); it != nth; ++ it) {
+			_layouts.erase(it->second);
+			++ _evicted;
 		}
+		_dirty = true;
+		_unused = capacity;
+	} else {
+		_unused = unused.size();
 	}
 }
 
@@ -62,6 +62,24 @@ public:
 		Vector<Rc<FontFaceData>> data;
 	};
 
+	// Variable axis values are snapped to multiples of step before specialization (0 or 1 - disabled),
+	// so, animated axis produces only bounded set of font instances
+	struct AxisQuantization {
+		uint16_t weight = 10;
+		uint16_t stretch = 0;
+		uint16_t grade = 0;
+	};
+
+	struct Stat {
+		uint64_t hits = 0; // layout requests, served with existing instance
+		uint64_t created = 0; // new font instances
+		uint64_t evicted = 0;
+		size_t layouts = 0;
+		size_t unused = 0; // instances, retained in LRU
+	};
+
+	static constexpr size_t DefaultUnusedCapacity = 32;
+
 	class Builder {
 	public:
 		struct Data;
@@ -124,6 +142,18 @@ public:
 	uint32_t getFamilyIndex(StringView) const;
 	StringView getFamilyName(uint32_t idx) const;
 
+	void setAxisQuantization(const AxisQuantization &);
+	AxisQuantization getAxisQuantization() const;
+
+	// how many unused font instances should be retained for reuse
+	void setUnusedCapacity(size_t);
+	size_t getUnusedCapacity() const { return _unusedCapacity; }
+
+	Stat getStat() const;
+
+	// drop all unused font instances (on memory pressure)
+	void trim();
+
 	void update(uint64_t clock);
 
 protected:
@@ -137,7 +167,8 @@ protected:
 	void setAliases(Map<String, String> &&);
 
 	FontSpecializationVector findSpecialization(const FamilySpec &, const FontParameters &, Vector<Rc<FontFaceData>> *);
-	void removeUnusedLayouts();
+	void quantize(FontParameters &) const;
+	void removeUnusedLayouts(size_t capacity);
 
 	bool _loaded = false;
 	std::atomic<uint64_t> _clock;
@@ -153,6 +184,13 @@ protected:
 	HashMap<StringView, Rc<FontLayout>> _layouts;
 	Rc<renderqueue::DependencyEvent> _dependency;
 
+	AxisQuantization _quantization;
+	size_t _unusedCapacity = DefaultUnusedCapacity;
+	std::atomic<uint64_t> _hits = 0;
+	uint64_t _created = 0;
+	uint64_t _evicted = 0;
+	size_t _unused = 0;
+
 	bool _dirty = false;
 	mutable std::shared_mutex _layoutSharedMutex;
 };
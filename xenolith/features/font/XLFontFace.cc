@@ -22,6 +22,7 @@
  **/
 
 #include "XLFontFace.h"
+#include "XLPlatform.h"
 
 namespace stappler::xenolith::font {
 
@@ -53,6 +54,13 @@ static CharGroupId getCharGroupForChar(char16_t c) {
 	return CharGroupId::None;
 }
 
+FontFaceData::~FontFaceData() {
+	if (_mappedHandle) {
+		platform::file::_unmapFile(_view, _mappedHandle);
+		_mappedHandle = nullptr;
+	}
+}
+
 bool FontFaceData::init(StringView name, BytesView data, bool persistent) {
 	if (persistent) {
 		_view = data;
@@ -80,6 +88,23 @@ bool FontFaceData::init(StringView name, Function<Bytes()> &&cb) {
 	return true;
 }
 
+bool FontFaceData::init(StringView name, FilePath path) {
+	_name = name.str<Interface>();
+
+	auto view = platform::file::_mapFile(path.get(), &_mappedHandle);
+	if (!view.empty()) {
+		// mapped pages are loaded by OS on demand, so, FreeType reads only required tables
+		_persistent = true;
+		_view = view;
+		return true;
+	}
+
+	_persistent = false;
+	_data = filesystem::readIntoMemory<Interface>(path.get());
+	_view = _data;
+	return !_data.empty();
+}
+
 void FontFaceData::inspectVariableFont(FontLayoutParameters params, FT_Face face) {
 	FT_MM_Var *masters = nullptr;
 	FT_Get_MM_Var(face, &masters);
@@ -83,12 +83,15 @@ struct FontCharStorage {
 
 class FontFaceData : public Ref {
 public:
-	virtual ~FontFaceData() { }
+	virtual ~FontFaceData();
 
 	bool init(StringView, BytesView, bool);
 	bool init(StringView, Bytes &&);
 	bool init(StringView, Function<Bytes()> &&);
 
+	// font file will be mapped into memory, if platform supports it, or loaded otherwise
+	bool init(StringView, FilePath);
+
 	void inspectVariableFont(FontLayoutParameters params, FT_Face);
 
 	StringView getName() const { return _name; }
@@ -116,6 +119,7 @@ protected:
 	String _name;
 	BytesView _view;
 	Bytes _data;
+	void *_mappedHandle = nullptr;
 	FontVariableAxis _variableAxis = FontVariableAxis::None;
 	FontWeight _weightMin;
 	FontWeight _weightMax;
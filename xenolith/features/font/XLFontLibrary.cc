@@ -134,12 +134,14 @@ Rc<FontFaceData> FontLibrary::openFontData(StringView dataName, FontLayoutParame
 
 	lock.unlock();
 	auto fontData = dataCallback();
-	if (fontData.view.empty() && !fontData.callback) {
+	if (fontData.view.empty() && !fontData.callback && fontData.path.empty()) {
 		return nullptr;
 	}
 
 	Rc<FontFaceData> dataObject;
-	if (fontData.callback) {
+	if (!fontData.path.empty()) {
+		dataObject = Rc<FontFaceData>::create(dataName, FilePath(fontData.path));
+	} else if (fontData.callback) {
 		dataObject = Rc<FontFaceData>::create(dataName, move(fontData.callback));
 	} else if (fontData.persistent) {
 		dataObject = Rc<FontFaceData>::create(dataName, move(fontData.view), true);
@@ -312,88 +314,109 @@ FontController::Builder FontLibrary::makeDefaultControllerBuilder(StringView key
 Rc<FontController> FontLibrary::acquireController(FontController::Builder &&b) {
 	Rc<FontController> ret = Rc<FontController>::create(this);
 
+	// Controller is populated progressively: every family is added as soon as all its sources
+	// are loaded and the font image is compiled, so, the first frame waits only for the default family
+	// All callbacks below are performed on the main thread
 	struct ControllerBuilder : Ref {
 		FontController::Builder builder;
 		Rc<FontController> controller;
 		Rc<gl::DynamicImage> dynamicImage;
 
 		bool invalid = false;
-		std::atomic<size_t> pendingData = 0;
+		bool imageLoaded = false;
+		size_t pendingData = 0;
 		FontLibrary *library = nullptr;
 
+		StringView defaultFamily;
+		Map<StringView, size_t> pendingFamilies;
+		Vector<const FontController::FamilyQuery *> readyFamilies;
+
 		ControllerBuilder(FontController::Builder &&b)
-		: builder(move(b)) { }
+		: builder(move(b)) {
+			auto data = builder.getData();
+			for (auto &it : data->familyQueries) {
+				pendingFamilies.emplace(it.second.family, it.second.sources.size());
+				if (it.second.sources.empty()) {
+					readyFamilies.emplace_back(&it.second);
+				}
+			}
+
+			auto aliasIt = data->aliases.find("default");
+			if (aliasIt != data->aliases.end()) {
+				defaultFamily = aliasIt->second;
+			} else if (!data->familyQueries.empty()) {
+				defaultFamily = data->familyQueries.begin()->second.family;
+			}
+
+			pendingData = data->dataQueries.size() + 1;
+		}
 
 		void invalidate() {
 			controller = nullptr;
 		}
 
-		void loadData() {
-			if (invalid) {
-				invalidate();
+		void addReadyFamilies() {
+			if (invalid || !imageLoaded || !controller) {
 				return;
 			}
 
-			library->getApplication()->perform([this] (const thread::Task &) -> bool {
-				for (auto &it : builder.getData()->familyQueries) {
-					Vector<Rc<FontFaceData>> d; d.reserve(it.second.sources.size());
-					for (auto &iit : it.second.sources) {
-						d.emplace_back(move(iit->data));
+			bool defaultLoaded = false;
+			for (auto &it : readyFamilies) {
+				Vector<Rc<FontFaceData>> d; d.reserve(it->sources.size());
+				for (auto &iit : it->sources) {
+					if (iit->data) {
+						d.emplace_back(iit->data);
 					}
-
-					controller->addFont(it.second.family, move(d));
-					/*for (auto &iit : it.second.chars) {
-						if (!iit.second.empty()) {
-							auto lId = controller->getLayout(FontParameters{
-								it.second.style, it.second.weight, it.second.stretch,
-								font::FontVariant::Normal,
-								font::ListStyleType::None,
-								iit.first, it.second.family
-							}, 1.0f);
-							controller->addString(lId, iit.second);
-						}
-					}*/
 				}
-				for (auto &it : builder.getData()->familyQueries) {
-					Vector<Rc<FontFaceData>> d; d.reserve(it.second.sources.size());
-					for (auto &iit : it.second.sources) {
-						d.emplace_back(move(iit->data));
-					}
+
+				if (!d.empty()) {
+					controller->addFont(it->family, move(d));
 				}
-				return true;
-			}, [this] (const Task &, bool success) {
-				if (success) {
-					controller->setAliases(builder.getAliases());
-					controller->setLoaded(true);
+				if (it->family == defaultFamily) {
+					defaultLoaded = true;
 				}
+			}
+			readyFamilies.clear();
+
+			if (!controller->isLoaded() && (defaultLoaded || pendingData == 0)) {
+				controller->setAliases(builder.getAliases());
+				controller->setLoaded(true);
+			}
+
+			if (pendingData == 0) {
 				controller = nullptr;
-			}, this);
+			}
 		}
 
-		void onDataLoaded(bool success) {
-			auto v = pendingData.fetch_sub(1);
-			if (!success) {
-				invalid = true;
-				if (v == 1) {
-					invalidate();
+		void onDataLoaded(const FontController::FontSource *source, StringView name) {
+			-- pendingData;
+			if (!source->data) {
+				log::vtext("FontLibrary", "Fail to load font source: ", name);
+			}
+
+			for (auto &it : builder.getData()->familyQueries) {
+				if (std::find(it.second.sources.begin(), it.second.sources.end(), source) != it.second.sources.end()) {
+					auto fIt = pendingFamilies.find(it.second.family);
+					if (fIt != pendingFamilies.end() && fIt->second > 0) {
+						if (-- fIt->second == 0) {
+							readyFamilies.emplace_back(&it.second);
+						}
+					}
 				}
-			} else if (v == 1) {
-				loadData();
 			}
+
+			addReadyFamilies();
 		}
 
 		void onImageLoaded(Rc<gl::DynamicImage> &&image) {
-			auto v = pendingData.fetch_sub(1);
+			-- pendingData;
 			if (image) {
 				controller->setImage(move(image));
-				if (v == 1) {
-					loadData();
-				}
+				imageLoaded = true;
+				addReadyFamilies();
 			} else {
 				invalid = true;
-				if (v == 1) {
-					invalidate();
-				}
+				invalidate();
 			}
 		}
 	};
@@ -402,10 +425,8 @@ Rc<FontController> FontLibrary::acquireController(FontController::Builder &&b) {
 	builder->library = this;
 	builder->controller = ret;
 
-	builder->pendingData = builder->builder.getData()->dataQueries.size() + 1;
-
 	for (auto &it : builder->builder.getData()->dataQueries) {
-		_application->perform([this, name = it.first, sourcePtr = &it.second, builder] (const thread::Task &) -> bool {
+		_application->perform([this, name = it.first, sourcePtr = &it.second] (const thread::Task &) -> bool {
 			sourcePtr->data = openFontData(name, sourcePtr->params, [&] () -> FontData {
 				if (sourcePtr->fontCallback) {
 					return FontData(move(sourcePtr->fontCallback));
@@ -414,20 +435,26 @@ Rc<FontController> FontLibrary::acquireController(FontController::Builder &&b) {
 				} else if (!sourcePtr->fontMemoryData.empty()) {
 					return FontData(move(sourcePtr->fontMemoryData));
 				} else if (!sourcePtr->fontFilePath.empty()) {
-					auto d = filesystem::readIntoMemory<Interface>(sourcePtr->fontFilePath);
-					if (!d.empty()) {
-						return FontData(move(d));
+					StringView path(sourcePtr->fontFilePath);
+					String npath;
+					if (filesystem::exists(path)) {
+						npath = path.str<Interface>();
+					} else if (!filepath::isAbsolute(path)) {
+						npath = filesystem::currentDir<Interface>(path);
+						if (!filesystem::exists(npath)) {
+							npath.clear();
+						}
+					}
+					if (!npath.empty()) {
+						return FontData(FilePath(npath));
 					}
 				}
 				return FontData(BytesView(), false);
 			});
-			if (sourcePtr->data) {
-				builder->onDataLoaded(true);
-			} else {
-				builder->onDataLoaded(false);
-			}
 			return true;
-		});
+		}, [name = it.first, sourcePtr = &it.second, builder] (const thread::Task &, bool) {
+			builder->onDataLoaded(sourcePtr, name);
+		}, builder.get());
 	}
 
 	builder->dynamicImage = Rc<gl::DynamicImage>::create([name = builder->builder.getName()] (gl::DynamicImage::Builder &builder) {
@@ -59,6 +59,7 @@ public:
 		BytesView view;
 		Bytes bytes;
 		Function<Bytes()> callback;
+		String path; // resolved file path, data will be mapped into memory
 
 		FontData(BytesView v, bool p) : persistent(p) {
 			if (persistent) {
@@ -72,6 +73,7 @@ public:
 			view = bytes;
 		}
 		FontData(Function<Bytes()> &&cb) : persistent(true), callback(move(cb)) { }
+		FontData(FilePath p) : persistent(true), path(p.get().str<Interface>()) { }
 	};
 
 	static BytesView getFont(DefaultFontName);
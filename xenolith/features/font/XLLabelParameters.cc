@@ -675,6 +675,82 @@ bool LabelParameters::updateFormatSpec(FormatSpec *format, const StyleVec &compi
 	return success;
 }
 
+template <typename T>
+static void LabelParameters_writeKey(String &key, const T &val) {
+	key.append((const char *)&val, sizeof(T));
+}
+
+static void LabelParameters_writeKey(String &key, const LabelParameters::DescriptionStyle &style) {
+	LabelParameters_writeKey(key, style.font.fontStyle.get());
+	LabelParameters_writeKey(key, style.font.fontWeight.get());
+	LabelParameters_writeKey(key, style.font.fontStretch.get());
+	LabelParameters_writeKey(key, style.font.fontGrade.get());
+	LabelParameters_writeKey(key, style.font.fontSize.value);
+	LabelParameters_writeKey(key, style.font.density);
+	LabelParameters_writeKey(key, style.font.fontVariant);
+	LabelParameters_writeKey(key, style.font.listStyleType);
+	LabelParameters_writeKey(key, style.font.persistent);
+	LabelParameters_writeKey(key, uint32_t(style.font.fontFamily.size()));
+	key.append(style.font.fontFamily.data(), style.font.fontFamily.size());
+
+	LabelParameters_writeKey(key, style.text.textTransform);
+	LabelParameters_writeKey(key, style.text.textDecoration);
+	LabelParameters_writeKey(key, style.text.whiteSpace);
+	LabelParameters_writeKey(key, style.text.hyphens);
+	LabelParameters_writeKey(key, style.text.verticalAlign);
+	LabelParameters_writeKey(key, style.text.color.r);
+	LabelParameters_writeKey(key, style.text.color.g);
+	LabelParameters_writeKey(key, style.text.color.b);
+	LabelParameters_writeKey(key, style.text.opacity);
+
+	LabelParameters_writeKey(key, style.colorDirty);
+	LabelParameters_writeKey(key, style.opacityDirty);
+}
+
+// device pixel values in key should not wrap for large sizes
+static uint32_t LabelParameters_keyPixels(float value, float density) {
+	return uint32_t(std::clamp(roundf(value * density), 0.0f, float(maxOf<uint32_t>())));
+}
+
+String LabelParameters::getFormatSpecKey(font::FontController *source, const StyleVec &compiledStyles, float density, uint8_t adjustValue) const {
+	if (_localeEnabled) {
+		// locale can be changed without label update, do not share such layouts
+		return String();
+	}
+
+	String key;
+	key.reserve(64 + compiledStyles.size() * 48 + _string16.size() * sizeof(char16_t));
+
+	LabelParameters_writeKey(key, (const void *)source);
+	LabelParameters_writeKey(key, density);
+	LabelParameters_writeKey(key, adjustValue);
+	LabelParameters_writeKey(key, LabelParameters_keyPixels(_width, density));
+	LabelParameters_writeKey(key, LabelParameters_keyPixels(_maxWidth, density));
+	LabelParameters_writeKey(key, LabelParameters_keyPixels(_textIndent, density));
+	LabelParameters_writeKey(key, _alignment);
+	LabelParameters_writeKey(key, _maxLines);
+	LabelParameters_writeKey(key, _maxChars);
+	LabelParameters_writeKey(key, _opticalAlignment);
+	LabelParameters_writeKey(key, _emplaceAllChars);
+	LabelParameters_writeKey(key, _fillerChar);
+	LabelParameters_writeKey(key, _isLineHeightAbsolute);
+	LabelParameters_writeKey(key, _lineHeight);
+
+	Rc<font::FontController> controller(source);
+	for (auto &it : compiledStyles) {
+		// key should contain specialized style, so subclasses with custom specialization will be supported
+		DescriptionStyle params = _style.merge(controller, it.style);
+		specializeStyle(params, density);
+
+		LabelParameters_writeKey(key, it.start);
+		LabelParameters_writeKey(key, it.length);
+		LabelParameters_writeKey(key, params);
+	}
+
+	key.append((const char *)_string16.data(), _string16.size() * sizeof(char16_t));
+	return key;
+}
+
 LabelParameters::~LabelParameters() { }
 
 bool LabelParameters::isLabelDirty() const {
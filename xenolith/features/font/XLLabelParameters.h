@@ -268,6 +268,11 @@ public:
 
 	virtual bool updateFormatSpec(FormatSpec *, const StyleVec &, float density, uint8_t adjustValue);
 
+	// Key, that identifies result of updateFormatSpec with the same arguments
+	// Labels with equal keys produce equal layouts, so, layout can be shared between them
+	// Returns empty string if layout should not be shared
+	virtual String getFormatSpecKey(font::FontController *, const StyleVec &, float density, uint8_t adjustValue) const;
+
 	virtual bool empty() const { return _string16.empty(); }
 
 	void setAlignment(Alignment alignment);
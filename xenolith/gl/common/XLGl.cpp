@@ -39,3 +39,4 @@
 #include "XLGlLoop.cc"
 #include "XLGlSdf.cc"
 #include "XLGlMesh.cc"
+#include "XLGlKtx.cc"
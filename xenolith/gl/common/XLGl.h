@@ -81,6 +81,7 @@ using AmbientLightData = glsl::AmbientLightData;
 using DirectLightData = glsl::DirectLightData;
 using Vertex_V4F_V4F_T2F2U = glsl::Vertex;
 using TransformObject = glsl::TransformObject;
+using InstanceObject = glsl::InstanceObject;
 using MeshIndexData = glsl::MeshIndexData;
 
 enum class ObjectType {
@@ -126,6 +127,9 @@ enum class CommandFlags : uint16_t {
 SP_DEFINE_ENUM_AS_MASK(CommandFlags)
 
 struct SamplerInfo {
+	// equals to VK_LOD_CLAMP_NONE, use as maxLod to sample all available mip levels
+	static constexpr float LodClampNone = 1000.0f;
+
 	Filter magFilter = Filter::Nearest;
 	Filter minFilter = Filter::Nearest;
 	SamplerMipmapMode mipmapMode = SamplerMipmapMode::Nearest;
@@ -222,6 +226,8 @@ struct ImageInfoData {
 	bool operator==(const ImageInfoData &) const = default;
 	bool operator!=(const ImageInfoData &) const = default;
 	auto operator<=>(const ImageInfoData &) const = default;
+
+	size_t hash() const;
 };
 
 struct ImageInfo : NamedMem, ImageInfoData {
@@ -273,6 +279,10 @@ struct ImageData : ImageInfo {
 	static ImageData make(Rc<ImageObject> &&);
 
 	BytesView data;
+
+	// number of mip levels, provided within data (level by level, starting from level 0)
+	uint32_t dataLevels = 1;
+
 	memory::function<void(uint8_t *, uint64_t, const DataCallback &)> memCallback = nullptr;
 	Function<void(uint8_t *, uint64_t, const DataCallback &)> stdCallback = nullptr;
 	Rc<ImageObject> image; // GL implementation-dependent object
@@ -355,6 +365,79 @@ struct Quad_V3F_C4F_T2F {
 	Vertex_V4F_V4F_T2F2U br;
 };
 
+struct MemoryHeapStat {
+	uint64_t size = 0;
+	uint64_t budget = 0; // as reported by driver, or heap size, if budget is not available
+	uint64_t usage = 0; // as reported by driver, or memory allocated by engine, if budget is not available
+	bool deviceLocal = false;
+};
+
+struct MemoryStat {
+	static constexpr uint32_t MaxHeaps = 16;
+
+	std::array<MemoryHeapStat, MaxHeaps> heaps;
+	uint32_t heapCount = 0;
+	bool hasBudget = false;
+
+	// max usage to budget ratio for device local heaps
+	float getDevicePressure() const {
+		float ret = 0.0f;
+		for (uint32_t i = 0; i < heapCount; ++ i) {
+			if (heaps[i].deviceLocal && heaps[i].budget > 0) {
+				ret = std::max(ret, float(heaps[i].usage) / float(heaps[i].budget));
+			}
+		}
+		return ret;
+	}
+
+	uint64_t getDeviceUsage() const {
+		uint64_t ret = 0;
+		for (uint32_t i = 0; i < heapCount; ++ i) {
+			if (heaps[i].deviceLocal) { ret += heaps[i].usage; }
+		}
+		return ret;
+	}
+
+	uint64_t getDeviceBudget() const {
+		uint64_t ret = 0;
+		for (uint32_t i = 0; i < heapCount; ++ i) {
+			if (heaps[i].deviceLocal) { ret += heaps[i].budget; }
+		}
+		return ret;
+	}
+};
+
+// Suballocation state of frame memory pools for single memory type
+struct MemoryPoolStat {
+	uint32_t type = 0; // memory type index
+	uint64_t reserved = 0; // size of device memory nodes
+	uint64_t used = 0; // size of live blocks
+	uint64_t free = 0; // free ranges and unused node tails
+	uint64_t largestFree = 0;
+	size_t freeBlocks = 0;
+
+	// 0.0 - all free space is contiguous, 1.0 - free space is spread over small blocks
+	float getFragmentation() const { return free ? 1.0f - float(largestFree) / float(free) : 0.0f; }
+};
+
+// Hit/miss counters of frame cache for images and framebuffers
+struct FrameCacheStat {
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+	uint64_t evictions = 0;
+	size_t images = 0; // idle cached images
+	size_t framebuffers = 0; // idle cached framebuffers
+	size_t usage = 0; // estimated memory of idle cached images
+};
+
+// GPU execution time of queue pass, measured with timestamp queries
+struct PassTimeStat {
+	String name;
+	uint64_t last = 0; // in nanoseconds
+	uint64_t average = 0; // rolling average, in nanoseconds
+	uint64_t samples = 0;
+};
+
 struct DrawStat {
 	uint32_t vertexes;
 	uint32_t triangles;
@@ -370,7 +453,12 @@ struct DrawStat {
 	uint32_t surfaceCmds;
 	uint32_t transparentCmds;
 
+	uint32_t transforms;
+	uint32_t batchedTransforms; // vertex arrays, that reused transform slot of previous array
+
 	uint32_t vertexInputTime;
+	uint32_t commandsRecordTime;
+	uint32_t secondaryBuffers; // 0 if commands was recorded inline
 };
 
 struct VertexSpan {
@@ -379,6 +467,8 @@ struct VertexSpan {
 	uint32_t instanceCount;
 	uint32_t firstIndex;
 	StateId state;
+	uint32_t firstInstance = 0; // offset in instance buffer for instanced spans
+	bool instanced = false;
 };
 
 struct VertexData : public AttachmentInputData {
@@ -573,6 +663,16 @@ String getCompositeAlphaFlagsDescription(CompositeAlphaFlags);
 String getSurfaceTransformFlagsDescription(SurfaceTransformFlags);
 String getImageUsageDescription(ImageUsage fmt);
 size_t getFormatBlockSize(ImageFormat format);
+Extent2 getFormatBlockExtent(ImageFormat format); // texel block dimensions, (1, 1) for uncompressed formats
+bool isCompressedFormat(ImageFormat format);
+uint32_t getMaxMipLevels(const Extent3 &);
+Extent3 getImageLevelExtent(const Extent3 &, uint32_t level);
+
+// size of tightly packed data for mip level (with all array layers)
+uint64_t getImageLevelSize(ImageFormat, const Extent3 &, uint32_t level, uint32_t layers = 1);
+
+// size of tightly packed data for first `levels` mip levels
+uint64_t getImageDataSize(ImageFormat, const Extent3 &, uint32_t levels, uint32_t layers = 1);
 PixelFormat getImagePixelFormat(ImageFormat format);
 bool isStencilFormat(ImageFormat format);
 bool isDepthFormat(ImageFormat format);
@@ -586,4 +686,15 @@ std::ostream & operator<<(std::ostream &stream, const ImageInfoData &value);
 
 }
 
+namespace std {
+
+template <>
+struct hash<stappler::xenolith::gl::ImageInfoData> {
+	size_t operator() (const stappler::xenolith::gl::ImageInfoData &value) const noexcept {
+		return value.hash();
+	}
+};
+
+}
+
 #endif /* XENOLITH_GL_COMMON_XLGL_H_ */
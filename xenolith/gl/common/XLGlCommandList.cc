@@ -42,6 +42,9 @@ Command *Command::create(memory::pool_t *p, CommandType t, CommandFlags flags) {
 	case CommandType::Deferred:
 		c->data = new ( memory::pool::palloc(p, sizeof(CmdDeferred)) ) CmdDeferred;
 		break;
+	case CommandType::InstanceArray:
+		c->data = new ( memory::pool::palloc(p, sizeof(CmdInstanceArray)) ) CmdInstanceArray;
+		break;
 	case CommandType::ShadowArray:
 		c->data = new ( memory::pool::palloc(p, sizeof(CmdShadowArray)) ) CmdShadowArray;
 		break;
@@ -71,6 +74,11 @@ void Command::release() {
 			d->deferred = nullptr;
 		}
 		break;
+	case CommandType::InstanceArray:
+		if (CmdInstanceArray *d = (CmdInstanceArray *)data) {
+			d->vertexes.data = nullptr;
+		}
+		break;
 	case CommandType::ShadowArray:
 		if (CmdShadowArray *d = (CmdShadowArray *)data) {
 			for (auto &it : d->vertexes) {
@@ -191,6 +199,30 @@ void CommandList::pushDeferredVertexResult(const Rc<DeferredVertexResult> &res,
 	});
 }
 
+void CommandList::pushInstanceArray(Rc<VertexData> &&vert, const Mat4 &t, SpanView<InstanceObject> instances,
+		SpanView<ZOrder> zPath, gl::MaterialId material, RenderingLevel level, float depthValue, CommandFlags flags) {
+	_pool->perform([&] {
+		auto cmd = Command::create(_pool->getPool(), CommandType::InstanceArray, flags);
+		auto cmdData = (CmdInstanceArray *)cmd->data;
+
+		cmdData->vertexes.mat = t;
+		cmdData->vertexes.data = move(vert);
+		cmdData->instances = instances.pdup(_pool->getPool());
+
+		while (!zPath.empty() && zPath.back() == ZOrder(0)) {
+			zPath.pop_back();
+		}
+
+		cmdData->zPath = zPath.pdup(_pool->getPool());
+		cmdData->material = material;
+		cmdData->state = _currentState;
+		cmdData->renderingLevel = level;
+		cmdData->depthValue = depthValue;
+
+		addCommand(cmd);
+	});
+}
+
 void CommandList::pushShadowArray(Rc<VertexData> &&vert, const Mat4 &t, float value) {
 	_pool->perform([&] {
 		auto cmd = Command::create(_pool->getPool(), CommandType::ShadowArray, CommandFlags::None);
@@ -278,6 +310,33 @@ void CommandList::sendStat(const DrawStat &stat) const {
 	}
 }
 
+void CommandList::clearDamage() {
+	_damage = Rect();
+	_damageFull = false;
+}
+
+void CommandList::addDamage(const Rect &rect) {
+	if (_damageFull || rect.size.width <= 0.0f || rect.size.height <= 0.0f) {
+		return;
+	}
+
+	if (_damage.size.width <= 0.0f || _damage.size.height <= 0.0f) {
+		_damage = rect;
+		return;
+	}
+
+	auto minX = std::min(_damage.origin.x, rect.origin.x);
+	auto minY = std::min(_damage.origin.y, rect.origin.y);
+	auto maxX = std::max(_damage.origin.x + _damage.size.width, rect.origin.x + rect.size.width);
+	auto maxY = std::max(_damage.origin.y + _damage.size.height, rect.origin.y + rect.size.height);
+
+	_damage = Rect(minX, minY, maxX - minX, maxY - minY);
+}
+
+void CommandList::setDamageFull() {
+	_damageFull = true;
+}
+
 void CommandList::addCommand(Command *cmd) {
 	if (!_last) {
 		_first = cmd;
@@ -33,6 +33,7 @@ enum class CommandType : uint16_t {
 	CommandGroup,
 	VertexArray,
 	Deferred,
+	InstanceArray,
 
 	ShadowArray,
 	ShadowDeferred,
@@ -59,6 +60,12 @@ struct CmdDeferred : CmdGeneral {
 	bool normalized = false;
 };
 
+// base vertexes, drawn once for each instance with single instanced draw call
+struct CmdInstanceArray : CmdGeneral {
+	TransformedVertexData vertexes;
+	SpanView<InstanceObject> instances;
+};
+
 struct CmdShadow {
 	gl::StateId state = 0;
 	float value = 0.0f;
@@ -106,6 +113,10 @@ public:
 	void pushDeferredVertexResult(const Rc<DeferredVertexResult> &, const Mat4 &view, const Mat4 &model, bool normalized,
 			SpanView<ZOrder> zPath, gl::MaterialId material, RenderingLevel, float depthValue, CommandFlags = CommandFlags::None);
 
+	// instances data will be copied into frame's pool
+	void pushInstanceArray(Rc<VertexData> &&, const Mat4 &, SpanView<InstanceObject> instances,
+			SpanView<ZOrder> zPath, gl::MaterialId material, RenderingLevel, float depthValue, CommandFlags = CommandFlags::None);
+
 	void pushShadowArray(Rc<VertexData> &&, const Mat4 &, float value);
 	void pushShadowArray(SpanView<TransformedVertexData>, float value);
 	void pushDeferredShadow(const Rc<DeferredVertexResult> &, const Mat4 &view, const Mat4 &model, bool normalized, float value);
@@ -125,6 +136,15 @@ public:
 
 	bool empty() const { return _first == nullptr; }
 
+	// Damaged area of frame in world coordinates (framebuffer pixels, like DrawStateValues::scissor)
+	// List is created with full damage, producer, that tracks damage, should clear it before drawing
+	void clearDamage();
+	void addDamage(const Rect &);
+	void setDamageFull();
+
+	bool isDamageFull() const { return _damageFull; }
+	const Rect &getDamage() const { return _damage; }
+
 protected:
 	void addCommand(Command *);
 
@@ -134,6 +154,8 @@ protected:
 	Command *_last = nullptr;
 	memory::vector<DrawStateValues> *_states = nullptr;
 	memory::function<void(DrawStat)> *_statCallback = nullptr;
+	Rect _damage;
+	bool _damageFull = true;
 };
 
 }
@@ -39,6 +39,8 @@ bool Device::init(const Instance *instance) {
 	_glInstance = instance;
 	_samplersInfo.emplace_back(SamplerInfo{ .magFilter = Filter::Nearest, .minFilter = Filter::Nearest});
 	_samplersInfo.emplace_back(SamplerInfo{ .magFilter = Filter::Linear, .minFilter = Filter::Linear});
+	_samplersInfo.emplace_back(SamplerInfo{ .magFilter = Filter::Linear, .minFilter = Filter::Linear,
+		.mipmapMode = SamplerMipmapMode::Linear, .maxLod = SamplerInfo::LodClampNone});
 	return true;
 }
 
@@ -88,6 +90,18 @@ auto Device::makeImage(const ImageInfo &) -> Rc<ImageStorage> {
 	return nullptr;
 }
 
+Vector<Rc<ImageStorage>> Device::makeAliasedImages(SpanView<ImageInfo> infos) {
+	Vector<Rc<ImageStorage>> ret; ret.reserve(infos.size());
+	for (auto &it : infos) {
+		if (auto img = makeImage(it)) {
+			ret.emplace_back(move(img));
+		} else {
+			return Vector<Rc<ImageStorage>>();
+		}
+	}
+	return ret;
+}
+
 Rc<Semaphore> Device::makeSemaphore() {
 	return nullptr;
 }
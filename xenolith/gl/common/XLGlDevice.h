@@ -71,6 +71,8 @@ public:
 
 	virtual Rc<Framebuffer> makeFramebuffer(const renderqueue::PassData *, SpanView<Rc<gl::ImageView>>, Extent2);
 	virtual Rc<ImageStorage> makeImage(const ImageInfo &);
+	// images, that can share the same memory (lifetimes should not overlap), default implementation allocates them separately
+	virtual Vector<Rc<ImageStorage>> makeAliasedImages(SpanView<ImageInfo>);
 	virtual Rc<Semaphore> makeSemaphore();
 	virtual Rc<ImageView> makeImageView(const Rc<ImageObject> &, const ImageViewInfo &);
 
@@ -444,7 +444,14 @@ enum class AttachmentStorageType {
 
 enum class ImageHints {
 	None = 0,
-	Opaque = 1 << 0
+	Opaque = 1 << 0,
+
+	// Fill mip levels from level 0 when image is transferred to device
+	// If MipLevels is 1, full mip chain is used
+	GenerateMipmaps = 1 << 1,
+
+	// Upload block-compressed image as uncompressed with CPU transcoding, even if device supports its format
+	Transcode = 1 << 2,
 };
 
 SP_DEFINE_ENUM_AS_MASK(ImageHints);
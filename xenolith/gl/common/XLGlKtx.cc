@@ -0,0 +1,535 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "XLGlKtx.h"
+
+namespace stappler::xenolith::gl {
+
+static constexpr uint8_t KtxIdentifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+struct KtxHeader {
+	uint8_t identifier[12];
+	uint32_t vkFormat;
+	uint32_t typeSize;
+	uint32_t pixelWidth;
+	uint32_t pixelHeight;
+	uint32_t pixelDepth;
+	uint32_t layerCount;
+	uint32_t faceCount;
+	uint32_t levelCount;
+	uint32_t supercompressionScheme;
+	uint32_t dfdByteOffset;
+	uint32_t dfdByteLength;
+	uint32_t kvdByteOffset;
+	uint32_t kvdByteLength;
+	uint64_t sgdByteOffset;
+	uint64_t sgdByteLength;
+};
+
+static_assert(sizeof(KtxHeader) == KtxInfo::HeaderSize, "Invalid KTX2 header size");
+
+uint64_t KtxInfo::getDataSize() const {
+	return getImageDataSize(format, extent, levels, layers);
+}
+
+ImageInfo KtxInfo::getImageInfo(ImageInfo &&info) const {
+	ImageInfo ret(move(info));
+	ret.format = format;
+	ret.imageType = type;
+	ret.extent = extent;
+	ret.arrayLayers = ArrayLayers(layers);
+	if (faces == 6) {
+		ret.flags |= ImageFlags::CubeCompatible;
+	}
+	if (generateMipmaps) {
+		ret.hints |= ImageHints::GenerateMipmaps;
+	} else {
+		ret.mipLevels = MipLevels(levels);
+	}
+	return ret;
+}
+
+bool isKtx2(BytesView data) {
+	return data.size() >= sizeof(KtxIdentifier) && memcmp(data.data(), KtxIdentifier, sizeof(KtxIdentifier)) == 0;
+}
+
+bool readKtxInfo(BytesView data, KtxInfo &info) {
+	if (data.size() < sizeof(KtxHeader) || !isKtx2(data)) {
+		return false;
+	}
+
+	// KTX2 is little-endian, as well as all our target platforms
+	KtxHeader header;
+	memcpy(&header, data.data(), sizeof(KtxHeader));
+
+	if (header.vkFormat == 0) {
+		log::vtext("gl::Ktx", "Containers without VkFormat (Basis Universal) are not supported");
+		return false;
+	}
+
+	if (header.supercompressionScheme != 0) {
+		log::vtext("gl::Ktx", "Supercompression scheme ", header.supercompressionScheme, " is not supported");
+		return false;
+	}
+
+	info.format = ImageFormat(header.vkFormat);
+	if (getFormatBlockSize(info.format) == 0) {
+		log::vtext("gl::Ktx", "Unknown format: ", header.vkFormat);
+		return false;
+	}
+
+	info.extent = Extent3(std::max(header.pixelWidth, uint32_t(1)), std::max(header.pixelHeight, uint32_t(1)),
+			std::max(header.pixelDepth, uint32_t(1)));
+	if (header.pixelDepth > 0) {
+		info.type = ImageType::Image3D;
+	} else if (header.pixelHeight > 0) {
+		info.type = ImageType::Image2D;
+	} else {
+		info.type = ImageType::Image1D;
+	}
+
+	info.faces = std::max(header.faceCount, uint32_t(1));
+	info.layers = std::max(header.layerCount, uint32_t(1)) * info.faces;
+	info.levels = std::max(header.levelCount, uint32_t(1));
+	info.generateMipmaps = (header.levelCount == 0);
+	info.supercompression = header.supercompressionScheme;
+
+	if (data.size() < sizeof(KtxHeader) + KtxInfo::LevelIndexSize * info.levels) {
+		return false;
+	}
+
+	info.index.clear();
+	info.index.reserve(info.levels);
+
+	auto ptr = data.data() + sizeof(KtxHeader);
+	for (uint32_t i = 0; i < info.levels; ++ i) {
+		uint64_t level[3];
+		memcpy(level, ptr + i * KtxInfo::LevelIndexSize, KtxInfo::LevelIndexSize);
+
+		if (level[1] != getImageLevelSize(info.format, info.extent, i, info.layers)) {
+			log::vtext("gl::Ktx", "Invalid size for level ", i, ": ", level[1]);
+			return false;
+		}
+
+		info.index.emplace_back(KtxLevel{level[0], level[1]});
+	}
+
+	return true;
+}
+
+bool readKtxData(BytesView data, const KtxInfo &info, uint8_t *target, uint64_t size) {
+	uint64_t offset = 0;
+	for (auto &it : info.index) {
+		// compare without sums, offsets and sizes from container may overflow
+		if (it.offset > data.size() || it.size > data.size() - it.offset || it.size > size - offset) {
+			return false;
+		}
+
+		// container stores levels from smallest to largest, but index is ordered from level 0
+		memcpy(target + offset, data.data() + it.offset, it.size);
+		offset += it.size;
+	}
+	return true;
+}
+
+bool isTranscodeSupported(ImageFormat fmt) {
+	return getTranscodeFormat(fmt) != ImageFormat::Undefined;
+}
+
+ImageFormat getTranscodeFormat(ImageFormat fmt) {
+	switch (fmt) {
+	case ImageFormat::BC1_RGB_UNORM_BLOCK:
+	case ImageFormat::BC1_RGBA_UNORM_BLOCK:
+	case ImageFormat::BC2_UNORM_BLOCK:
+	case ImageFormat::BC3_UNORM_BLOCK:
+	case ImageFormat::ETC2_R8G8B8_UNORM_BLOCK:
+	case ImageFormat::ETC2_R8G8B8A1_UNORM_BLOCK:
+	case ImageFormat::ETC2_R8G8B8A8_UNORM_BLOCK:
+		return ImageFormat::R8G8B8A8_UNORM;
+		break;
+	case ImageFormat::BC1_RGB_SRGB_BLOCK:
+	case ImageFormat::BC1_RGBA_SRGB_BLOCK:
+	case ImageFormat::BC2_SRGB_BLOCK:
+	case ImageFormat::BC3_SRGB_BLOCK:
+	case ImageFormat::ETC2_R8G8B8_SRGB_BLOCK:
+	case ImageFormat::ETC2_R8G8B8A1_SRGB_BLOCK:
+	case ImageFormat::ETC2_R8G8B8A8_SRGB_BLOCK:
+		return ImageFormat::R8G8B8A8_SRGB;
+		break;
+	case ImageFormat::BC4_UNORM_BLOCK:
+		return ImageFormat::R8_UNORM;
+		break;
+	case ImageFormat::BC5_UNORM_BLOCK:
+		return ImageFormat::R8G8_UNORM;
+		break;
+	default:
+		break;
+	}
+	return ImageFormat::Undefined;
+}
+
+// Block decoders write 4x4 texels into `out` with `channels` components per texel, row by row
+
+static void Ktx_decodeBc1Color(const uint8_t *block, uint8_t *out, bool alpha, bool alwaysOpaque) {
+	auto c0 = uint16_t(block[0] | (block[1] << 8));
+	auto c1 = uint16_t(block[2] | (block[3] << 8));
+	auto bits = uint32_t(block[4] | (block[5] << 8) | (block[6] << 16) | (uint32_t(block[7]) << 24));
+
+	uint8_t colors[4][4];
+	auto expand = [] (uint16_t c, uint8_t *target) {
+		auto r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+		target[0] = uint8_t((r << 3) | (r >> 2));
+		target[1] = uint8_t((g << 2) | (g >> 4));
+		target[2] = uint8_t((b << 3) | (b >> 2));
+		target[3] = 255;
+	};
+
+	expand(c0, colors[0]);
+	expand(c1, colors[1]);
+
+	if (c0 > c1 || alwaysOpaque) {
+		for (int i = 0; i < 3; ++ i) {
+			colors[2][i] = uint8_t((2 * colors[0][i] + colors[1][i]) / 3);
+			colors[3][i] = uint8_t((colors[0][i] + 2 * colors[1][i]) / 3);
+		}
+		colors[2][3] = colors[3][3] = 255;
+	} else {
+		for (int i = 0; i < 3; ++ i) {
+			colors[2][i] = uint8_t((colors[0][i] + colors[1][i]) / 2);
+			colors[3][i] = 0;
+		}
+		colors[2][3] = 255;
+		colors[3][3] = alpha ? 0 : 255;
+	}
+
+	for (uint32_t i = 0; i < 16; ++ i) {
+		memcpy(out + i * 4, colors[(bits >> (i * 2)) & 3], 4);
+	}
+}
+
+// BC3 alpha and BC4/BC5 channel block
+static void Ktx_decodeBc4Channel(const uint8_t *block, uint8_t *out, uint32_t stride) {
+	uint8_t values[8];
+	values[0] = block[0];
+	values[1] = block[1];
+	if (values[0] > values[1]) {
+		for (int i = 1; i < 7; ++ i) {
+			values[i + 1] = uint8_t(((7 - i) * values[0] + i * values[1]) / 7);
+		}
+	} else {
+		for (int i = 1; i < 5; ++ i) {
+			values[i + 1] = uint8_t(((5 - i) * values[0] + i * values[1]) / 5);
+		}
+		values[6] = 0;
+		values[7] = 255;
+	}
+
+	uint64_t bits = 0;
+	for (int i = 0; i < 6; ++ i) {
+		bits |= uint64_t(block[2 + i]) << (8 * i);
+	}
+
+	for (uint32_t i = 0; i < 16; ++ i) {
+		out[i * stride] = values[(bits >> (i * 3)) & 7];
+	}
+}
+
+static constexpr int Ktx_EtcModifiers[8][2] = {
+	{ 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+};
+
+static constexpr int Ktx_EtcDistances[8] = { 3, 6, 11, 16, 22, 32, 41, 64 };
+
+static constexpr int Ktx_EacModifiers[16][8] = {
+	{ -3, -6, -9, -15, 2, 5, 8, 14 },
+	{ -3, -7, -10, -13, 2, 6, 9, 12 },
+	{ -2, -5, -8, -13, 1, 4, 7, 12 },
+	{ -2, -4, -6, -13, 1, 3, 5, 12 },
+	{ -3, -6, -8, -12, 2, 5, 7, 11 },
+	{ -3, -7, -9, -11, 2, 6, 8, 10 },
+	{ -4, -7, -8, -11, 3, 6, 7, 10 },
+	{ -3, -5, -8, -11, 2, 4, 7, 10 },
+	{ -2, -6, -8, -10, 1, 5, 7, 9 },
+	{ -2, -5, -8, -10, 1, 4, 7, 9 },
+	{ -2, -4, -8, -10, 1, 3, 7, 9 },
+	{ -2, -5, -7, -10, 1, 4, 6, 9 },
+	{ -3, -4, -7, -10, 2, 3, 6, 9 },
+	{ -1, -2, -3, -10, 0, 1, 2, 9 },
+	{ -4, -6, -8, -9, 3, 5, 7, 8 },
+	{ -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+static uint8_t Ktx_clamp(int value) {
+	return uint8_t(std::min(std::max(value, 0), 255));
+}
+
+static uint64_t Ktx_readBigEndian(const uint8_t *block) {
+	uint64_t ret = 0;
+	for (int i = 0; i < 8; ++ i) {
+		ret = (ret << 8) | block[i];
+	}
+	return ret;
+}
+
+// ETC2 RGB block, `punchthrough` for RGB8A1 format
+static void Ktx_decodeEtc2Color(const uint8_t *block, uint8_t *out, bool punchthrough) {
+	auto bits = Ktx_readBigEndian(block);
+	auto get = [&] (uint32_t offset, uint32_t count) -> int {
+		return int((bits >> offset) & ((uint64_t(1) << count) - 1));
+	};
+
+	auto ext4 = [] (int v) { return (v << 4) | v; };
+	auto ext5 = [] (int v) { return (v << 3) | (v >> 2); };
+	auto ext6 = [] (int v) { return (v << 2) | (v >> 4); };
+	auto ext7 = [] (int v) { return (v << 1) | (v >> 6); };
+
+	auto diff = get(33, 1);
+	auto flip = get(32, 1);
+	bool opaque = !punchthrough || diff;
+
+	auto writeTexel = [&] (uint32_t x, uint32_t y, int r, int g, int b, int a) {
+		auto t = out + (y * 4 + x) * 4;
+		t[0] = Ktx_clamp(r); t[1] = Ktx_clamp(g); t[2] = Ktx_clamp(b); t[3] = Ktx_clamp(a);
+	};
+
+	// pixel indexes are stored column by column
+	auto getIndex = [&] (uint32_t x, uint32_t y) {
+		auto p = x * 4 + y;
+		return int(((bits >> (16 + p)) & 1) << 1 | ((bits >> p) & 1));
+	};
+
+	auto writePaint = [&] (const int paint[4][3]) {
+		for (uint32_t x = 0; x < 4; ++ x) {
+			for (uint32_t y = 0; y < 4; ++ y) {
+				auto idx = getIndex(x, y);
+				if (!opaque && idx == 2) {
+					writeTexel(x, y, 0, 0, 0, 0);
+				} else {
+					writeTexel(x, y, paint[idx][0], paint[idx][1], paint[idx][2], 255);
+				}
+			}
+		}
+	};
+
+	int base[2][3];
+	if (!punchthrough && !diff) {
+		// individual mode
+		base[0][0] = ext4(get(60, 4)); base[1][0] = ext4(get(56, 4));
+		base[0][1] = ext4(get(52, 4)); base[1][1] = ext4(get(48, 4));
+		base[0][2] = ext4(get(44, 4)); base[1][2] = ext4(get(40, 4));
+	} else {
+		int r = get(59, 5), g = get(51, 5), b = get(43, 5);
+		auto sext3 = [] (int v) { return (v & 4) ? v - 8 : v; };
+		int r2 = r + sext3(get(56, 3)), g2 = g + sext3(get(48, 3)), b2 = b + sext3(get(40, 3));
+
+		if (r2 < 0 || r2 > 31) {
+			// T mode
+			int c0[3] = { ext4((get(59, 2) << 2) | get(56, 2)), ext4(get(52, 4)), ext4(get(48, 4)) };
+			int c1[3] = { ext4(get(44, 4)), ext4(get(40, 4)), ext4(get(36, 4)) };
+			auto d = Ktx_EtcDistances[(get(34, 2) << 1) | get(32, 1)];
+
+			int paint[4][3] = {
+				{ c0[0], c0[1], c0[2] },
+				{ c1[0] + d, c1[1] + d, c1[2] + d },
+				{ c1[0], c1[1], c1[2] },
+				{ c1[0] - d, c1[1] - d, c1[2] - d }
+			};
+			writePaint(paint);
+			return;
+		} else if (g2 < 0 || g2 > 31) {
+			// H mode
+			int r0 = get(59, 4), g0 = (get(56, 3) << 1) | get(52, 1), b0 = (get(51, 1) << 3) | get(47, 3);
+			int r1 = get(43, 4), g1 = get(39, 4), b1 = get(35, 4);
+			int v0 = (r0 << 8) | (g0 << 4) | b0;
+			int v1 = (r1 << 8) | (g1 << 4) | b1;
+			auto d = Ktx_EtcDistances[(get(34, 1) << 2) | (get(32, 1) << 1) | (v0 >= v1 ? 1 : 0)];
+
+			int c0[3] = { ext4(r0), ext4(g0), ext4(b0) };
+			int c1[3] = { ext4(r1), ext4(g1), ext4(b1) };
+			int paint[4][3] = {
+				{ c0[0] + d, c0[1] + d, c0[2] + d },
+				{ c0[0] - d, c0[1] - d, c0[2] - d },
+				{ c1[0] + d, c1[1] + d, c1[2] + d },
+				{ c1[0] - d, c1[1] - d, c1[2] - d }
+			};
+			writePaint(paint);
+			return;
+		} else if (b2 < 0 || b2 > 31) {
+			// planar mode
+			int o[3] = {
+				ext6(get(57, 6)),
+				ext7((get(56, 1) << 6) | get(49, 6)),
+				ext6((get(48, 1) << 5) | (get(43, 2) << 3) | get(39, 3))
+			};
+			int h[3] = { ext6((get(34, 5) << 1) | get(32, 1)), ext7(get(25, 7)), ext6(get(19, 6)) };
+			int v[3] = { ext6(get(13, 6)), ext7(get(6, 7)), ext6(get(0, 6)) };
+
+			for (int x = 0; x < 4; ++ x) {
+				for (int y = 0; y < 4; ++ y) {
+					int c[3];
+					for (int i = 0; i < 3; ++ i) {
+						c[i] = (x * (h[i] - o[i]) + y * (v[i] - o[i]) + 4 * o[i] + 2) >> 2;
+					}
+					writeTexel(x, y, c[0], c[1], c[2], 255);
+				}
+			}
+			return;
+		}
+
+		base[0][0] = ext5(r); base[1][0] = ext5(r2);
+		base[0][1] = ext5(g); base[1][1] = ext5(g2);
+		base[0][2] = ext5(b); base[1][2] = ext5(b2);
+	}
+
+	int tables[2] = { get(37, 3), get(34, 3) };
+
+	for (uint32_t x = 0; x < 4; ++ x) {
+		for (uint32_t y = 0; y < 4; ++ y) {
+			auto sub = flip ? (y >= 2 ? 1 : 0) : (x >= 2 ? 1 : 0);
+			auto idx = getIndex(x, y);
+			auto &mod = Ktx_EtcModifiers[tables[sub]];
+
+			int m = 0;
+			switch (idx) {
+			case 0: m = opaque ? mod[0] : 0; break;
+			case 1: m = mod[1]; break;
+			case 2: m = -mod[0]; break;
+			case 3: m = -mod[1]; break;
+			}
+
+			if (!opaque && idx == 2) {
+				writeTexel(x, y, 0, 0, 0, 0);
+			} else {
+				writeTexel(x, y, base[sub][0] + m, base[sub][1] + m, base[sub][2] + m, 255);
+			}
+		}
+	}
+}
+
+static void Ktx_decodeEacAlpha(const uint8_t *block, uint8_t *out) {
+	auto bits = Ktx_readBigEndian(block);
+	int base = int(bits >> 56);
+	int mul = int((bits >> 52) & 0xF);
+	auto &mod = Ktx_EacModifiers[(bits >> 48) & 0xF];
+
+	for (uint32_t x = 0; x < 4; ++ x) {
+		for (uint32_t y = 0; y < 4; ++ y) {
+			auto p = x * 4 + y;
+			auto idx = (bits >> (45 - p * 3)) & 7;
+			out[(y * 4 + x) * 4 + 3] = Ktx_clamp(base + mod[idx] * mul);
+		}
+	}
+}
+
+static void Ktx_decodeBlock(ImageFormat fmt, const uint8_t *block, uint8_t *out) {
+	switch (fmt) {
+	case ImageFormat::BC1_RGB_UNORM_BLOCK:
+	case ImageFormat::BC1_RGB_SRGB_BLOCK:
+		Ktx_decodeBc1Color(block, out, false, false);
+		break;
+	case ImageFormat::BC1_RGBA_UNORM_BLOCK:
+	case ImageFormat::BC1_RGBA_SRGB_BLOCK:
+		Ktx_decodeBc1Color(block, out, true, false);
+		break;
+	case ImageFormat::BC2_UNORM_BLOCK:
+	case ImageFormat::BC2_SRGB_BLOCK:
+		Ktx_decodeBc1Color(block + 8, out, false, true);
+		for (uint32_t i = 0; i < 16; ++ i) {
+			auto a = (block[i / 2] >> ((i % 2) * 4)) & 0xF;
+			out[i * 4 + 3] = uint8_t((a << 4) | a);
+		}
+		break;
+	case ImageFormat::BC3_UNORM_BLOCK:
+	case ImageFormat::BC3_SRGB_BLOCK:
+		Ktx_decodeBc1Color(block + 8, out, false, true);
+		Ktx_decodeBc4Channel(block, out + 3, 4);
+		break;
+	case ImageFormat::BC4_UNORM_BLOCK:
+		Ktx_decodeBc4Channel(block, out, 1);
+		break;
+	case ImageFormat::BC5_UNORM_BLOCK:
+		Ktx_decodeBc4Channel(block, out, 2);
+		Ktx_decodeBc4Channel(block + 8, out + 1, 2);
+		break;
+	case ImageFormat::ETC2_R8G8B8_UNORM_BLOCK:
+	case ImageFormat::ETC2_R8G8B8_SRGB_BLOCK:
+		Ktx_decodeEtc2Color(block, out, false);
+		break;
+	case ImageFormat::ETC2_R8G8B8A1_UNORM_BLOCK:
+	case ImageFormat::ETC2_R8G8B8A1_SRGB_BLOCK:
+		Ktx_decodeEtc2Color(block, out, true);
+		break;
+	case ImageFormat::ETC2_R8G8B8A8_UNORM_BLOCK:
+	case ImageFormat::ETC2_R8G8B8A8_SRGB_BLOCK:
+		Ktx_decodeEtc2Color(block + 8, out, false);
+		Ktx_decodeEacAlpha(block, out);
+		break;
+	default:
+		break;
+	}
+}
+
+bool transcodeImage(ImageFormat fmt, const Extent3 &extent, uint32_t levels, uint32_t layers, BytesView source, uint8_t *target, uint64_t size) {
+	auto targetFormat = getTranscodeFormat(fmt);
+	if (targetFormat == ImageFormat::Undefined) {
+		log::vtext("gl::Ktx", "Transcoding is not supported for ", getImageFormatName(fmt));
+		return false;
+	}
+
+	if (source.size() < getImageDataSize(fmt, extent, levels, layers) || size < getImageDataSize(targetFormat, extent, levels, layers)) {
+		log::vtext("gl::Ktx", "Not enough data to transcode image");
+		return false;
+	}
+
+	auto blockSize = getFormatBlockSize(fmt);
+	auto channels = getFormatBlockSize(targetFormat);
+
+	auto sourcePtr = source.data();
+	uint8_t texels[16 * 4];
+
+	for (uint32_t level = 0; level < levels; ++ level) {
+		auto e = getImageLevelExtent(extent, level);
+		auto blocksX = (e.width + 3) / 4;
+		auto blocksY = (e.height + 3) / 4;
+		auto rowSize = e.width * channels;
+
+		// depth slices and array layers are stored one after another for each level
+		for (uint32_t slice = 0; slice < e.depth * layers; ++ slice) {
+			for (uint32_t by = 0; by < blocksY; ++ by) {
+				for (uint32_t bx = 0; bx < blocksX; ++ bx) {
+					Ktx_decodeBlock(fmt, sourcePtr, texels);
+					sourcePtr += blockSize;
+
+					for (uint32_t y = 0; y < 4 && by * 4 + y < e.height; ++ y) {
+						auto w = std::min(uint32_t(4), e.width - bx * 4);
+						memcpy(target + (by * 4 + y) * rowSize + bx * 4 * channels, texels + y * 4 * channels, w * channels);
+					}
+				}
+			}
+			target += rowSize * e.height;
+		}
+	}
+
+	return true;
+}
+
+}
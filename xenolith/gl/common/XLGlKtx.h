@@ -0,0 +1,76 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef XENOLITH_GL_COMMON_XLGLKTX_H_
+#define XENOLITH_GL_COMMON_XLGLKTX_H_
+
+#include "XLGl.h"
+
+namespace stappler::xenolith::gl {
+
+struct KtxLevel {
+	uint64_t offset = 0;
+	uint64_t size = 0;
+};
+
+// KTX2 container description, https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+// Only non-supercompressed containers with defined VkFormat are supported
+struct KtxInfo {
+	static constexpr size_t HeaderSize = 80;
+	static constexpr size_t LevelIndexSize = 24;
+
+	ImageFormat format = ImageFormat::Undefined;
+	ImageType type = ImageType::Image2D;
+	Extent3 extent = Extent3(1, 1, 1);
+	uint32_t levels = 1;
+	uint32_t layers = 1; // array layers multiplied by faces
+	uint32_t faces = 1;
+	uint32_t supercompression = 0;
+	bool generateMipmaps = false; // levelCount in container is 0, mipmaps should be generated on load
+	Vector<KtxLevel> index;
+
+	// size of data for all levels, repacked for upload
+	uint64_t getDataSize() const;
+
+	// image info, that can be used with Resource::Builder
+	ImageInfo getImageInfo(ImageInfo &&) const;
+};
+
+bool isKtx2(BytesView);
+
+// read header and level index, size of data required is HeaderSize + LevelIndexSize * levels
+bool readKtxInfo(BytesView, KtxInfo &);
+
+// copy levels from container into target buffer in upload order (level 0 first)
+bool readKtxData(BytesView, const KtxInfo &, uint8_t *target, uint64_t size);
+
+// CPU fallback for block-compressed formats, that are not supported by device
+// BC1-BC5 and ETC2/EAC RGB(A) formats can be transcoded
+bool isTranscodeSupported(ImageFormat);
+ImageFormat getTranscodeFormat(ImageFormat);
+
+// transcode `levels` mip levels with `layers` array layers into uncompressed format from getTranscodeFormat
+bool transcodeImage(ImageFormat, const Extent3 &, uint32_t levels, uint32_t layers, BytesView source, uint8_t *target, uint64_t size);
+
+}
+
+#endif /* XENOLITH_GL_COMMON_XLGLKTX_H_ */
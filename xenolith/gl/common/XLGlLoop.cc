@@ -38,4 +38,111 @@ bool Loop::init(Application *app, Instance *gl) {
 	return true;
 }
 
+MemoryStat Loop::getMemoryStat() const {
+	std::unique_lock<Mutex> lock(_memoryMutex);
+	return _memoryStat;
+}
+
+Vector<MemoryPoolStat> Loop::getMemoryPoolStat() const {
+	std::unique_lock<Mutex> lock(_memoryMutex);
+	return _memoryPoolStat;
+}
+
+void Loop::setMemoryBudgetOverride(uint64_t value) {
+	_memoryBudgetOverride = value;
+}
+
+void Loop::setMemoryPressureThreshold(float value) {
+	_memoryPressureThreshold = value;
+}
+
+void Loop::setGpuTimestampsEnabled(bool value) {
+	_gpuTimestamps = value;
+}
+
+Vector<PassTimeStat> Loop::getPassTimeStat() const {
+	Vector<PassTimeStat> ret;
+	std::unique_lock<Mutex> lock(_passTimeMutex);
+	ret.reserve(_passTime.size());
+	for (auto &it : _passTime) {
+		ret.emplace_back(it.second.stat);
+	}
+	return ret;
+}
+
+void Loop::pushPassTime(StringView pass, uint64_t value) {
+	auto name = pass.str<Interface>();
+
+	std::unique_lock<Mutex> lock(_passTimeMutex);
+	auto it = _passTime.find(name);
+	if (it == _passTime.end()) {
+		it = _passTime.emplace(name, PassTimeData()).first;
+		it->second.stat.name = name;
+	}
+
+	it->second.average.addValue(value);
+	it->second.stat.last = value;
+	it->second.stat.average = it->second.average.getAverage(true);
+	++ it->second.stat.samples;
+}
+
+FrameCacheStat Loop::getFrameCacheStat() const {
+	std::unique_lock<Mutex> lock(_frameCacheMutex);
+	return _frameCacheStat;
+}
+
+FrameCacheStat Loop::getFrameCacheFrameStat() const {
+	std::unique_lock<Mutex> lock(_frameCacheMutex);
+	return _frameCacheFrameStat;
+}
+
+void Loop::updateFrameCacheStat(const FrameCacheStat &stat, const FrameCacheStat &frame) {
+	std::unique_lock<Mutex> lock(_frameCacheMutex);
+	_frameCacheStat = stat;
+	_frameCacheFrameStat = frame;
+}
+
+void Loop::updateMemoryPoolStat(Vector<MemoryPoolStat> &&stat) {
+	std::unique_lock<Mutex> lock(_memoryMutex);
+	_memoryPoolStat = move(stat);
+}
+
+void Loop::updateMemoryStat(MemoryStat &&stat) {
+	// interval between pressure notifications, eviction results should be visible in next budget query
+	static constexpr uint64_t PressureInterval = 500'000;
+
+	if (auto budget = _memoryBudgetOverride.load()) {
+		for (uint32_t i = 0; i < stat.heapCount; ++ i) {
+			if (stat.heaps[i].deviceLocal) {
+				stat.heaps[i].budget = budget;
+			}
+		}
+	}
+
+	do {
+		std::unique_lock<Mutex> lock(_memoryMutex);
+		_memoryStat = stat;
+	} while (0);
+
+	auto pressure = stat.getDevicePressure();
+	if (pressure < _memoryPressureThreshold.load()) {
+		return;
+	}
+
+	auto now = platform::device::_clock(platform::device::ClockType::Monotonic);
+	if (now - _memoryPressureTime < PressureInterval) {
+		return;
+	}
+
+	_memoryPressureTime = now;
+
+	if (_frameCache) {
+		_frameCache->trim();
+	}
+
+	_application->performOnMainThread([app = _application, stat] {
+		app->onMemoryPressure(stat);
+	}, nullptr, false);
+}
+
 }
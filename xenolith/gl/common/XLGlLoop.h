@@ -28,6 +28,7 @@
 #include "XLGlMaterial.h"
 #include "XLResourceCache.h"
 #include "XLRenderQueueFrameCache.h"
+#include "SPMovingAverage.h"
 
 namespace stappler::xenolith::gl {
 
@@ -41,6 +42,7 @@ public:
 	using PassData = renderqueue::PassData;
 	using ImageAttachment = renderqueue::ImageAttachment;
 	using AttachmentHandle = renderqueue::AttachmentHandle;
+	using FrameAttachmentData = renderqueue::FrameAttachmentData;
 	using DependencyEvent = renderqueue::DependencyEvent;
 
 	static constexpr uint32_t LoopThreadId = 2;
@@ -90,6 +92,10 @@ public:
 	virtual Rc<ImageStorage> acquireImage(const ImageAttachment *, const AttachmentHandle *, Extent3 e) = 0;
 	virtual void releaseImage(Rc<ImageStorage> &&) = 0;
 
+	// acquire images with shared memory for attachments within the same alias group
+	virtual Vector<Rc<ImageStorage>> acquireAliasedImages(SpanView<const FrameAttachmentData *>) = 0;
+	virtual void releaseAliasedImages(Vector<Rc<ImageStorage>> &&) = 0;
+
 	virtual Rc<Semaphore> makeSemaphore() = 0;
 
 	virtual void addView(ViewInfo &&) = 0;
@@ -105,12 +111,65 @@ public:
 	virtual void wakeup() = 0;
 	virtual void waitIdle() = 0;
 
+	// last published snapshot of device memory budget
+	MemoryStat getMemoryStat() const;
+
+	// suballocation state of frame memory pools storage, updated by gl loop
+	Vector<MemoryPoolStat> getMemoryPoolStat() const;
+
+	// pins device local heaps budget to specified value (0 - use driver's budget), useful to test eviction
+	void setMemoryBudgetOverride(uint64_t);
+	uint64_t getMemoryBudgetOverride() const { return _memoryBudgetOverride.load(); }
+
+	// when usage to budget ratio exceeds threshold, loop drops its caches and asks application to evict resources
+	void setMemoryPressureThreshold(float);
+	float getMemoryPressureThreshold() const { return _memoryPressureThreshold.load(); }
+
+	// write timestamp queries around every queue pass submission (disabled by default)
+	void setGpuTimestampsEnabled(bool);
+	bool isGpuTimestampsEnabled() const { return _gpuTimestamps.load(); }
+
+	// rolling averages of GPU time for each pass, that was measured
+	Vector<PassTimeStat> getPassTimeStat() const;
+
+	// called when pass time is resolved from timestamp queries
+	void pushPassTime(StringView pass, uint64_t);
+
+	// frame cache counters since cache creation, and for last loop iteration with any cache activity
+	FrameCacheStat getFrameCacheStat() const;
+	FrameCacheStat getFrameCacheFrameStat() const;
+
 protected:
+	// should be called from GL thread
+	void updateMemoryStat(MemoryStat &&);
+	void updateMemoryPoolStat(Vector<MemoryPoolStat> &&);
+	void updateFrameCacheStat(const FrameCacheStat &, const FrameCacheStat &frame);
+
 	std::atomic_flag _shouldExit;
 	Rc<ResourceCache> _resourceCache;
 	Application *_application = nullptr;
 	Rc<Instance> _glInstance;
 	Rc<FrameCache> _frameCache;
+
+	mutable Mutex _memoryMutex;
+	MemoryStat _memoryStat;
+	Vector<MemoryPoolStat> _memoryPoolStat;
+	std::atomic<uint64_t> _memoryBudgetOverride = 0;
+	std::atomic<float> _memoryPressureThreshold = 0.9f;
+	uint64_t _memoryPressureTime = 0;
+
+	struct PassTimeData {
+		PassTimeStat stat;
+		math::MovingAverage<20, uint64_t> average;
+	};
+
+	mutable Mutex _frameCacheMutex;
+	FrameCacheStat _frameCacheStat;
+	FrameCacheStat _frameCacheFrameStat;
+
+	std::atomic<bool> _gpuTimestamps = false;
+	mutable Mutex _passTimeMutex;
+	Map<String, PassTimeData> _passTime;
 };
 
 }
@@ -313,7 +313,8 @@ void MaterialSet::emplaceMaterialImages(Material *oldMaterial, Material *newMate
 	// find unique images
 	uint32_t imageIdx = 0;
 	for (auto &it : newImages) {
-		it.info = it.image->getViewInfo(it.info);
+		// compiled image can differ from source data in format and mip levels
+		it.info = it.image->image ? it.image->image->getViewInfo(it.info) : it.image->getViewInfo(it.info);
 
 		bool isAlias = false;
 		for (auto &uit : uniqueImages) {
@@ -79,6 +79,7 @@ public:
 	uint32_t getObjectSize() const { return _objectSize; }
 	uint32_t getImagesInSet() const { return _imagesInSet; }
 	uint64_t getGeneration() const { return _generation; }
+	const MaterialAttachment *getOwner() const { return _owner; }
 	const std::unordered_map<MaterialId, Rc<Material>> &getMaterials() const { return _materials; }
 
 	void setBuffer(Rc<BufferObject> &&, std::unordered_map<MaterialId, uint32_t> &&);
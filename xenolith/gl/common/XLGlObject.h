@@ -344,7 +344,9 @@ public:
 protected:
 	uint32_t _count = 0;
 	Vector<uint64_t> _layoutIndexes;
-	Vector<BufferObject *> _layoutBuffers;
+
+	// written buffers are retained, so, buffer address can not be reused while set remembers it
+	Vector<Rc<BufferObject>> _layoutBuffers;
 };
 
 class Semaphore : public gl::Object {
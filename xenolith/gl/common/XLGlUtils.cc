@@ -616,6 +616,17 @@ String BufferInfo::description() const {
 	return stream.str();
 }
 
+size_t ImageInfoData::hash() const {
+	// hash fields one by one, struct padding is not guaranteed to be zeroed
+	std::array<uint32_t, 13> data = {
+		uint32_t(format), uint32_t(flags), uint32_t(imageType),
+		extent.width, extent.height, extent.depth,
+		mipLevels.get(), arrayLayers.get(), uint32_t(samples), uint32_t(tiling), uint32_t(usage),
+		uint32_t(type), uint32_t(hints)
+	};
+	return hash::hashSize((const char *)data.data(), data.size() * sizeof(uint32_t));
+}
+
 bool ImageInfo::isCompatible(const ImageInfo &img) const {
 	if (img.format == format && img.flags == flags && img.imageType == imageType && img.mipLevels == img.mipLevels
 			&& img.arrayLayers == arrayLayers && img.samples == samples && img.tiling == tiling && img.usage == usage) {
@@ -868,6 +879,67 @@ String ImageViewInfo::description() const {
 	return stream.str();
 }
 
+Extent2 getFormatBlockExtent(ImageFormat format) {
+	switch (format) {
+	case ImageFormat::ASTC_4x4_UNORM_BLOCK: case ImageFormat::ASTC_4x4_SRGB_BLOCK: return Extent2(4, 4); break;
+	case ImageFormat::ASTC_5x4_UNORM_BLOCK: case ImageFormat::ASTC_5x4_SRGB_BLOCK: return Extent2(5, 4); break;
+	case ImageFormat::ASTC_5x5_UNORM_BLOCK: case ImageFormat::ASTC_5x5_SRGB_BLOCK: return Extent2(5, 5); break;
+	case ImageFormat::ASTC_6x5_UNORM_BLOCK: case ImageFormat::ASTC_6x5_SRGB_BLOCK: return Extent2(6, 5); break;
+	case ImageFormat::ASTC_6x6_UNORM_BLOCK: case ImageFormat::ASTC_6x6_SRGB_BLOCK: return Extent2(6, 6); break;
+	case ImageFormat::ASTC_8x5_UNORM_BLOCK: case ImageFormat::ASTC_8x5_SRGB_BLOCK: return Extent2(8, 5); break;
+	case ImageFormat::ASTC_8x6_UNORM_BLOCK: case ImageFormat::ASTC_8x6_SRGB_BLOCK: return Extent2(8, 6); break;
+	case ImageFormat::ASTC_8x8_UNORM_BLOCK: case ImageFormat::ASTC_8x8_SRGB_BLOCK: return Extent2(8, 8); break;
+	case ImageFormat::ASTC_10x5_UNORM_BLOCK: case ImageFormat::ASTC_10x5_SRGB_BLOCK: return Extent2(10, 5); break;
+	case ImageFormat::ASTC_10x6_UNORM_BLOCK: case ImageFormat::ASTC_10x6_SRGB_BLOCK: return Extent2(10, 6); break;
+	case ImageFormat::ASTC_10x8_UNORM_BLOCK: case ImageFormat::ASTC_10x8_SRGB_BLOCK: return Extent2(10, 8); break;
+	case ImageFormat::ASTC_10x10_UNORM_BLOCK: case ImageFormat::ASTC_10x10_SRGB_BLOCK: return Extent2(10, 10); break;
+	case ImageFormat::ASTC_12x10_UNORM_BLOCK: case ImageFormat::ASTC_12x10_SRGB_BLOCK: return Extent2(12, 10); break;
+	case ImageFormat::ASTC_12x12_UNORM_BLOCK: case ImageFormat::ASTC_12x12_SRGB_BLOCK: return Extent2(12, 12); break;
+	default:
+		if (toInt(format) >= toInt(ImageFormat::BC1_RGB_UNORM_BLOCK) && toInt(format) <= toInt(ImageFormat::EAC_R11G11_SNORM_BLOCK)) {
+			// BCn, ETC2 and EAC
+			return Extent2(4, 4);
+		}
+		break;
+	}
+	return Extent2(1, 1);
+}
+
+bool isCompressedFormat(ImageFormat format) {
+	auto e = getFormatBlockExtent(format);
+	return e.width > 1 || e.height > 1;
+}
+
+Extent3 getImageLevelExtent(const Extent3 &extent, uint32_t level) {
+	return Extent3(std::max(extent.width >> level, uint32_t(1)), std::max(extent.height >> level, uint32_t(1)),
+			std::max(extent.depth >> level, uint32_t(1)));
+}
+
+uint64_t getImageLevelSize(ImageFormat format, const Extent3 &extent, uint32_t level, uint32_t layers) {
+	auto block = getFormatBlockExtent(format);
+	auto e = getImageLevelExtent(extent, level);
+	return uint64_t((e.width + block.width - 1) / block.width) * uint64_t((e.height + block.height - 1) / block.height)
+			* uint64_t(e.depth) * uint64_t(layers) * getFormatBlockSize(format);
+}
+
+uint64_t getImageDataSize(ImageFormat format, const Extent3 &extent, uint32_t levels, uint32_t layers) {
+	uint64_t ret = 0;
+	for (uint32_t i = 0; i < levels; ++ i) {
+		ret += getImageLevelSize(format, extent, i, layers);
+	}
+	return ret;
+}
+
+uint32_t getMaxMipLevels(const Extent3 &extent) {
+	auto size = std::max(std::max(extent.width, extent.height), extent.depth);
+	uint32_t levels = 1;
+	while (size > 1) {
+		size >>= 1;
+		++ levels;
+	}
+	return levels;
+}
+
 size_t getFormatBlockSize(ImageFormat format) {
 	switch (format) {
 	case ImageFormat::Undefined: return 0; break;
@@ -96,7 +96,8 @@ void View::performOnThread(Function<void()> &&func, Ref *target, bool immediate)
 }
 
 void View::handleInputEvent(const InputEventData &event) {
-	_loop->getApplication()->performOnMainThread([this, event = event] () mutable {
+	auto t = platform::device::_clock(platform::device::ClockType::Monotonic);
+	_loop->getApplication()->performOnMainThread([this, t, event = event] () mutable {
 		if (event.isPointEvent()) {
 			event.point.density = _constraints.density;
 		}
@@ -114,6 +115,9 @@ void View::handleInputEvent(const InputEventData &event) {
 			onFocus(this, _hasFocus);
 			break;
 		default:
+			if (!_inputTime) {
+				_inputTime = t;
+			}
 			break;
 		}
 		_director->getInputDispatcher()->handleInputEvent(event);
@@ -122,7 +126,8 @@ void View::handleInputEvent(const InputEventData &event) {
 }
 
 void View::handleInputEvents(Vector<InputEventData> &&events) {
-	_loop->getApplication()->performOnMainThread([this, events = move(events)] () mutable {
+	auto t = platform::device::_clock(platform::device::ClockType::Monotonic);
+	_loop->getApplication()->performOnMainThread([this, t, events = move(events)] () mutable {
 		for (auto &event : events) {
 			if (event.isPointEvent()) {
 				event.point.density = _constraints.density;
@@ -141,6 +146,9 @@ void View::handleInputEvents(Vector<InputEventData> &&events) {
 				onFocus(this, _hasFocus);
 				break;
 			default:
+				if (!_inputTime) {
+					_inputTime = t;
+				}
 				break;
 			}
 			_director->getInputDispatcher()->handleInputEvent(event);
@@ -202,6 +210,14 @@ uint64_t View::getAvgFenceTime() const {
 	return _frameEmitter->getAvgFenceTime();
 }
 
+uint64_t View::getLastInputLatency() const {
+	return _lastInputLatency;
+}
+
+uint64_t View::getAvgInputLatency() const {
+	return _avgInputLatencyValue;
+}
+
 uint64_t View::getFrameInterval() const {
 	std::unique_lock<Mutex> lock(_frameIntervalMutex);
 	return _frameInterval;
@@ -239,4 +255,15 @@ void View::setDecorationVisible(bool) {
 
 }
 
+void View::updateInputLatency(uint64_t inputTime, uint64_t presentTime) {
+	if (!inputTime || presentTime < inputTime) {
+		return;
+	}
+
+	auto dt = presentTime - inputTime;
+	_lastInputLatency = dt;
+	_avgInputLatency.addValue(dt);
+	_avgInputLatencyValue = _avgInputLatency.getAverage(true);
+}
+
 }
@@ -116,6 +116,10 @@ public:
 
 	uint64_t getAvgFenceTime() const;
 
+	// time between first input event, handled within frame, and presentation of this frame
+	uint64_t getLastInputLatency() const;
+	uint64_t getAvgInputLatency() const;
+
 	const FrameContraints & getFrameContraints() const { return _constraints; }
 	ScreenOrientation getScreenOrientation() const { return _orientation; }
 
@@ -138,6 +142,9 @@ public:
 protected:
 	virtual void wakeup() = 0;
 
+	// should be called from view's thread, when frame with input, sampled at inputTime, was presented
+	void updateInputLatency(uint64_t inputTime, uint64_t presentTime);
+
 	FrameContraints _constraints;
 	ScreenOrientation _orientation = ScreenOrientation::Landscape;
 
@@ -174,6 +181,11 @@ protected:
 	math::MovingAverage<20, uint64_t> _avgFrameInterval;
 	std::atomic<uint64_t> _avgFrameIntervalValue = 0;
 	uint64_t _backButtonCounter = 0;
+
+	uint64_t _inputTime = 0; // first input event, that was not sampled by frame yet, main thread only
+	std::atomic<uint64_t> _lastInputLatency = 0;
+	math::MovingAverage<20, uint64_t> _avgInputLatency;
+	std::atomic<uint64_t> _avgInputLatencyValue = 0;
 };
 
 }
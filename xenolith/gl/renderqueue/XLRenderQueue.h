@@ -238,6 +238,10 @@ struct AttachmentData : NamedMem {
 	AttachmentUsage usage = AttachmentUsage::None;
 	memory::vector<AttachmentPassData *> passes;
 	Rc<Attachment> attachment;
+
+	// attachments within the same group have disjoint lifetimes in frame and share device memory
+	// (assigned by implementation's queue compiler, maxOf<uint32_t>() if attachment has its own memory)
+	uint32_t aliasGroup = maxOf<uint32_t>();
 };
 
 struct DescriptorSetData : NamedMem {
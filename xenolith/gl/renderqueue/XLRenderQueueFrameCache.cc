@@ -29,6 +29,11 @@
 
 namespace stappler::xenolith::renderqueue {
 
+static size_t FrameCache_getImageSize(const gl::ImageInfoData &info) {
+	auto samples = std::max(uint32_t(info.samples), uint32_t(1));
+	return gl::getImageDataSize(info.format, info.extent, info.mipLevels.get(), info.arrayLayers.get()) * samples;
+}
+
 FrameCache::~FrameCache() { }
 
 bool FrameCache::init(gl::Loop &loop, gl::Device &dev) {
@@ -42,59 +47,62 @@ void FrameCache::invalidate() {
 	_imageViews.clear();
 	_renderPasses.clear();
 	_images.clear();
+	_aliasedImages.clear();
+	_usage = 0;
 }
 
 Rc<gl::Framebuffer> FrameCache::acquireFramebuffer(const PassData *data, SpanView<Rc<gl::ImageView>> views, Extent2 e) {
-	Vector<uint64_t> ids; ids.reserve(views.size() + 2);
-	ids.emplace_back(data->impl->getIndex());
-	for (auto &it : views) {
-		ids.emplace_back(it->getIndex());
-	}
-	ids.emplace_back(uint64_t(e.width) << uint64_t(32) | uint64_t(e.height));
+	auto hash = makeFramebufferKey(data->impl->getIndex(), views, e);
 
-	auto it = _framebuffers.find(ids);
-	if (it != _framebuffers.end()) {
+	auto it = _framebuffers.find(hash);
+	if (it != _framebuffers.end() && it->second.ids == _framebufferKey) {
+		it->second.access = _time;
 		if (!it->second.framebuffers.empty()) {
-			auto fb = it->second.framebuffers.back();
+			auto fb = move(it->second.framebuffers.back());
 			it->second.framebuffers.pop_back();
+			onHit();
 			return fb;
 		}
 	}
 
+	onMiss();
 	return _device->makeFramebuffer(data, views, e);
 }
 
 void FrameCache::releaseFramebuffer(Rc<gl::Framebuffer> &&fb) {
-	auto e = fb->getExtent();
-	Vector<uint64_t> ids; ids.reserve(fb->getViewIds().size() + 2);
-	ids.emplace_back(fb->getRenderPass()->getIndex());
-	for (auto &it : fb->getViewIds()) {
-		ids.emplace_back(it);
-	}
-	ids.emplace_back(uint64_t(e.width) << uint64_t(32) | uint64_t(e.height));
-
-	if (isReachable(SpanView<uint64_t>(ids))) {
-		auto it = _framebuffers.find(ids);
-		if (it == _framebuffers.end()) {
-			_framebuffers.emplace(move(ids), FrameCacheFramebuffer{ Vector<Rc<gl::Framebuffer>>{move(fb)}, e });
-		} else {
-			it->second.framebuffers.emplace_back(move(fb));
-		}
+	auto hash = makeFramebufferKey(*fb);
+
+	if (!isReachable(SpanView<uint64_t>(_framebufferKey))) {
+		return;
 	}
+
+	auto it = _framebuffers.find(hash);
+	if (it == _framebuffers.end()) {
+		auto e = fb->getExtent();
+		_framebuffers.emplace(hash, FrameCacheFramebuffer{ _framebufferKey, Vector<Rc<gl::Framebuffer>>{move(fb)}, e, _time });
+	} else if (it->second.ids == _framebufferKey) {
+		it->second.framebuffers.emplace_back(move(fb));
+		it->second.access = _time;
+	}
+	// on hash collision framebuffer is not cached
 }
 
 Rc<ImageStorage> FrameCache::acquireImage(const gl::ImageInfo &info, SpanView<gl::ImageViewInfo> v) {
 	auto imageIt = _images.find(info);
 	if (imageIt != _images.end()) {
+		imageIt->second.access = _time;
 		if (!imageIt->second.images.empty()) {
 			auto ret = move(imageIt->second.images.back());
 			imageIt->second.images.pop_back();
+			_usage -= imageIt->second.size;
 			ret->rearmSemaphores(*_loop);
 			makeViews(ret, v);
+			onHit();
 			return ret;
 		}
 	}
 
+	onMiss();
 	auto ret = _device->makeImage(info);
 	ret->rearmSemaphores(*_loop);
 	makeViews(ret, v);
@@ -115,12 +123,66 @@ void FrameCache::releaseImage(Rc<ImageStorage> &&img) {
 	}
 
 	imageIt->second.images.emplace_back(move(img));
+	imageIt->second.access = _time;
+	_usage += imageIt->second.size;
+
+	if (_usage > _budget) {
+		evictImages(_budget);
+	}
+}
+
+Vector<Rc<ImageStorage>> FrameCache::acquireAliasedImages(SpanView<gl::ImageInfo> infos, SpanView<Vector<gl::ImageViewInfo>> v) {
+	Vector<ImageInfoData> key; key.reserve(infos.size());
+	for (auto &it : infos) {
+		key.emplace_back(it);
+	}
+
+	Vector<Rc<ImageStorage>> ret;
+
+	auto imagesIt = _aliasedImages.find(key);
+	if (imagesIt != _aliasedImages.end() && !imagesIt->second.sets.empty()) {
+		ret = move(imagesIt->second.sets.back());
+		imagesIt->second.sets.pop_back();
+		imagesIt->second.access = _time;
+		onHit();
+	} else {
+		onMiss();
+		ret = _device->makeAliasedImages(infos);
+		if (ret.size() != infos.size()) {
+			return Vector<Rc<ImageStorage>>();
+		}
+	}
+
+	for (size_t i = 0; i < ret.size(); ++ i) {
+		ret[i]->rearmSemaphores(*_loop);
+		makeViews(ret[i], v[i]);
+	}
+	return ret;
+}
+
+void FrameCache::releaseAliasedImages(Vector<Rc<ImageStorage>> &&images) {
+	Vector<ImageInfoData> key; key.reserve(images.size());
+	for (auto &it : images) {
+		// set is cached only while all of its images are in use by render queues
+		if (!it->isCacheable() || !isReachable(it->getInfo())) {
+			return;
+		}
+		key.emplace_back(it->getInfo());
+	}
+
+	auto imagesIt = _aliasedImages.find(key);
+	if (imagesIt == _aliasedImages.end()) {
+		_aliasedImages.emplace(move(key), FrameCacheAliasedImages{Vector<Vector<Rc<ImageStorage>>>{move(images)}, _time});
+	} else {
+		imagesIt->second.sets.emplace_back(move(images));
+		imagesIt->second.access = _time;
+	}
 }
 
 void FrameCache::addImage(const ImageInfoData &info) {
 	auto it = _images.find(info);
 	if (it == _images.end()) {
-		_images.emplace(info, FrameCacheImageAttachment{uint32_t(1), Vector<Rc<ImageStorage>>()});
+		_images.emplace(info, FrameCacheImageAttachment{uint32_t(1), Vector<Rc<ImageStorage>>(), FrameCache_getImageSize(info), _time});
 	} else {
 		++ it->second.refCount;
 	}
@@ -130,10 +192,25 @@ void FrameCache::removeImage(const ImageInfoData &info) {
 	auto it = _images.find(info);
 	if (it != _images.end()) {
 		if (it->second.refCount == 1) {
+			_usage -= it->second.size * it->second.images.size();
 			for (auto &iit : it->second.images) {
 				_autorelease.emplace_back(iit);
 			}
 			_images.erase(it);
+
+			auto aIt = _aliasedImages.begin();
+			while (aIt != _aliasedImages.end()) {
+				if (std::find(aIt->first.begin(), aIt->first.end(), info) != aIt->first.end()) {
+					for (auto &set : aIt->second.sets) {
+						for (auto &iit : set) {
+							_autorelease.emplace_back(iit);
+						}
+					}
+					aIt = _aliasedImages.erase(aIt);
+				} else {
+					++ aIt;
+				}
+			}
 		} else {
 			-- it->second.refCount;
 		}
@@ -151,11 +228,8 @@ void FrameCache::removeImageView(uint64_t id) {
 
 		auto iit = _framebuffers.begin();
 		while (iit != _framebuffers.end()) {
-			if (!isReachable(SpanView<uint64_t>(iit->first))) {
-				for (auto &it : iit->second.framebuffers) {
-					_autorelease.emplace_back(it);
-				}
-				iit = _framebuffers.erase(iit);
+			if (!isReachable(SpanView<uint64_t>(iit->second.ids))) {
+				iit = eraseFramebuffers(iit);
 			} else {
 				++ iit;
 			}
@@ -174,11 +248,8 @@ void FrameCache::removeRenderPass(uint64_t id) {
 
 		auto iit = _framebuffers.begin();
 		while (iit != _framebuffers.end()) {
-			if (!isReachable(SpanView<uint64_t>(iit->first))) {
-				for (auto &it : iit->second.framebuffers) {
-					_autorelease.emplace_back(it);
-				}
-				iit = _framebuffers.erase(iit);
+			if (!isReachable(SpanView<uint64_t>(iit->second.ids))) {
+				iit = eraseFramebuffers(iit);
 			} else {
 				++ iit;
 			}
@@ -189,44 +260,66 @@ void FrameCache::removeRenderPass(uint64_t id) {
 void FrameCache::removeUnreachableFramebuffers() {
 	auto fbsIt = _framebuffers.begin();
 	while (fbsIt != _framebuffers.end()) {
-		auto e = fbsIt->second.extent;
+		auto e = Extent3(fbsIt->second.extent, 1);
 		bool found = false;
 		for (auto &it : _images) {
-			if (it.first.extent == Extent3(e, 1)) {
+			if (it.first.extent == e) {
 				found = true;
+				break;
 			}
 		}
-		if (!found) {
-			for (auto &it : fbsIt->second.framebuffers) {
-				_autorelease.emplace_back(it);
-			}
-			fbsIt = _framebuffers.erase(fbsIt);
+
+		// all framebuffers in entry share the same ids, so reachability is checked once per entry
+		if (!found || !isReachable(SpanView<uint64_t>(fbsIt->second.ids))) {
+			fbsIt = eraseFramebuffers(fbsIt);
 		} else {
-			auto fbIt = fbsIt->second.framebuffers.begin();
-			while (fbIt != fbsIt->second.framebuffers.end()) {
-				auto e = (*fbIt)->getExtent();
-				Vector<uint64_t> ids; ids.reserve((*fbIt)->getViewIds().size() + 2);
-				ids.emplace_back((*fbIt)->getRenderPass()->getIndex());
-				for (auto &it : (*fbIt)->getViewIds()) {
-					ids.emplace_back(it);
-				}
-				ids.emplace_back(uint64_t(e.width) << uint64_t(32) | uint64_t(e.height));
+			++ fbsIt;
+		}
+	}
+}
 
-				if (isReachable(SpanView<uint64_t>(ids))) {
-					_autorelease.emplace_back(*fbIt);
-					fbIt = fbsIt->second.framebuffers.erase(fbIt);
-				} else {
-					++ fbIt;
-				}
-			}
+void FrameCache::trim() {
+	for (auto &it : _images) {
+		for (auto &iit : it.second.images) {
+			_autorelease.emplace_back(move(iit));
+		}
+		it.second.images.clear();
+	}
+	_usage = 0;
 
-			if (fbsIt->second.framebuffers.empty()) {
-				fbsIt = _framebuffers.erase(fbsIt);
-			} else {
-				++ fbsIt;
+	for (auto &it : _aliasedImages) {
+		for (auto &set : it.second.sets) {
+			for (auto &iit : set) {
+				_autorelease.emplace_back(move(iit));
 			}
 		}
 	}
+	_aliasedImages.clear();
+
+	for (auto &it : _framebuffers) {
+		for (auto &iit : it.second.framebuffers) {
+			_autorelease.emplace_back(move(iit));
+		}
+	}
+	_framebuffers.clear();
+}
+
+void FrameCache::update(uint64_t now) {
+	_time = now;
+
+	if (_frameStat.hits > 0 || _frameStat.misses > 0 || _frameStat.evictions > 0) {
+		_lastFrameStat = _frameStat;
+		_lastFrameStat.images = getImagesCount();
+		_lastFrameStat.framebuffers = getFramebuffersCount();
+		_lastFrameStat.usage = _usage;
+		_frameStat = Stat();
+	}
+
+	// scan for aged objects few times per max age, not on every iteration
+	if (_time - _lastEviction > _maxAge / 4) {
+		_lastEviction = _time;
+		evictAged();
+	}
 }
 
 size_t FrameCache::getFramebuffersCount() const {
@@ -249,6 +342,29 @@ size_t FrameCache::getImageViewsCount() const {
 	return _imageViews.size();
 }
 
+void FrameCache::setBudget(size_t value) {
+	_budget = value;
+	if (_usage > _budget) {
+		evictImages(_budget);
+	}
+}
+
+void FrameCache::setViewExtent(const gl::View *view, Extent2 extent) {
+	if (extent.width == 0 || extent.height == 0) {
+		_viewExtents.erase(view);
+	} else {
+		_viewExtents.insert_or_assign(view, extent);
+	}
+}
+
+FrameCache::Stat FrameCache::getStat() const {
+	auto ret = _stat;
+	ret.images = getImagesCount();
+	ret.framebuffers = getFramebuffersCount();
+	ret.usage = _usage;
+	return ret;
+}
+
 void FrameCache::clear() {
 	if (!_freezed) {
 		_autorelease.clear();
@@ -266,6 +382,15 @@ void FrameCache::unfreeze() {
 	_freezed = false;
 }
 
+bool FrameCache::isViewExtent(Extent2 extent) const {
+	for (auto &it : _viewExtents) {
+		if (it.second == extent) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool FrameCache::isReachable(SpanView<uint64_t> ids) const {
 	auto fb = ids.front();
 	if (_renderPasses.find(fb) == _renderPasses.end()) {
@@ -286,6 +411,126 @@ bool FrameCache::isReachable(const ImageInfoData &info) const {
 	return it != _images.end();
 }
 
+uint64_t FrameCache::makeFramebufferKey(uint64_t pass, SpanView<uint64_t> views, Extent2 e) {
+	_framebufferKey.clear();
+	_framebufferKey.emplace_back(pass);
+	for (auto &it : views) {
+		_framebufferKey.emplace_back(it);
+	}
+	_framebufferKey.emplace_back(uint64_t(e.width) << uint64_t(32) | uint64_t(e.height));
+	return gl::Framebuffer::getViewHash(SpanView<uint64_t>(_framebufferKey));
+}
+
+uint64_t FrameCache::makeFramebufferKey(uint64_t pass, SpanView<Rc<gl::ImageView>> views, Extent2 e) {
+	_framebufferKey.clear();
+	_framebufferKey.emplace_back(pass);
+	for (auto &it : views) {
+		_framebufferKey.emplace_back(it->getIndex());
+	}
+	_framebufferKey.emplace_back(uint64_t(e.width) << uint64_t(32) | uint64_t(e.height));
+	return gl::Framebuffer::getViewHash(SpanView<uint64_t>(_framebufferKey));
+}
+
+uint64_t FrameCache::makeFramebufferKey(const gl::Framebuffer &fb) {
+	return makeFramebufferKey(fb.getRenderPass()->getIndex(), SpanView<uint64_t>(fb.getViewIds()), fb.getExtent());
+}
+
+void FrameCache::onHit() {
+	++ _stat.hits;
+	++ _frameStat.hits;
+}
+
+void FrameCache::onMiss() {
+	++ _stat.misses;
+	++ _frameStat.misses;
+}
+
+void FrameCache::onEvicted(size_t count) {
+	_stat.evictions += count;
+	_frameStat.evictions += count;
+}
+
+HashMap<uint64_t, FrameCacheFramebuffer>::iterator FrameCache::eraseFramebuffers(HashMap<uint64_t, FrameCacheFramebuffer>::iterator it) {
+	for (auto &fb : it->second.framebuffers) {
+		_autorelease.emplace_back(move(fb));
+	}
+	return _framebuffers.erase(it);
+}
+
+void FrameCache::evictImages(size_t target) {
+	Vector<FrameCacheImageAttachment *> entries; entries.reserve(_images.size());
+	for (auto &it : _images) {
+		if (!it.second.images.empty()) {
+			entries.emplace_back(&it.second);
+		}
+	}
+
+	// least recently used first
+	std::sort(entries.begin(), entries.end(), [] (const FrameCacheImageAttachment *l, const FrameCacheImageAttachment *r) {
+		return l->access < r->access;
+	});
+
+	for (auto &it : entries) {
+		while (!it->images.empty() && _usage > target) {
+			_autorelease.emplace_back(move(it->images.back()));
+			it->images.pop_back();
+			_usage -= it->size;
+			onEvicted(1);
+		}
+		if (_usage <= target) {
+			break;
+		}
+	}
+}
+
+void FrameCache::evictAged() {
+	if (_time <= _maxAge) {
+		return;
+	}
+
+	auto threshold = _time - _maxAge;
+
+	// image entries are owned by render queues (see addImage), only idle images are released
+	// objects with current swapchain extent are kept, they are used again on resize back or view restart
+	for (auto &it : _images) {
+		if (!it.second.images.empty() && it.second.access < threshold
+				&& !isViewExtent(Extent2(it.first.extent.width, it.first.extent.height))) {
+			_usage -= it.second.size * it.second.images.size();
+			onEvicted(it.second.images.size());
+			for (auto &iit : it.second.images) {
+				_autorelease.emplace_back(move(iit));
+			}
+			it.second.images.clear();
+		}
+	}
+
+	auto aIt = _aliasedImages.begin();
+	while (aIt != _aliasedImages.end()) {
+		if (aIt->second.access < threshold && (aIt->first.empty()
+				|| !isViewExtent(Extent2(aIt->first.front().extent.width, aIt->first.front().extent.height)))) {
+			onEvicted(aIt->second.sets.size());
+			for (auto &set : aIt->second.sets) {
+				for (auto &iit : set) {
+					_autorelease.emplace_back(move(iit));
+				}
+			}
+			aIt = _aliasedImages.erase(aIt);
+		} else {
+			++ aIt;
+		}
+	}
+
+	auto fbIt = _framebuffers.begin();
+	while (fbIt != _framebuffers.end()) {
+		if (fbIt->second.access < threshold && !isViewExtent(fbIt->second.extent)) {
+			onEvicted(fbIt->second.framebuffers.size());
+			fbIt = eraseFramebuffers(fbIt);
+		} else {
+			++ fbIt;
+		}
+	}
+}
+
 void FrameCache::makeViews(const Rc<ImageStorage> &img, SpanView<gl::ImageViewInfo> views) {
 	for (auto &info : views) {
 		auto v = img->getView(info);
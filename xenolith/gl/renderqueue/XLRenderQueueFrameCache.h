@@ -28,19 +28,36 @@
 namespace stappler::xenolith::renderqueue {
 
 struct FrameCacheFramebuffer final {
+	Vector<uint64_t> ids; // render pass index, image view indexes, packed extent
 	Vector<Rc<gl::Framebuffer>> framebuffers;
 	Extent2 extent;
+	uint64_t access = 0; // cache time of last acquire or release
 };
 
 struct FrameCacheImageAttachment final {
 	uint32_t refCount;
 	Vector<Rc<ImageStorage>> images;
+	size_t size = 0; // estimated memory size for one image
+	uint64_t access = 0;
+};
+
+struct FrameCacheAliasedImages final {
+	Vector<Vector<Rc<ImageStorage>>> sets;
+	uint64_t access = 0;
 };
 
 class FrameCache final : public Ref {
 public:
 	using ImageInfoData = gl::ImageInfoData;
 
+	// memory cap for idle cached images
+	static constexpr size_t DefaultBudget = 256 * 1024 * 1024;
+
+	// idle images and framebuffers, that were not used for this time, are released (microseconds)
+	static constexpr uint64_t DefaultMaxAge = 5'000'000;
+
+	using Stat = gl::FrameCacheStat;
+
 	virtual ~FrameCache();
 
 	bool init(gl::Loop &, gl::Device &);
@@ -52,6 +69,10 @@ public:
 	Rc<ImageStorage> acquireImage(const gl::ImageInfo &, SpanView<gl::ImageViewInfo> v);
 	void releaseImage(Rc<ImageStorage> &&);
 
+	// images with shared memory are cached as a whole set, keyed by infos of all images in set
+	Vector<Rc<ImageStorage>> acquireAliasedImages(SpanView<gl::ImageInfo>, SpanView<Vector<gl::ImageViewInfo>>);
+	void releaseAliasedImages(Vector<Rc<ImageStorage>> &&);
+
 	void addImage(const ImageInfoData &);
 	void removeImage(const ImageInfoData &);
 
@@ -63,10 +84,33 @@ public:
 
 	void removeUnreachableFramebuffers();
 
+	// extent of view's current swapchain, idle objects of this extent are not released by age,
+	// so resize back to it does not recreate them; zero extent removes view
+	void setViewExtent(const gl::View *, Extent2);
+
+	// release all cached images and framebuffers, that are not in use now (on memory pressure)
+	void trim();
+
+	// called by loop once per iteration with monotonic time:
+	// advances cache time, rolls per-frame counters and releases aged objects
+	void update(uint64_t now);
+
 	size_t getFramebuffersCount() const;
 	size_t getImagesCount() const;
 	size_t getImageViewsCount() const;
 
+	void setBudget(size_t);
+	size_t getBudget() const { return _budget; }
+
+	void setMaxAge(uint64_t value) { _maxAge = value; }
+	uint64_t getMaxAge() const { return _maxAge; }
+
+	// counters since cache creation
+	Stat getStat() const;
+
+	// counters for last loop iteration with any cache activity
+	const Stat &getFrameStat() const { return _lastFrameStat; }
+
 	void clear();
 
 	void freeze();
@@ -75,15 +119,43 @@ public:
 protected:
 	bool isReachable(SpanView<uint64_t> ids) const;
 	bool isReachable(const ImageInfoData &) const;
+	bool isViewExtent(Extent2) const;
 
 	void makeViews(const Rc<ImageStorage> &, SpanView<gl::ImageViewInfo>);
 
+	// fills _framebufferKey and returns its hash
+	uint64_t makeFramebufferKey(uint64_t pass, SpanView<uint64_t> views, Extent2);
+	uint64_t makeFramebufferKey(uint64_t pass, SpanView<Rc<gl::ImageView>> views, Extent2);
+	uint64_t makeFramebufferKey(const gl::Framebuffer &);
+
+	void onHit();
+	void onMiss();
+	void onEvicted(size_t count);
+
+	HashMap<uint64_t, FrameCacheFramebuffer>::iterator eraseFramebuffers(HashMap<uint64_t, FrameCacheFramebuffer>::iterator);
+	void evictImages(size_t target);
+	void evictAged();
+
 	gl::Loop *_loop = nullptr;
 	gl::Device *_device = nullptr;
-	Map<gl::ImageInfoData, FrameCacheImageAttachment> _images;
-	Map<Vector<uint64_t>, FrameCacheFramebuffer> _framebuffers;
-	Set<uint64_t> _imageViews;
-	Set<uint64_t> _renderPasses;
+	HashMap<gl::ImageInfoData, FrameCacheImageAttachment> _images;
+	Map<Vector<gl::ImageInfoData>, FrameCacheAliasedImages> _aliasedImages;
+	HashMap<uint64_t, FrameCacheFramebuffer> _framebuffers; // keyed by hash of framebuffer ids
+	std::unordered_set<uint64_t> _imageViews;
+	std::unordered_set<uint64_t> _renderPasses;
+	Map<const gl::View *, Extent2> _viewExtents;
+
+	Vector<uint64_t> _framebufferKey; // reusable key buffer, to avoid allocation on every lookup
+
+	size_t _budget = DefaultBudget;
+	size_t _usage = 0;
+	uint64_t _maxAge = DefaultMaxAge;
+	uint64_t _time = 0;
+	uint64_t _lastEviction = 0;
+
+	Stat _stat;
+	Stat _frameStat;
+	Stat _lastFrameStat;
 
 	bool _freezed = false;
 	Vector<Rc<Ref>> _autorelease;
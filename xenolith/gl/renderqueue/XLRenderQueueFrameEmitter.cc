@@ -188,6 +188,18 @@ void FrameRequest::setRenderTarget(const AttachmentData *a, Rc<ImageStorage> &&i
 	_renderTargets.emplace(a, move(img));
 }
 
+void FrameRequest::setClearColor(const AttachmentData *a, const Color4F &color) {
+	_clearColors.insert_or_assign(a, color);
+}
+
+const Color4F *FrameRequest::getClearColor(const AttachmentData *a) const {
+	auto it = _clearColors.find(a);
+	if (it != _clearColors.end()) {
+		return &it->second;
+	}
+	return nullptr;
+}
+
 bool FrameRequest::onOutputReady(gl::Loop &loop, FrameAttachmentData &data) {
 	auto it = _output.find(data.handle->getAttachment()->getData());
 	if (it != _output.end()) {
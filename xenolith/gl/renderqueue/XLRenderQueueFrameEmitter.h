@@ -77,6 +77,10 @@ public:
 
 	void setRenderTarget(const AttachmentData *, Rc<ImageStorage> &&);
 
+	// overrides attachment's clear color for this frame
+	void setClearColor(const AttachmentData *, const Color4F &);
+	const Color4F *getClearColor(const AttachmentData *) const;
+
 	bool onOutputReady(gl::Loop &, FrameAttachmentData &);
 	void onOutputInvalidated(gl::Loop &, FrameAttachmentData &);
 
@@ -131,6 +135,7 @@ protected:
 	Map<const ImageAttachment *, gl::ImageInfoData> _imageSpecialization;
 	Map<const AttachmentData *, Rc<FrameOutputBinding>> _output;
 	Map<const AttachmentData *, Rc<ImageStorage>> _renderTargets;
+	Map<const AttachmentData *, Color4F> _clearColors;
 
 	Vector<Rc<DependencyEvent>> _signalDependencies;
 
@@ -351,6 +351,20 @@ void FrameHandle::signalDependencies(bool success) {
 	_request->signalDependencies(*_loop, success);
 }
 
+void FrameHandle::addPassTime(StringView pass, uint64_t value) {
+	do {
+		std::unique_lock<Mutex> lock(_passTimeMutex);
+		_passTime.emplace_back(pass, value);
+	} while (0);
+
+	_loop->pushPassTime(pass, value);
+}
+
+Vector<Pair<StringView, uint64_t>> FrameHandle::getPassTime() const {
+	std::unique_lock<Mutex> lock(_passTimeMutex);
+	return _passTime;
+}
+
 void FrameHandle::onQueueInvalidated(FrameQueue &) {
 	++ _queuesCompleted;
 	invalidate();
@@ -60,6 +60,7 @@ public:
 	const FrameOutputBinding *getOutputBinding(const AttachmentData *a) const { return _request->getOutputBinding(a); }
 	Rc<ImageStorage> getRenderTarget(const Attachment *a) const { return _request->getRenderTarget(a->getData()); }
 	Rc<ImageStorage> getRenderTarget(const AttachmentData *a) const { return _request->getRenderTarget(a); }
+	const Color4F *getClearColor(const AttachmentData *a) const { return _request->getClearColor(a); }
 	const Vector<Rc<DependencyEvent>> &getSignalDependencies() const { return _request->getSignalDependencies(); }
 
 	const Vector<Rc<FrameQueue>> &getFrameQueues() const { return _queues; }
@@ -105,6 +106,11 @@ public:
 
 	virtual void signalDependencies(bool success);
 
+	// GPU time of queue passes in nanoseconds, available only when timestamps are enabled on loop
+	// values are added when pass's fence is signaled, so, all values are available in complete callback
+	void addPassTime(StringView pass, uint64_t);
+	Vector<Pair<StringView, uint64_t>> getPassTime() const;
+
 protected:
 	virtual bool setup();
 
@@ -134,6 +140,9 @@ protected:
 
 	Vector<Rc<FrameQueue>> _queues;
 	Function<void(FrameHandle &)> _complete;
+
+	mutable Mutex _passTimeMutex;
+	Vector<Pair<StringView, uint64_t>> _passTime;
 };
 
 }
@@ -383,8 +383,17 @@ void FrameQueue::onAttachmentAcquire(FrameAttachmentData &attachment) {
 
 		attachment.image = _frame->getRenderTarget(attachment.handle->getAttachment());
 
+		if (auto color = _frame->getClearColor(attachment.handle->getAttachment()->getData())) {
+			attachment.hasClearColor = true;
+			attachment.clearColor = *color;
+		}
+
 		if (!attachment.image && attachment.handle->isAvailable(*this)) {
-			attachment.image = _loop->acquireImage(img, attachment.handle.get(), attachment.extent);
+			if (attachment.handle->getAttachment()->getData()->aliasGroup != maxOf<uint32_t>()) {
+				attachment.image = acquireAliasedImage(attachment);
+			} else {
+				attachment.image = _loop->acquireImage(img, attachment.handle.get(), attachment.extent);
+			}
 			if (!attachment.image) {
 				invalidate(attachment);
 				return;
@@ -423,7 +432,9 @@ void FrameQueue::onAttachmentAcquire(FrameAttachmentData &attachment) {
 void FrameQueue::onAttachmentRelease(FrameAttachmentData &attachment) {
 	if (attachment.image) {
 		if (attachment.handle->getAttachment()->getData()->type == AttachmentType::Image) {
-			if (attachment.image) {
+			if (attachment.handle->getAttachment()->getData()->aliasGroup != maxOf<uint32_t>()) {
+				releaseAliasedImage(attachment);
+			} else if (attachment.image) {
 				_loop->releaseImage(move(attachment.image));
 				attachment.image = nullptr;
 			}
@@ -445,6 +456,52 @@ void FrameQueue::onAttachmentRelease(FrameAttachmentData &attachment) {
 	}
 }
 
+Rc<ImageStorage> FrameQueue::acquireAliasedImage(FrameAttachmentData &attachment) {
+	auto group = attachment.handle->getAttachment()->getData()->aliasGroup;
+	auto it = _aliasedImages.find(group);
+	if (it == _aliasedImages.end()) {
+		// images of the group share memory, so, we should acquire them all at once
+		FrameAliasedImages data;
+		for (auto &a : _attachments) {
+			if (a.first->aliasGroup == group) {
+				data.attachments.emplace_back(&a.second);
+			}
+		}
+
+		// stable order, so, cached image sets can be reused in next frames
+		std::sort(data.attachments.begin(), data.attachments.end(), [] (const FrameAttachmentData *l, const FrameAttachmentData *r) {
+			return l->handle->getName() < r->handle->getName();
+		});
+
+		data.images = _loop->acquireAliasedImages(data.attachments);
+		if (data.images.size() != data.attachments.size()) {
+			return nullptr;
+		}
+
+		it = _aliasedImages.emplace(group, move(data)).first;
+	}
+
+	for (size_t i = 0; i < it->second.attachments.size(); ++ i) {
+		if (it->second.attachments[i] == &attachment) {
+			return it->second.images[i];
+		}
+	}
+	return nullptr;
+}
+
+void FrameQueue::releaseAliasedImage(FrameAttachmentData &attachment) {
+	attachment.image = nullptr;
+
+	auto it = _aliasedImages.find(attachment.handle->getAttachment()->getData()->aliasGroup);
+	if (it != _aliasedImages.end()) {
+		++ it->second.released;
+		if (it->second.released == it->second.attachments.size()) {
+			_loop->releaseAliasedImages(move(it->second.images));
+			_aliasedImages.erase(it);
+		}
+	}
+}
+
 bool FrameQueue::isRenderPassReady(const FramePassData &data) const {
 	return isRenderPassReadyForState(data, FrameRenderPassState::Initial);
 }
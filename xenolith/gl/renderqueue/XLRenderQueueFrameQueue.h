@@ -79,6 +79,17 @@ struct FrameAttachmentData {
 
 	Rc<ImageStorage> image;
 	bool waitForResult = false;
+
+	// clear color, requested for this frame instead of attachment's one
+	bool hasClearColor = false;
+	Color4F clearColor;
+};
+
+// images for attachments with shared memory, acquired with first attachment and released with the last one
+struct FrameAliasedImages {
+	Vector<const FrameAttachmentData *> attachments;
+	Vector<Rc<ImageStorage>> images;
+	uint32_t released = 0;
 };
 
 struct FrameSyncAttachment {
@@ -140,6 +151,9 @@ protected:
 	void onAttachmentAcquire(FrameAttachmentData &);
 	void onAttachmentRelease(FrameAttachmentData &);
 
+	Rc<ImageStorage> acquireAliasedImage(FrameAttachmentData &);
+	void releaseAliasedImage(FrameAttachmentData &);
+
 	bool isRenderPassReady(const FramePassData &) const;
 	bool isRenderPassReadyForState(const FramePassData &, FrameRenderPassState) const;
 	void updateRenderPassState(FramePassData &, FrameRenderPassState);
@@ -181,6 +195,8 @@ protected:
 	std::unordered_set<FramePassData *> _renderPassesPrepared;
 	std::unordered_set<FrameAttachmentData *> _attachmentsInitial;
 
+	Map<uint32_t, FrameAliasedImages> _aliasedImages;
+
 	std::forward_list<Rc<Ref>> _autorelease;
 	uint32_t _renderPassSubmitted = 0;
 	uint32_t _renderPassCompleted = 0;
@@ -70,11 +70,16 @@ public:
 	void setFrameIndex(uint64_t idx) { _frameIndex = idx; }
 	uint64_t getFrameIndex() const { return _frameIndex; }
 
+	// time of first input event, handled within frame, that was rendered into image (0 if none)
+	void setInputTime(uint64_t t) { _inputTime = t; }
+	uint64_t getInputTime() const { return _inputTime; }
+
 protected:
 	void notifyReady();
 
 	uint64_t _acquisitionTime = 0;
 	uint64_t _frameIndex = 0;
+	uint64_t _inputTime = 0;
 	Rc<gl::ImageObject> _image;
 	Rc<gl::Semaphore> _waitSem;
 	Rc<gl::Semaphore> _signalSem;
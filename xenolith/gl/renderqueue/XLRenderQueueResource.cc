@@ -22,6 +22,7 @@
 
 #include "SPBitmap.h"
 #include "XLRenderQueueResource.h"
+#include "XLGlKtx.h"
 
 namespace stappler::xenolith::renderqueue {
 
@@ -157,9 +158,15 @@ static void Resource_loadImageDefault(StringView path, BytesView encodedImageDat
 	}
 }
 
-void Resource::loadImageFileData(uint8_t *ptr, uint64_t expectedSize, StringView path, gl::ImageFormat fmt, const gl::ImageData::DataCallback &dcb) {
-	auto p = memory::pool::create(memory::pool::acquire());
-	memory::pool::push(p);
+// Encoded data is mapped, so, decoder reads file pages on demand without intermediate copy
+// Falls back to reading into pool memory, if file can not be mapped
+static BytesView Resource_openFileData(StringView path, memory::pool_t *p, void **handle) {
+	auto view = platform::file::_mapFile(path, handle);
+	if (!view.empty()) {
+		return view;
+	}
+
+	*handle = nullptr;
 	auto f = filesystem::openForReading(path);
 	if (f) {
 		auto fsize = f.size();
@@ -167,6 +174,25 @@ void Resource::loadImageFileData(uint8_t *ptr, uint64_t expectedSize, StringView
 		f.seek(0, io::Seek::Set);
 		f.read(mem, fsize);
 		f.close();
+		return BytesView(mem, fsize);
+	}
+	return BytesView();
+}
+
+static void Resource_closeFileData(BytesView data, void *handle) {
+	if (handle) {
+		platform::file::_unmapFile(data, handle);
+	}
+}
+
+void Resource::loadImageFileData(uint8_t *ptr, uint64_t expectedSize, StringView path, gl::ImageFormat fmt, const gl::ImageData::DataCallback &dcb) {
+	auto p = memory::pool::create(memory::pool::acquire());
+	memory::pool::push(p);
+	void *handle = nullptr;
+	auto fileData = Resource_openFileData(path, p, &handle);
+	if (!fileData.empty()) {
+		auto mem = fileData.data();
+		auto fsize = fileData.size();
 
 		bitmap::ImageInfo info;
 		if (!bitmap::getImageInfo(BytesView(mem, fsize), info)) {
@@ -234,6 +260,7 @@ void Resource::loadImageFileData(uint8_t *ptr, uint64_t expectedSize, StringView
 				Resource_loadImageDefault(path, BytesView(mem, fsize), fmt, dcb);
 			}
 		}
+		Resource_closeFileData(fileData, handle);
 	} else {
 		log::vtext("Resource", "loadImageFileData: ", path, ": fail to load file");
 		dcb(BytesView());
@@ -258,6 +285,13 @@ bool Resource::init(Builder && buf) {
 	buf._data = nullptr;
 	for (auto &it : _data->images) {
 		it->resource = this;
+		if ((it->hints & gl::ImageHints::GenerateMipmaps) != gl::ImageHints::None) {
+			// mip levels are filled with blit from level 0
+			if (it->mipLevels.get() == 1) {
+				it->mipLevels = gl::MipLevels(gl::getMaxMipLevels(it->extent));
+			}
+			it->usage |= gl::ImageUsage::TransferSrc;
+		}
 	}
 	for (auto &it : _data->buffers) {
 		it->resource = this;
@@ -360,6 +394,96 @@ static void Resource_loadFileData(uint8_t *ptr, uint64_t size, StringView path,
 	memory::pool::destroy(p);
 };
 
+static bool Resource_readKtxFileInfo(StringView path, gl::KtxInfo &info) {
+	auto f = filesystem::openForReading(path);
+	if (!f) {
+		return false;
+	}
+
+	auto fsize = f.size();
+	if (fsize < gl::KtxInfo::HeaderSize) {
+		return false;
+	}
+
+	uint8_t header[gl::KtxInfo::HeaderSize];
+	f.seek(0, io::Seek::Set);
+	f.read(header, gl::KtxInfo::HeaderSize);
+	if (!gl::isKtx2(BytesView(header, gl::KtxInfo::HeaderSize))) {
+		return false;
+	}
+
+	// levelCount field, level index follows the header
+	uint32_t levelCount = 0;
+	memcpy(&levelCount, header + 40, sizeof(uint32_t));
+
+	auto indexSize = gl::KtxInfo::LevelIndexSize * std::max(levelCount, uint32_t(1));
+	if (fsize < gl::KtxInfo::HeaderSize + indexSize) {
+		return false;
+	}
+
+	Bytes data; data.resize(gl::KtxInfo::HeaderSize + indexSize);
+	memcpy(data.data(), header, gl::KtxInfo::HeaderSize);
+	f.read(data.data() + gl::KtxInfo::HeaderSize, indexSize);
+	f.close();
+
+	return gl::readKtxInfo(data, info);
+}
+
+static void Resource_loadKtxFileData(uint8_t *ptr, uint64_t size, StringView path, const gl::ImageData::DataCallback &dcb) {
+	auto p = memory::pool::create(memory::pool::acquire());
+	memory::pool::push(p);
+	void *handle = nullptr;
+	auto fileData = Resource_openFileData(path, p, &handle);
+	if (!fileData.empty()) {
+		auto mem = fileData.data();
+		auto fsize = fileData.size();
+
+		gl::KtxInfo info;
+		if (!gl::readKtxInfo(BytesView(mem, fsize), info)) {
+			log::vtext("Resource", "loadKtxFileData: ", path, ": fail to read KTX2 header");
+			dcb(BytesView());
+		} else if (ptr) {
+			if (!gl::readKtxData(BytesView(mem, fsize), info, ptr, size)) {
+				log::vtext("Resource", "loadKtxFileData: ", path, ": invalid level data");
+			}
+		} else {
+			auto dataSize = info.getDataSize();
+			auto data = (uint8_t *)memory::pool::palloc(p, dataSize);
+			if (gl::readKtxData(BytesView(mem, fsize), info, data, dataSize)) {
+				dcb(BytesView(data, dataSize));
+			} else {
+				log::vtext("Resource", "loadKtxFileData: ", path, ": invalid level data");
+				dcb(BytesView());
+			}
+		}
+		Resource_closeFileData(fileData, handle);
+	} else {
+		log::vtext("Resource", "loadKtxFileData: ", path, ": fail to load file");
+		dcb(BytesView());
+	}
+	memory::pool::pop();
+	memory::pool::destroy(p);
+}
+
+// repack KTX2 container into level-by-level data, that can be uploaded directly
+static bool Resource_readKtxData(gl::ImageData *buf, gl::ImageInfo &&img, BytesView data, memory::pool_t *pool) {
+	gl::KtxInfo info;
+	if (!gl::readKtxInfo(data, info)) {
+		return false;
+	}
+
+	auto dataSize = info.getDataSize();
+	auto mem = (uint8_t *)memory::pool::palloc(pool, dataSize);
+	if (!gl::readKtxData(data, info, mem, dataSize)) {
+		return false;
+	}
+
+	static_cast<gl::ImageInfo &>(*buf) = info.getImageInfo(move(img));
+	buf->data = BytesView(mem, dataSize);
+	buf->dataLevels = info.levels;
+	return true;
+}
+
 Resource::Builder::Builder(StringView name) {
 	auto p = memory::pool::create((memory::pool_t *)nullptr);
 	memory::pool::push(p);
@@ -492,9 +616,16 @@ const gl::ImageData *Resource::Builder::addImage(StringView key, gl::ImageInfo &
 
 	auto p = Resource_conditionalInsert<gl::ImageData>(_data->images, key, [&] () -> gl::ImageData * {
 		auto buf = new (_data->pool) gl::ImageData;
-		static_cast<gl::ImageInfo &>(*buf) = move(img);
+		if (gl::isKtx2(data)) {
+			if (!Resource_readKtxData(buf, move(img), data, _data->pool)) {
+				log::vtext("Resource", _data->key, ": Invalid KTX2 data for image: ", key);
+				return nullptr;
+			}
+		} else {
+			static_cast<gl::ImageInfo &>(*buf) = move(img);
+			buf->data = data.pdup(_data->pool);
+		}
 		buf->key = key.pdup(_data->pool);
-		buf->data = data.pdup(_data->pool);
 		return buf;
 	}, _data->pool);
 	if (!p) {
@@ -524,21 +655,33 @@ const gl::ImageData *Resource::Builder::addImage(StringView key, gl::ImageInfo &
 		return nullptr;
 	}
 
+	gl::KtxInfo ktx;
+	bool isKtx = Resource_readKtxFileInfo(npath, ktx);
+
 	Extent3 extent;
 	extent.depth = 1;
-	if (!bitmap::getImageSize(StringView(npath), extent.width, extent.height)) {
+	if (!isKtx && !bitmap::getImageSize(StringView(npath), extent.width, extent.height)) {
 		return nullptr;
 	}
 
 	auto p = Resource_conditionalInsert<gl::ImageData>(_data->images, key, [&] () -> gl::ImageData * {
 		auto fpath = StringView(npath).pdup(_data->pool);
 		auto buf = new (_data->pool) gl::ImageData;
-		static_cast<gl::ImageInfo &>(*buf) = move(img);
+		if (isKtx) {
+			// format, extent and levels are defined by container
+			static_cast<gl::ImageInfo &>(*buf) = ktx.getImageInfo(move(img));
+			buf->dataLevels = ktx.levels;
+			buf->memCallback = [fpath] (uint8_t *ptr, uint64_t size, const gl::ImageData::DataCallback &dcb) {
+				Resource_loadKtxFileData(ptr, size, fpath, dcb);
+			};
+		} else {
+			static_cast<gl::ImageInfo &>(*buf) = move(img);
+			buf->memCallback = [fpath, format = img.format] (uint8_t *ptr, uint64_t size, const gl::ImageData::DataCallback &dcb) {
+				Resource::loadImageFileData(ptr, size, fpath, format, dcb);
+			};
+			buf->extent = extent;
+		}
 		buf->key = key.pdup(_data->pool);
-		buf->memCallback = [fpath, format = img.format] (uint8_t *ptr, uint64_t size, const gl::ImageData::DataCallback &dcb) {
-			Resource::loadImageFileData(ptr, size, fpath, format, dcb);
-		};
-		buf->extent = extent;
 		return buf;
 	}, _data->pool);
 	if (!p) {
@@ -555,9 +698,17 @@ const gl::ImageData *Resource::Builder::addImageByRef(StringView key, gl::ImageI
 
 	auto p = Resource_conditionalInsert<gl::ImageData>(_data->images, key, [&] () -> gl::ImageData * {
 		auto buf = new (_data->pool) gl::ImageData;
-		static_cast<gl::ImageInfo &>(*buf) = move(img);
+		if (gl::isKtx2(data)) {
+			// container should be repacked, so data can not be used by reference
+			if (!Resource_readKtxData(buf, move(img), data, _data->pool)) {
+				log::vtext("Resource", _data->key, ": Invalid KTX2 data for image: ", key);
+				return nullptr;
+			}
+		} else {
+			static_cast<gl::ImageInfo &>(*buf) = move(img);
+			buf->data = data;
+		}
 		buf->key = key.pdup(_data->pool);
-		buf->data = data;
 		return buf;
 	}, _data->pool);
 	if (!p) {
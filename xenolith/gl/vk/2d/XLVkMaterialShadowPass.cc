@@ -117,9 +117,19 @@ bool MaterialShadowPass::init(Queue::Builder &queueBuilder, PassBuilder &passBui
 	_lightsData = info.lightsAttachment;
 	_shadowPrimitives = info.sdfPrimitivesAttachment;
 
+	// shadow data is produced by compute pass, possibly on another queue family,
+	// wait stages are used for cross-queue semaphores
+	auto shadowDataDependency = [] (AttachmentPassBuilder &builder) {
+		builder.setDependency(AttachmentDependencyInfo{
+			PipelineStage::VertexShader | PipelineStage::FragmentShader, AccessType::ShaderRead,
+			PipelineStage::VertexShader | PipelineStage::FragmentShader, AccessType::ShaderRead,
+			FrameRenderPassState::Submitted,
+		});
+	};
+
 	auto colorAttachment = passBuilder.addAttachment(_output);
 	auto shadowAttachment = passBuilder.addAttachment(_shadow);
-	auto sdfAttachment = passBuilder.addAttachment(_sdf);
+	auto sdfAttachment = passBuilder.addAttachment(_sdf, shadowDataDependency);
 	auto depth2dAttachment = passBuilder.addAttachment(_depth2d);
 
 	auto layout2d = passBuilder.addDescriptorLayout([&] (PipelineLayoutBuilder &layoutBuilder) {
@@ -127,8 +137,8 @@ bool MaterialShadowPass::init(Queue::Builder &queueBuilder, PassBuilder &passBui
 		layoutBuilder.addSet([&] (DescriptorSetBuilder &setBuilder) {
 			setBuilder.addDescriptor(passBuilder.addAttachment(_vertexes));
 			setBuilder.addDescriptor(passBuilder.addAttachment(_materials));
-			setBuilder.addDescriptor(passBuilder.addAttachment(_lightsData));
-			setBuilder.addDescriptor(passBuilder.addAttachment(_shadowPrimitives));
+			setBuilder.addDescriptor(passBuilder.addAttachment(_lightsData, shadowDataDependency));
+			setBuilder.addDescriptor(passBuilder.addAttachment(_shadowPrimitives, shadowDataDependency));
 			setBuilder.addDescriptor(shadowAttachment, DescriptorType::InputAttachment, AttachmentLayout::ShaderReadOnlyOptimal);
 			setBuilder.addDescriptor(sdfAttachment, DescriptorType::SampledImage, AttachmentLayout::ShaderReadOnlyOptimal);
 		});
@@ -163,6 +173,20 @@ bool MaterialShadowPass::init(Queue::Builder &queueBuilder, PassBuilder &passBui
 			DepthInfo(false, true, gl::CompareOp::LessOrEqual)
 		}));
 
+		// transparent pipeline for offscreen layers (see RasterCache), alpha channel accumulates coverage
+		subpassBuilder.addGraphicPipeline("TransparentLayer", layout2d, shaderSpecInfo, PipelineMaterialInfo({
+			BlendInfo(gl::BlendFactor::SrcAlpha, gl::BlendFactor::OneMinusSrcAlpha, gl::BlendOp::Add,
+					gl::BlendFactor::One, gl::BlendFactor::OneMinusSrcAlpha, gl::BlendOp::Add),
+			DepthInfo(false, true, gl::CompareOp::LessOrEqual)
+		}));
+
+		// pipeline to compose premultiplied offscreen layers
+		subpassBuilder.addGraphicPipeline("Premultiplied", layout2d, shaderSpecInfo, PipelineMaterialInfo({
+			BlendInfo(gl::BlendFactor::One, gl::BlendFactor::OneMinusSrcAlpha, gl::BlendOp::Add,
+					gl::BlendFactor::One, gl::BlendFactor::OneMinusSrcAlpha, gl::BlendOp::Add),
+			DepthInfo(false, true, gl::CompareOp::LessOrEqual)
+		}));
+
 		// pipeline for debugging - draw lines instead of triangles
 		subpassBuilder.addGraphicPipeline("DebugTriangles", layout2d, shaderSpecInfo, PipelineMaterialInfo(
 			BlendInfo(gl::BlendFactor::SrcAlpha, gl::BlendFactor::OneMinusSrcAlpha, gl::BlendOp::Add,
@@ -344,8 +368,7 @@ void MaterialShadowPassHandle::prepareMaterialCommands(gl::MaterialSet * materia
 		auto viewport = VkViewport{ 0.0f, 0.0f, float(currentExtent.width), float(currentExtent.height), 0.0f, 1.0f };
 		buf.cmdSetViewport(0, makeSpanView(&viewport, 1));
 
-		auto scissorRect = VkRect2D{ { 0, 0}, { currentExtent.width, currentExtent.height } };
-		buf.cmdSetScissor(0, makeSpanView(&scissorRect, 1));
+		buf.cmdSetScissor(0, makeSpanView(&_renderArea, 1));
 
 		uint32_t samplerIndex = 1; // linear filtering
 		buf.cmdPushConstants(VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
@@ -383,12 +406,22 @@ bool MaterialComputeShadowPass::init(Queue::Builder &queueBuilder, PassBuilder &
 		return Rc<ShadowSdfImageAttachment>::create(builder, defaultExtent);
 	});
 
+	// graphics pass can use shadow data only after compute pass submission
+	auto shadowDataDependency = [] (AttachmentPassBuilder &builder) {
+		builder.setDependency(AttachmentDependencyInfo{
+			PipelineStage::ComputeShader, AccessType::ShaderRead | AccessType::ShaderWrite,
+			PipelineStage::ComputeShader, AccessType::ShaderRead | AccessType::ShaderWrite,
+			FrameRenderPassState::Submitted,
+		});
+	};
+
 	auto layout = passBuilder.addDescriptorLayout([&] (PipelineLayoutBuilder &layoutBuilder) {
 		layoutBuilder.addSet([&] (DescriptorSetBuilder &setBuilder) {
-			setBuilder.addDescriptor(passBuilder.addAttachment(_lights));
+			setBuilder.addDescriptor(passBuilder.addAttachment(_lights, shadowDataDependency));
 			setBuilder.addDescriptor(passBuilder.addAttachment(_vertexes));
-			setBuilder.addDescriptor(passBuilder.addAttachment(_primitives));
-			setBuilder.addDescriptor(passBuilder.addAttachment(_sdf), DescriptorType::StorageImage, AttachmentLayout::General);
+			setBuilder.addDescriptor(passBuilder.addAttachment(_primitives, shadowDataDependency));
+			setBuilder.addDescriptor(passBuilder.addAttachment(_sdf, shadowDataDependency),
+					DescriptorType::StorageImage, AttachmentLayout::General);
 		});
 	});
 
@@ -471,18 +504,32 @@ void MaterialComputeShadowPassHandle::writeShadowCommands(RenderPassImpl *pass,
 		auto gIdx = _device->getQueueFamily(QueueOperations::Graphics)->index;
 
 		if (_pool->getFamilyIdx() != gIdx) {
-			BufferMemoryBarrier transferBufferBarrier(_lightsBuffer->getBuffer(),
-				VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_SHADER_READ_BIT,
-				QueueFamilyTransfer{_pool->getFamilyIdx(), gIdx}, 0, VK_WHOLE_SIZE);
-
 			ImageMemoryBarrier transferImageBarrier(sdfImage,
 				VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
 				VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
 				QueueFamilyTransfer{_pool->getFamilyIdx(), gIdx});
 			sdfImage->setPendingBarrier(transferImageBarrier);
 
-			buf.cmdPipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
-					makeSpanView(&transferBufferBarrier, 1), makeSpanView(&transferImageBarrier, 1));
+			if (_lightsBuffer) {
+				BufferMemoryBarrier transferBufferBarrier(_lightsBuffer->getBuffer(),
+					VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_SHADER_READ_BIT,
+					QueueFamilyTransfer{_pool->getFamilyIdx(), gIdx}, 0, VK_WHOLE_SIZE);
+				_lightsBuffer->getBuffer()->setPendingBarrier(transferBufferBarrier);
+
+				buf.cmdPipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+						makeSpanView(&transferBufferBarrier, 1), makeSpanView(&transferImageBarrier, 1));
+			} else {
+				buf.cmdPipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+						makeSpanView(&transferImageBarrier, 1));
+			}
+		} else {
+			// same queue family (no dedicated compute family, or async compute disabled on device)
+			ImageMemoryBarrier imageBarrier(sdfImage,
+				VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+				VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+			buf.cmdPipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+					makeSpanView(&imageBarrier, 1));
 		}
 		return;
 	}
@@ -589,10 +636,30 @@ void MaterialComputeShadowPassHandle::writeShadowCommands(RenderPassImpl *pass,
 		_primitivesBuffer->getRects()->setPendingBarrier(bufferBarriers[4]);
 		_primitivesBuffer->getRoundedRects()->setPendingBarrier(bufferBarriers[5]);
 		_primitivesBuffer->getPolygons()->setPendingBarrier(bufferBarriers[6]);
-		_lightsBuffer->getBuffer()->setPendingBarrier(bufferBarriers[3]);
+		_lightsBuffer->getBuffer()->setPendingBarrier(bufferBarriers[7]);
 
 		buf.cmdPipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
 				bufferBarriers, makeSpanView(&transferImageBarrier, 1));
+	} else {
+		// same queue family (no dedicated compute family, or async compute disabled on device),
+		// submission order is preserved, only make results visible for graphics pass
+		BufferMemoryBarrier bufferBarriers[] = {
+			BufferMemoryBarrier(_primitivesBuffer->getTriangles(), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+			BufferMemoryBarrier(_primitivesBuffer->getGridSize(), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+			BufferMemoryBarrier(_primitivesBuffer->getGridIndex(), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+			BufferMemoryBarrier(_primitivesBuffer->getCircles(), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+			BufferMemoryBarrier(_primitivesBuffer->getRects(), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+			BufferMemoryBarrier(_primitivesBuffer->getRoundedRects(), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+			BufferMemoryBarrier(_primitivesBuffer->getPolygons(), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+		};
+
+		ImageMemoryBarrier imageBarrier(sdfImage,
+			VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+			VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+		buf.cmdPipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+				bufferBarriers, makeSpanView(&imageBarrier, 1));
 	}
 }
 
@@ -24,6 +24,7 @@
 #include "XLVkAllocator.h"
 #include "XLVkBuffer.h"
 #include "XLVkPipeline.h"
+#include "XLVkSwapchain.h"
 #include "XLGlCommandList.h"
 
 namespace stappler::xenolith::vk {
@@ -86,6 +87,7 @@ bool VertexMaterialAttachmentHandle::isDescriptorDirty(const PassHandle &, const
 		return _vertexes;
 		break;
 	case 1:
+	case 2:
 		return _transforms;
 		break;
 	default:
@@ -108,6 +110,15 @@ bool VertexMaterialAttachmentHandle::writeDescriptor(const QueuePassHandle &, De
 		info.range = _transforms->getSize();
 		return true;
 		break;
+	case 2: {
+		// descriptor should be valid even without instanced commands, use transforms as placeholder
+		auto &buffer = _instances ? _instances : _transforms;
+		info.buffer = buffer;
+		info.offset = 0;
+		info.range = buffer->getSize();
+		return true;
+		break;
+	}
 	default:
 		break;
 	}
@@ -128,6 +139,7 @@ struct VertexMaterialDrawPlan {
 	struct PlanCommandInfo {
 		const gl::CmdGeneral *cmd;
 		SpanView<gl::TransformedVertexData> vertexes;
+		SpanView<gl::InstanceObject> instances; // not empty for instanced commands
 	};
 
 	struct MaterialWritePlan {
@@ -136,6 +148,7 @@ struct VertexMaterialDrawPlan {
 		uint32_t vertexes = 0;
 		uint32_t indexes = 0;
 		uint32_t transforms = 0;
+		uint32_t instances = 0;
 		Map<gl::StateId, std::forward_list<PlanCommandInfo>> states;
 	};
 
@@ -143,6 +156,7 @@ struct VertexMaterialDrawPlan {
 		uint8_t *transform;
 		uint8_t *vertexes;
 		uint8_t *indexes;
+		uint8_t *instances;
 	};
 
 	Extent2 surfaceExtent;
@@ -170,6 +184,7 @@ struct VertexMaterialDrawPlan {
 	uint32_t vertexOffset = 0;
 	uint32_t indexOffset = 0;
 	uint32_t transtormOffset = 0;
+	uint32_t instanceOffset = 0;
 
 	uint32_t materialVertexes = 0;
 	uint32_t materialIndexes = 0;
@@ -178,6 +193,7 @@ struct VertexMaterialDrawPlan {
 	uint32_t solidCmds = 0;
 	uint32_t surfaceCmds = 0;
 	uint32_t transparentCmds = 0;
+	uint32_t batchedTransforms = 0;
 
 	bool hasGpuSideAtlases = false;
 
@@ -185,7 +201,8 @@ struct VertexMaterialDrawPlan {
 	: surfaceExtent{constraints.extent}, transform(constraints.transform) { }
 
 	void emplaceWritePlan(const gl::Material *material, std::unordered_map<gl::MaterialId, MaterialWritePlan> &writePlan,
-				const gl::Command *c, const gl::CmdGeneral *cmd, SpanView<gl::TransformedVertexData> vertexes) {
+				const gl::Command *c, const gl::CmdGeneral *cmd, SpanView<gl::TransformedVertexData> vertexes,
+				SpanView<gl::InstanceObject> instances = SpanView<gl::InstanceObject>()) {
 		auto it = writePlan.find(cmd->material);
 		if (it == writePlan.end()) {
 			if (material) {
@@ -213,12 +230,15 @@ struct VertexMaterialDrawPlan {
 				}
 			}
 
+			globalWritePlan.instances += instances.size();
+			it->second.instances += instances.size();
+
 			auto iit = it->second.states.find(cmd->state);
 			if (iit == it->second.states.end()) {
 				iit = it->second.states.emplace(cmd->state, std::forward_list<PlanCommandInfo>()).first;
 			}
 
-			iit->second.emplace_front(PlanCommandInfo{cmd, vertexes});
+			iit->second.emplace_front(PlanCommandInfo{cmd, vertexes, instances});
 		}
 
 		auto pathsIt = paths.find(cmd->zPath);
@@ -245,6 +265,26 @@ struct VertexMaterialDrawPlan {
 		}
 	};
 
+	void pushInstanceData(gl::MaterialSet *materialSet, const gl::Command *c, const gl::CmdInstanceArray *cmd) {
+		auto material = materialSet->getMaterialById(cmd->material);
+		if (!material || cmd->instances.empty() || !cmd->vertexes.data) {
+			return;
+		}
+
+		auto vertexes = makeSpanView(&cmd->vertexes, 1);
+		if (material->getPipeline()->isSolid()) {
+			emplaceWritePlan(material, solidWritePlan, c, cmd, vertexes, cmd->instances);
+		} else if (cmd->renderingLevel == RenderingLevel::Surface) {
+			emplaceWritePlan(material, surfaceWritePlan, c, cmd, vertexes, cmd->instances);
+		} else {
+			auto v = transparentWritePlan.find(cmd->zPath);
+			if (v == transparentWritePlan.end()) {
+				v = transparentWritePlan.emplace(cmd->zPath, std::unordered_map<gl::MaterialId, MaterialWritePlan>()).first;
+			}
+			emplaceWritePlan(material, v->second, c, cmd, vertexes, cmd->instances);
+		}
+	}
+
 	void pushDeferred(gl::MaterialSet *materialSet, const gl::Command *c, const gl::CmdDeferred *cmd) {
 		auto material = materialSet->getMaterialById(cmd->material);
 		if (!material) {
@@ -301,9 +341,7 @@ struct VertexMaterialDrawPlan {
 	}
 
 	void pushInitial(WriteTarget &writeTarget) {
-		gl::TransformObject val;
-		memcpy(writeTarget.transform, &val, sizeof(gl::TransformObject));
-		transtormOffset += sizeof(gl::TransformObject); ++ transformIdx;
+		pushTransform(writeTarget, gl::TransformObject());
 
 		Vector<uint32_t> indexes{ 0, 2, 1, 0, 3, 2 };
 
@@ -379,13 +417,30 @@ struct VertexMaterialDrawPlan {
 		return vec;
 	}
 
+	void pushTransform(WriteTarget &writeTarget, const gl::TransformObject &transform) {
+		memcpy(writeTarget.transform + transtormOffset, &transform, sizeof(gl::TransformObject));
+		transtormOffset += sizeof(gl::TransformObject);
+		++ transformIdx;
+	}
+
+	// returns index of first written instance
+	uint32_t pushInstances(WriteTarget &writeTarget, SpanView<gl::InstanceObject> instances) {
+		auto target = (gl::InstanceObject *)writeTarget.instances + instanceOffset;
+		memcpy(target, (const uint8_t *)instances.data(), instances.size() * sizeof(gl::InstanceObject));
+
+		auto ret = instanceOffset;
+		instanceOffset += instances.size();
+		return ret;
+	}
+
+	// vertexes use last pushed transform, translation (if any) is applied to vertex positions
 	void pushVertexes(WriteTarget &writeTarget, const gl::MaterialId &materialId, const MaterialWritePlan &plan,
-				const gl::CmdGeneral *cmd, const gl::TransformObject &transform, gl::VertexData *vertexes) {
+				const gl::CmdGeneral *cmd, const Vec3 *translation, gl::VertexData *vertexes) {
 		auto target = (gl::Vertex_V4F_V4F_T2F2U *)writeTarget.vertexes + vertexOffset;
 		memcpy(target, (uint8_t *)vertexes->data.data(),
 				vertexes->data.size() * sizeof(gl::Vertex_V4F_V4F_T2F2U));
 
-		memcpy(writeTarget.transform + transtormOffset, &transform, sizeof(gl::TransformObject));
+		const uint32_t currentIdx = transformIdx - 1;
 
 		size_t idx = 0;
 		if (plan.atlas) {
@@ -395,7 +450,7 @@ struct VertexMaterialDrawPlan {
 
 			for (; idx < vertexes->data.size(); ++ idx) {
 				auto &t = target[idx];
-				t.material = transformIdx | transformIdx << 16;
+				t.material = currentIdx | currentIdx << 16;
 
 				if (!hasGpuSideAtlases) {
 					if (font::FontAtlasValue *d = (font::FontAtlasValue *)plan.atlas->getObjectByName(t.object)) {
@@ -426,7 +481,14 @@ struct VertexMaterialDrawPlan {
 		} else {
 			for (; idx < vertexes->data.size(); ++ idx) {
 				auto &t = target[idx];
-				t.material = transformIdx | transformIdx << 16;
+				t.material = currentIdx | currentIdx << 16;
+			}
+		}
+
+		if (translation) {
+			for (idx = 0; idx < vertexes->data.size(); ++ idx) {
+				auto &t = target[idx];
+				t.pos += Vec4(translation->x * t.pos.w, translation->y * t.pos.w, translation->z * t.pos.w, 0.0f);
 			}
 		}
 
@@ -438,13 +500,49 @@ struct VertexMaterialDrawPlan {
 
 		vertexOffset += vertexes->data.size();
 		indexOffset += vertexes->indexes.size();
-		transtormOffset += sizeof(gl::TransformObject);
-		++ transformIdx;
 
 		materialVertexes += vertexes->data.size();
 		materialIndexes += vertexes->indexes.size();
 	}
 
+	// checks if batch transform can be used instead of mat, returns translation for vertexes
+	bool getBatchTranslation(const Mat4 &batchInverse, const Mat4 &mat, Vec3 &translation) const {
+		static constexpr float Epsilon = 1e-5f;
+
+		auto diff = batchInverse * mat;
+		for (uint32_t col = 0; col < 4; ++ col) {
+			for (uint32_t row = 0; row < 4; ++ row) {
+				if (col == 3 && row != 3) {
+					continue; // translation column
+				}
+				auto expected = (col == row) ? 1.0f : 0.0f;
+				if (std::abs(diff.m[col * 4 + row] - expected) > Epsilon) {
+					return false;
+				}
+			}
+		}
+
+		translation = Vec3(diff.m[12], diff.m[13], diff.m[14]);
+		return true;
+	}
+
+	gl::TransformObject makeTransform(const PlanCommandInfo &cmd, const Mat4 &mat) const {
+		gl::TransformObject val(mat);
+
+		auto pathIt = paths.find(cmd.cmd->zPath);
+		if (pathIt != paths.end()) {
+			val.offset.z = pathIt->second;
+		}
+
+		if (cmd.cmd->depthValue > 0.0f) {
+			auto f16 = halffloat::encode(cmd.cmd->depthValue);
+			auto value = halffloat::decode(f16);
+			val.shadow = Vec4(value, value, value, 1.0);
+		}
+
+		return val;
+	}
+
 	void drawWritePlan(Vector<gl::VertexSpan> &spans, WriteTarget &writeTarget, std::unordered_map<gl::MaterialId, MaterialWritePlan> &writePlan) {
 		// optimize draw order, minimize switching pipeline, textureSet and descriptors
 		Vector<const Pair<const gl::MaterialId, MaterialWritePlan> *> drawOrder;
@@ -478,26 +576,65 @@ struct VertexMaterialDrawPlan {
 				materialVertexes = 0;
 				materialIndexes = 0;
 
+				// Consecutive vertex arrays within one material and state share transform slot, when their transforms
+				// differs only in translation (common for labels and sprites within one layer); translation difference
+				// is applied to vertex positions. Atlas offsets are applied before transform, so it's safe for them too
+				bool hasBatch = false;
+				gl::TransformObject batchTransform;
+				Mat4 batchInverse;
+
 				for (auto &cmd : state.second) {
-					for (auto &iit : cmd.vertexes) {
-						gl::TransformObject val(iit.mat);
+					if (!cmd.instances.empty()) {
+						// drawn with separate instanced spans
+						continue;
+					}
 
-						auto pathIt = paths.find(cmd.cmd->zPath);
-						if (pathIt != paths.end()) {
-							val.offset.z = pathIt->second;
+					for (auto &iit : cmd.vertexes) {
+						auto val = makeTransform(cmd, iit.mat);
+
+						Vec3 translation;
+						if (hasBatch && val.offset == batchTransform.offset && val.shadow == batchTransform.shadow
+								&& getBatchTranslation(batchInverse, iit.mat, translation)) {
+							pushVertexes(writeTarget, it->first, it->second, cmd.cmd,
+									translation.isZero() ? nullptr : &translation, iit.data.get());
+							++ batchedTransforms;
+						} else {
+							pushTransform(writeTarget, val);
+							pushVertexes(writeTarget, it->first, it->second, cmd.cmd, nullptr, iit.data.get());
+
+							// projection might be degenerate, do not batch with it
+							hasBatch = std::abs(iit.mat.determinant()) > std::numeric_limits<float>::epsilon();
+							if (hasBatch) {
+								batchTransform = val;
+								batchInverse = iit.mat.getInversed();
+							}
 						}
+					}
+				}
 
-						if (cmd.cmd->depthValue > 0.0f) {
-							auto f16 = halffloat::encode(cmd.cmd->depthValue);
-							auto value = halffloat::decode(f16);
-							val.shadow = Vec4(value, value, value, 1.0);
-						}
+				if (materialIndexes > 0) {
+					spans.emplace_back(gl::VertexSpan({ it->first, materialIndexes, 1, indexOffset - materialIndexes, state.first}));
+				}
 
-						pushVertexes(writeTarget, it->first, it->second, cmd.cmd, val, iit.data.get());
+				// base vertexes of instanced command are written once, instances are read by vertex shader with gl_InstanceIndex
+				for (auto &cmd : state.second) {
+					if (cmd.instances.empty()) {
+						continue;
 					}
-				}
 
-				spans.emplace_back(gl::VertexSpan({ it->first, materialIndexes, 1, indexOffset - materialIndexes, state.first}));
+					for (auto &iit : cmd.vertexes) {
+						materialVertexes = 0;
+						materialIndexes = 0;
+
+						pushTransform(writeTarget, makeTransform(cmd, iit.mat));
+						pushVertexes(writeTarget, it->first, it->second, cmd.cmd, nullptr, iit.data.get());
+
+						auto firstInstance = pushInstances(writeTarget, cmd.instances);
+
+						spans.emplace_back(gl::VertexSpan({ it->first, materialIndexes, uint32_t(cmd.instances.size()),
+							indexOffset - materialIndexes, state.first, firstInstance, true}));
+					}
+				}
 			}
 		}
 	}
@@ -546,6 +683,9 @@ bool VertexMaterialAttachmentHandle::loadVertexes(FrameHandle &fhandle, const Rc
 		case gl::CommandType::Deferred:
 			plan.pushDeferred(_materialSet.get(), cmd, (const gl::CmdDeferred *)cmd->data);
 			break;
+		case gl::CommandType::InstanceArray:
+			plan.pushInstanceData(_materialSet.get(), cmd, (const gl::CmdInstanceArray *)cmd->data);
+			break;
 		case gl::CommandType::ShadowArray:
 		case gl::CommandType::ShadowDeferred:
 			break;
@@ -579,14 +719,25 @@ bool VertexMaterialAttachmentHandle::loadVertexes(FrameHandle &fhandle, const Rc
 		return false;
 	}
 
-	DeviceBuffer::MappedRegion vertexesMap, indexesMap, transformMap;
+	if (plan.globalWritePlan.instances > 0) {
+		_instances = pool->spawn(AllocationUsage::DeviceLocalHostVisible,
+				gl::BufferInfo(gl::BufferUsage::StorageBuffer, plan.globalWritePlan.instances * sizeof(gl::InstanceObject)));
+		if (!_instances) {
+			return false;
+		}
+	}
+
+	DeviceBuffer::MappedRegion vertexesMap, indexesMap, transformMap, instancesMap;
 
-	Bytes vertexData, indexData, transformData;
+	Bytes vertexData, indexData, transformData, instanceData;
 
 	if (fhandle.isPersistentMapping()) {
 		vertexesMap = _vertexes->map();
 		indexesMap = _indexes->map();
 		transformMap = _transforms->map();
+		if (_instances) {
+			instancesMap = _instances->map();
+		}
 
 		memset(vertexesMap.ptr, 0, sizeof(gl::Vertex_V4F_V4F_T2F2U) * 1024);
 		memset(indexesMap.ptr, 0, sizeof(uint32_t) * 1024);
@@ -598,9 +749,14 @@ bool VertexMaterialAttachmentHandle::loadVertexes(FrameHandle &fhandle, const Rc
 		vertexesMap.ptr = vertexData.data(); vertexesMap.size = vertexData.size();
 		indexesMap.ptr = indexData.data(); indexesMap.size = indexData.size();
 		transformMap.ptr = transformData.data(); transformMap.size = transformData.size();
+
+		if (_instances) {
+			instanceData.resize(_instances->getSize());
+			instancesMap.ptr = instanceData.data(); instancesMap.size = instanceData.size();
+		}
 	}
 
-	VertexMaterialDrawPlan::WriteTarget writeTarget{transformMap.ptr, vertexesMap.ptr, indexesMap.ptr};
+	VertexMaterialDrawPlan::WriteTarget writeTarget{transformMap.ptr, vertexesMap.ptr, indexesMap.ptr, instancesMap.ptr};
 
 	// write initial full screen quad
 	plan.pushAll(_spans, writeTarget);
@@ -609,10 +765,21 @@ bool VertexMaterialAttachmentHandle::loadVertexes(FrameHandle &fhandle, const Rc
 		_vertexes->unmap(vertexesMap, true);
 		_indexes->unmap(indexesMap, true);
 		_transforms->unmap(transformMap, true);
+		if (_instances) {
+			_instances->unmap(instancesMap, true);
+		}
 	} else {
 		_vertexes->setData(vertexData);
 		_indexes->setData(indexData);
 		_transforms->setData(transformData);
+		if (_instances) {
+			_instances->setData(instanceData);
+		}
+	}
+
+	auto dev = handle->getAllocator()->getDevice();
+	if (dev->hasMultiDrawIndirect() && dev->hasDrawIndirectFirstInstance()) {
+		writeIndirectCommands(pool);
 	}
 
 	_drawStat.vertexes = plan.globalWritePlan.vertexes - plan.excludeVertexes;
@@ -623,14 +790,40 @@ bool VertexMaterialAttachmentHandle::loadVertexes(FrameHandle &fhandle, const Rc
 	_drawStat.solidCmds = plan.solidCmds;
 	_drawStat.surfaceCmds = plan.surfaceCmds;
 	_drawStat.transparentCmds = plan.transparentCmds;
+	_drawStat.transforms = plan.transformIdx;
+	_drawStat.batchedTransforms = plan.batchedTransforms;
 	_drawStat.vertexInputTime = platform::device::_clock() - t;
 
-	commands->sendStat(_drawStat);
-
+	// stat will be sent by render pass, when commands recording time is known
 	_commands = commands;
 	return true;
 }
 
+bool VertexMaterialAttachmentHandle::writeIndirectCommands(const Rc<DeviceMemoryPool> &pool) {
+	_indirect = pool->spawn(AllocationUsage::DeviceLocalHostVisible,
+			gl::BufferInfo(gl::BufferUsage::IndirectBuffer, _spans.size() * sizeof(VkDrawIndexedIndirectCommand)));
+	if (!_indirect) {
+		return false;
+	}
+
+	Vector<VkDrawIndexedIndirectCommand> commands; commands.reserve(_spans.size());
+	for (auto &it : _spans) {
+		auto materialOrderIdx = _materialSet->getMaterialOrder(it.material);
+		if (it.instanced || materialOrderIdx == maxOf<uint32_t>()) {
+			// instanced spans are drawn directly; for removed material - draw nothing
+			commands.emplace_back(VkDrawIndexedIndirectCommand{it.indexCount, 0, it.firstIndex, 0, 0});
+		} else {
+			commands.emplace_back(VkDrawIndexedIndirectCommand{it.indexCount, 1, it.firstIndex, 0, materialOrderIdx});
+		}
+	}
+
+	if (!_indirect->setData(BytesView((const uint8_t *)commands.data(), commands.size() * sizeof(VkDrawIndexedIndirectCommand)))) {
+		_indirect = nullptr;
+		return false;
+	}
+	return true;
+}
+
 gl::ImageFormat MaterialVertexPass::select2dDepthFormat(SpanView<gl::ImageFormat> formats) {
 	gl::ImageFormat ret = gl::ImageFormat::Undefined;
 
@@ -705,17 +898,38 @@ bool MaterialVertexPassHandle::prepare(FrameQueue &q, Function<void(bool)> &&cb)
 	return QueuePassHandle::prepare(q, move(cb));
 }
 
+struct MaterialVertexPassRecordData : public Ref {
+	struct Range {
+		SpanView<gl::VertexSpan> spans;
+		Rc<CommandPool> pool;
+		const CommandBuffer *buffer = nullptr;
+	};
+
+	Vector<Range> ranges;
+	std::atomic<size_t> next = 0;
+	size_t finished = 0;
+
+	Mutex mutex;
+	std::condition_variable cond;
+};
+
 Vector<const CommandBuffer *> MaterialVertexPassHandle::doPrepareCommands(FrameHandle &handle) {
-	auto buf = _pool->recordBuffer(*_device, [&] (CommandBuffer &buf) {
-		auto materials = _materialBuffer->getSet().get();
+	auto t = platform::device::_clock();
+	auto materials = _materialBuffer->getSet().get();
+
+	_commands = _vertexBuffer->popCommands();
+	_partialRender = prepareRenderArea();
+	_secondaryBuffers = recordSecondaryBuffers(handle, materials);
 
+	auto buf = _pool->recordBuffer(*_device, [&] (CommandBuffer &buf) {
 		Vector<ImageMemoryBarrier> outputImageBarriers;
 		Vector<BufferMemoryBarrier> outputBufferBarriers;
 
 		doFinalizeTransfer(materials, outputImageBarriers, outputBufferBarriers);
 
-		if (!outputBufferBarriers.empty() && !outputImageBarriers.empty()) {
-			buf.cmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+		if (!outputBufferBarriers.empty() || !outputImageBarriers.empty()) {
+			// pending images can be written with transfer (compiled images) or with render pass (offscreen layers)
+			buf.cmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
 				VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
 				outputBufferBarriers, outputImageBarriers);
 		}
@@ -724,32 +938,190 @@ Vector<const CommandBuffer *> MaterialVertexPassHandle::doPrepareCommands(FrameH
 
 		_data->impl.cast<RenderPassImpl>()->perform(*this, buf, [&] {
 			prepareMaterialCommands(materials, buf);
-		});
+		}, _secondaryBuffers.empty() ? VK_SUBPASS_CONTENTS_INLINE : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS,
+				_partialRender ? &_renderArea : nullptr);
 
 		finalizeRenderPass(buf);
 		return true;
 	});
 
+	if (_commands) {
+		auto stat = _vertexBuffer->getDrawStat();
+		stat.commandsRecordTime = platform::device::_clock() - t;
+		stat.secondaryBuffers = _secondaryBuffers.size();
+		_commands->sendStat(stat);
+	}
+
 	return Vector<const CommandBuffer *>{buf};
 }
 
-void MaterialVertexPassHandle::prepareRenderPass(CommandBuffer &) { }
+static VkRect2D MaterialVertexPassHandle_intersect(const VkRect2D &a, const VkRect2D &b) {
+	auto minX = std::max(a.offset.x, b.offset.x);
+	auto minY = std::max(a.offset.y, b.offset.y);
+	auto maxX = std::min(a.offset.x + int32_t(a.extent.width), b.offset.x + int32_t(b.extent.width));
+	auto maxY = std::min(a.offset.y + int32_t(a.extent.height), b.offset.y + int32_t(b.extent.height));
 
-void MaterialVertexPassHandle::prepareMaterialCommands(gl::MaterialSet * materials, CommandBuffer &buf) {
+	if (maxX <= minX || maxY <= minY) {
+		return VkRect2D{ { minX, minY }, { 0, 0 } };
+	}
+	return VkRect2D{ { minX, minY }, { uint32_t(maxX - minX), uint32_t(maxY - minY) } };
+}
+
+bool MaterialVertexPassHandle::prepareRenderArea() {
 	auto &fb = getFramebuffer();
 	auto currentExtent = fb->getExtent();
-	auto commands = _vertexBuffer->popCommands();
-	auto pass = (RenderPassImpl *)_data->impl.get();
 
-	if (_vertexBuffer->empty() || !_vertexBuffer->getIndexes() || !_vertexBuffer->getVertexes()) {
+	_renderArea = VkRect2D{ { 0, 0}, { currentExtent.width, currentExtent.height } };
+
+	auto pass = (MaterialVertexPass *)_renderPass.get();
+	auto output = (const ImageAttachmentHandle *)getAttachmentHandle(pass->getOutput());
+	if (!_commands || !output || !output->getImage() || !output->getImage()->isSwapchainImage()) {
+		return false;
+	}
+
+	auto image = (SwapchainImage *)output->getImage().get();
+	auto &swapchain = image->getSwapchain();
+	if (!swapchain || !swapchain->isDamageTrackingEnabled()) {
+		return false;
+	}
+
+	// damage is in world space, bound it with screen extent before conversion into framebuffer coordinates
+	Extent2 worldExtent(_constraints.extent.width, _constraints.extent.height);
+	switch (_constraints.transform) {
+	case gl::SurfaceTransformFlags::Rotate90:
+	case gl::SurfaceTransformFlags::Rotate270:
+		std::swap(worldExtent.width, worldExtent.height);
+		break;
+	default: break;
+	}
+
+	VkRect2D damage{ { 0, 0 }, { 0, 0 } };
+	auto &rect = _commands->getDamage();
+	auto minX = std::clamp(floorf(rect.origin.x), 0.0f, float(worldExtent.width));
+	auto minY = std::clamp(floorf(rect.origin.y), 0.0f, float(worldExtent.height));
+	auto maxX = std::clamp(ceilf(rect.origin.x + rect.size.width), 0.0f, float(worldExtent.width));
+	auto maxY = std::clamp(ceilf(rect.origin.y + rect.size.height), 0.0f, float(worldExtent.height));
+	if (maxX > minX && maxY > minY) {
+		damage = rotateScissor(_constraints, URect{uint32_t(minX), uint32_t(minY), uint32_t(maxX - minX), uint32_t(maxY - minY)});
+	}
+
+	VkRect2D area;
+	if (swapchain->acquireDamage(image->getImageIndex(), damage, _commands->isDamageFull(), area)) {
+		_renderArea = MaterialVertexPassHandle_intersect(_renderArea, area);
+		return _renderArea.extent.width > 0 && _renderArea.extent.height > 0;
+	}
+	return false;
+}
+
+void MaterialVertexPassHandle::prepareRenderPass(CommandBuffer &) { }
+
+void MaterialVertexPassHandle::prepareMaterialCommands(gl::MaterialSet * materials, CommandBuffer &buf) {
+	if (!_secondaryBuffers.empty()) {
+		buf.cmdExecuteCommands(_secondaryBuffers);
+		return;
+	}
+
+	if (!_commands || _vertexBuffer->empty() || !_vertexBuffer->getIndexes() || !_vertexBuffer->getVertexes()) {
 		return;
 	}
 
+	writeVertexSpans(buf, materials, _vertexBuffer->getVertexData());
+}
+
+Vector<const CommandBuffer *> MaterialVertexPassHandle::recordSecondaryBuffers(FrameHandle &handle, gl::MaterialSet *materials) {
+	auto &spans = _vertexBuffer->getVertexData();
+	if (!_commands || _vertexBuffer->empty() || !_vertexBuffer->getIndexes() || !_vertexBuffer->getVertexes()
+			|| spans.size() < SecondaryBuffersMinSpans) {
+		return Vector<const CommandBuffer *>();
+	}
+
+	auto pass = (RenderPassImpl *)_data->impl.get();
+	auto fb = (Framebuffer *)getFramebuffer().get();
+	auto alt = pass->isAlternativeRequired(*this);
+	auto familyIdx = _pool->getFamilyIdx();
+
+	// ranges in draw order: solid, surface, transparent
+	auto &stat = _vertexBuffer->getDrawStat();
+	auto data = Rc<MaterialVertexPassRecordData>::alloc();
+
+	size_t offset = 0;
+	for (size_t count : { size_t(stat.solidCmds), size_t(stat.surfaceCmds), size_t(stat.transparentCmds) }) {
+		count = std::min(count, spans.size() - offset);
+		if (count > 0) {
+			data->ranges.emplace_back(MaterialVertexPassRecordData::Range{SpanView<gl::VertexSpan>(spans.data() + offset, count)});
+		}
+		offset += count;
+	}
+
+	if (offset < spans.size()) {
+		data->ranges.emplace_back(MaterialVertexPassRecordData::Range{
+			SpanView<gl::VertexSpan>(spans.data() + offset, spans.size() - offset)});
+	}
+
+	// Each range is recorded with its own command pool, pools are not externally synchronized.
+	// Recording thread takes ranges, not yet taken by worker threads, so we never wait for queued tasks
+	auto process = [this, data, materials, pass, fb, alt, familyIdx] {
+		size_t idx = 0;
+		while ((idx = data->next.fetch_add(1)) < data->ranges.size()) {
+			auto &range = data->ranges[idx];
+			range.pool = _device->acquireCommandPool(familyIdx);
+			if (range.pool) {
+				range.buffer = range.pool->recordSecondaryBuffer(*_device, pass, 0, fb, alt, [&] (CommandBuffer &buf) {
+					writeVertexSpans(buf, materials, range.spans);
+					return true;
+				});
+			}
+
+			std::unique_lock<Mutex> lock(data->mutex);
+			++ data->finished;
+			data->cond.notify_all();
+		}
+	};
+
+	for (size_t i = 1; i < data->ranges.size(); ++ i) {
+		handle.performInQueue([process] (FrameHandle &) {
+			process();
+		}, this, "MaterialVertexPassHandle::recordSecondaryBuffers");
+	}
+
+	process();
+
+	std::unique_lock<Mutex> lock(data->mutex);
+	data->cond.wait(lock, [&] {
+		return data->finished == data->ranges.size();
+	});
+
+	Vector<const CommandBuffer *> ret;
+	bool success = true;
+	for (auto &it : data->ranges) {
+		if (it.pool) {
+			_secondaryPools.emplace_back(move(it.pool));
+		}
+		if (it.buffer) {
+			ret.emplace_back(it.buffer);
+		} else {
+			success = false;
+		}
+	}
+
+	if (!success) {
+		// fallback to inline recording, pools will be released with pass
+		log::vtext("MaterialVertexPassHandle", "Fail to record secondary buffers, fallback to inline recording");
+		ret.clear();
+	}
+
+	return ret;
+}
+
+void MaterialVertexPassHandle::writeVertexSpans(CommandBuffer &buf, gl::MaterialSet *materials, SpanView<gl::VertexSpan> spans) const {
+	auto &fb = getFramebuffer();
+	auto currentExtent = fb->getExtent();
+	auto pass = (RenderPassImpl *)_data->impl.get();
+
 	VkViewport viewport{ 0.0f, 0.0f, float(currentExtent.width), float(currentExtent.height), 0.0f, 1.0f };
 	buf.cmdSetViewport(0, makeSpanView(&viewport, 1));
 
-	VkRect2D scissorRect{ { 0, 0}, { currentExtent.width, currentExtent.height } };
-	buf.cmdSetScissor(0, makeSpanView(&scissorRect, 1));
+	buf.cmdSetScissor(0, makeSpanView(&_renderArea, 1));
 
 	// bind primary descriptors
 	// default texture set comes with other sets
@@ -769,7 +1141,7 @@ void MaterialVertexPassHandle::prepareMaterialCommands(gl::MaterialSet * materia
 			return;
 		}
 
-		auto state = commands->getState(stateId);
+		auto state = _commands->getState(stateId);
 		if (!state) {
 			return;
 		}
@@ -777,31 +1149,43 @@ void MaterialVertexPassHandle::prepareMaterialCommands(gl::MaterialSet * materia
 		if (state->isScissorEnabled()) {
 			if (dynamicState.isScissorEnabled()) {
 				if (dynamicState.scissor != state->scissor) {
-					auto scissorRect = rotateScissor(_constraints, state->scissor);
+					auto scissorRect = MaterialVertexPassHandle_intersect(rotateScissor(_constraints, state->scissor), _renderArea);
 					buf.cmdSetScissor(0, makeSpanView(&scissorRect, 1));
 					dynamicState.scissor = state->scissor;
 				}
 			} else {
 				dynamicState.enabled |= renderqueue::DynamicState::Scissor;
-				auto scissorRect = rotateScissor(_constraints, state->scissor);
+				auto scissorRect = MaterialVertexPassHandle_intersect(rotateScissor(_constraints, state->scissor), _renderArea);
 				buf.cmdSetScissor(0, makeSpanView(&scissorRect, 1));
 				dynamicState.scissor = state->scissor;
 			}
 		} else {
 			if (dynamicState.isScissorEnabled()) {
 				dynamicState.enabled &= ~(renderqueue::DynamicState::Scissor);
-				VkRect2D scissorRect{ { 0, 0}, { currentExtent.width, currentExtent.height } };
-				buf.cmdSetScissor(0, makeSpanView(&scissorRect, 1));
+				buf.cmdSetScissor(0, makeSpanView(&_renderArea, 1));
 			}
 		}
 
 		dynamicStateId = stateId;
 	};
 
-	for (auto &materialVertexSpan : _vertexBuffer->getVertexData()) {
-		auto materialOrderIdx = materials->getMaterialOrder(materialVertexSpan.material);
+	auto indirect = _vertexBuffer->getIndirectCommands().get();
+	auto indirectOffset = size_t(spans.data() - _vertexBuffer->getVertexData().data());
+	auto maxDrawCount = std::max(_device->getMaxDrawIndirectCount(), uint32_t(1));
+
+	if (indirect) {
+		// material index is passed as firstInstance of each indirect command
+		uint32_t pushConstants[2] = { 0, 1 };
+		buf.cmdPushConstants(pass->getPipelineLayout(0),
+				VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, BytesView((const uint8_t *)pushConstants, sizeof(pushConstants)));
+	}
+
+	size_t spanIdx = 0;
+	while (spanIdx < spans.size()) {
+		auto &materialVertexSpan = spans[spanIdx];
 		auto material = materials->getMaterialById(materialVertexSpan.material);
 		if (!material) {
+			++ spanIdx;
 			continue;
 		}
 
@@ -830,16 +1214,48 @@ void MaterialVertexPassHandle::prepareMaterialCommands(gl::MaterialSet * materia
 
 		enableState(materialVertexSpan.state);
 
+		if (indirect && !materialVertexSpan.instanced) {
+			// consecutive spans with the same pipeline, texture set and dynamic state are drawn with single call
+			auto nextIdx = spanIdx + 1;
+			while (nextIdx < spans.size() && nextIdx - spanIdx < maxDrawCount) {
+				auto &next = spans[nextIdx];
+				auto nextMaterial = materials->getMaterialById(next.material);
+				if (!nextMaterial || next.instanced || next.state != materialVertexSpan.state
+						|| nextMaterial->getPipeline()->pipeline != pipeline || nextMaterial->getLayoutIndex() != textureSetIndex) {
+					break;
+				}
+				++ nextIdx;
+			}
+
+			buf.cmdDrawIndexedIndirect(indirect, (indirectOffset + spanIdx) * sizeof(VkDrawIndexedIndirectCommand),
+					uint32_t(nextIdx - spanIdx), sizeof(VkDrawIndexedIndirectCommand));
+			spanIdx = nextIdx;
+			continue;
+		}
+
+		// material index and flags, instance data is read with gl_InstanceIndex for instanced spans
+		uint32_t pushConstants[2] = {
+			materials->getMaterialOrder(materialVertexSpan.material),
+			materialVertexSpan.instanced ? uint32_t(2) : uint32_t(0)
+		};
 		buf.cmdPushConstants(pass->getPipelineLayout(0),
-				VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, BytesView((const uint8_t *)&materialOrderIdx, sizeof(uint32_t)));
+				VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, BytesView((const uint8_t *)pushConstants, sizeof(pushConstants)));
 
 		buf.cmdDrawIndexed(
 			materialVertexSpan.indexCount, // indexCount
 			materialVertexSpan.instanceCount, // instanceCount
 			materialVertexSpan.firstIndex, // firstIndex
 			0, // int32_t   vertexOffset
-			0  // uint32_t  firstInstance
+			materialVertexSpan.firstInstance  // uint32_t  firstInstance
 		);
+
+		if (indirect) {
+			// restore indirect mode for next spans
+			uint32_t indirectConstants[2] = { 0, 1 };
+			buf.cmdPushConstants(pass->getPipelineLayout(0),
+					VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, BytesView((const uint8_t *)indirectConstants, sizeof(indirectConstants)));
+		}
+		++ spanIdx;
 	}
 }
 
@@ -61,8 +61,15 @@ public:
 	const Rc<DeviceBuffer> &getVertexes() const { return _vertexes; }
 	const Rc<DeviceBuffer> &getIndexes() const { return _indexes; }
 
+	// VkDrawIndexedIndirectCommand for each vertex span, material index passed as firstInstance
+	// nullptr if device can not draw indirect with firstInstance
+	const Rc<DeviceBuffer> &getIndirectCommands() const { return _indirect; }
+
 	Rc<gl::CommandList> popCommands() const;
 
+	// stat for last loaded vertexes, sent to command list by render pass after commands recording
+	const gl::DrawStat &getDrawStat() const { return _drawStat; }
+
 	bool empty() const;
 
 protected:
@@ -70,9 +77,13 @@ protected:
 
 	virtual bool isGpuTransform() const { return false; }
 
+	bool writeIndirectCommands(const Rc<DeviceMemoryPool> &);
+
 	Rc<DeviceBuffer> _indexes;
 	Rc<DeviceBuffer> _vertexes;
 	Rc<DeviceBuffer> _transforms;
+	Rc<DeviceBuffer> _instances;
+	Rc<DeviceBuffer> _indirect;
 	Vector<gl::VertexSpan> _spans;
 
 	Rc<gl::MaterialSet> _materialSet;
@@ -90,6 +101,7 @@ public:
 
 	virtual ~MaterialVertexPass() { }
 
+	const AttachmentData *getOutput() const { return _output; }
 	const AttachmentData *getVertexes() const { return _vertexes; }
 	const AttachmentData *getMaterials() const { return _materials; }
 
@@ -109,6 +121,10 @@ protected:
 
 class MaterialVertexPassHandle : public QueuePassHandle {
 public:
+	// Minimal number of draw spans in frame to record solid, surface and transparent ranges
+	// into secondary buffers in parallel; smaller frames are recorded inline
+	static constexpr size_t SecondaryBuffersMinSpans = 64;
+
 	virtual ~MaterialVertexPassHandle() { }
 
 	virtual bool prepare(FrameQueue &, Function<void(bool)> &&) override;
@@ -120,8 +136,23 @@ protected:
 	virtual void prepareMaterialCommands(gl::MaterialSet * materials, CommandBuffer &);
 	virtual void finalizeRenderPass(CommandBuffer &);
 
+	// records draw ranges for first subpass into secondary buffers, returns empty vector if inline recording should be used
+	virtual Vector<const CommandBuffer *> recordSecondaryBuffers(FrameHandle &, gl::MaterialSet *);
+
+	// acquire area to redraw from frame damage, when rendering into swapchain image with damage tracking
+	// returns true if only part of output should be redrawn (see SwapchainHandle::acquireDamage)
+	virtual bool prepareRenderArea();
+
+	void writeVertexSpans(CommandBuffer &, gl::MaterialSet *, SpanView<gl::VertexSpan>) const;
+
 	const VertexMaterialAttachmentHandle *_vertexBuffer = nullptr;
 	const MaterialAttachmentHandle *_materialBuffer = nullptr;
+
+	Rc<gl::CommandList> _commands;
+	Vector<const CommandBuffer *> _secondaryBuffers;
+
+	VkRect2D _renderArea{ { 0, 0 }, { 0, 0 } }; // scissor bounds for all draw commands
+	bool _partialRender = false;
 };
 
 }
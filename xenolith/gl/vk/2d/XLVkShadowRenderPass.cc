@@ -427,6 +427,7 @@ bool ShadowVertexAttachmentHandle::loadVertexes(FrameHandle &fhandle, const Rc<g
 		case gl::CommandType::CommandGroup:
 		case gl::CommandType::VertexArray:
 		case gl::CommandType::Deferred:
+		case gl::CommandType::InstanceArray:
 			break;
 		case gl::CommandType::ShadowArray:
 			plan.emplaceWritePlan(cmd, (const gl::CmdShadowArray *)cmd->data, ((const gl::CmdShadowArray *)cmd->data)->vertexes);
@@ -56,3 +56,4 @@ THE SOFTWARE.
 #include "XLVkObject.cc"
 #include "XLVkTextureSet.cc"
 #include "XLVkSwapchain.cc"
+#include "XLVkCallTracer.cc"
@@ -55,14 +55,22 @@ namespace stappler::xenolith::vk {
 
 #if DEBUG
 #define VK_DEBUG_LOG 1
-#define VK_HOOK_DEBUG 0 // enable engine hooks for Vulkan calls
 static constexpr bool s_enableValidationLayers = true;
 #else
 #define VK_DEBUG_LOG 0
-#define VK_HOOK_DEBUG 0 // enable engine hooks for Vulkan calls
 static constexpr bool s_enableValidationLayers = false;
 #endif
 
+// compile engine hooks for Vulkan calls (used only when CallTracer is installed),
+// can be enabled for release builds with build flags
+#ifndef VK_HOOK_DEBUG
+#if DEBUG
+#define VK_HOOK_DEBUG 1
+#else
+#define VK_HOOK_DEBUG 0
+#endif
+#endif
+
 [[maybe_unused]] static const char * const s_validationLayers[] = {
     "VK_LAYER_KHRONOS_validation"
 };
@@ -108,6 +116,9 @@ static const char * const s_optionalDeviceExtensions[] = {
 	VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
 	VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME,
 	VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME,
+
+	// Partial present for damage-tracked frames
+	VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME,
 #if __APPLE__
 	VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME,
 #endif
@@ -128,6 +139,7 @@ enum class ExtensionFlags {
 	GetMemoryRequirements2 = 1 << 9,
 	DedicatedAllocation = 1 << 10,
 	Portability = 1 << 11,
+	IncrementalPresent = 1 << 12,
 };
 
 SP_DEFINE_ENUM_AS_MASK(ExtensionFlags);
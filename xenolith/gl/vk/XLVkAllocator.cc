@@ -141,6 +141,9 @@ Allocator::~Allocator() { }
 bool Allocator::init(Device &dev, VkPhysicalDevice device, const DeviceInfo::Features &features, const DeviceInfo::Properties &props) {
 	_device = &dev;
 	_bufferImageGranularity = props.device10.properties.limits.bufferImageGranularity;
+	for (auto &it : _heapAllocated) {
+		it = 0;
+	}
 	_nonCoherentAtomSize = props.device10.properties.limits.nonCoherentAtomSize;
 
 	if ((features.flags & ExtensionFlags::GetMemoryRequirements2) != ExtensionFlags::None) {
@@ -243,6 +246,13 @@ bool Allocator::init(Device &dev, VkPhysicalDevice device, const DeviceInfo::Fea
 }
 
 void Allocator::invalidate(Device &dev) {
+	// storage pools returns its nodes into allocator on destruction
+	std::unique_lock<Mutex> lock(_framePoolMutex);
+	for (auto &it : _framePools) {
+		it = nullptr;
+	}
+	lock.unlock();
+
 	for (auto &type : _memTypes) {
 		for (auto &nodes : type->buf) {
 			for (auto &node : nodes) {
@@ -275,6 +285,77 @@ void Allocator::update() {
 	}
 }
 
+gl::MemoryStat Allocator::getMemoryStat() {
+	update();
+
+	gl::MemoryStat ret;
+	ret.hasBudget = _hasBudget;
+	for (auto &it : _memHeaps) {
+		if (ret.heapCount >= gl::MemoryStat::MaxHeaps) {
+			break;
+		}
+
+		auto &heap = ret.heaps[ret.heapCount ++];
+		heap.size = it.heap.size;
+		heap.deviceLocal = (it.heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+		if (_hasBudget) {
+			heap.budget = it.budget;
+			heap.usage = it.usage;
+		} else {
+			heap.budget = it.heap.size;
+			heap.usage = _heapAllocated[it.idx].load();
+		}
+	}
+	return ret;
+}
+
+void Allocator::trackAllocation(uint32_t typeIdx, VkDeviceSize size) {
+	if (typeIdx < _memTypes.size()) {
+		_heapAllocated[_memTypes[typeIdx]->type.heapIndex] += size;
+	}
+}
+
+void Allocator::trackRelease(uint32_t typeIdx, VkDeviceSize size) {
+	if (typeIdx < _memTypes.size()) {
+		_heapAllocated[_memTypes[typeIdx]->type.heapIndex] -= size;
+	}
+}
+
+Rc<DeviceMemoryPool> Allocator::getFramePoolStorage(bool persistentMapping) {
+	std::unique_lock<Mutex> lock(_framePoolMutex);
+	auto &pool = _framePools[persistentMapping ? 1 : 0];
+	if (!pool) {
+		pool = Rc<DeviceMemoryPool>::create(Rc<Allocator>(this), persistentMapping);
+	}
+	return pool;
+}
+
+Vector<gl::MemoryPoolStat> Allocator::getPoolStat() const {
+	Map<uint32_t, gl::MemoryPoolStat> stats;
+
+	std::unique_lock<Mutex> lock(_framePoolMutex);
+	for (auto &pool : _framePools) {
+		if (!pool) {
+			continue;
+		}
+		for (auto &it : pool->getStat()) {
+			auto &stat = stats.emplace(it.type, gl::MemoryPoolStat{it.type}).first->second;
+			stat.reserved += it.reserved;
+			stat.used += it.used;
+			stat.free += it.free;
+			stat.freeBlocks += it.freeBlocks;
+			stat.largestFree = std::max(stat.largestFree, it.largestFree);
+		}
+	}
+	lock.unlock();
+
+	Vector<gl::MemoryPoolStat> ret; ret.reserve(stats.size());
+	for (auto &it : stats) {
+		ret.emplace_back(it.second);
+	}
+	return ret;
+}
+
 uint32_t Allocator::getInitialTypeMask() const {
 	uint32_t ret = 0;
 	for (size_t i = 0; i < _memProperties.memoryProperties.memoryTypeCount; ++ i) {
@@ -422,6 +503,8 @@ Allocator::MemNode Allocator::alloc(MemType *type, uint64_t in_size, bool persis
 		}
 	}
 
+	trackAllocation(type->idx, size);
+
 	ret.index = index;
 	ret.size = size;
 	ret.offset = 0;
@@ -482,6 +565,7 @@ void Allocator::free(MemType *type, SpanView<MemNode> nodes) {
 		_device->makeApiCall([&] (const DeviceTable &table, VkDevice device) {
 			table.vkFreeMemory(device, it.mem, nullptr);
 		});
+		trackRelease(type->idx, it.size);
 	}
 }
 
@@ -756,7 +840,7 @@ Rc<DeviceMemory> Allocator::emplaceObjects(AllocationUsage usage, SpanView<Rc<Im
 		}
 	}
 
-	auto memory = Rc<DeviceMemory>::create(*_device, memObject);
+	auto memory = Rc<DeviceMemory>::create(*_device, memObject, allocMemType->idx, requiredMemory);
 
 	// bind memory
 	if (nonLinearObjects > 0) {
@@ -801,6 +885,55 @@ Rc<DeviceMemory> Allocator::emplaceObjects(AllocationUsage usage, SpanView<Rc<Im
 	return memory;
 }
 
+Rc<DeviceMemory> Allocator::emplaceAliasedObjects(AllocationUsage usage, SpanView<Rc<Image>> images, VkDeviceSize *size) {
+	auto mask = getInitialTypeMask();
+	VkDeviceSize requiredMemory = 0;
+
+	for (auto &it : images) {
+		auto req = getImageMemoryRequirements(it->getImage());
+		if (req.requiresDedicated) {
+			return nullptr;
+		}
+		mask &= req.requirements.memoryTypeBits;
+		if (mask == 0) {
+			log::text("vk::Allocator", "emplaceAliasedObjects: fail to find common memory type");
+			return nullptr;
+		}
+		requiredMemory = std::max(requiredMemory, req.requirements.size);
+	}
+
+	auto allocMemType = findMemoryType(mask, usage);
+	if (!allocMemType) {
+		log::vtext("vk::Allocator", "emplaceAliasedObjects: fail to find memory type");
+		return nullptr;
+	}
+
+	if (requiredMemory == 0) {
+		return nullptr;
+	}
+
+	VkMemoryAllocateInfo allocInfo{};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = requiredMemory;
+	allocInfo.memoryTypeIndex = allocMemType->idx;
+
+	VkDeviceMemory memObject;
+	if (_device->getTable()->vkAllocateMemory(_device->getDevice(), &allocInfo, nullptr, &memObject) != VK_SUCCESS) {
+		log::vtext("vk::Allocator", "emplaceAliasedObjects: fail to allocate memory");
+		return nullptr;
+	}
+
+	auto memory = Rc<DeviceMemory>::create(*_device, memObject, allocMemType->idx, requiredMemory);
+	for (auto &it : images) {
+		it->bindMemory(Rc<DeviceMemory>(memory), 0);
+	}
+
+	if (size) {
+		*size = requiredMemory;
+	}
+	return memory;
+}
+
 bool Allocator::allocateDedicated(AllocationUsage usage, Buffer *target) {
 	auto req = getBufferMemoryRequirements(target->getBuffer());
 	auto type = findMemoryType(req.requirements.memoryTypeBits, usage);
@@ -846,7 +979,7 @@ bool Allocator::allocateDedicated(AllocationUsage usage, Buffer *target) {
 		}
 	}
 
-	target->bindMemory(Rc<DeviceMemory>::create(*_device, memory));
+	target->bindMemory(Rc<DeviceMemory>::create(*_device, memory, type->idx, req.requirements.size));
 	return true;
 }
 
@@ -897,7 +1030,7 @@ bool Allocator::allocateDedicated(AllocationUsage usage, Image *target) {
 		}
 	}
 
-	target->bindMemory(Rc<DeviceMemory>::create(*_device, memory));
+	target->bindMemory(Rc<DeviceMemory>::create(*_device, memory, type->idx, req.requirements.size));
 	return true;
 }
 
@@ -907,8 +1040,12 @@ DeviceMemoryPool::~DeviceMemoryPool() {
 			it->invalidate(*_allocator->getDevice());
 		}
 		_buffers.clear();
-		for (auto &it : _heaps) {
-			clear(&it.second);
+		if (_storage) {
+			_storage->trim();
+		} else {
+			for (auto &it : _heaps) {
+				clear(&it.second);
+			}
 		}
 	}
 }
@@ -919,6 +1056,13 @@ bool DeviceMemoryPool::init(const Rc<Allocator> &alloc, bool persistentMapping)
 	return true;
 }
 
+bool DeviceMemoryPool::init(const Rc<DeviceMemoryPool> &storage) {
+	_allocator = storage->getAllocator();
+	_persistentMapping = storage->_persistentMapping;
+	_storage = storage;
+	return true;
+}
+
 Rc<DeviceBuffer> DeviceMemoryPool::spawn(AllocationUsage type, const gl::BufferInfo &info) {
 	VkBufferCreateInfo bufferInfo { };
 	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -946,16 +1090,18 @@ Rc<DeviceBuffer> DeviceMemoryPool::spawn(AllocationUsage type, const gl::BufferI
 			return nullptr;
 		}
 
-		std::unique_lock<Mutex> lock(_mutex);
+		auto storage = getStorage();
+
+		std::unique_lock<Mutex> lock(storage->_mutex);
 		MemData *pool = nullptr;
-		auto it = _heaps.find(memType->idx);
-		if (it == _heaps.end()) {
-			pool = &_heaps.emplace(memType->idx, MemData{memType}).first->second;
+		auto it = storage->_heaps.find(memType->idx);
+		if (it == storage->_heaps.end()) {
+			pool = &storage->_heaps.emplace(memType->idx, MemData{memType}).first->second;
 		} else {
 			pool = &it->second;
 		}
 
-		if (auto mem = alloc(pool, requirements.requirements.size,
+		if (auto mem = storage->alloc(pool, requirements.requirements.size,
 				requirements.requirements.alignment, AllocationType::Linear, type)) {
 			if (dev->getTable()->vkBindBufferMemory(dev->getDevice(), target, mem.mem, mem.offset) == VK_SUCCESS) {
 				auto ret = Rc<DeviceBuffer>::create(this, target, move(mem), type, info);
@@ -990,16 +1136,43 @@ Allocator::MemBlock DeviceMemoryPool::alloc(MemData *mem, VkDeviceSize in_size,
 
 	auto size = math::align<VkDeviceSize>(in_size, alignment);
 
+	if (mem->type->isHostVisible() && !mem->type->isHostCoherent()) {
+		alignment = math::align<VkDeviceSize>(alignment, _allocator->getNonCoherentAtomSize());
+	}
+
+	// pool allocates only linear resources, so, free ranges can be reused without granularity checks
+	if (allocType == AllocationType::Linear && mem->free.count > 0) {
+		if (auto block = mem->free.extract(size, alignment)) {
+			auto &ranges = mem->ranges[block.mem];
+			ranges.erase(block.offset);
+
+			auto alignedOffset = math::align<VkDeviceSize>(block.offset, alignment);
+			if (alignedOffset > block.offset) {
+				Allocator::MemBlock front(block);
+				front.size = alignedOffset - block.offset;
+				ranges.emplace(front.offset, front);
+				mem->free.insert(front);
+			}
+
+			if (alignedOffset + size < block.offset + block.size) {
+				Allocator::MemBlock back(block);
+				back.offset = alignedOffset + size;
+				back.size = block.offset + block.size - back.offset;
+				ranges.emplace(back.offset, back);
+				mem->free.insert(back);
+			}
+
+			mem->used += size;
+			return Allocator::MemBlock({block.mem, alignedOffset, size, mem->type->idx, block.ptr});
+		}
+	}
+
 	Allocator::MemNode *node = nullptr;
 
 	size_t alignedOffset = 0;
 	for (auto &it : mem->mem) {
 		alignedOffset = math::align<VkDeviceSize>(it.offset, alignment);
 
-		if (mem->type->isHostVisible() && !mem->type->isHostCoherent()) {
-			alignedOffset = math::align<VkDeviceSize>(alignedOffset, _allocator->getNonCoherentAtomSize());
-		}
-
 		if (it.lastAllocation != allocType && it.lastAllocation != AllocationType::Unknown) {
 			alignedOffset = math::align<VkDeviceSize>(alignedOffset, _allocator->getBufferImageGranularity());
 		}
@@ -1021,6 +1194,7 @@ Allocator::MemBlock DeviceMemoryPool::alloc(MemData *mem, VkDeviceSize in_size,
 	if (node && node->mem) {
 		node->offset = alignedOffset + size;
 		node->lastAllocation = allocType;
+		mem->used += size;
 		return Allocator::MemBlock({node->mem, alignedOffset, size, mem->type->idx, node->ptr});
 	}
 
@@ -1028,16 +1202,236 @@ Allocator::MemBlock DeviceMemoryPool::alloc(MemData *mem, VkDeviceSize in_size,
 }
 
 void DeviceMemoryPool::free(Allocator::MemBlock &&block) {
+	if (_storage) {
+		_storage->free(move(block));
+		return;
+	}
+
+	std::unique_lock<Mutex> lock(_mutex);
 	auto it = _heaps.find(block.type);
-	if (it != _heaps.end()) {
-		it->second.freed.emplace_back(move(block));
+	if (it == _heaps.end()) {
+		return;
+	}
+
+	auto mem = &it->second;
+	auto nodeIt = std::find_if(mem->mem.begin(), mem->mem.end(), [&] (const Allocator::MemNode &node) {
+		return node.mem == block.mem;
+	});
+	if (nodeIt == mem->mem.end()) {
+		return;
+	}
+
+	mem->used -= std::min(mem->used, block.size);
+
+	auto &ranges = mem->ranges[block.mem];
+
+	// coalesce with next free range
+	auto next = ranges.find(block.offset + block.size);
+	if (next != ranges.end()) {
+		mem->free.remove(next->second);
+		block.size += next->second.size;
+		ranges.erase(next);
+	}
+
+	// coalesce with previous free range
+	auto prev = ranges.lower_bound(block.offset);
+	if (prev != ranges.begin()) {
+		-- prev;
+		if (prev->first + prev->second.size == block.offset) {
+			mem->free.remove(prev->second);
+			block.offset = prev->first;
+			block.size += prev->second.size;
+			ranges.erase(prev);
+		}
+	}
+
+	if (block.offset + block.size == nodeIt->offset) {
+		// range on the tail of node, return it to node's linear space
+		nodeIt->offset = block.offset;
+		if (nodeIt->offset == 0) {
+			nodeIt->lastAllocation = AllocationType::Unknown;
+		}
+	} else {
+		ranges.emplace(block.offset, block);
+		mem->free.insert(block);
 	}
 }
 
 void DeviceMemoryPool::clear(MemData *mem) {
 	_allocator->free(mem->type, mem->mem);
 	mem->mem.clear();
-	mem->freed.clear();
+	mem->free.clear();
+	mem->ranges.clear();
+	mem->used = 0;
+}
+
+void DeviceMemoryPool::trim() {
+	std::unique_lock<Mutex> lock(_mutex);
+	for (auto &it : _heaps) {
+		Vector<Allocator::MemNode> nodes;
+		auto nIt = it.second.mem.begin();
+		while (nIt != it.second.mem.end()) {
+			// node without live blocks: all its ranges was coalesced back into linear space
+			if (nIt->offset == 0) {
+				it.second.ranges.erase(nIt->mem);
+				nodes.emplace_back(*nIt);
+				nIt = it.second.mem.erase(nIt);
+			} else {
+				++ nIt;
+			}
+		}
+		if (!nodes.empty()) {
+			_allocator->free(it.second.type, nodes);
+		}
+	}
+}
+
+Vector<DeviceMemoryPool::MemStat> DeviceMemoryPool::getStat() const {
+	if (_storage) {
+		return _storage->getStat();
+	}
+
+	Vector<MemStat> ret;
+
+	std::unique_lock<Mutex> lock(_mutex);
+	for (auto &it : _heaps) {
+		MemStat stat;
+		stat.type = it.second.type->idx;
+		stat.used = it.second.used;
+		stat.free = it.second.free.size;
+		stat.freeBlocks = it.second.free.count;
+		stat.largestFree = it.second.free.getLargestBlock();
+		for (auto &node : it.second.mem) {
+			stat.reserved += node.size;
+			stat.free += node.getFreeSpace();
+			stat.largestFree = std::max(stat.largestFree, VkDeviceSize(node.getFreeSpace()));
+		}
+		ret.emplace_back(stat);
+	}
+	return ret;
+}
+
+static void DeviceMemoryPool_mapping(VkDeviceSize size, uint32_t &fl, uint32_t &sl) {
+	using FreeIndex = DeviceMemoryPool::FreeIndex;
+	if (size < FreeIndex::MinBlockSize) {
+		fl = 0;
+		sl = uint32_t(size / (FreeIndex::MinBlockSize / FreeIndex::SecondLevelCount));
+	} else {
+		auto f = uint32_t(std::bit_width(size) - 1);
+		sl = uint32_t(size >> (f - FreeIndex::SecondLevelBits)) ^ FreeIndex::SecondLevelCount;
+		fl = std::min(f - FreeIndex::MinBlockShift + 1, FreeIndex::FirstLevelCount - 1);
+	}
+}
+
+void DeviceMemoryPool::FreeIndex::insert(const Allocator::MemBlock &block) {
+	if (blocks.empty()) {
+		blocks.resize(FirstLevelCount * SecondLevelCount);
+	}
+
+	uint32_t fl, sl;
+	DeviceMemoryPool_mapping(block.size, fl, sl);
+
+	blocks[fl * SecondLevelCount + sl].emplace_back(block);
+	firstLevel |= uint64_t(1) << fl;
+	secondLevel[fl] |= uint32_t(1) << sl;
+	size += block.size;
+	++ count;
+}
+
+bool DeviceMemoryPool::FreeIndex::remove(const Allocator::MemBlock &block) {
+	if (blocks.empty()) {
+		return false;
+	}
+
+	uint32_t fl, sl;
+	DeviceMemoryPool_mapping(block.size, fl, sl);
+
+	auto &list = blocks[fl * SecondLevelCount + sl];
+	auto it = std::find_if(list.begin(), list.end(), [&] (const Allocator::MemBlock &b) {
+		return b.mem == block.mem && b.offset == block.offset;
+	});
+	if (it == list.end()) {
+		return false;
+	}
+
+	*it = list.back();
+	list.pop_back();
+	if (list.empty()) {
+		secondLevel[fl] &= ~(uint32_t(1) << sl);
+		if (secondLevel[fl] == 0) {
+			firstLevel &= ~(uint64_t(1) << fl);
+		}
+	}
+	size -= block.size;
+	-- count;
+	return true;
+}
+
+Allocator::MemBlock DeviceMemoryPool::FreeIndex::extract(VkDeviceSize required, VkDeviceSize alignment) {
+	if (count == 0) {
+		return Allocator::MemBlock();
+	}
+
+	// search for class, where every block can hold required size with alignment
+	auto searchSize = required + (alignment > 1 ? alignment - 1 : 0);
+	if (searchSize >= MinBlockSize) {
+		searchSize += (VkDeviceSize(1) << (std::bit_width(searchSize) - 1 - SecondLevelBits)) - 1;
+	} else {
+		searchSize += (MinBlockSize / SecondLevelCount) - 1;
+	}
+
+	uint32_t fl, sl;
+	DeviceMemoryPool_mapping(searchSize, fl, sl);
+
+	uint32_t slMap = (sl < SecondLevelCount) ? (secondLevel[fl] & (~uint32_t(0) << sl)) : 0;
+	if (!slMap) {
+		auto flMap = (fl + 1 < 64) ? (firstLevel & (~uint64_t(0) << (fl + 1))) : 0;
+		if (!flMap) {
+			return Allocator::MemBlock();
+		}
+		fl = std::countr_zero(flMap);
+		slMap = secondLevel[fl];
+	}
+	sl = std::countr_zero(slMap);
+
+	auto &list = blocks[fl * SecondLevelCount + sl];
+	auto ret = list.back();
+	if (math::align<VkDeviceSize>(ret.offset, alignment) + required > ret.offset + ret.size) {
+		return Allocator::MemBlock(); // possible only within last (unbounded) size class
+	}
+
+	list.pop_back();
+	if (list.empty()) {
+		secondLevel[fl] &= ~(uint32_t(1) << sl);
+		if (secondLevel[fl] == 0) {
+			firstLevel &= ~(uint64_t(1) << fl);
+		}
+	}
+	size -= ret.size;
+	-- count;
+	return ret;
+}
+
+VkDeviceSize DeviceMemoryPool::FreeIndex::getLargestBlock() const {
+	if (firstLevel == 0) {
+		return 0;
+	}
+
+	auto fl = uint32_t(std::bit_width(firstLevel) - 1);
+	auto sl = uint32_t(std::bit_width(secondLevel[fl]) - 1);
+	VkDeviceSize ret = 0;
+	for (auto &it : blocks[fl * SecondLevelCount + sl]) {
+		ret = std::max(ret, it.size);
+	}
+	return ret;
+}
+
+void DeviceMemoryPool::FreeIndex::clear() {
+	firstLevel = 0;
+	secondLevel.fill(0);
+	blocks.clear();
+	size = 0;
+	count = 0;
 }
 
 }
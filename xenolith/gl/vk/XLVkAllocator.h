@@ -31,6 +31,7 @@ namespace stappler::xenolith::vk {
 
 class Device;
 class DeviceBuffer;
+class DeviceMemoryPool;
 
 enum class AllocationUsage {
 	DeviceLocal, // device local only
@@ -126,6 +127,20 @@ public:
 
 	void update();
 
+	// updates budget data (if available) and returns snapshot
+	gl::MemoryStat getMemoryStat();
+
+	// device memory, allocated through allocator and owned by DeviceMemory objects,
+	// used as heap usage when VK_EXT_memory_budget is not available
+	void trackAllocation(uint32_t typeIdx, VkDeviceSize);
+	void trackRelease(uint32_t typeIdx, VkDeviceSize);
+
+	// shared storage for frame memory pools: ranges of completed frames are reused by next frames
+	Rc<DeviceMemoryPool> getFramePoolStorage(bool persistentMapping);
+
+	// suballocation state of frame memory pools storage
+	Vector<gl::MemoryPoolStat> getPoolStat() const;
+
 	uint32_t getInitialTypeMask() const;
 	const Vector<MemHeap> &getMemHeaps() const { return _memHeaps; }
 	Device *getDevice() const { return _device; }
@@ -151,6 +166,9 @@ public:
 
 	Rc<DeviceMemory> emplaceObjects(AllocationUsage usage, SpanView<Rc<Image>>, SpanView<Rc<Buffer>>);
 
+	// bind all images to the same memory region (at zero offset), images should not be used simultaneously
+	Rc<DeviceMemory> emplaceAliasedObjects(AllocationUsage usage, SpanView<Rc<Image>>, VkDeviceSize *size = nullptr);
+
 protected:
 	friend class DeviceMemoryPool;
 
@@ -176,27 +194,73 @@ protected:
 	bool _hasBudget = false;
 	bool _hasMemReq2 = false;
 	bool _hasDedicated = false;
+
+	std::array<std::atomic<uint64_t>, VK_MAX_MEMORY_HEAPS> _heapAllocated;
+
+	mutable Mutex _framePoolMutex;
+	std::array<Rc<DeviceMemoryPool>, 2> _framePools; // by persistent mapping flag
 };
 
 class DeviceMemoryPool : public Ref {
 public:
+	// Two-level segregated fit index for free ranges within pool's nodes
+	// First level - power of two size class, second level - linear subdivision of it
+	struct FreeIndex {
+		static constexpr uint32_t MinBlockShift = 8;
+		static constexpr VkDeviceSize MinBlockSize = 1 << MinBlockShift;
+		static constexpr uint32_t SecondLevelBits = 4;
+		static constexpr uint32_t SecondLevelCount = 1 << SecondLevelBits;
+		static constexpr uint32_t FirstLevelCount = 40;
+
+		uint64_t firstLevel = 0;
+		std::array<uint32_t, FirstLevelCount> secondLevel;
+		Vector<Vector<Allocator::MemBlock>> blocks; // allocated on first insert
+		VkDeviceSize size = 0; // total free size
+		size_t count = 0;
+
+		FreeIndex() { secondLevel.fill(0); }
+
+		void insert(const Allocator::MemBlock &);
+		bool remove(const Allocator::MemBlock &);
+
+		// extracts free range, that can hold size bytes with required alignment
+		Allocator::MemBlock extract(VkDeviceSize size, VkDeviceSize alignment);
+
+		VkDeviceSize getLargestBlock() const;
+
+		void clear();
+	};
+
 	struct MemData {
 		Allocator::MemType *type = nullptr;
 		Vector<Allocator::MemNode> mem;
-		Vector<Allocator::MemBlock> freed;
+		FreeIndex free;
+		Map<VkDeviceMemory, Map<VkDeviceSize, Allocator::MemBlock>> ranges; // free ranges by offset, for coalescing
+		VkDeviceSize used = 0;
 	};
 
+	using MemStat = gl::MemoryPoolStat;
+
 	virtual ~DeviceMemoryPool();
 
 	bool init(const Rc<Allocator> &, bool persistentMapping = false);
 
+	// frame pool: suballocates from storage pool, memory of pool's buffers
+	// returns into storage's free index when pool is released (after frame's submissions are completed)
+	bool init(const Rc<DeviceMemoryPool> &storage);
+
 	Rc<DeviceBuffer> spawn(AllocationUsage type, const gl::BufferInfo &);
 	Rc<Buffer> spawnPersistent(AllocationUsage, const gl::BufferInfo &);
 
 	Device *getDevice() const;
 	const Rc<Allocator> &getAllocator() const { return _allocator; }
 
-	Mutex &getMutex() { return _mutex; }
+	Mutex &getMutex() { return getStorage()->_mutex; }
+
+	Vector<MemStat> getStat() const;
+
+	// returns completely free nodes into allocator
+	void trim();
 
 protected:
 	friend class DeviceBuffer;
@@ -205,9 +269,12 @@ protected:
 	void free(Allocator::MemBlock &&);
 	void clear(MemData *);
 
-	Mutex _mutex;
+	DeviceMemoryPool *getStorage() { return _storage ? _storage.get() : this; }
+
+	mutable Mutex _mutex;
 	bool _persistentMapping = false;
 	Rc<Allocator> _allocator;
+	Rc<DeviceMemoryPool> _storage;
 	Map<int64_t, MemData> _heaps;
 	std::forward_list<Rc<DeviceBuffer>> _buffers;
 };
@@ -0,0 +1,160 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "XLVkCallTracer.h"
+
+namespace stappler::xenolith::vk {
+
+static uint64_t CallTracer_now() {
+	return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static uint32_t CallTracer_threadId() {
+	static std::atomic<uint32_t> s_nextThreadId = 1;
+	static thread_local uint32_t tl_threadId = 0;
+	if (tl_threadId == 0) {
+		tl_threadId = s_nextThreadId.fetch_add(1);
+	}
+	return tl_threadId;
+}
+
+static thread_local uint64_t tl_callStart = 0;
+
+bool CallTracer::init(size_t maxEvents) {
+	_maxEvents = maxEvents;
+	_timeStart = CallTracer_now();
+	return true;
+}
+
+void CallTracer::nextFrame() {
+	auto now = CallTracer_now();
+
+	std::unique_lock<Mutex> lock(_mutex);
+	_marks.emplace_back(FrameMark{_current.index, now});
+	auto index = _current.index;
+	_frames.emplace_back(move(_current));
+	if (_frames.size() > MaxFrames) {
+		_frames.erase(_frames.begin());
+	}
+	_current = FrameStat();
+	_current.index = index + 1;
+}
+
+auto CallTracer::getFrames() const -> Vector<FrameStat> {
+	std::unique_lock<Mutex> lock(_mutex);
+	return _frames;
+}
+
+auto CallTracer::getTotal() const -> Map<StringView, CallStat> {
+	std::unique_lock<Mutex> lock(_mutex);
+	return _total;
+}
+
+String CallTracer::exportTrace() const {
+	std::unique_lock<Mutex> lock(_mutex);
+
+	auto writeTime = [&] (StringStream &stream, uint64_t value) {
+		// trace format uses microseconds
+		auto frac = value % 1000;
+		stream << value / 1000 << "." << (frac < 100 ? "0" : "") << (frac < 10 ? "0" : "") << frac;
+	};
+
+	StringStream stream;
+	stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	bool first = true;
+	for (auto &it : _events) {
+		if (!first) { stream << ","; } else { first = false; }
+		stream << "{\"name\":\"" << it.name << "\",\"cat\":\"vulkan\",\"ph\":\"X\",\"pid\":1,\"tid\":" << it.thread << ",\"ts\":";
+		writeTime(stream, it.start - _timeStart);
+		stream << ",\"dur\":";
+		writeTime(stream, it.duration);
+		stream << "}";
+	}
+
+	for (auto &it : _marks) {
+		if (!first) { stream << ","; } else { first = false; }
+		stream << "{\"name\":\"Frame " << it.index << "\",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":";
+		writeTime(stream, it.time - _timeStart);
+		stream << "}";
+	}
+
+	stream << "],\"otherData\":{\"droppedEvents\":" << _droppedEvents << "}}";
+	return stream.str();
+}
+
+bool CallTracer::exportTrace(StringView path) const {
+	auto data = exportTrace();
+	if (!filesystem::write(path, (const uint8_t *)data.data(), data.size())) {
+		log::vtext("vk::CallTracer", "Fail to write trace: ", path);
+		return false;
+	}
+	return true;
+}
+
+void CallTracer::clear() {
+	std::unique_lock<Mutex> lock(_mutex);
+	_timeStart = CallTracer_now();
+	_droppedEvents = 0;
+	_events.clear();
+	_marks.clear();
+	_frames.clear();
+	_total.clear();
+	_current = FrameStat();
+}
+
+void CallTracer::onPreCall(void *, const char *, PFN_vkVoidFunction) {
+	tl_callStart = CallTracer_now();
+}
+
+void CallTracer::onPostCall(void *ctx, const char *name, PFN_vkVoidFunction) {
+	auto tracer = (CallTracer *)ctx;
+	tracer->pushCall(name, tl_callStart, CallTracer_now());
+	if (strcmp(name, "vkQueuePresentKHR") == 0) {
+		tracer->nextFrame();
+	}
+}
+
+void CallTracer::pushCall(const char *name, uint64_t start, uint64_t end) {
+	auto thread = CallTracer_threadId();
+	auto duration = end - start;
+
+	std::unique_lock<Mutex> lock(_mutex);
+	auto &stat = _current.entries[StringView(name)];
+	++ stat.count;
+	stat.time += duration;
+	++ _current.calls;
+	_current.time += duration;
+
+	auto &total = _total[StringView(name)];
+	++ total.count;
+	total.time += duration;
+
+	if (_events.size() < _maxEvents) {
+		_events.emplace_back(Event{name, start, duration, thread});
+	} else {
+		++ _droppedEvents;
+	}
+}
+
+}
@@ -0,0 +1,104 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef XENOLITH_GL_VK_XLVKCALLTRACER_H_
+#define XENOLITH_GL_VK_XLVKCALLTRACER_H_
+
+#include "XLVk.h"
+
+namespace stappler::xenolith::vk {
+
+/* Vulkan API call tracer, installed with Device::setCallTracer
+ *
+ * Tracer receives pre/post notifications from device hook table, counts calls per entry point
+ * and CPU time, spent inside driver. Frame boundaries are detected with vkQueuePresentKHR,
+ * or defined with nextFrame (for offscreen rendering).
+ *
+ * Recorded calls can be exported as Chrome/Perfetto JSON trace (chrome://tracing, ui.perfetto.dev)
+ */
+class CallTracer : public Ref {
+public:
+	static constexpr size_t DefaultMaxEvents = 256 * 1024;
+	static constexpr size_t MaxFrames = 120;
+
+	struct CallStat {
+		uint64_t count = 0;
+		uint64_t time = 0; // in nanoseconds
+	};
+
+	struct FrameStat {
+		uint64_t index = 0;
+		uint64_t calls = 0;
+		uint64_t time = 0; // total time within driver, in nanoseconds
+		Map<StringView, CallStat> entries;
+	};
+
+	virtual ~CallTracer() { }
+
+	// events are dropped, when maxEvents limit is reached; statistics is collected anyway
+	bool init(size_t maxEvents = DefaultMaxEvents);
+
+	void nextFrame();
+
+	// last MaxFrames completed frames
+	Vector<FrameStat> getFrames() const;
+
+	// calls statistics since tracer installation or last clear
+	Map<StringView, CallStat> getTotal() const;
+
+	String exportTrace() const;
+	bool exportTrace(StringView path) const;
+
+	void clear();
+
+	static void onPreCall(void *, const char *, PFN_vkVoidFunction);
+	static void onPostCall(void *, const char *, PFN_vkVoidFunction);
+
+protected:
+	struct Event {
+		const char *name;
+		uint64_t start;
+		uint64_t duration;
+		uint32_t thread;
+	};
+
+	struct FrameMark {
+		uint64_t index;
+		uint64_t time;
+	};
+
+	void pushCall(const char *name, uint64_t start, uint64_t end);
+
+	mutable Mutex _mutex;
+	uint64_t _timeStart = 0;
+	size_t _maxEvents = DefaultMaxEvents;
+	uint64_t _droppedEvents = 0;
+	Vector<Event> _events;
+	Vector<FrameMark> _marks;
+	Vector<FrameStat> _frames;
+	FrameStat _current;
+	Map<StringView, CallStat> _total;
+};
+
+}
+
+#endif /* XENOLITH_GL_VK_XLVKCALLTRACER_H_ */
@@ -40,6 +40,9 @@ DeviceFrameHandle::~DeviceFrameHandle() {
 		//auto dev = (Device *)_device;
 		//dev->getTable()->vkDeviceWaitIdle(dev->getDevice());
 	}
+
+	// frame is released only after all its submissions are completed, so buffers of frame pools
+	// can be safely destroyed, its memory returns into allocator's frame pool storage
 	_memPools.clear();
 }
 
@@ -56,7 +59,7 @@ const Rc<DeviceMemoryPool> &DeviceFrameHandle::getMemPool(void *key) {
 	std::unique_lock<Mutex> lock(_mutex);
 	auto v = _memPools.find(key);
 	if (v == _memPools.end()) {
-		v = _memPools.emplace(key, Rc<DeviceMemoryPool>::create(_allocator, _request->isPersistentMapping())).first;
+		v = _memPools.emplace(key, Rc<DeviceMemoryPool>::create(_allocator->getFramePoolStorage(_request->isPersistentMapping()))).first;
 	}
 	return v->second;
 }
@@ -78,8 +81,16 @@ Device::~Device() {
 		clearShaders();
 		invalidateObjects();
 
+#if VK_HOOK_DEBUG
+		unregisterDeviceHookTable(_device);
+		setDeviceHookThreadContext(nullptr, nullptr, nullptr, nullptr, nullptr);
+#endif
 		_table->vkDestroyDevice(_device, nullptr);
 		delete _table;
+#if VK_HOOK_DEBUG
+		delete _hooks;
+		_hooks = nullptr;
+#endif
 
 		_device = nullptr;
 		_table = nullptr;
@@ -99,7 +110,8 @@ bool Device::init(const vk::Instance *inst, DeviceInfo && info, const Features &
 			}
 		}
 		count = std::min(count, std::min(info.count, uint32_t(std::thread::hardware_concurrency())));
-		_families.emplace_back(DeviceQueueFamily({ info.index, count, preferred, info.ops, info.minImageTransferGranularity}));
+		_families.emplace_back(DeviceQueueFamily({ info.index, count, preferred, info.ops, info.minImageTransferGranularity,
+			info.timestampValidBits}));
 	};
 
 	_presentMask = info.presentFamily.presentSurfaceMask;
@@ -237,41 +249,62 @@ void Device::end() {
 	_samplers.clear();
 }
 
+const DeviceTable * Device::getTable() const {
 #if VK_HOOK_DEBUG
-static thread_local uint64_t s_vkFnCallStart = 0;
+	if (auto tracer = _tracer.load()) {
+		// hook table routes calls to original table through thread-local context
+		setDeviceHookThreadContext(&CallTracer::onPreCall, &CallTracer::onPostCall, _table, nullptr, (void *)tracer);
+		return _hooks;
+	}
 #endif
 
-const DeviceTable * Device::getTable() const {
+	return _table;
+}
+
+bool Device::setCallTracer(Rc<CallTracer> &&tracer) {
 #if VK_HOOK_DEBUG
-	setDeviceHookThreadContext([] (void *ctx, const char *name, PFN_vkVoidFunction fn) {
-		/*auto dev = (Device *)ctx;
-		if (std::this_thread::get_id() == dev->_loopThreadId) {
-			if (fn != (PFN_vkVoidFunction)dev->_original->vkCreateFence
-					&& fn != (PFN_vkVoidFunction)dev->_original->vkGetFenceStatus) {
-				log::text("Vk-Call-Loop", name);
-			}
-		}
-		if (fn == (PFN_vkVoidFunction)dev->_original->vkQueueSubmit
-				|| fn == (PFN_vkVoidFunction)dev->_original->vkQueuePresentKHR
-				|| fn == (PFN_vkVoidFunction)dev->_original->vkAcquireNextImageKHR
-				|| fn == (PFN_vkVoidFunction)dev->_original->vkCreateSwapchainKHR
-				|| fn == (PFN_vkVoidFunction)dev->_original->vkDestroySwapchainKHR) {
-			//log::text("Vk-Call", name);
-		}*/
-		s_vkFnCallStart = platform::device::_clock();
-	}, [] (void *ctx, const char *name, PFN_vkVoidFunction fn) {
-		auto dt = platform::device::_clock() - s_vkFnCallStart;
-		/*auto dev = (Device *)ctx;
-		if (std::this_thread::get_id() == dev->_loopThreadId) {
-			log::vtext("Vk-Call-Timeout", name, ": ", dt);
-		}*/
-		if (dt > 200000) {
-			log::vtext("Vk-Call-Timeout", name, ": ", dt);
-		}
-	}, _original, nullptr, (void *)this);
+	std::unique_lock<Mutex> lock(_resourceMutex);
+	_tracer = tracer.get();
+
+	// hooks on any thread use device's registered context, thread context is only a fallback
+	if (tracer) {
+		setDeviceHookContext(_device, &CallTracer::onPreCall, &CallTracer::onPostCall, nullptr, (void *)tracer.get());
+	} else {
+		setDeviceHookContext(_device, nullptr, nullptr, nullptr, nullptr);
+		setDeviceHookThreadContext(nullptr, nullptr, nullptr, nullptr, nullptr);
+	}
+
+	if (tracer) {
+		// tracer can be used by other threads after uninstall, so, keep it until device is destroyed
+		_tracers.emplace_back(move(tracer));
+	}
+	return true;
+#else
+	log::vtext("vk::Device", "Fail to install call tracer: hook tables are disabled with VK_HOOK_DEBUG");
+	return false;
 #endif
+}
 
-	return _table;
+CallTracer *Device::getCallTracer() const {
+#if VK_HOOK_DEBUG
+	return _tracer.load();
+#else
+	return nullptr;
+#endif
+}
+
+CommandBuffer::BarrierStat Device::getBarrierStat() const {
+	CommandBuffer::BarrierStat ret;
+	ret.calls = _barrierCalls.load();
+	ret.barriers = _barriersEmitted.load();
+	ret.elided = _barriersElided.load();
+	return ret;
+}
+
+void Device::addBarrierStat(const CommandBuffer::BarrierStat &stat) {
+	_barrierCalls += stat.calls;
+	_barriersEmitted += stat.barriers;
+	_barriersElided += stat.elided;
 }
 
 const DeviceQueueFamily *Device::getQueueFamily(uint32_t familyIdx) const {
@@ -319,6 +352,30 @@ const Vector<DeviceQueueFamily> &Device::getQueueFamilies() const {
 	return _families;
 }
 
+void Device::setAsyncComputeEnabled(bool value) {
+	_asyncCompute = value;
+}
+
+bool Device::hasAsyncCompute() const {
+	auto compute = getQueueFamily(getPassQueueOps(QueueOperations::Compute));
+	auto graphics = getQueueFamily(QueueOperations::Graphics);
+	return compute && graphics && compute->index != graphics->index;
+}
+
+QueueOperations Device::getPassQueueOps(QueueOperations ops) const {
+	if (ops == QueueOperations::Compute && !_asyncCompute) {
+		auto graphics = getQueueFamily(QueueOperations::Graphics);
+		if (graphics && (graphics->ops & QueueOperations::Compute) != QueueOperations::None) {
+			return QueueOperations::Graphics;
+		}
+	}
+	return ops;
+}
+
+void Device::setQueueSemaphoresForced(bool value) {
+	_queueSemaphoresForced = value;
+}
+
 Rc<DeviceQueue> Device::tryAcquireQueueSync(QueueOperations ops, bool lockThread) {
 	auto family = (DeviceQueueFamily *)getQueueFamily(ops);
 	if (!family) {
@@ -534,6 +591,25 @@ void Device::releaseCommandPoolUnsafe(Rc<CommandPool> &&pool) {
 	_families[pool->getFamilyIdx()].pools.emplace_back(Rc<CommandPool>(pool));
 }
 
+Rc<QueryPool> Device::acquireQueryPool() {
+	// begin and end timestamps
+	static constexpr uint32_t QueryCount = 2;
+
+	std::unique_lock<Mutex> lock(_resourceMutex);
+	if (!_queryPools.empty()) {
+		auto ret = _queryPools.back();
+		_queryPools.pop_back();
+		return ret;
+	}
+	lock.unlock();
+	return Rc<QueryPool>::create(*this, QueryCount);
+}
+
+void Device::releaseQueryPool(Rc<QueryPool> &&pool) {
+	std::unique_lock<Mutex> lock(_resourceMutex);
+	_queryPools.emplace_back(move(pool));
+}
+
 static BytesView Device_emplaceConstant(Bytes &data, BytesView constant) {
 	auto originalSize = data.size();
 	auto constantSize = constant.size();
@@ -632,6 +708,43 @@ auto Device::makeImage(const gl::ImageInfo &imageInfo) -> Rc<ImageStorage> {
 	return Rc<ImageStorage>::create(move(img));
 }
 
+auto Device::makeAliasedImages(SpanView<gl::ImageInfo> infos) -> Vector<Rc<ImageStorage>> {
+	bool isTransient = true;
+	for (auto &it : infos) {
+		if ((it.usage & gl::ImageUsage::TransientAttachment) == gl::ImageUsage::None) {
+			isTransient = false;
+		}
+	}
+
+	Vector<Rc<Image>> images; images.reserve(infos.size());
+	VkDeviceSize separateSize = 0;
+	for (auto &it : infos) {
+		auto img = _allocator->preallocate(it, false);
+		if (!img) {
+			return Vector<Rc<ImageStorage>>();
+		}
+		separateSize += _allocator->getImageMemoryRequirements(img->getImage()).requirements.size;
+		images.emplace_back(move(img));
+	}
+
+	auto usage = isTransient ? AllocationUsage::DeviceLocalLazilyAllocated : AllocationUsage::DeviceLocal;
+
+	VkDeviceSize sharedSize = 0;
+	if (!_allocator->emplaceAliasedObjects(usage, images, &sharedSize)) {
+		// images can not share memory (no common memory type or dedicated allocation required)
+		return gl::Device::makeAliasedImages(infos);
+	}
+
+	log::vtext("vk::Device", "Attachment memory for ", images.size(), " aliased images: ",
+			separateSize, " bytes -> ", sharedSize, " bytes", isTransient ? " (lazily allocated)" : "");
+
+	Vector<Rc<ImageStorage>> ret; ret.reserve(images.size());
+	for (auto &it : images) {
+		ret.emplace_back(Rc<ImageStorage>::create(move(it)));
+	}
+	return ret;
+}
+
 Rc<gl::Semaphore> Device::makeSemaphore() {
 	auto ret = Rc<Semaphore>::create(*this);
 	return ret;
@@ -650,6 +763,34 @@ bool Device::hasDynamicIndexedBuffers() const {
 	return _info.features.device10.features.shaderStorageBufferArrayDynamicIndexing;
 }
 
+bool Device::hasMultiDrawIndirect() const {
+	return _info.features.device10.features.multiDrawIndirect;
+}
+
+bool Device::hasDrawIndirectFirstInstance() const {
+	return _info.features.device10.features.drawIndirectFirstInstance;
+}
+
+bool Device::hasIncrementalPresent() const {
+	for (auto &it : _info.optionalExtensions) {
+		if (it == StringView(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+VkFormatProperties Device::getFormatProperties(VkFormat fmt) const {
+	auto it = _formats.find(fmt);
+	if (it != _formats.end()) {
+		return it->second;
+	}
+
+	VkFormatProperties properties;
+	_vkInstance->vkGetPhysicalDeviceFormatProperties(_info.device, fmt, &properties);
+	return properties;
+}
+
 void Device::waitIdle() const {
 	_table->vkDeviceWaitIdle(_device);
 }
@@ -764,12 +905,10 @@ bool Device::setup(const Instance *instance, VkPhysicalDevice p, const Propertie
 		return false;
 	}
 
-#if VK_HOOK_DEBUG
-	auto hookTable = new DeviceTable(DeviceTable::makeHooks());
-	_original = new DeviceTable(instance->vkGetDeviceProcAddr, _device);
-	_table = hookTable;
-#else
 	_table = new DeviceTable(instance->vkGetDeviceProcAddr, _device);
+#if VK_HOOK_DEBUG
+	_hooks = new DeviceTable(DeviceTable::makeHooks());
+	registerDeviceHookTable(_device, _table);
 #endif
 
 	return true;
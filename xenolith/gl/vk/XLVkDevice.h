@@ -26,6 +26,7 @@
 #include "XLVkInstance.h"
 #include "XLVkDeviceQueue.h"
 #include "XLVkLoop.h"
+#include "XLVkCallTracer.h"
 
 namespace stappler::xenolith::vk {
 
@@ -33,6 +34,7 @@ class Fence;
 class Allocator;
 class TextureSetLayout;
 class Sampler;
+class QueryPool;
 class Loop;
 class DeviceMemoryPool;
 
@@ -70,15 +72,45 @@ public:
 	virtual void end() override;
 
 	const DeviceInfo & getInfo() const { return _info; }
+
+	// returns hook table, when call tracer is installed
 	const DeviceTable * getTable() const;
+
+	// install (or uninstall with nullptr) Vulkan call tracer, returns false if hooks are not compiled in
+	bool setCallTracer(Rc<CallTracer> &&);
+	CallTracer *getCallTracer() const;
 	const Rc<Allocator> & getAllocator() const { return _allocator; }
 
+	// pipeline barriers statistics, accumulated from all recorded command buffers
+	CommandBuffer::BarrierStat getBarrierStat() const;
+	void addBarrierStat(const CommandBuffer::BarrierStat &);
+
 	const DeviceQueueFamily *getQueueFamily(uint32_t) const;
 	const DeviceQueueFamily *getQueueFamily(QueueOperations) const;
 	const DeviceQueueFamily *getQueueFamily(gl::RenderPassType) const;
 
 	const Vector<DeviceQueueFamily> &getQueueFamilies() const;
 
+	// compute passes use dedicated compute queue family (if device has one), enabled by default
+	// when disabled, compute passes are submitted into graphics family, without ownership transfers
+	void setAsyncComputeEnabled(bool);
+	bool isAsyncComputeEnabled() const { return _asyncCompute.load(); }
+
+	// true if compute passes will actually be executed on separate queue family
+	bool hasAsyncCompute() const;
+
+	// operations, used to select queue family for render pass with declared operations
+	QueueOperations getPassQueueOps(QueueOperations) const;
+
+	// for testing: synchronize passes with different queue operations with semaphores, even if they are
+	// submitted into the same queue family, so semaphore path can be checked on single-family devices
+	void setQueueSemaphoresForced(bool);
+	bool isQueueSemaphoresForced() const { return _queueSemaphoresForced.load(); }
+
+	// semaphores, signaled between passes since device creation
+	uint64_t getQueueSemaphoresCount() const { return _queueSemaphoresCount.load(); }
+	void addQueueSemaphore() { ++ _queueSemaphoresCount; }
+
 	// acquire VkQueue handle
 	// - QueueOperations - one of QueueOperations flags, defining capabilities of required queue
 	// - gl::FrameHandle - frame, in which queue will be used
@@ -107,6 +139,13 @@ public:
 	void releaseCommandPool(gl::Loop &, Rc<CommandPool> &&);
 	void releaseCommandPoolUnsafe(Rc<CommandPool> &&);
 
+	// timestamp query pools for pass timing, pool should be released only after results was read
+	Rc<QueryPool> acquireQueryPool();
+	void releaseQueryPool(Rc<QueryPool> &&);
+
+	// nanoseconds per timestamp tick
+	float getTimestampPeriod() const { return _info.properties.device10.properties.limits.timestampPeriod; }
+
 	const Rc<TextureSetLayout> &getTextureSetLayout() const { return _textureSetLayout; }
 
 	BytesView emplaceConstant(renderqueue::PredefinedConstant, Bytes &) const;
@@ -118,6 +157,7 @@ public:
 
 	virtual Rc<gl::Framebuffer> makeFramebuffer(const renderqueue::PassData *, SpanView<Rc<gl::ImageView>>, Extent2) override;
 	virtual Rc<ImageStorage> makeImage(const gl::ImageInfo &) override;
+	virtual Vector<Rc<ImageStorage>> makeAliasedImages(SpanView<gl::ImageInfo>) override;
 	virtual Rc<gl::Semaphore> makeSemaphore() override;
 	virtual Rc<gl::ImageView> makeImageView(const Rc<gl::ImageObject> &, const gl::ImageViewInfo &) override;
 
@@ -130,6 +170,13 @@ public:
 
 	bool hasNonSolidFillMode() const;
 	bool hasDynamicIndexedBuffers() const;
+	bool hasMultiDrawIndirect() const;
+	bool hasDrawIndirectFirstInstance() const;
+	bool hasIncrementalPresent() const;
+
+	uint32_t getMaxDrawIndirectCount() const { return _info.properties.device10.properties.limits.maxDrawIndirectCount; }
+
+	VkFormatProperties getFormatProperties(VkFormat) const;
 
 	virtual void waitIdle() const override;
 
@@ -146,7 +193,9 @@ private:
 	const vk::Instance *_vkInstance = nullptr;
 	const DeviceTable *_table = nullptr;
 #if VK_HOOK_DEBUG
-	const DeviceTable *_original = nullptr;
+	const DeviceTable *_hooks = nullptr;
+	std::atomic<CallTracer *> _tracer = nullptr;
+	Vector<Rc<CallTracer>> _tracers;
 #endif
 	VkDevice _device = VK_NULL_HANDLE;
 
@@ -162,8 +211,16 @@ private:
 
 	Vector<VkSampler> _immutableSamplers;
 	Vector<Rc<Sampler>> _samplers;
+	Vector<Rc<QueryPool>> _queryPools;
 	size_t _compiledSamplers = 0;
 	std::atomic<bool> _samplersCompiled = false;
+	std::atomic<bool> _asyncCompute = true;
+	std::atomic<bool> _queueSemaphoresForced = false;
+	std::atomic<uint64_t> _queueSemaphoresCount = 0;
+
+	std::atomic<uint64_t> _barrierCalls = 0;
+	std::atomic<uint64_t> _barriersEmitted = 0;
+	std::atomic<uint64_t> _barriersElided = 0;
 
 	std::unordered_map<VkFormat, VkFormatProperties> _formats;
 
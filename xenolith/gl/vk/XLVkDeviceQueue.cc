@@ -285,43 +285,26 @@ void CommandBuffer::invalidate() {
 
 void CommandBuffer::cmdPipelineBarrier(VkPipelineStageFlags srcFlags, VkPipelineStageFlags dstFlags, VkDependencyFlags deps,
 		SpanView<ImageMemoryBarrier> imageBarriers) {
-	Vector<VkImageMemoryBarrier> images; images.reserve(imageBarriers.size());
-	for (auto &it : imageBarriers) {
-		images.emplace_back(VkImageMemoryBarrier{
-			VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
-			it.srcAccessMask, it.dstAccessMask,
-			it.oldLayout, it.newLayout,
-			it.familyTransfer.srcQueueFamilyIndex, it.familyTransfer.dstQueueFamilyIndex,
-			it.image->getImage(), it.subresourceRange
-		});
-		addImage(it.image);
-	}
-
-	_table->vkCmdPipelineBarrier(_buffer, srcFlags, dstFlags, deps, 0, nullptr, 0, nullptr, images.size(), images.data());
+	cmdPipelineBarrier(srcFlags, dstFlags, deps, SpanView<BufferMemoryBarrier>(), imageBarriers);
 }
 
 void CommandBuffer::cmdPipelineBarrier(VkPipelineStageFlags srcFlags, VkPipelineStageFlags dstFlags, VkDependencyFlags deps,
 		SpanView<BufferMemoryBarrier> bufferBarriers) {
-	Vector<VkBufferMemoryBarrier> buffers; buffers.reserve(bufferBarriers.size());
-	for (auto &it : bufferBarriers) {
-		buffers.emplace_back(VkBufferMemoryBarrier{
-			VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, nullptr,
-			it.srcAccessMask, it.dstAccessMask,
-			it.familyTransfer.srcQueueFamilyIndex, it.familyTransfer.dstQueueFamilyIndex,
-			it.buffer->getBuffer(), it.offset, it.size
-		});
-		addBuffer(it.buffer);
-	}
-
-	_table->vkCmdPipelineBarrier(_buffer, srcFlags, dstFlags, deps, 0, nullptr, buffers.size(), buffers.data(), 0, nullptr);
+	cmdPipelineBarrier(srcFlags, dstFlags, deps, bufferBarriers, SpanView<ImageMemoryBarrier>());
 }
 
-
 void CommandBuffer::cmdPipelineBarrier(VkPipelineStageFlags srcFlags, VkPipelineStageFlags dstFlags, VkDependencyFlags deps,
 		SpanView<BufferMemoryBarrier> bufferBarriers, SpanView<ImageMemoryBarrier> imageBarriers) {
-	Vector<VkBufferMemoryBarrier> buffers; buffers.reserve(bufferBarriers.size());
+	// barriers with different scopes can not be merged without widening them
+	if (srcFlags != _pendingSrcStages || dstFlags != _pendingDstStages || deps != _pendingDependencies) {
+		flushBarriers();
+		_pendingSrcStages = srcFlags;
+		_pendingDstStages = dstFlags;
+		_pendingDependencies = deps;
+	}
+
 	for (auto &it : bufferBarriers) {
-		buffers.emplace_back(VkBufferMemoryBarrier{
+		addPendingBarrier(VkBufferMemoryBarrier{
 			VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, nullptr,
 			it.srcAccessMask, it.dstAccessMask,
 			it.familyTransfer.srcQueueFamilyIndex, it.familyTransfer.dstQueueFamilyIndex,
@@ -330,9 +313,15 @@ void CommandBuffer::cmdPipelineBarrier(VkPipelineStageFlags srcFlags, VkPipeline
 		addBuffer(it.buffer);
 	}
 
-	Vector<VkImageMemoryBarrier> images; images.reserve(imageBarriers.size());
 	for (auto &it : imageBarriers) {
-		images.emplace_back(VkImageMemoryBarrier{
+		// layout is not changed and there is no execution scope to wait for, so, barrier does nothing
+		if (it.oldLayout == it.newLayout && srcFlags == VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT
+				&& it.familyTransfer.srcQueueFamilyIndex == it.familyTransfer.dstQueueFamilyIndex) {
+			++ _barrierStat.elided;
+			continue;
+		}
+
+		addPendingBarrier(VkImageMemoryBarrier{
 			VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
 			it.srcAccessMask, it.dstAccessMask,
 			it.oldLayout, it.newLayout,
@@ -341,9 +330,22 @@ void CommandBuffer::cmdPipelineBarrier(VkPipelineStageFlags srcFlags, VkPipeline
 		});
 		addImage(it.image);
 	}
+}
 
-	_table->vkCmdPipelineBarrier(_buffer, srcFlags, dstFlags, deps, 0, nullptr,
-			buffers.size(), buffers.data(), images.size(), images.data());
+void CommandBuffer::flushBarriers() {
+	if (_pendingBufferBarriers.empty() && _pendingImageBarriers.empty()) {
+		return;
+	}
+
+	_table->vkCmdPipelineBarrier(_buffer, _pendingSrcStages, _pendingDstStages, _pendingDependencies, 0, nullptr,
+			_pendingBufferBarriers.size(), _pendingBufferBarriers.data(),
+			_pendingImageBarriers.size(), _pendingImageBarriers.data());
+
+	++ _barrierStat.calls;
+	_barrierStat.barriers += _pendingBufferBarriers.size() + _pendingImageBarriers.size();
+
+	_pendingBufferBarriers.clear();
+	_pendingImageBarriers.clear();
 }
 
 void CommandBuffer::cmdCopyBuffer(Buffer *src, Buffer *dst) {
@@ -357,6 +359,7 @@ void CommandBuffer::cmdCopyBuffer(Buffer *src, Buffer *dst, VkDeviceSize srcOffs
 }
 
 void CommandBuffer::cmdCopyBuffer(Buffer *src, Buffer *dst, SpanView<VkBufferCopy> copy) {
+	flushBarriers();
 	addBuffer(src);
 	addBuffer(dst);
 
@@ -364,6 +367,7 @@ void CommandBuffer::cmdCopyBuffer(Buffer *src, Buffer *dst, SpanView<VkBufferCop
 }
 
 void CommandBuffer::cmdCopyImage(Image *src, VkImageLayout srcLayout, Image *dst, VkImageLayout dstLayout, VkFilter filter) {
+	flushBarriers();
 	auto sourceExtent = src->getInfo().extent;
 	auto targetExtent = dst->getInfo().extent;
 
@@ -392,6 +396,7 @@ void CommandBuffer::cmdCopyImage(Image *src, VkImageLayout srcLayout, Image *dst
 }
 
 void CommandBuffer::cmdCopyImage(Image *src, VkImageLayout srcLayout, Image *dst, VkImageLayout dstLayout, const VkImageCopy &copy) {
+	flushBarriers();
 	addImage(src);
 	addImage(dst);
 
@@ -399,6 +404,7 @@ void CommandBuffer::cmdCopyImage(Image *src, VkImageLayout srcLayout, Image *dst
 }
 
 void CommandBuffer::cmdCopyImage(Image *src, VkImageLayout srcLayout, Image *dst, VkImageLayout dstLayout, SpanView<VkImageCopy> copy) {
+	flushBarriers();
 	addImage(src);
 	addImage(dst);
 
@@ -416,6 +422,7 @@ void CommandBuffer::cmdCopyBufferToImage(Buffer *buf, Image *img, VkImageLayout
 }
 
 void CommandBuffer::cmdCopyBufferToImage(Buffer *buf, Image *img, VkImageLayout layout, SpanView<VkBufferImageCopy> copy) {
+	flushBarriers();
 	addBuffer(buf);
 	addImage(img);
 
@@ -433,6 +440,7 @@ void CommandBuffer::cmdCopyImageToBuffer(Image *img, VkImageLayout layout, Buffe
 }
 
 void CommandBuffer::cmdCopyImageToBuffer(Image *img, VkImageLayout layout, Buffer *buf, SpanView<VkBufferImageCopy> copy) {
+	flushBarriers();
 	addBuffer(buf);
 	addImage(img);
 
@@ -440,6 +448,7 @@ void CommandBuffer::cmdCopyImageToBuffer(Image *img, VkImageLayout layout, Buffe
 }
 
 void CommandBuffer::cmdClearColorImage(Image *image, VkImageLayout layout, const Color4F &color) {
+	flushBarriers();
 	VkClearColorValue clearColorEmpty;
 	clearColorEmpty.float32[0] = color.r;
 	clearColorEmpty.float32[1] = color.g;
@@ -453,8 +462,12 @@ void CommandBuffer::cmdClearColorImage(Image *image, VkImageLayout layout, const
 			&clearColorEmpty, 1, &range);
 }
 
-void CommandBuffer::cmdBeginRenderPass(RenderPassImpl *pass, Framebuffer *fb, VkSubpassContents subpass, bool alt) {
-	auto &clearValues = pass->getClearValues();
+void CommandBuffer::cmdBeginRenderPass(RenderPassImpl *pass, Framebuffer *fb, VkSubpassContents subpass, bool alt,
+		const VkRect2D *renderArea, SpanView<VkClearValue> clearValues) {
+	flushBarriers();
+	if (clearValues.empty()) {
+		clearValues = pass->getClearValues();
+	}
 	auto currentExtent = fb->getExtent();
 
 	VkRenderPassBeginInfo renderPassInfo {
@@ -462,10 +475,14 @@ void CommandBuffer::cmdBeginRenderPass(RenderPassImpl *pass, Framebuffer *fb, Vk
 	};
 	renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
 	renderPassInfo.pNext = nullptr;
-	renderPassInfo.renderPass = pass->getRenderPass(alt);
+	renderPassInfo.renderPass = pass->getRenderPass(alt, renderArea != nullptr);
 	renderPassInfo.framebuffer = fb->getFramebuffer();
-	renderPassInfo.renderArea.offset = { 0, 0 };
-	renderPassInfo.renderArea.extent = VkExtent2D{currentExtent.width, currentExtent.height};
+	if (renderArea) {
+		renderPassInfo.renderArea = *renderArea;
+	} else {
+		renderPassInfo.renderArea.offset = { 0, 0 };
+		renderPassInfo.renderArea.extent = VkExtent2D{currentExtent.width, currentExtent.height};
+	}
 	renderPassInfo.clearValueCount = clearValues.size();
 	renderPassInfo.pClearValues = clearValues.data();
 
@@ -476,6 +493,7 @@ void CommandBuffer::cmdBeginRenderPass(RenderPassImpl *pass, Framebuffer *fb, Vk
 }
 
 void CommandBuffer::cmdEndRenderPass() {
+	flushBarriers();
 	_table->vkCmdEndRenderPass(_buffer);
 
 	_currentSubpass = 0;
@@ -534,13 +552,21 @@ void CommandBuffer::cmdBindComputeDescriptorSets(VkPipelineLayout layout, SpanVi
 }
 
 void CommandBuffer::cmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+	flushBarriers();
 	_table->vkCmdDraw(_buffer, vertexCount, instanceCount, firstVertex, firstInstance);
 }
 void CommandBuffer::cmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex,
 		int32_t vertexOffset, uint32_t firstInstance) {
+	flushBarriers();
 	_table->vkCmdDrawIndexed(_buffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 }
 
+void CommandBuffer::cmdDrawIndexedIndirect(Buffer *buf, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+	flushBarriers();
+	_table->vkCmdDrawIndexedIndirect(_buffer, buf->getBuffer(), offset, drawCount, stride);
+	addBuffer(buf);
+}
+
 void CommandBuffer::cmdPushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, BytesView data) {
 	_table->vkCmdPushConstants(_buffer, layout, stageFlags, offset, data.size(), data.data());
 }
@@ -555,20 +581,87 @@ void CommandBuffer::cmdFillBuffer(Buffer *buffer, uint32_t data) {
 }
 
 void CommandBuffer::cmdFillBuffer(Buffer *buffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
+	flushBarriers();
 	addBuffer(buffer);
 	_table->vkCmdFillBuffer(_buffer, buffer->getBuffer(), dstOffset, size, data);
 }
 
 void CommandBuffer::cmdDispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+	flushBarriers();
 	_table->vkCmdDispatch(_buffer, groupCountX, groupCountY, groupCountZ);
 }
 
 uint32_t CommandBuffer::cmdNextSubpass() {
+	flushBarriers();
 	_table->vkCmdNextSubpass(_buffer, VK_SUBPASS_CONTENTS_INLINE);
 	++ _currentSubpass;
 	return _currentSubpass;
 }
 
+void CommandBuffer::cmdExecuteCommands(SpanView<const CommandBuffer *> buffers) {
+	Vector<VkCommandBuffer> vkBuffers; vkBuffers.reserve(buffers.size());
+	for (auto &it : buffers) {
+		if (it) {
+			vkBuffers.emplace_back(it->getBuffer());
+		}
+	}
+
+	if (vkBuffers.empty()) {
+		return;
+	}
+
+	flushBarriers();
+	_table->vkCmdExecuteCommands(_buffer, uint32_t(vkBuffers.size()), vkBuffers.data());
+}
+
+// barrier structs has padding, so they are compared by members, not with memcmp
+static bool CommandBuffer_isEqual(const VkBufferMemoryBarrier &l, const VkBufferMemoryBarrier &r) {
+	return l.pNext == r.pNext && l.srcAccessMask == r.srcAccessMask && l.dstAccessMask == r.dstAccessMask
+			&& l.srcQueueFamilyIndex == r.srcQueueFamilyIndex && l.dstQueueFamilyIndex == r.dstQueueFamilyIndex
+			&& l.buffer == r.buffer && l.offset == r.offset && l.size == r.size;
+}
+
+static bool CommandBuffer_isEqual(const VkImageMemoryBarrier &l, const VkImageMemoryBarrier &r) {
+	return l.pNext == r.pNext && l.srcAccessMask == r.srcAccessMask && l.dstAccessMask == r.dstAccessMask
+			&& l.oldLayout == r.oldLayout && l.newLayout == r.newLayout
+			&& l.srcQueueFamilyIndex == r.srcQueueFamilyIndex && l.dstQueueFamilyIndex == r.dstQueueFamilyIndex
+			&& l.image == r.image
+			&& l.subresourceRange.aspectMask == r.subresourceRange.aspectMask
+			&& l.subresourceRange.baseMipLevel == r.subresourceRange.baseMipLevel
+			&& l.subresourceRange.levelCount == r.subresourceRange.levelCount
+			&& l.subresourceRange.baseArrayLayer == r.subresourceRange.baseArrayLayer
+			&& l.subresourceRange.layerCount == r.subresourceRange.layerCount;
+}
+
+void CommandBuffer::addPendingBarrier(const VkBufferMemoryBarrier &barrier) {
+	for (auto &it : _pendingBufferBarriers) {
+		if (it.buffer == barrier.buffer) {
+			if (CommandBuffer_isEqual(it, barrier)) {
+				++ _barrierStat.elided;
+				return;
+			}
+			// order of barriers within single call is not defined, so, second barrier for the same object goes to next call
+			flushBarriers();
+			break;
+		}
+	}
+	_pendingBufferBarriers.emplace_back(barrier);
+}
+
+void CommandBuffer::addPendingBarrier(const VkImageMemoryBarrier &barrier) {
+	for (auto &it : _pendingImageBarriers) {
+		if (it.image == barrier.image) {
+			if (CommandBuffer_isEqual(it, barrier)) {
+				++ _barrierStat.elided;
+				return;
+			}
+			flushBarriers();
+			break;
+		}
+	}
+	_pendingImageBarriers.emplace_back(barrier);
+}
+
 void CommandBuffer::addImage(Image *image) {
 	_images.emplace(image);
 }
@@ -609,6 +702,27 @@ void CommandPool::invalidate(Device &dev) {
 
 const CommandBuffer *CommandPool::recordBuffer(Device &dev, const Callback<bool(CommandBuffer &)> &cb,
 		VkCommandBufferUsageFlagBits flags, Level level) {
+	return doRecordBuffer(dev, cb, flags, level, nullptr, 0);
+}
+
+const CommandBuffer *CommandPool::recordSecondaryBuffer(Device &dev, RenderPassImpl *pass, uint32_t subpass, Framebuffer *fb, bool alt,
+		const Callback<bool(CommandBuffer &)> &cb, VkCommandBufferUsageFlagBits flags) {
+	VkCommandBufferInheritanceInfo inheritanceInfo{};
+	inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+	inheritanceInfo.pNext = nullptr;
+	inheritanceInfo.renderPass = pass->getRenderPass(alt);
+	inheritanceInfo.subpass = subpass;
+	inheritanceInfo.framebuffer = fb ? fb->getFramebuffer() : VK_NULL_HANDLE;
+	inheritanceInfo.occlusionQueryEnable = VK_FALSE;
+	inheritanceInfo.queryFlags = 0;
+	inheritanceInfo.pipelineStatistics = 0;
+
+	return doRecordBuffer(dev, cb, flags | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+			Level::Secondary, &inheritanceInfo, subpass);
+}
+
+const CommandBuffer *CommandPool::doRecordBuffer(Device &dev, const Callback<bool(CommandBuffer &)> &cb,
+		VkCommandBufferUsageFlags flags, Level level, const VkCommandBufferInheritanceInfo *inheritanceInfo, uint32_t subpass) {
 	if (!_commandPool) {
 		return nullptr;
 	}
@@ -629,7 +743,7 @@ const CommandBuffer *CommandPool::recordBuffer(Device &dev, const Callback<bool(
 	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 	beginInfo.pNext = nullptr;
 	beginInfo.flags = flags;
-	beginInfo.pInheritanceInfo = nullptr;
+	beginInfo.pInheritanceInfo = inheritanceInfo;
 
 	if (dev.getTable()->vkBeginCommandBuffer(buf, &beginInfo) != VK_SUCCESS) {
 		dev.getTable()->vkFreeCommandBuffers(dev.getDevice(), _commandPool, 1, &buf);
@@ -643,10 +757,18 @@ const CommandBuffer *CommandPool::recordBuffer(Device &dev, const Callback<bool(
 		return nullptr;
 	}
 
+	if (inheritanceInfo) {
+		// framebuffer is retained by primary buffer, that begins render pass
+		b->_currentSubpass = subpass;
+	}
+
 	auto result = cb(*b);
 
+	b->flushBarriers();
 	dev.getTable()->vkEndCommandBuffer(buf);
 
+	dev.addBarrierStat(b->getBarrierStat());
+
 	if (!result) {
 		dev.getTable()->vkFreeCommandBuffers(dev.getDevice(), _commandPool, 1, &buf);
 		return nullptr;
@@ -77,6 +77,7 @@ struct DeviceQueueFamily {
 	QueueOperations preferred = QueueOperations::None;
 	QueueOperations ops = QueueOperations::None;
 	VkExtent3D transferGranularity;
+	uint32_t timestampValidBits = 0; // 0 if timestamp queries are not supported
 	Vector<Rc<DeviceQueue>> queues;
 	Vector<Rc<CommandPool>> pools;
 	Vector<Waiter> waiters;
@@ -206,11 +207,19 @@ struct DescriptorBufferViewInfo : public DescriptorInfo {
 
 class CommandBuffer : public Ref {
 public:
+	struct BarrierStat {
+		uint64_t calls = 0; // vkCmdPipelineBarrier calls recorded
+		uint64_t barriers = 0; // barriers emitted with those calls
+		uint64_t elided = 0; // duplicate or no-op barriers, that was dropped
+	};
+
 	virtual ~CommandBuffer();
 
 	bool init(const CommandPool *, const DeviceTable *, VkCommandBuffer);
 	void invalidate();
 
+	// Barriers are accumulated and recorded with a single vkCmdPipelineBarrier call before next action command
+	// (or before raw command buffer handle is acquired with non-const getBuffer)
 	void cmdPipelineBarrier(VkPipelineStageFlags, VkPipelineStageFlags, VkDependencyFlags,
 			SpanView<ImageMemoryBarrier>);
 	void cmdPipelineBarrier(VkPipelineStageFlags, VkPipelineStageFlags, VkDependencyFlags,
@@ -218,6 +227,9 @@ public:
 	void cmdPipelineBarrier(VkPipelineStageFlags, VkPipelineStageFlags, VkDependencyFlags,
 			SpanView<BufferMemoryBarrier>, SpanView<ImageMemoryBarrier>);
 
+	// record accumulated barriers now
+	void flushBarriers();
+
 	void cmdCopyBuffer(Buffer *src, Buffer *dst);
 	void cmdCopyBuffer(Buffer *src, Buffer *dst, VkDeviceSize srcOffset, VkDeviceSize dstOffset, VkDeviceSize size);
 	void cmdCopyBuffer(Buffer *src, Buffer *dst, SpanView<VkBufferCopy>);
@@ -234,7 +246,10 @@ public:
 
 	void cmdClearColorImage(Image *, VkImageLayout, const Color4F &);
 
-	void cmdBeginRenderPass(RenderPassImpl *pass, Framebuffer *fb, VkSubpassContents subpass, bool alt = false);
+	// if renderArea is defined, render pass variant, that preserves swapchain image contents, is used
+	// if clearValues is empty, pass's own clear values are used
+	void cmdBeginRenderPass(RenderPassImpl *pass, Framebuffer *fb, VkSubpassContents subpass, bool alt = false,
+			const VkRect2D *renderArea = nullptr, SpanView<VkClearValue> clearValues = SpanView<VkClearValue>());
 	void cmdEndRenderPass();
 
 	void cmdSetViewport(uint32_t firstViewport, SpanView<VkViewport> viewports);
@@ -254,6 +269,7 @@ public:
 	void cmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
 	void cmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex,
 			int32_t vertexOffset, uint32_t firstInstance);
+	void cmdDrawIndexedIndirect(Buffer *, VkDeviceSize offset, uint32_t drawCount, uint32_t stride);
 
 	void cmdPushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, BytesView);
 	void cmdPushConstants(VkShaderStageFlags stageFlags, uint32_t offset, BytesView);
@@ -265,16 +281,28 @@ public:
 
 	uint32_t cmdNextSubpass();
 
+	// execute secondary buffers within current subpass (subpass should be started with secondary contents)
+	void cmdExecuteCommands(SpanView<const CommandBuffer *>);
+
+	// handle for direct API calls, pending barriers are recorded before it returned
+	VkCommandBuffer getBuffer() { flushBarriers(); return _buffer; }
 	VkCommandBuffer getBuffer() const { return _buffer; }
 
+	const BarrierStat &getBarrierStat() const { return _barrierStat; }
+
 	uint32_t getCurrentSubpass() const { return _currentSubpass; }
 	uint32_t getBoundLayoutIndex() const { return _boundLayoutIndex; }
 	VkPipelineLayout getBoundLayout() const { return _boundLayout; }
 
 protected:
+	friend class CommandPool;
+
 	void addImage(Image *);
 	void addBuffer(Buffer *);
 
+	void addPendingBarrier(const VkBufferMemoryBarrier &);
+	void addPendingBarrier(const VkImageMemoryBarrier &);
+
 	uint32_t _currentSubpass = 0;
 	uint32_t _boundLayoutIndex = 0;
 	VkPipelineLayout _boundLayout = VK_NULL_HANDLE;
@@ -288,6 +316,13 @@ protected:
 	Set<Rc<Framebuffer>> _framebuffers;
 	Set<Rc<DescriptorSet>> _descriptorSets;
 	Set<Rc<DeviceMemoryPool>> _memPool;
+
+	VkPipelineStageFlags _pendingSrcStages = 0;
+	VkPipelineStageFlags _pendingDstStages = 0;
+	VkDependencyFlags _pendingDependencies = 0;
+	Vector<VkBufferMemoryBarrier> _pendingBufferBarriers;
+	Vector<VkImageMemoryBarrier> _pendingImageBarriers;
+	BarrierStat _barrierStat;
 };
 
 class CommandPool : public Ref {
@@ -308,12 +343,19 @@ public:
 	const CommandBuffer * recordBuffer(Device &dev, const Callback<bool(CommandBuffer &)> &,
 			VkCommandBufferUsageFlagBits = DefaultFlags, Level = Level::Primary);
 
+	// record secondary buffer, that continues subpass of render pass, started in primary buffer
+	const CommandBuffer * recordSecondaryBuffer(Device &dev, RenderPassImpl *, uint32_t subpass, Framebuffer *, bool alt,
+			const Callback<bool(CommandBuffer &)> &, VkCommandBufferUsageFlagBits = DefaultFlags);
+
 	void freeDefaultBuffers(Device &dev, Vector<VkCommandBuffer> &);
 	void reset(Device &dev, bool release = false);
 
 	void autorelease(Rc<Ref> &&);
 
 protected:
+	const CommandBuffer * doRecordBuffer(Device &dev, const Callback<bool(CommandBuffer &)> &,
+			VkCommandBufferUsageFlags, Level, const VkCommandBufferInheritanceInfo *, uint32_t subpass);
+
 	uint32_t _familyIdx = 0;
 	uint32_t _currentComplexity = 0;
 	uint32_t _bestComplexity = 0;
@@ -46,6 +46,7 @@ DeviceInfo::Features DeviceInfo::Features::getOptional() {
 	ret.device10.features.shaderStorageImageArrayDynamicIndexing = VK_TRUE;
 	ret.device10.features.shaderUniformBufferArrayDynamicIndexing = VK_TRUE;
 	ret.device10.features.multiDrawIndirect = VK_TRUE;
+	ret.device10.features.drawIndirectFirstInstance = VK_TRUE;
 	ret.device10.features.shaderFloat64 = VK_TRUE;
 	ret.device10.features.shaderInt64 = VK_TRUE;
 	ret.device10.features.shaderInt16 = VK_TRUE;
@@ -86,6 +86,7 @@ struct DeviceInfo {
 		uint32_t used = 0;
 		VkExtent3D minImageTransferGranularity;
 		uint32_t presentSurfaceMask;
+		uint32_t timestampValidBits = 0;
 	};
 
 	VkPhysicalDevice device = VK_NULL_HANDLE;
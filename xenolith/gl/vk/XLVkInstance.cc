@@ -437,6 +437,7 @@ DeviceInfo Instance::getDeviceInfo(VkPhysicalDevice device) const {
 		queueInfo[i].used = 0;
 		queueInfo[i].minImageTransferGranularity = queueFamily.minImageTransferGranularity;
 		queueInfo[i].presentSurfaceMask = presentSupport;
+		queueInfo[i].timestampValidBits = queueFamily.timestampValidBits;
 
 		if ((queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) && graphicsFamily == maxOf<uint32_t>()) {
 			graphicsFamily = i;
@@ -533,12 +533,17 @@ bool Loop::worker() {
 			Loop_runTimers(_internal, dt);
 			XL_PROFILE_END(timers)
 			data.last = data.now;
+
+			updateMemoryStat(_internal->device->getAllocator()->getMemoryStat());
+			updateMemoryPoolStat(_internal->device->getAllocator()->getPoolStat());
 		}
 
 		XL_PROFILE_BEGIN(autorelease, "vk::Loop::Autorelease", "autorelease", 500);
 		_internal->autorelease->clear();
 		XL_PROFILE_END(autorelease)
 
+		_frameCache->update(data.now);
+		updateFrameCacheStat(_frameCache->getStat(), _frameCache->getFrameStat());
 		_frameCache->clear();
 
 		XL_PROFILE_END(loop)
@@ -673,11 +678,7 @@ void Loop::releaseFramebuffer(Rc<gl::Framebuffer> &&fb) {
 	_frameCache->releaseFramebuffer(move(fb));
 }
 
-auto Loop::acquireImage(const ImageAttachment *a, const AttachmentHandle *h, Extent3 e) -> Rc<ImageStorage> {
-	if (!_running.load()) {
-		return nullptr;
-	}
-
+static gl::ImageInfo Loop_getAttachmentImageInfo(const ImageAttachment *a, const AttachmentHandle *h, Extent3 e) {
 	gl::ImageInfo info = a->getAttachmentInfo(h, e);
 	info.extent = e;
 	if (a->isTransient()) {
@@ -686,7 +687,15 @@ auto Loop::acquireImage(const ImageAttachment *a, const AttachmentHandle *h, Ext
 			info.usage |= gl::ImageUsage::TransientAttachment;
 		}
 	}
+	return info;
+}
+
+auto Loop::acquireImage(const ImageAttachment *a, const AttachmentHandle *h, Extent3 e) -> Rc<ImageStorage> {
+	if (!_running.load()) {
+		return nullptr;
+	}
 
+	auto info = Loop_getAttachmentImageInfo(a, h, e);
 	auto views = a->getImageViews(info);
 	return _frameCache->acquireImage(info, views);
 }
@@ -697,6 +706,28 @@ void Loop::releaseImage(Rc<ImageStorage> &&image) {
 	}, this, true);
 }
 
+auto Loop::acquireAliasedImages(SpanView<const FrameAttachmentData *> attachments) -> Vector<Rc<ImageStorage>> {
+	if (!_running.load()) {
+		return Vector<Rc<ImageStorage>>();
+	}
+
+	Vector<gl::ImageInfo> infos; infos.reserve(attachments.size());
+	Vector<Vector<gl::ImageViewInfo>> views; views.reserve(attachments.size());
+	for (auto &it : attachments) {
+		auto a = (const ImageAttachment *)it->handle->getAttachment().get();
+		auto &info = infos.emplace_back(Loop_getAttachmentImageInfo(a, it->handle.get(), it->extent));
+		views.emplace_back(a->getImageViews(info));
+	}
+
+	return _frameCache->acquireAliasedImages(infos, views);
+}
+
+void Loop::releaseAliasedImages(Vector<Rc<ImageStorage>> &&images) {
+	performOnGlThread([this, images = move(images)] () mutable {
+		_frameCache->releaseAliasedImages(move(images));
+	}, this, true);
+}
+
 void Loop::addView(gl::ViewInfo &&info) {
 	performOnGlThread([this, info = move(info)] () mutable {
 		_internal->addView(move(info));
@@ -797,4 +828,8 @@ void Loop::waitIdle() {
 	}
 }
 
+Device *Loop::getDevice() const {
+	return _internal ? _internal->device.get() : nullptr;
+}
+
 }
@@ -83,6 +83,9 @@ public:
 	virtual Rc<ImageStorage> acquireImage(const ImageAttachment *, const AttachmentHandle *, Extent3 e) override;
 	virtual void releaseImage(Rc<ImageStorage> &&) override;
 
+	virtual Vector<Rc<ImageStorage>> acquireAliasedImages(SpanView<const FrameAttachmentData *>) override;
+	virtual void releaseAliasedImages(Vector<Rc<ImageStorage>> &&) override;
+
 	virtual void addView(gl::ViewInfo &&) override;
 	virtual void removeView(gl::View *) override;
 
@@ -100,6 +103,12 @@ public:
 	virtual void wakeup() override;
 	virtual void waitIdle() override;
 
+	// number of loop iterations, used to group work, scheduled within the same iteration
+	uint64_t getClock() const { return _clock.load(); }
+
+	// device is available only when loop is running, should be used from gl thread
+	Device *getDevice() const;
+
 protected:
 	using gl::Loop::init;
 
@@ -115,7 +124,7 @@ protected:
 
 	Rc<Instance> _vkInstance;
 
-	uint64_t _clock = 0;
+	std::atomic<uint64_t> _clock = 0;
 
 };
 
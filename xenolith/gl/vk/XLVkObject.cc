@@ -22,6 +22,7 @@
  **/
 
 #include "XLVkObject.h"
+#include "XLVkAllocator.h"
 
 namespace stappler::xenolith::vk {
 
@@ -36,6 +37,37 @@ bool DeviceMemory::init(Device &dev, VkDeviceMemory memory) {
 	}, gl::ObjectType::DeviceMemory, ObjectHandle(_memory));
 }
 
+DeviceMemory::~DeviceMemory() {
+	releaseTracking();
+}
+
+bool DeviceMemory::init(Device &dev, VkDeviceMemory memory, uint32_t typeIdx, VkDeviceSize size) {
+	if (!init(dev, memory)) {
+		return false;
+	}
+
+	if (auto &alloc = dev.getAllocator()) {
+		alloc->trackAllocation(typeIdx, size);
+		_typeIdx = typeIdx;
+		_trackedSize = size;
+	}
+	return true;
+}
+
+void DeviceMemory::invalidate() {
+	releaseTracking();
+	gl::Object::invalidate();
+}
+
+void DeviceMemory::releaseTracking() {
+	if (_trackedSize > 0 && _device) {
+		if (auto &alloc = ((Device *)_device)->getAllocator()) {
+			alloc->trackRelease(_typeIdx, _trackedSize);
+		}
+		_trackedSize = 0;
+	}
+}
+
 bool Image::init(Device &dev, VkImage image, const gl::ImageInfo &info, uint32_t idx) {
 	_info = info;
 	_image = image;
@@ -368,4 +400,23 @@ bool Sampler::init(Device &dev, const gl::SamplerInfo &info) {
 	return false;
 }
 
+bool QueryPool::init(Device &dev, uint32_t count) {
+	VkQueryPoolCreateInfo createInfo; sanitizeVkStruct(createInfo);
+	createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+	createInfo.pNext = nullptr;
+	createInfo.flags = 0;
+	createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+	createInfo.queryCount = count;
+	createInfo.pipelineStatistics = 0;
+
+	if (dev.getTable()->vkCreateQueryPool(dev.getDevice(), &createInfo, nullptr, &_pool) == VK_SUCCESS) {
+		_count = count;
+		return gl::Object::init(dev, [] (gl::Device *dev, gl::ObjectType, ObjectHandle ptr) {
+			auto d = ((Device *)dev);
+			d->getTable()->vkDestroyQueryPool(d->getDevice(), (VkQueryPool)ptr.get(), nullptr);
+		}, gl::ObjectType::QueryPool, ObjectHandle(_pool));
+	}
+	return false;
+}
+
 }
@@ -34,16 +34,25 @@ class SwapchainImage;
 
 class DeviceMemory : public gl::Object {
 public:
-	virtual ~DeviceMemory() { }
+	virtual ~DeviceMemory();
 
 	bool init(Device &dev, VkDeviceMemory);
 
+	// memory, that should be accounted in allocator's heap usage
+	bool init(Device &dev, VkDeviceMemory, uint32_t typeIdx, VkDeviceSize size);
+
+	virtual void invalidate() override;
+
 	VkDeviceMemory getMemory() const { return _memory; }
 
 protected:
 	using gl::Object::init;
 
+	void releaseTracking();
+
 	VkDeviceMemory _memory = VK_NULL_HANDLE;
+	uint32_t _typeIdx = 0;
+	VkDeviceSize _trackedSize = 0;
 };
 
 class Image : public gl::ImageObject {
@@ -132,6 +141,23 @@ protected:
 	VkSampler _sampler = VK_NULL_HANDLE;
 };
 
+// Timestamp query pool, used to measure GPU time of queue passes
+class QueryPool : public gl::Object {
+public:
+	virtual ~QueryPool() { }
+
+	bool init(Device &dev, uint32_t count);
+
+	VkQueryPool getPool() const { return _pool; }
+	uint32_t getCount() const { return _count; }
+
+protected:
+	using gl::Object::init;
+
+	VkQueryPool _pool = VK_NULL_HANDLE;
+	uint32_t _count = 0;
+};
+
 }
 
 #endif /* XENOLITH_GL_VK_XLVKOBJECT_H_ */
@@ -39,12 +39,16 @@ DescriptorBinding::DescriptorBinding(VkDescriptorType type, uint32_t count) : ty
 Rc<Ref> DescriptorBinding::write(uint32_t idx, DescriptorBufferInfo &&info) {
 	auto ret = move(data[idx].data);
 	data[idx] = DescriptorData{gl::ObjectHandle(info.buffer->getBuffer()), move(info.buffer)};
+	data[idx].offset = info.offset;
+	data[idx].range = info.range;
 	return ret;
 }
 
 Rc<Ref> DescriptorBinding::write(uint32_t idx, DescriptorImageInfo &&info) {
 	auto ret = move(data[idx].data);
 	data[idx] = DescriptorData{gl::ObjectHandle(info.imageView->getImageView()), move(info.imageView)};
+	data[idx].sampler = info.sampler;
+	data[idx].layout = info.layout;
 	return ret;
 }
 
@@ -54,6 +58,19 @@ Rc<Ref> DescriptorBinding::write(uint32_t idx, DescriptorBufferViewInfo &&info)
 	return ret;
 }
 
+bool DescriptorBinding::isWritten(uint32_t idx, const DescriptorBufferInfo &info) const {
+	// stored data retains buffer object, so, handle can not be reused by another buffer
+	auto &d = data[idx];
+	return d.data && d.object == gl::ObjectHandle(info.buffer->getBuffer())
+			&& d.offset == info.offset && d.range == info.range;
+}
+
+bool DescriptorBinding::isWritten(uint32_t idx, const DescriptorImageInfo &info) const {
+	auto &d = data[idx];
+	return d.data && d.object == gl::ObjectHandle(info.imageView->getImageView())
+			&& d.sampler == info.sampler && d.layout == info.layout;
+}
+
 bool RenderPassImpl::Data::cleanup(Device &dev) {
 	if (renderPass) {
 		dev.getTable()->vkDestroyRenderPass(dev.getDevice(), renderPass, nullptr);
@@ -65,6 +82,11 @@ bool RenderPassImpl::Data::cleanup(Device &dev) {
 		renderPassAlternative = VK_NULL_HANDLE;
 	}
 
+	if (renderPassPreserve) {
+		dev.getTable()->vkDestroyRenderPass(dev.getDevice(), renderPassPreserve, nullptr);
+		renderPassPreserve = VK_NULL_HANDLE;
+	}
+
 	for (auto &it : layouts) {
 		for (VkDescriptorSetLayout &set : it.layouts) {
 			dev.getTable()->vkDestroyDescriptorSetLayout(dev.getDevice(), set, nullptr);
@@ -105,10 +127,13 @@ bool RenderPassImpl::init(Device &dev, PassData &data) {
 	return false;
 }
 
-VkRenderPass RenderPassImpl::getRenderPass(bool alt) const {
+VkRenderPass RenderPassImpl::getRenderPass(bool alt, bool preserve) const {
 	if (alt && _data->renderPassAlternative) {
 		return _data->renderPassAlternative;
 	}
+	if (preserve && _data->renderPassPreserve) {
+		return _data->renderPassPreserve;
+	}
 	return _data->renderPass;
 }
 
@@ -145,107 +170,119 @@ bool RenderPassImpl::writeDescriptors(const QueuePassHandle &handle, uint32_t la
 		writeData.pBufferInfo = VK_NULL_HANDLE;
 		writeData.pTexelBufferView = VK_NULL_HANDLE;
 
+		auto flushWrites = [&] (uint32_t i) {
+			if (writeData.descriptorCount > 0) {
+				if (localImages) {
+					writeData.pImageInfo = localImages->data();
+				}
+				if (localBuffers) {
+					writeData.pBufferInfo = localBuffers->data();
+				}
+				if (localViews) {
+					writeData.pTexelBufferView = localViews->data();
+				}
+
+				writes.emplace_back(move(writeData));
+
+				writeData.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+				writeData.pNext = nullptr;
+				writeData.dstSet = set->set;
+				writeData.dstBinding = currentDescriptor;
+				writeData.descriptorCount = 0;
+				writeData.descriptorType = VkDescriptorType(desc.type);
+				writeData.pImageInfo = VK_NULL_HANDLE;
+				writeData.pBufferInfo = VK_NULL_HANDLE;
+				writeData.pTexelBufferView = VK_NULL_HANDLE;
+
+				localImages = nullptr;
+				localBuffers = nullptr;
+				localViews = nullptr;
+			}
+
+			writeData.dstArrayElement = i + 1;
+		};
+
 		auto c = a->getDescriptorArraySize(handle, desc, external);
 		for (uint32_t i = 0; i < c; ++ i) {
 			if (a->isDescriptorDirty(handle, desc, i, external)) {
+				bool written = true;
 				switch (desc.type) {
 				case DescriptorType::Sampler:
 				case DescriptorType::CombinedImageSampler:
 				case DescriptorType::SampledImage:
 				case DescriptorType::StorageImage:
-				case DescriptorType::InputAttachment:
-					if (!localImages) {
-						localImages = &images.emplace_front(Vector<VkDescriptorImageInfo>());
-					}
-					if (localImages) {
-						auto h = (ImageAttachmentHandle *)a;
-
-						DescriptorImageInfo info(&desc, i, external);
-						if (!h->writeDescriptor(handle, info)) {
-							return false;
-						} else {
-							localImages->emplace_back(VkDescriptorImageInfo{info.sampler, info.imageView->getImageView(), info.layout});
-							if (auto ref = set->bindings[currentDescriptor].write(i, move(info))) {
-								handle.autorelease(ref);
-							}
+				case DescriptorType::InputAttachment: {
+					auto h = (ImageAttachmentHandle *)a;
+
+					DescriptorImageInfo info(&desc, i, external);
+					if (!h->writeDescriptor(handle, info)) {
+						return false;
+					} else if (set->bindings[currentDescriptor].isWritten(i, info)) {
+						// descriptor already contains this image, skip write
+						written = false;
+					} else {
+						if (!localImages) {
+							localImages = &images.emplace_front(Vector<VkDescriptorImageInfo>());
+						}
+						localImages->emplace_back(VkDescriptorImageInfo{info.sampler, info.imageView->getImageView(), info.layout});
+						if (auto ref = set->bindings[currentDescriptor].write(i, move(info))) {
+							handle.autorelease(ref);
 						}
 					}
 					break;
+				}
 				case DescriptorType::StorageTexelBuffer:
-				case DescriptorType::UniformTexelBuffer:
+				case DescriptorType::UniformTexelBuffer: {
 					if (!localViews) {
 						localViews = &views.emplace_front(Vector<VkBufferView>());
 					}
-					if (localViews) {
-						auto h = (TexelAttachmentHandle *)a;
-
-						DescriptorBufferViewInfo info(&desc, i, external);
-						if (h->writeDescriptor(handle, info)) {
-							localViews->emplace_back(info.target);
-							if (auto ref = set->bindings[currentDescriptor].write(i, move(info))) {
-								handle.autorelease(ref);
-							}
-						} else {
-							return false;
+					auto h = (TexelAttachmentHandle *)a;
+
+					DescriptorBufferViewInfo info(&desc, i, external);
+					if (h->writeDescriptor(handle, info)) {
+						localViews->emplace_back(info.target);
+						if (auto ref = set->bindings[currentDescriptor].write(i, move(info))) {
+							handle.autorelease(ref);
 						}
+					} else {
+						return false;
 					}
 					break;
+				}
 				case DescriptorType::UniformBuffer:
 				case DescriptorType::StorageBuffer:
 				case DescriptorType::UniformBufferDynamic:
-				case DescriptorType::StorageBufferDynamic:
-					if (!localBuffers) {
-						localBuffers = &buffers.emplace_front(Vector<VkDescriptorBufferInfo>());
-					}
-					if (localBuffers) {
-						auto h = (BufferAttachmentHandle *)a;
-
-						DescriptorBufferInfo info(&desc, i, external);
-						if (!h->writeDescriptor(handle, info)) {
-							return false;
-						} else {
-							localBuffers->emplace_back(VkDescriptorBufferInfo{info.buffer->getBuffer(), info.offset, info.range});
-							if (auto ref = set->bindings[currentDescriptor].write(i, move(info))) {
-								handle.autorelease(ref);
-							}
+				case DescriptorType::StorageBufferDynamic: {
+					auto h = (BufferAttachmentHandle *)a;
+
+					DescriptorBufferInfo info(&desc, i, external);
+					if (!h->writeDescriptor(handle, info)) {
+						return false;
+					} else if (set->bindings[currentDescriptor].isWritten(i, info)) {
+						// descriptor already contains this buffer range, skip write
+						written = false;
+					} else {
+						if (!localBuffers) {
+							localBuffers = &buffers.emplace_front(Vector<VkDescriptorBufferInfo>());
+						}
+						localBuffers->emplace_back(VkDescriptorBufferInfo{info.buffer->getBuffer(), info.offset, info.range});
+						if (auto ref = set->bindings[currentDescriptor].write(i, move(info))) {
+							handle.autorelease(ref);
 						}
 					}
 					break;
+				}
 				case DescriptorType::Unknown:
 				case DescriptorType::Attachment:
 					break;
 				}
-				++ writeData.descriptorCount;
-			} else {
-				if (writeData.descriptorCount > 0) {
-					if (localImages) {
-						writeData.pImageInfo = localImages->data();
-					}
-					if (localBuffers) {
-						writeData.pBufferInfo = localBuffers->data();
-					}
-					if (localViews) {
-						writeData.pTexelBufferView = localViews->data();
-					}
-
-					writes.emplace_back(move(writeData));
-
-					writeData.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-					writeData.pNext = nullptr;
-					writeData.dstSet = set->set;
-					writeData.dstBinding = currentDescriptor;
-					writeData.descriptorCount = 0;
-					writeData.descriptorType = VkDescriptorType(desc.type);
-					writeData.pImageInfo = VK_NULL_HANDLE;
-					writeData.pBufferInfo = VK_NULL_HANDLE;
-					writeData.pTexelBufferView = VK_NULL_HANDLE;
-
-					localImages = nullptr;
-					localBuffers = nullptr;
-					localViews = nullptr;
+				if (written) {
+					++ writeData.descriptorCount;
+				} else {
+					flushWrites(i);
 				}
-
-				writeData.dstArrayElement = i + 1;
+			} else {
+				flushWrites(i);
 			}
 		}
 
@@ -290,19 +327,47 @@ bool RenderPassImpl::writeDescriptors(const QueuePassHandle &handle, uint32_t la
 	return true;
 }
 
-void RenderPassImpl::perform(const QueuePassHandle &handle, CommandBuffer &buf, const Callback<void()> &cb) {
-	bool useAlternative = false;
+bool RenderPassImpl::isAlternativeRequired(const QueuePassHandle &handle) const {
 	for (auto &it : _variableAttachments) {
 		if (auto aHandle = handle.getAttachmentHandle(it->attachment)) {
 			if (aHandle->getQueueData()->image && !aHandle->getQueueData()->image->isSwapchainImage()) {
-				useAlternative = true;
-				break;
+				return true;
 			}
 		}
 	}
+	return false;
+}
+
+bool RenderPassImpl::getFrameClearValues(const QueuePassHandle &handle, Vector<VkClearValue> &values) const {
+	for (size_t i = 0; i < _clearAttachments.size(); ++ i) {
+		if (!_clearAttachments[i]) {
+			continue;
+		}
 
+		if (auto aHandle = handle.getAttachmentHandle(_clearAttachments[i]->attachment)) {
+			auto data = aHandle->getQueueData();
+			if (data && data->hasClearColor) {
+				if (values.empty()) {
+					values = _clearValues;
+				}
+				auto &c = data->clearColor;
+				values[i] = VkClearValue{c.r, c.g, c.b, c.a};
+			}
+		}
+	}
+	return !values.empty();
+}
+
+void RenderPassImpl::perform(const QueuePassHandle &handle, CommandBuffer &buf, const Callback<void()> &cb,
+		VkSubpassContents contents, const VkRect2D *renderArea) {
 	if (_data->renderPass) {
-		buf.cmdBeginRenderPass(this, (Framebuffer *)handle.getFramebuffer().get(), VK_SUBPASS_CONTENTS_INLINE, useAlternative);
+		auto alt = isAlternativeRequired(handle);
+
+		Vector<VkClearValue> clearValues;
+		getFrameClearValues(handle, clearValues);
+
+		buf.cmdBeginRenderPass(this, (Framebuffer *)handle.getFramebuffer().get(), contents, alt,
+				(!alt && _data->renderPassPreserve) ? renderArea : nullptr, clearValues);
 
 		cb();
 
@@ -324,6 +389,7 @@ bool RenderPassImpl::initGraphicsPass(Device &dev, PassData &data) {
 
 		VkAttachmentDescription attachment;
 		VkAttachmentDescription attachmentAlternative;
+		VkAttachmentDescription attachmentPreserve;
 
 		bool mayAlias = false;
 		for (auto &u : desc->subpasses) {
@@ -345,16 +411,24 @@ bool RenderPassImpl::initGraphicsPass(Device &dev, PassData &data) {
 		attachmentAlternative.initialLayout = attachment.initialLayout = VkImageLayout(desc->initialLayout);
 		attachmentAlternative.finalLayout = attachment.finalLayout = VkImageLayout(desc->finalLayout);
 
+		attachmentPreserve = attachment;
+
 		if (desc->finalLayout == renderqueue::AttachmentLayout::PresentSrc) {
 			hasAlternative = true;
 			attachmentAlternative.finalLayout = VkImageLayout(renderqueue::AttachmentLayout::TransferSrcOptimal);
 			_variableAttachments.emplace(desc);
+
+			if (desc->initialLayout == renderqueue::AttachmentLayout::Undefined) {
+				// swapchain image was presented with previous frame, transition from undefined layout discards contents
+				attachmentPreserve.initialLayout = VkImageLayout(renderqueue::AttachmentLayout::PresentSrc);
+			}
 		}
 
 		desc->index = _attachmentDescriptions.size();
 
 		_attachmentDescriptions.emplace_back(attachment);
 		_attachmentDescriptionsAlternative.emplace_back(attachmentAlternative);
+		_attachmentDescriptionsPreserve.emplace_back(attachmentPreserve);
 
 		auto fmt = gl::getImagePixelFormat(imageAttachment->getImageInfo().format);
 		switch (fmt) {
@@ -406,6 +480,18 @@ bool RenderPassImpl::initGraphicsPass(Device &dev, PassData &data) {
 			break;
 		}
 
+		// only color attachments can be cleared with color, requested for the frame
+		switch (fmt) {
+		case gl::PixelFormat::D:
+		case gl::PixelFormat::DS:
+		case gl::PixelFormat::S:
+			_clearAttachments.emplace_back(nullptr);
+			break;
+		default:
+			_clearAttachments.emplace_back((desc->loadOp == renderqueue::AttachmentLoadOp::Clear) ? desc : nullptr);
+			break;
+		}
+
 		attachmentReferences += desc->subpasses.size();
 
 		if (data.subpasses.size() >= 3 && desc->subpasses.size() < data.subpasses.size()) {
@@ -549,6 +635,14 @@ bool RenderPassImpl::initGraphicsPass(Device &dev, PassData &data) {
 		if (dev.getTable()->vkCreateRenderPass(dev.getDevice(), &renderPassInfo, nullptr, &pass.renderPassAlternative) != VK_SUCCESS) {
 			return pass.cleanup(dev);
 		}
+
+		// variant for partial rendering into swapchain image, compatible with main render pass
+		renderPassInfo.attachmentCount = _attachmentDescriptionsPreserve.size();
+		renderPassInfo.pAttachments = _attachmentDescriptionsPreserve.data();
+
+		if (dev.getTable()->vkCreateRenderPass(dev.getDevice(), &renderPassInfo, nullptr, &pass.renderPassPreserve) != VK_SUCCESS) {
+			return pass.cleanup(dev);
+		}
 	}
 
 	if (initDescriptors(dev, data, pass)) {
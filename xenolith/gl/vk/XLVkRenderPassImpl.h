@@ -34,6 +34,12 @@ class Device;
 struct DescriptorData {
 	gl::ObjectHandle object;
 	Rc<Ref> data;
+
+	// last written parameters, to skip redundant writes
+	VkDeviceSize offset = 0;
+	VkDeviceSize range = 0;
+	VkSampler sampler = VK_NULL_HANDLE;
+	VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
 };
 
 struct DescriptorBinding {
@@ -47,6 +53,10 @@ struct DescriptorBinding {
 	Rc<Ref> write(uint32_t, DescriptorBufferInfo &&);
 	Rc<Ref> write(uint32_t, DescriptorImageInfo &&);
 	Rc<Ref> write(uint32_t, DescriptorBufferViewInfo &&);
+
+	// check if descriptor already contains the same data (so, write can be skipped)
+	bool isWritten(uint32_t, const DescriptorBufferInfo &) const;
+	bool isWritten(uint32_t, const DescriptorImageInfo &) const;
 };
 
 struct DescriptorSet : public Ref {
@@ -66,6 +76,7 @@ public:
 	struct Data {
 		VkRenderPass renderPass = VK_NULL_HANDLE;
 		VkRenderPass renderPassAlternative = VK_NULL_HANDLE;
+		VkRenderPass renderPassPreserve = VK_NULL_HANDLE;
 		Vector<LayoutData> layouts;
 
 		bool cleanup(Device &dev);
@@ -75,18 +86,31 @@ public:
 
 	virtual bool init(Device &dev, PassData &);
 
-	VkRenderPass getRenderPass(bool alt = false) const;
+	// preserve - variant, that keeps swapchain image contents outside of render area (for partial rendering)
+	VkRenderPass getRenderPass(bool alt = false, bool preserve = false) const;
 	VkPipelineLayout getPipelineLayout(uint32_t idx) const { return _data->layouts[idx].layout; }
 	const Vector<Rc<DescriptorSet>> &getDescriptorSets(uint32_t idx) const { return _data->layouts[idx].sets; }
 	const Vector<VkClearValue> &getClearValues() const { return _clearValues; }
 
+	// fills values with pass clear values, if frame overrides clear color for any attachment
+	bool getFrameClearValues(const QueuePassHandle &, Vector<VkClearValue> &) const;
+
 	//VkDescriptorSet getDescriptorSet(uint32_t) const;
 
 	// if async is true - update descriptors with updateAfterBind flag
 	// 			   false - without updateAfterBindFlag
 	virtual bool writeDescriptors(const QueuePassHandle &, uint32_t layoutIndex, bool async) const;
 
-	virtual void perform(const QueuePassHandle &, CommandBuffer &buf, const Callback<void()> &);
+	// true if render pass variant for non-swapchain images should be used with current attachments
+	bool isAlternativeRequired(const QueuePassHandle &) const;
+
+	// true if render pass has variant, that preserves swapchain image contents
+	bool hasPreserveVariant() const { return _data && _data->renderPassPreserve; }
+
+	// contents defines how commands for first subpass will be provided (inline or with secondary buffers)
+	// if renderArea is defined, only this area of swapchain image is redrawn, the rest is preserved
+	virtual void perform(const QueuePassHandle &, CommandBuffer &buf, const Callback<void()> &,
+			VkSubpassContents = VK_SUBPASS_CONTENTS_INLINE, const VkRect2D *renderArea = nullptr);
 
 protected:
 	using gl::RenderPass::init;
@@ -101,6 +125,7 @@ protected:
 
 	Vector<VkAttachmentDescription> _attachmentDescriptions;
 	Vector<VkAttachmentDescription> _attachmentDescriptionsAlternative;
+	Vector<VkAttachmentDescription> _attachmentDescriptionsPreserve;
 	Vector<VkAttachmentReference> _attachmentReferences;
 	Vector<uint32_t> _preservedAttachments;
 	Vector<VkSubpassDependency> _subpassDependencies;
@@ -109,6 +134,7 @@ protected:
 	Data *_data = nullptr;
 
 	Vector<VkClearValue> _clearValues;
+	Vector<const renderqueue::AttachmentPassData *> _clearAttachments; // color attachments for _clearValues
 };
 
 }
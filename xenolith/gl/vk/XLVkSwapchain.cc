@@ -130,6 +130,9 @@ bool SwapchainHandle::init(Device &dev, const gl::SurfaceInfo &info, const gl::S
 			_images.emplace_back(SwapchainImageData{move(image), move(views)});
 		}
 
+		_damage.resize(_images.size());
+		_incrementalPresent = dev.hasIncrementalPresent();
+
 		_rebuildMode = _presentMode = presentMode;
 		_imageInfo = move(swapchainImageInfo);
 		_config = move(cfg);
@@ -203,6 +206,7 @@ auto SwapchainHandle::acquire(bool lockfree, const Rc<Fence> &fence) -> Rc<Swapc
 			fence->setArmed();
 		}
 		++ _acquiredImages;
+		_damage[imageIndex].tracked = false;
 		return Rc<SwapchainAcquiredImage>::alloc(imageIndex, &_images.at(imageIndex), move(sem), this);
 		break;
 	case VK_SUBOPTIMAL_KHR:
@@ -215,6 +219,7 @@ auto SwapchainHandle::acquire(bool lockfree, const Rc<Fence> &fence) -> Rc<Swapc
 		}
 		_deprecated = true;
 		++ _acquiredImages;
+		_damage[imageIndex].tracked = false;
 		return Rc<SwapchainAcquiredImage>::alloc(imageIndex, &_images.at(imageIndex), move(sem), this);
 		break;
 	default:
@@ -240,6 +245,29 @@ VkResult SwapchainHandle::present(DeviceQueue &queue, const Rc<ImageStorage> &im
 	presentInfo.pImageIndices = &imageIndex;
 	presentInfo.pResults = nullptr; // Optional
 
+	VkRectLayerKHR presentRect;
+	VkPresentRegionKHR presentRegion;
+	VkPresentRegionsKHR presentRegions;
+
+	do {
+		std::unique_lock<Mutex> lock(_resourceMutex);
+		if (imageIndex < _damage.size()) {
+			auto &d = _damage[imageIndex];
+			if (!d.tracked) {
+				// image was written outside of damage tracking (like copy from offscreen image),
+				// so, history of other images is not valid
+				for (auto &it : _damage) {
+					it.valid = false;
+				}
+			} else if (d.partial && _incrementalPresent) {
+				presentRect = VkRectLayerKHR{d.present.offset, d.present.extent, 0};
+				presentRegion = VkPresentRegionKHR{1, &presentRect};
+				presentRegions = VkPresentRegionsKHR{VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR, nullptr, 1, &presentRegion};
+				presentInfo.pNext = &presentRegions;
+			}
+		}
+	} while (0);
+
 	VkResult result = VK_ERROR_UNKNOWN;
 	_device->makeApiCall([&] (const DeviceTable &table, VkDevice device) {
 #if XL_VKAPI_DEBUG
@@ -282,6 +310,93 @@ void SwapchainHandle::invalidateImage(const ImageStorage *image) {
 	if (!((SwapchainImage *)image)->isPresented()) {
 		std::unique_lock<Mutex> lock(_resourceMutex);
 		-- _acquiredImages;
+
+		// frame was not completed, image contents is unknown
+		auto idx = image->getImageIndex();
+		if (idx < _damage.size()) {
+			_damage[idx].valid = false;
+		}
+	}
+}
+
+static bool SwapchainHandle_isEmpty(const VkRect2D &rect) {
+	return rect.extent.width == 0 || rect.extent.height == 0;
+}
+
+static VkRect2D SwapchainHandle_union(const VkRect2D &a, const VkRect2D &b) {
+	if (SwapchainHandle_isEmpty(a)) {
+		return b;
+	} else if (SwapchainHandle_isEmpty(b)) {
+		return a;
+	}
+
+	auto minX = std::min(a.offset.x, b.offset.x);
+	auto minY = std::min(a.offset.y, b.offset.y);
+	auto maxX = std::max(a.offset.x + int32_t(a.extent.width), b.offset.x + int32_t(b.extent.width));
+	auto maxY = std::max(a.offset.y + int32_t(a.extent.height), b.offset.y + int32_t(b.extent.height));
+
+	return VkRect2D{{minX, minY}, {uint32_t(maxX - minX), uint32_t(maxY - minY)}};
+}
+
+static VkRect2D SwapchainHandle_clamp(const VkRect2D &rect, const Extent3 &extent) {
+	auto minX = std::clamp(rect.offset.x, int32_t(0), int32_t(extent.width));
+	auto minY = std::clamp(rect.offset.y, int32_t(0), int32_t(extent.height));
+	auto maxX = std::clamp(rect.offset.x + int32_t(rect.extent.width), minX, int32_t(extent.width));
+	auto maxY = std::clamp(rect.offset.y + int32_t(rect.extent.height), minY, int32_t(extent.height));
+
+	if (maxX == minX || maxY == minY) {
+		// nothing was changed, but render area and present region can not be empty
+		return VkRect2D{{0, 0}, {1, 1}};
+	}
+
+	return VkRect2D{{minX, minY}, {uint32_t(maxX - minX), uint32_t(maxY - minY)}};
+}
+
+bool SwapchainHandle::acquireDamage(uint32_t idx, const VkRect2D &damage, bool full, VkRect2D &area) {
+	std::unique_lock<Mutex> lock(_resourceMutex);
+	if (idx >= _damage.size()) {
+		return false;
+	}
+
+	for (size_t i = 0; i < _damage.size(); ++ i) {
+		if (i != idx) {
+			if (full) {
+				_damage[i].valid = false;
+			} else {
+				_damage[i].area = SwapchainHandle_union(_damage[i].area, damage);
+			}
+		}
+	}
+
+	auto &img = _damage[idx];
+	auto partial = _damageTracking && img.valid && !full;
+	if (partial) {
+		area = SwapchainHandle_clamp(SwapchainHandle_union(img.area, damage), _imageInfo.extent);
+		img.present = SwapchainHandle_clamp(damage, _imageInfo.extent);
+	}
+
+	img.area = VkRect2D{{0, 0}, {0, 0}};
+	img.valid = true;
+	img.partial = partial;
+	img.tracked = true;
+
+	++ _damageStat.frames;
+	if (partial) {
+		++ _damageStat.partialFrames;
+		_damageStat.lastArea = area;
+	}
+	return partial;
+}
+
+SwapchainHandle::DamageStat SwapchainHandle::getDamageStat() {
+	std::unique_lock<Mutex> lock(_resourceMutex);
+	return _damageStat;
+}
+
+void SwapchainHandle::invalidateDamage() {
+	std::unique_lock<Mutex> lock(_resourceMutex);
+	for (auto &it : _damage) {
+		it.valid = false;
 	}
 }
 
@@ -89,6 +89,28 @@ public:
 	VkResult present(DeviceQueue &queue, const Rc<ImageStorage> &);
 	void invalidateImage(const ImageStorage *);
 
+	struct DamageStat {
+		uint64_t frames = 0; // frames, rendered with acquireDamage
+		uint64_t partialFrames = 0; // frames, rendered only within damaged area
+		VkRect2D lastArea = VkRect2D{{0, 0}, {0, 0}}; // area, redrawn by last partial frame
+	};
+
+	// Damage tracking for partial rendering (see View::EngineOptions::enableDamageTracking)
+	void setDamageTracking(bool value) { _damageTracking = value; }
+	bool isDamageTrackingEnabled() const { return _damageTracking; }
+
+	// damaged area is passed to presentation engine (VK_KHR_incremental_present)
+	bool isIncrementalPresent() const { return _incrementalPresent; }
+
+	DamageStat getDamageStat();
+
+	// merges frame damage into history of all images and writes area, that should be redrawn in image
+	// to make it up to date (in framebuffer coordinates); returns false if image should be redrawn entirely
+	bool acquireDamage(uint32_t imageIndex, const VkRect2D &damage, bool full, VkRect2D &area);
+
+	// forget contents of all images, next frame for every image will be redrawn entirely
+	void invalidateDamage();
+
 	Rc<Semaphore> acquireSemaphore();
 	void releaseSemaphore(Rc<Semaphore> &&);
 
@@ -97,6 +119,14 @@ public:
 protected:
 	using gl::Object::init;
 
+	struct ImageDamage {
+		VkRect2D area = VkRect2D{{0, 0}, {0, 0}}; // changed since image was rendered last time
+		VkRect2D present = VkRect2D{{0, 0}, {0, 0}}; // changed by frame, that was rendered into image
+		bool valid = false; // image contains previously rendered frame
+		bool partial = false; // current image's frame was rendered partially
+		bool tracked = false; // current image's frame was rendered with acquireDamage
+	};
+
 	gl::ImageViewInfo getSwapchainImageViewInfo(const gl::ImageInfo &image) const;
 
 	Device *_device = nullptr;
@@ -116,6 +146,11 @@ protected:
 	Vector<Rc<Semaphore>> _semaphores;
 	Rc<Semaphore> _presentSemaphore;
 	Rc<Surface> _surface;
+
+	bool _damageTracking = false;
+	bool _incrementalPresent = false;
+	Vector<ImageDamage> _damage; // guarded by _resourceMutex
+	DamageStat _damageStat; // guarded by _resourceMutex
 };
 
 class SwapchainImage : public renderqueue::ImageStorage {
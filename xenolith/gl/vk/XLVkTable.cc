@@ -67,6 +67,54 @@ void setDeviceHookThreadContext(
 	tl_deviceHookTable.ctx = c;
 }
 
+// hook context by loader dispatch key of device, has priority over thread-local context
+static Mutex s_deviceHookMutex;
+static Map<const void *, DeviceTableHookInfo> s_deviceHookTables;
+
+// all dispatchable handles of the device (VkDevice, VkQueue, VkCommandBuffer) starts with the same loader dispatch pointer
+template <typename T>
+static const void *DeviceTable_getDispatchKey(T handle) {
+	return *(const void * const *)handle;
+}
+
+template <typename T>
+static DeviceTableHookInfo DeviceTable_getHookInfo(T handle) {
+	std::unique_lock<Mutex> lock(s_deviceHookMutex);
+	auto it = s_deviceHookTables.find(DeviceTable_getDispatchKey(handle));
+	if (it != s_deviceHookTables.end()) {
+		return it->second;
+	}
+	lock.unlock();
+
+	log::vtext("vk::DeviceTable", "Hook is called for unregistered device, thread context table is used");
+	return tl_deviceHookTable;
+}
+
+void registerDeviceHookTable(VkDevice device, const DeviceTable *table) {
+	std::unique_lock<Mutex> lock(s_deviceHookMutex);
+	auto &info = s_deviceHookTables[DeviceTable_getDispatchKey(device)];
+	info = DeviceTableHookInfo{nullptr, nullptr, table, nullptr, nullptr};
+}
+
+void setDeviceHookContext(VkDevice device,
+		void (*pre) (void *ctx, const char *, PFN_vkVoidFunction),
+		void (*post) (void *ctx, const char *, PFN_vkVoidFunction),
+		const DeviceTable *r, void *c) {
+	std::unique_lock<Mutex> lock(s_deviceHookMutex);
+	auto it = s_deviceHookTables.find(DeviceTable_getDispatchKey(device));
+	if (it != s_deviceHookTables.end()) {
+		it->second.preCall = pre;
+		it->second.postCall = post;
+		it->second.replace = r;
+		it->second.ctx = c;
+	}
+}
+
+void unregisterDeviceHookTable(VkDevice device) {
+	std::unique_lock<Mutex> lock(s_deviceHookMutex);
+	s_deviceHookTables.erase(DeviceTable_getDispatchKey(device));
+}
+
 #endif /* VK_HOOK_DEBUG */
 
 static PFN_vkVoidFunction loadInstanceAliased(PFN_vkGetInstanceProcAddr addr, VkInstance instance, const char *name,
@@ -2271,1260 +2319,1381 @@ static VkBool32 xl_hook_tl_instanceHookTable_vkGetPhysicalDeviceScreenPresentati
 #if defined(VK_VERSION_1_0)
 
 static PFN_vkVoidFunction xl_hook_tl_deviceHookTable_vkGetDeviceProcAddr(VkDevice device, const char* pName) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceProcAddr;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceProcAddr) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceProcAddr;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceProcAddr;
+	if (__info.replace && __info.replace->vkGetDeviceProcAddr) {
+		__fn = __info.replace->vkGetDeviceProcAddr;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceProcAddr", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceProcAddr", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pName);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceProcAddr", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceProcAddr", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyDevice;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyDevice) {
-		__fn = tl_deviceHookTable.replace->vkDestroyDevice;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyDevice;
+	if (__info.replace && __info.replace->vkDestroyDevice) {
+		__fn = __info.replace->vkDestroyDevice;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyDevice", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyDevice", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyDevice", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyDevice", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceQueue;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceQueue) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceQueue;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceQueue;
+	if (__info.replace && __info.replace->vkGetDeviceQueue) {
+		__fn = __info.replace->vkGetDeviceQueue;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceQueue", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceQueue", (PFN_vkVoidFunction)__fn); }
 	__fn(device, queueFamilyIndex, queueIndex, pQueue);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceQueue", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceQueue", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
-	auto __fn = tl_deviceHookTable.table->vkQueueSubmit;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkQueueSubmit) {
-		__fn = tl_deviceHookTable.replace->vkQueueSubmit;
+	auto __info = DeviceTable_getHookInfo(queue);
+	auto __fn = __info.table->vkQueueSubmit;
+	if (__info.replace && __info.replace->vkQueueSubmit) {
+		__fn = __info.replace->vkQueueSubmit;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkQueueSubmit", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkQueueSubmit", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(queue, submitCount, pSubmits, fence);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkQueueSubmit", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkQueueSubmit", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkQueueWaitIdle(VkQueue queue) {
-	auto __fn = tl_deviceHookTable.table->vkQueueWaitIdle;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkQueueWaitIdle) {
-		__fn = tl_deviceHookTable.replace->vkQueueWaitIdle;
+	auto __info = DeviceTable_getHookInfo(queue);
+	auto __fn = __info.table->vkQueueWaitIdle;
+	if (__info.replace && __info.replace->vkQueueWaitIdle) {
+		__fn = __info.replace->vkQueueWaitIdle;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkQueueWaitIdle", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkQueueWaitIdle", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(queue);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkQueueWaitIdle", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkQueueWaitIdle", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkDeviceWaitIdle(VkDevice device) {
-	auto __fn = tl_deviceHookTable.table->vkDeviceWaitIdle;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDeviceWaitIdle) {
-		__fn = tl_deviceHookTable.replace->vkDeviceWaitIdle;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDeviceWaitIdle;
+	if (__info.replace && __info.replace->vkDeviceWaitIdle) {
+		__fn = __info.replace->vkDeviceWaitIdle;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDeviceWaitIdle", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDeviceWaitIdle", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDeviceWaitIdle", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDeviceWaitIdle", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
-	auto __fn = tl_deviceHookTable.table->vkAllocateMemory;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkAllocateMemory) {
-		__fn = tl_deviceHookTable.replace->vkAllocateMemory;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkAllocateMemory;
+	if (__info.replace && __info.replace->vkAllocateMemory) {
+		__fn = __info.replace->vkAllocateMemory;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkAllocateMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkAllocateMemory", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pAllocateInfo, pAllocator, pMemory);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkAllocateMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkAllocateMemory", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkFreeMemory;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkFreeMemory) {
-		__fn = tl_deviceHookTable.replace->vkFreeMemory;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkFreeMemory;
+	if (__info.replace && __info.replace->vkFreeMemory) {
+		__fn = __info.replace->vkFreeMemory;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkFreeMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkFreeMemory", (PFN_vkVoidFunction)__fn); }
 	__fn(device, memory, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkFreeMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkFreeMemory", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) {
-	auto __fn = tl_deviceHookTable.table->vkMapMemory;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkMapMemory) {
-		__fn = tl_deviceHookTable.replace->vkMapMemory;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkMapMemory;
+	if (__info.replace && __info.replace->vkMapMemory) {
+		__fn = __info.replace->vkMapMemory;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkMapMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkMapMemory", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, memory, offset, size, flags, ppData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkMapMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkMapMemory", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkUnmapMemory(VkDevice device, VkDeviceMemory memory) {
-	auto __fn = tl_deviceHookTable.table->vkUnmapMemory;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkUnmapMemory) {
-		__fn = tl_deviceHookTable.replace->vkUnmapMemory;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkUnmapMemory;
+	if (__info.replace && __info.replace->vkUnmapMemory) {
+		__fn = __info.replace->vkUnmapMemory;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkUnmapMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkUnmapMemory", (PFN_vkVoidFunction)__fn); }
 	__fn(device, memory);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkUnmapMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkUnmapMemory", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
-	auto __fn = tl_deviceHookTable.table->vkFlushMappedMemoryRanges;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkFlushMappedMemoryRanges) {
-		__fn = tl_deviceHookTable.replace->vkFlushMappedMemoryRanges;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkFlushMappedMemoryRanges;
+	if (__info.replace && __info.replace->vkFlushMappedMemoryRanges) {
+		__fn = __info.replace->vkFlushMappedMemoryRanges;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkFlushMappedMemoryRanges", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkFlushMappedMemoryRanges", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, memoryRangeCount, pMemoryRanges);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkFlushMappedMemoryRanges", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkFlushMappedMemoryRanges", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
-	auto __fn = tl_deviceHookTable.table->vkInvalidateMappedMemoryRanges;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkInvalidateMappedMemoryRanges) {
-		__fn = tl_deviceHookTable.replace->vkInvalidateMappedMemoryRanges;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkInvalidateMappedMemoryRanges;
+	if (__info.replace && __info.replace->vkInvalidateMappedMemoryRanges) {
+		__fn = __info.replace->vkInvalidateMappedMemoryRanges;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, memoryRangeCount, pMemoryRanges);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceMemoryCommitment;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceMemoryCommitment) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceMemoryCommitment;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceMemoryCommitment;
+	if (__info.replace && __info.replace->vkGetDeviceMemoryCommitment) {
+		__fn = __info.replace->vkGetDeviceMemoryCommitment;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction)__fn); }
 	__fn(device, memory, pCommittedMemoryInBytes);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
-	auto __fn = tl_deviceHookTable.table->vkBindBufferMemory;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBindBufferMemory) {
-		__fn = tl_deviceHookTable.replace->vkBindBufferMemory;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkBindBufferMemory;
+	if (__info.replace && __info.replace->vkBindBufferMemory) {
+		__fn = __info.replace->vkBindBufferMemory;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBindBufferMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBindBufferMemory", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, buffer, memory, memoryOffset);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBindBufferMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBindBufferMemory", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
-	auto __fn = tl_deviceHookTable.table->vkBindImageMemory;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBindImageMemory) {
-		__fn = tl_deviceHookTable.replace->vkBindImageMemory;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkBindImageMemory;
+	if (__info.replace && __info.replace->vkBindImageMemory) {
+		__fn = __info.replace->vkBindImageMemory;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBindImageMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBindImageMemory", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, image, memory, memoryOffset);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBindImageMemory", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBindImageMemory", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetBufferMemoryRequirements;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetBufferMemoryRequirements) {
-		__fn = tl_deviceHookTable.replace->vkGetBufferMemoryRequirements;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetBufferMemoryRequirements;
+	if (__info.replace && __info.replace->vkGetBufferMemoryRequirements) {
+		__fn = __info.replace->vkGetBufferMemoryRequirements;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetBufferMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetBufferMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 	__fn(device, buffer, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetBufferMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetBufferMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageMemoryRequirements;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageMemoryRequirements) {
-		__fn = tl_deviceHookTable.replace->vkGetImageMemoryRequirements;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageMemoryRequirements;
+	if (__info.replace && __info.replace->vkGetImageMemoryRequirements) {
+		__fn = __info.replace->vkGetImageMemoryRequirements;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 	__fn(device, image, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageSparseMemoryRequirements;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageSparseMemoryRequirements) {
-		__fn = tl_deviceHookTable.replace->vkGetImageSparseMemoryRequirements;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageSparseMemoryRequirements;
+	if (__info.replace && __info.replace->vkGetImageSparseMemoryRequirements) {
+		__fn = __info.replace->vkGetImageSparseMemoryRequirements;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 	__fn(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) {
-	auto __fn = tl_deviceHookTable.table->vkQueueBindSparse;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkQueueBindSparse) {
-		__fn = tl_deviceHookTable.replace->vkQueueBindSparse;
+	auto __info = DeviceTable_getHookInfo(queue);
+	auto __fn = __info.table->vkQueueBindSparse;
+	if (__info.replace && __info.replace->vkQueueBindSparse) {
+		__fn = __info.replace->vkQueueBindSparse;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkQueueBindSparse", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkQueueBindSparse", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(queue, bindInfoCount, pBindInfo, fence);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkQueueBindSparse", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkQueueBindSparse", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
-	auto __fn = tl_deviceHookTable.table->vkCreateFence;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateFence) {
-		__fn = tl_deviceHookTable.replace->vkCreateFence;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateFence;
+	if (__info.replace && __info.replace->vkCreateFence) {
+		__fn = __info.replace->vkCreateFence;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateFence", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateFence", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pFence);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateFence", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateFence", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyFence;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyFence) {
-		__fn = tl_deviceHookTable.replace->vkDestroyFence;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyFence;
+	if (__info.replace && __info.replace->vkDestroyFence) {
+		__fn = __info.replace->vkDestroyFence;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyFence", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyFence", (PFN_vkVoidFunction)__fn); }
 	__fn(device, fence, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyFence", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyFence", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences) {
-	auto __fn = tl_deviceHookTable.table->vkResetFences;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkResetFences) {
-		__fn = tl_deviceHookTable.replace->vkResetFences;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkResetFences;
+	if (__info.replace && __info.replace->vkResetFences) {
+		__fn = __info.replace->vkResetFences;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkResetFences", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkResetFences", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, fenceCount, pFences);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkResetFences", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkResetFences", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetFenceStatus(VkDevice device, VkFence fence) {
-	auto __fn = tl_deviceHookTable.table->vkGetFenceStatus;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetFenceStatus) {
-		__fn = tl_deviceHookTable.replace->vkGetFenceStatus;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetFenceStatus;
+	if (__info.replace && __info.replace->vkGetFenceStatus) {
+		__fn = __info.replace->vkGetFenceStatus;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetFenceStatus", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetFenceStatus", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, fence);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetFenceStatus", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetFenceStatus", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) {
-	auto __fn = tl_deviceHookTable.table->vkWaitForFences;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkWaitForFences) {
-		__fn = tl_deviceHookTable.replace->vkWaitForFences;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkWaitForFences;
+	if (__info.replace && __info.replace->vkWaitForFences) {
+		__fn = __info.replace->vkWaitForFences;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkWaitForFences", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkWaitForFences", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, fenceCount, pFences, waitAll, timeout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkWaitForFences", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkWaitForFences", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
-	auto __fn = tl_deviceHookTable.table->vkCreateSemaphore;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateSemaphore) {
-		__fn = tl_deviceHookTable.replace->vkCreateSemaphore;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateSemaphore;
+	if (__info.replace && __info.replace->vkCreateSemaphore) {
+		__fn = __info.replace->vkCreateSemaphore;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateSemaphore", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateSemaphore", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pSemaphore);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateSemaphore", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateSemaphore", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroySemaphore;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroySemaphore) {
-		__fn = tl_deviceHookTable.replace->vkDestroySemaphore;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroySemaphore;
+	if (__info.replace && __info.replace->vkDestroySemaphore) {
+		__fn = __info.replace->vkDestroySemaphore;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroySemaphore", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroySemaphore", (PFN_vkVoidFunction)__fn); }
 	__fn(device, semaphore, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroySemaphore", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroySemaphore", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
-	auto __fn = tl_deviceHookTable.table->vkCreateEvent;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateEvent) {
-		__fn = tl_deviceHookTable.replace->vkCreateEvent;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateEvent;
+	if (__info.replace && __info.replace->vkCreateEvent) {
+		__fn = __info.replace->vkCreateEvent;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateEvent", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pEvent);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateEvent", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyEvent;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyEvent) {
-		__fn = tl_deviceHookTable.replace->vkDestroyEvent;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyEvent;
+	if (__info.replace && __info.replace->vkDestroyEvent) {
+		__fn = __info.replace->vkDestroyEvent;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyEvent", (PFN_vkVoidFunction)__fn); }
 	__fn(device, event, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyEvent", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetEventStatus(VkDevice device, VkEvent event) {
-	auto __fn = tl_deviceHookTable.table->vkGetEventStatus;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetEventStatus) {
-		__fn = tl_deviceHookTable.replace->vkGetEventStatus;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetEventStatus;
+	if (__info.replace && __info.replace->vkGetEventStatus) {
+		__fn = __info.replace->vkGetEventStatus;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetEventStatus", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetEventStatus", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, event);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetEventStatus", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetEventStatus", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkSetEvent(VkDevice device, VkEvent event) {
-	auto __fn = tl_deviceHookTable.table->vkSetEvent;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSetEvent) {
-		__fn = tl_deviceHookTable.replace->vkSetEvent;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSetEvent;
+	if (__info.replace && __info.replace->vkSetEvent) {
+		__fn = __info.replace->vkSetEvent;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSetEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSetEvent", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, event);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSetEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSetEvent", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkResetEvent(VkDevice device, VkEvent event) {
-	auto __fn = tl_deviceHookTable.table->vkResetEvent;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkResetEvent) {
-		__fn = tl_deviceHookTable.replace->vkResetEvent;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkResetEvent;
+	if (__info.replace && __info.replace->vkResetEvent) {
+		__fn = __info.replace->vkResetEvent;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkResetEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkResetEvent", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, event);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkResetEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkResetEvent", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
-	auto __fn = tl_deviceHookTable.table->vkCreateQueryPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateQueryPool) {
-		__fn = tl_deviceHookTable.replace->vkCreateQueryPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateQueryPool;
+	if (__info.replace && __info.replace->vkCreateQueryPool) {
+		__fn = __info.replace->vkCreateQueryPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateQueryPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateQueryPool", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pQueryPool);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateQueryPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateQueryPool", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyQueryPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyQueryPool) {
-		__fn = tl_deviceHookTable.replace->vkDestroyQueryPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyQueryPool;
+	if (__info.replace && __info.replace->vkDestroyQueryPool) {
+		__fn = __info.replace->vkDestroyQueryPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyQueryPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyQueryPool", (PFN_vkVoidFunction)__fn); }
 	__fn(device, queryPool, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyQueryPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyQueryPool", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) {
-	auto __fn = tl_deviceHookTable.table->vkGetQueryPoolResults;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetQueryPoolResults) {
-		__fn = tl_deviceHookTable.replace->vkGetQueryPoolResults;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetQueryPoolResults;
+	if (__info.replace && __info.replace->vkGetQueryPoolResults) {
+		__fn = __info.replace->vkGetQueryPoolResults;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetQueryPoolResults", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetQueryPoolResults", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetQueryPoolResults", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetQueryPoolResults", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
-	auto __fn = tl_deviceHookTable.table->vkCreateBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateBuffer) {
-		__fn = tl_deviceHookTable.replace->vkCreateBuffer;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateBuffer;
+	if (__info.replace && __info.replace->vkCreateBuffer) {
+		__fn = __info.replace->vkCreateBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateBuffer", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pBuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateBuffer", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyBuffer) {
-		__fn = tl_deviceHookTable.replace->vkDestroyBuffer;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyBuffer;
+	if (__info.replace && __info.replace->vkDestroyBuffer) {
+		__fn = __info.replace->vkDestroyBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyBuffer", (PFN_vkVoidFunction)__fn); }
 	__fn(device, buffer, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyBuffer", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
-	auto __fn = tl_deviceHookTable.table->vkCreateBufferView;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateBufferView) {
-		__fn = tl_deviceHookTable.replace->vkCreateBufferView;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateBufferView;
+	if (__info.replace && __info.replace->vkCreateBufferView) {
+		__fn = __info.replace->vkCreateBufferView;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateBufferView", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateBufferView", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pView);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateBufferView", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateBufferView", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyBufferView;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyBufferView) {
-		__fn = tl_deviceHookTable.replace->vkDestroyBufferView;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyBufferView;
+	if (__info.replace && __info.replace->vkDestroyBufferView) {
+		__fn = __info.replace->vkDestroyBufferView;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyBufferView", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyBufferView", (PFN_vkVoidFunction)__fn); }
 	__fn(device, bufferView, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyBufferView", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyBufferView", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
-	auto __fn = tl_deviceHookTable.table->vkCreateImage;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateImage) {
-		__fn = tl_deviceHookTable.replace->vkCreateImage;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateImage;
+	if (__info.replace && __info.replace->vkCreateImage) {
+		__fn = __info.replace->vkCreateImage;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateImage", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pImage);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateImage", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyImage;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyImage) {
-		__fn = tl_deviceHookTable.replace->vkDestroyImage;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyImage;
+	if (__info.replace && __info.replace->vkDestroyImage) {
+		__fn = __info.replace->vkDestroyImage;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyImage", (PFN_vkVoidFunction)__fn); }
 	__fn(device, image, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyImage", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageSubresourceLayout;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageSubresourceLayout) {
-		__fn = tl_deviceHookTable.replace->vkGetImageSubresourceLayout;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageSubresourceLayout;
+	if (__info.replace && __info.replace->vkGetImageSubresourceLayout) {
+		__fn = __info.replace->vkGetImageSubresourceLayout;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageSubresourceLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageSubresourceLayout", (PFN_vkVoidFunction)__fn); }
 	__fn(device, image, pSubresource, pLayout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageSubresourceLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageSubresourceLayout", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) {
-	auto __fn = tl_deviceHookTable.table->vkCreateImageView;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateImageView) {
-		__fn = tl_deviceHookTable.replace->vkCreateImageView;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateImageView;
+	if (__info.replace && __info.replace->vkCreateImageView) {
+		__fn = __info.replace->vkCreateImageView;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateImageView", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateImageView", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pView);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateImageView", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateImageView", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyImageView;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyImageView) {
-		__fn = tl_deviceHookTable.replace->vkDestroyImageView;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyImageView;
+	if (__info.replace && __info.replace->vkDestroyImageView) {
+		__fn = __info.replace->vkDestroyImageView;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyImageView", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyImageView", (PFN_vkVoidFunction)__fn); }
 	__fn(device, imageView, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyImageView", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyImageView", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) {
-	auto __fn = tl_deviceHookTable.table->vkCreateShaderModule;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateShaderModule) {
-		__fn = tl_deviceHookTable.replace->vkCreateShaderModule;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateShaderModule;
+	if (__info.replace && __info.replace->vkCreateShaderModule) {
+		__fn = __info.replace->vkCreateShaderModule;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateShaderModule", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateShaderModule", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pShaderModule);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateShaderModule", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateShaderModule", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyShaderModule;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyShaderModule) {
-		__fn = tl_deviceHookTable.replace->vkDestroyShaderModule;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyShaderModule;
+	if (__info.replace && __info.replace->vkDestroyShaderModule) {
+		__fn = __info.replace->vkDestroyShaderModule;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyShaderModule", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyShaderModule", (PFN_vkVoidFunction)__fn); }
 	__fn(device, shaderModule, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyShaderModule", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyShaderModule", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) {
-	auto __fn = tl_deviceHookTable.table->vkCreatePipelineCache;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreatePipelineCache) {
-		__fn = tl_deviceHookTable.replace->vkCreatePipelineCache;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreatePipelineCache;
+	if (__info.replace && __info.replace->vkCreatePipelineCache) {
+		__fn = __info.replace->vkCreatePipelineCache;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreatePipelineCache", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreatePipelineCache", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pPipelineCache);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreatePipelineCache", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreatePipelineCache", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyPipelineCache;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyPipelineCache) {
-		__fn = tl_deviceHookTable.replace->vkDestroyPipelineCache;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyPipelineCache;
+	if (__info.replace && __info.replace->vkDestroyPipelineCache) {
+		__fn = __info.replace->vkDestroyPipelineCache;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyPipelineCache", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyPipelineCache", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pipelineCache, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyPipelineCache", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyPipelineCache", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkGetPipelineCacheData;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetPipelineCacheData) {
-		__fn = tl_deviceHookTable.replace->vkGetPipelineCacheData;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetPipelineCacheData;
+	if (__info.replace && __info.replace->vkGetPipelineCacheData) {
+		__fn = __info.replace->vkGetPipelineCacheData;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetPipelineCacheData", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetPipelineCacheData", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipelineCache, pDataSize, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetPipelineCacheData", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetPipelineCacheData", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) {
-	auto __fn = tl_deviceHookTable.table->vkMergePipelineCaches;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkMergePipelineCaches) {
-		__fn = tl_deviceHookTable.replace->vkMergePipelineCaches;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkMergePipelineCaches;
+	if (__info.replace && __info.replace->vkMergePipelineCaches) {
+		__fn = __info.replace->vkMergePipelineCaches;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkMergePipelineCaches", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkMergePipelineCaches", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, dstCache, srcCacheCount, pSrcCaches);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkMergePipelineCaches", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkMergePipelineCaches", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-	auto __fn = tl_deviceHookTable.table->vkCreateGraphicsPipelines;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateGraphicsPipelines) {
-		__fn = tl_deviceHookTable.replace->vkCreateGraphicsPipelines;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateGraphicsPipelines;
+	if (__info.replace && __info.replace->vkCreateGraphicsPipelines) {
+		__fn = __info.replace->vkCreateGraphicsPipelines;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateGraphicsPipelines", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateGraphicsPipelines", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateGraphicsPipelines", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateGraphicsPipelines", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-	auto __fn = tl_deviceHookTable.table->vkCreateComputePipelines;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateComputePipelines) {
-		__fn = tl_deviceHookTable.replace->vkCreateComputePipelines;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateComputePipelines;
+	if (__info.replace && __info.replace->vkCreateComputePipelines) {
+		__fn = __info.replace->vkCreateComputePipelines;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateComputePipelines", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateComputePipelines", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateComputePipelines", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateComputePipelines", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyPipeline;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyPipeline) {
-		__fn = tl_deviceHookTable.replace->vkDestroyPipeline;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyPipeline;
+	if (__info.replace && __info.replace->vkDestroyPipeline) {
+		__fn = __info.replace->vkDestroyPipeline;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyPipeline", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyPipeline", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pipeline, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyPipeline", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyPipeline", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) {
-	auto __fn = tl_deviceHookTable.table->vkCreatePipelineLayout;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreatePipelineLayout) {
-		__fn = tl_deviceHookTable.replace->vkCreatePipelineLayout;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreatePipelineLayout;
+	if (__info.replace && __info.replace->vkCreatePipelineLayout) {
+		__fn = __info.replace->vkCreatePipelineLayout;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreatePipelineLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreatePipelineLayout", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pPipelineLayout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreatePipelineLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreatePipelineLayout", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyPipelineLayout;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyPipelineLayout) {
-		__fn = tl_deviceHookTable.replace->vkDestroyPipelineLayout;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyPipelineLayout;
+	if (__info.replace && __info.replace->vkDestroyPipelineLayout) {
+		__fn = __info.replace->vkDestroyPipelineLayout;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyPipelineLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyPipelineLayout", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pipelineLayout, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyPipelineLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyPipelineLayout", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
-	auto __fn = tl_deviceHookTable.table->vkCreateSampler;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateSampler) {
-		__fn = tl_deviceHookTable.replace->vkCreateSampler;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateSampler;
+	if (__info.replace && __info.replace->vkCreateSampler) {
+		__fn = __info.replace->vkCreateSampler;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateSampler", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateSampler", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pSampler);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateSampler", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateSampler", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroySampler;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroySampler) {
-		__fn = tl_deviceHookTable.replace->vkDestroySampler;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroySampler;
+	if (__info.replace && __info.replace->vkDestroySampler) {
+		__fn = __info.replace->vkDestroySampler;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroySampler", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroySampler", (PFN_vkVoidFunction)__fn); }
 	__fn(device, sampler, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroySampler", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroySampler", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) {
-	auto __fn = tl_deviceHookTable.table->vkCreateDescriptorSetLayout;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateDescriptorSetLayout) {
-		__fn = tl_deviceHookTable.replace->vkCreateDescriptorSetLayout;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateDescriptorSetLayout;
+	if (__info.replace && __info.replace->vkCreateDescriptorSetLayout) {
+		__fn = __info.replace->vkCreateDescriptorSetLayout;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateDescriptorSetLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateDescriptorSetLayout", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pSetLayout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateDescriptorSetLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateDescriptorSetLayout", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyDescriptorSetLayout;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyDescriptorSetLayout) {
-		__fn = tl_deviceHookTable.replace->vkDestroyDescriptorSetLayout;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyDescriptorSetLayout;
+	if (__info.replace && __info.replace->vkDestroyDescriptorSetLayout) {
+		__fn = __info.replace->vkDestroyDescriptorSetLayout;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction)__fn); }
 	__fn(device, descriptorSetLayout, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) {
-	auto __fn = tl_deviceHookTable.table->vkCreateDescriptorPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateDescriptorPool) {
-		__fn = tl_deviceHookTable.replace->vkCreateDescriptorPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateDescriptorPool;
+	if (__info.replace && __info.replace->vkCreateDescriptorPool) {
+		__fn = __info.replace->vkCreateDescriptorPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateDescriptorPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateDescriptorPool", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pDescriptorPool);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateDescriptorPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateDescriptorPool", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyDescriptorPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyDescriptorPool) {
-		__fn = tl_deviceHookTable.replace->vkDestroyDescriptorPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyDescriptorPool;
+	if (__info.replace && __info.replace->vkDestroyDescriptorPool) {
+		__fn = __info.replace->vkDestroyDescriptorPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyDescriptorPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyDescriptorPool", (PFN_vkVoidFunction)__fn); }
 	__fn(device, descriptorPool, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyDescriptorPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyDescriptorPool", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) {
-	auto __fn = tl_deviceHookTable.table->vkResetDescriptorPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkResetDescriptorPool) {
-		__fn = tl_deviceHookTable.replace->vkResetDescriptorPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkResetDescriptorPool;
+	if (__info.replace && __info.replace->vkResetDescriptorPool) {
+		__fn = __info.replace->vkResetDescriptorPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkResetDescriptorPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkResetDescriptorPool", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, descriptorPool, flags);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkResetDescriptorPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkResetDescriptorPool", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) {
-	auto __fn = tl_deviceHookTable.table->vkAllocateDescriptorSets;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkAllocateDescriptorSets) {
-		__fn = tl_deviceHookTable.replace->vkAllocateDescriptorSets;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkAllocateDescriptorSets;
+	if (__info.replace && __info.replace->vkAllocateDescriptorSets) {
+		__fn = __info.replace->vkAllocateDescriptorSets;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkAllocateDescriptorSets", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkAllocateDescriptorSets", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pAllocateInfo, pDescriptorSets);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkAllocateDescriptorSets", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkAllocateDescriptorSets", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) {
-	auto __fn = tl_deviceHookTable.table->vkFreeDescriptorSets;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkFreeDescriptorSets) {
-		__fn = tl_deviceHookTable.replace->vkFreeDescriptorSets;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkFreeDescriptorSets;
+	if (__info.replace && __info.replace->vkFreeDescriptorSets) {
+		__fn = __info.replace->vkFreeDescriptorSets;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkFreeDescriptorSets", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkFreeDescriptorSets", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, descriptorPool, descriptorSetCount, pDescriptorSets);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkFreeDescriptorSets", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkFreeDescriptorSets", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) {
-	auto __fn = tl_deviceHookTable.table->vkUpdateDescriptorSets;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkUpdateDescriptorSets) {
-		__fn = tl_deviceHookTable.replace->vkUpdateDescriptorSets;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkUpdateDescriptorSets;
+	if (__info.replace && __info.replace->vkUpdateDescriptorSets) {
+		__fn = __info.replace->vkUpdateDescriptorSets;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkUpdateDescriptorSets", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkUpdateDescriptorSets", (PFN_vkVoidFunction)__fn); }
 	__fn(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkUpdateDescriptorSets", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkUpdateDescriptorSets", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
-	auto __fn = tl_deviceHookTable.table->vkCreateFramebuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateFramebuffer) {
-		__fn = tl_deviceHookTable.replace->vkCreateFramebuffer;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateFramebuffer;
+	if (__info.replace && __info.replace->vkCreateFramebuffer) {
+		__fn = __info.replace->vkCreateFramebuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateFramebuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateFramebuffer", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pFramebuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateFramebuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateFramebuffer", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyFramebuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyFramebuffer) {
-		__fn = tl_deviceHookTable.replace->vkDestroyFramebuffer;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyFramebuffer;
+	if (__info.replace && __info.replace->vkDestroyFramebuffer) {
+		__fn = __info.replace->vkDestroyFramebuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyFramebuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyFramebuffer", (PFN_vkVoidFunction)__fn); }
 	__fn(device, framebuffer, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyFramebuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyFramebuffer", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
-	auto __fn = tl_deviceHookTable.table->vkCreateRenderPass;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateRenderPass) {
-		__fn = tl_deviceHookTable.replace->vkCreateRenderPass;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateRenderPass;
+	if (__info.replace && __info.replace->vkCreateRenderPass) {
+		__fn = __info.replace->vkCreateRenderPass;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateRenderPass", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateRenderPass", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pRenderPass);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateRenderPass", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateRenderPass", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyRenderPass;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyRenderPass) {
-		__fn = tl_deviceHookTable.replace->vkDestroyRenderPass;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyRenderPass;
+	if (__info.replace && __info.replace->vkDestroyRenderPass) {
+		__fn = __info.replace->vkDestroyRenderPass;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyRenderPass", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyRenderPass", (PFN_vkVoidFunction)__fn); }
 	__fn(device, renderPass, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyRenderPass", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyRenderPass", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {
-	auto __fn = tl_deviceHookTable.table->vkGetRenderAreaGranularity;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetRenderAreaGranularity) {
-		__fn = tl_deviceHookTable.replace->vkGetRenderAreaGranularity;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetRenderAreaGranularity;
+	if (__info.replace && __info.replace->vkGetRenderAreaGranularity) {
+		__fn = __info.replace->vkGetRenderAreaGranularity;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetRenderAreaGranularity", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetRenderAreaGranularity", (PFN_vkVoidFunction)__fn); }
 	__fn(device, renderPass, pGranularity);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetRenderAreaGranularity", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetRenderAreaGranularity", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
-	auto __fn = tl_deviceHookTable.table->vkCreateCommandPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateCommandPool) {
-		__fn = tl_deviceHookTable.replace->vkCreateCommandPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateCommandPool;
+	if (__info.replace && __info.replace->vkCreateCommandPool) {
+		__fn = __info.replace->vkCreateCommandPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateCommandPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateCommandPool", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pCommandPool);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateCommandPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateCommandPool", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyCommandPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyCommandPool) {
-		__fn = tl_deviceHookTable.replace->vkDestroyCommandPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyCommandPool;
+	if (__info.replace && __info.replace->vkDestroyCommandPool) {
+		__fn = __info.replace->vkDestroyCommandPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyCommandPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyCommandPool", (PFN_vkVoidFunction)__fn); }
 	__fn(device, commandPool, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyCommandPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyCommandPool", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
-	auto __fn = tl_deviceHookTable.table->vkResetCommandPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkResetCommandPool) {
-		__fn = tl_deviceHookTable.replace->vkResetCommandPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkResetCommandPool;
+	if (__info.replace && __info.replace->vkResetCommandPool) {
+		__fn = __info.replace->vkResetCommandPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkResetCommandPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkResetCommandPool", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, commandPool, flags);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkResetCommandPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkResetCommandPool", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) {
-	auto __fn = tl_deviceHookTable.table->vkAllocateCommandBuffers;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkAllocateCommandBuffers) {
-		__fn = tl_deviceHookTable.replace->vkAllocateCommandBuffers;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkAllocateCommandBuffers;
+	if (__info.replace && __info.replace->vkAllocateCommandBuffers) {
+		__fn = __info.replace->vkAllocateCommandBuffers;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkAllocateCommandBuffers", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkAllocateCommandBuffers", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pAllocateInfo, pCommandBuffers);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkAllocateCommandBuffers", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkAllocateCommandBuffers", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
-	auto __fn = tl_deviceHookTable.table->vkFreeCommandBuffers;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkFreeCommandBuffers) {
-		__fn = tl_deviceHookTable.replace->vkFreeCommandBuffers;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkFreeCommandBuffers;
+	if (__info.replace && __info.replace->vkFreeCommandBuffers) {
+		__fn = __info.replace->vkFreeCommandBuffers;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkFreeCommandBuffers", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkFreeCommandBuffers", (PFN_vkVoidFunction)__fn); }
 	__fn(device, commandPool, commandBufferCount, pCommandBuffers);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkFreeCommandBuffers", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkFreeCommandBuffers", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) {
-	auto __fn = tl_deviceHookTable.table->vkBeginCommandBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBeginCommandBuffer) {
-		__fn = tl_deviceHookTable.replace->vkBeginCommandBuffer;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkBeginCommandBuffer;
+	if (__info.replace && __info.replace->vkBeginCommandBuffer) {
+		__fn = __info.replace->vkBeginCommandBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBeginCommandBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBeginCommandBuffer", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(commandBuffer, pBeginInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBeginCommandBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBeginCommandBuffer", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkEndCommandBuffer(VkCommandBuffer commandBuffer) {
-	auto __fn = tl_deviceHookTable.table->vkEndCommandBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkEndCommandBuffer) {
-		__fn = tl_deviceHookTable.replace->vkEndCommandBuffer;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkEndCommandBuffer;
+	if (__info.replace && __info.replace->vkEndCommandBuffer) {
+		__fn = __info.replace->vkEndCommandBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkEndCommandBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkEndCommandBuffer", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(commandBuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkEndCommandBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkEndCommandBuffer", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
-	auto __fn = tl_deviceHookTable.table->vkResetCommandBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkResetCommandBuffer) {
-		__fn = tl_deviceHookTable.replace->vkResetCommandBuffer;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkResetCommandBuffer;
+	if (__info.replace && __info.replace->vkResetCommandBuffer) {
+		__fn = __info.replace->vkResetCommandBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkResetCommandBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkResetCommandBuffer", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(commandBuffer, flags);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkResetCommandBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkResetCommandBuffer", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindPipeline;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindPipeline) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindPipeline;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindPipeline;
+	if (__info.replace && __info.replace->vkCmdBindPipeline) {
+		__fn = __info.replace->vkCmdBindPipeline;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindPipeline", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindPipeline", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pipelineBindPoint, pipeline);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindPipeline", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindPipeline", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetViewport;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetViewport) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetViewport;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetViewport;
+	if (__info.replace && __info.replace->vkCmdSetViewport) {
+		__fn = __info.replace->vkCmdSetViewport;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetViewport", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetViewport", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstViewport, viewportCount, pViewports);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetViewport", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetViewport", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetScissor;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetScissor) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetScissor;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetScissor;
+	if (__info.replace && __info.replace->vkCmdSetScissor) {
+		__fn = __info.replace->vkCmdSetScissor;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetScissor", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetScissor", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstScissor, scissorCount, pScissors);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetScissor", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetScissor", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetLineWidth;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetLineWidth) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetLineWidth;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetLineWidth;
+	if (__info.replace && __info.replace->vkCmdSetLineWidth) {
+		__fn = __info.replace->vkCmdSetLineWidth;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetLineWidth", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetLineWidth", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, lineWidth);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetLineWidth", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetLineWidth", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthBias;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthBias) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthBias;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthBias;
+	if (__info.replace && __info.replace->vkCmdSetDepthBias) {
+		__fn = __info.replace->vkCmdSetDepthBias;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBias", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthBias", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBias", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthBias", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetBlendConstants;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetBlendConstants) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetBlendConstants;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetBlendConstants;
+	if (__info.replace && __info.replace->vkCmdSetBlendConstants) {
+		__fn = __info.replace->vkCmdSetBlendConstants;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetBlendConstants", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetBlendConstants", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, blendConstants);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetBlendConstants", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetBlendConstants", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthBounds;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthBounds) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthBounds;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthBounds;
+	if (__info.replace && __info.replace->vkCmdSetDepthBounds) {
+		__fn = __info.replace->vkCmdSetDepthBounds;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBounds", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthBounds", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, minDepthBounds, maxDepthBounds);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBounds", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthBounds", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetStencilCompareMask;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetStencilCompareMask) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetStencilCompareMask;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetStencilCompareMask;
+	if (__info.replace && __info.replace->vkCmdSetStencilCompareMask) {
+		__fn = __info.replace->vkCmdSetStencilCompareMask;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetStencilCompareMask", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetStencilCompareMask", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, faceMask, compareMask);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetStencilCompareMask", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetStencilCompareMask", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetStencilWriteMask;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetStencilWriteMask) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetStencilWriteMask;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetStencilWriteMask;
+	if (__info.replace && __info.replace->vkCmdSetStencilWriteMask) {
+		__fn = __info.replace->vkCmdSetStencilWriteMask;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetStencilWriteMask", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetStencilWriteMask", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, faceMask, writeMask);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetStencilWriteMask", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetStencilWriteMask", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetStencilReference;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetStencilReference) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetStencilReference;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetStencilReference;
+	if (__info.replace && __info.replace->vkCmdSetStencilReference) {
+		__fn = __info.replace->vkCmdSetStencilReference;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetStencilReference", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetStencilReference", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, faceMask, reference);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetStencilReference", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetStencilReference", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindDescriptorSets;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindDescriptorSets) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindDescriptorSets;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindDescriptorSets;
+	if (__info.replace && __info.replace->vkCmdBindDescriptorSets) {
+		__fn = __info.replace->vkCmdBindDescriptorSets;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindDescriptorSets", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindDescriptorSets", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindDescriptorSets", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindDescriptorSets", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindIndexBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindIndexBuffer) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindIndexBuffer;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindIndexBuffer;
+	if (__info.replace && __info.replace->vkCmdBindIndexBuffer) {
+		__fn = __info.replace->vkCmdBindIndexBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindIndexBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindIndexBuffer", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, indexType);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindIndexBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindIndexBuffer", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindVertexBuffers;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindVertexBuffers) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindVertexBuffers;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindVertexBuffers;
+	if (__info.replace && __info.replace->vkCmdBindVertexBuffers) {
+		__fn = __info.replace->vkCmdBindVertexBuffers;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindVertexBuffers", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindVertexBuffers", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindVertexBuffers", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindVertexBuffers", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDraw;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDraw) {
-		__fn = tl_deviceHookTable.replace->vkCmdDraw;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDraw;
+	if (__info.replace && __info.replace->vkCmdDraw) {
+		__fn = __info.replace->vkCmdDraw;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDraw", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDraw", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDraw", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDraw", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndexed;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndexed) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndexed;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndexed;
+	if (__info.replace && __info.replace->vkCmdDrawIndexed) {
+		__fn = __info.replace->vkCmdDrawIndexed;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexed", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndexed", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexed", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndexed", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndirect;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndirect) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndirect;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndirect;
+	if (__info.replace && __info.replace->vkCmdDrawIndirect) {
+		__fn = __info.replace->vkCmdDrawIndirect;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirect", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndirect", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, drawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirect", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndirect", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndexedIndirect;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndexedIndirect) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndexedIndirect;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndexedIndirect;
+	if (__info.replace && __info.replace->vkCmdDrawIndexedIndirect) {
+		__fn = __info.replace->vkCmdDrawIndexedIndirect;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, drawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDispatch;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDispatch) {
-		__fn = tl_deviceHookTable.replace->vkCmdDispatch;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDispatch;
+	if (__info.replace && __info.replace->vkCmdDispatch) {
+		__fn = __info.replace->vkCmdDispatch;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDispatch", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDispatch", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, groupCountX, groupCountY, groupCountZ);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDispatch", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDispatch", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDispatchIndirect;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDispatchIndirect) {
-		__fn = tl_deviceHookTable.replace->vkCmdDispatchIndirect;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDispatchIndirect;
+	if (__info.replace && __info.replace->vkCmdDispatchIndirect) {
+		__fn = __info.replace->vkCmdDispatchIndirect;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDispatchIndirect", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDispatchIndirect", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDispatchIndirect", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDispatchIndirect", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyBuffer) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyBuffer;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyBuffer;
+	if (__info.replace && __info.replace->vkCmdCopyBuffer) {
+		__fn = __info.replace->vkCmdCopyBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyBuffer", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyBuffer", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyImage;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyImage) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyImage;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyImage;
+	if (__info.replace && __info.replace->vkCmdCopyImage) {
+		__fn = __info.replace->vkCmdCopyImage;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyImage", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyImage", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBlitImage;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBlitImage) {
-		__fn = tl_deviceHookTable.replace->vkCmdBlitImage;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBlitImage;
+	if (__info.replace && __info.replace->vkCmdBlitImage) {
+		__fn = __info.replace->vkCmdBlitImage;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBlitImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBlitImage", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBlitImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBlitImage", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyBufferToImage;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyBufferToImage) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyBufferToImage;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyBufferToImage;
+	if (__info.replace && __info.replace->vkCmdCopyBufferToImage) {
+		__fn = __info.replace->vkCmdCopyBufferToImage;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyBufferToImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyBufferToImage", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyBufferToImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyBufferToImage", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyImageToBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyImageToBuffer) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyImageToBuffer;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyImageToBuffer;
+	if (__info.replace && __info.replace->vkCmdCopyImageToBuffer) {
+		__fn = __info.replace->vkCmdCopyImageToBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyImageToBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyImageToBuffer", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyImageToBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyImageToBuffer", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkCmdUpdateBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdUpdateBuffer) {
-		__fn = tl_deviceHookTable.replace->vkCmdUpdateBuffer;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdUpdateBuffer;
+	if (__info.replace && __info.replace->vkCmdUpdateBuffer) {
+		__fn = __info.replace->vkCmdUpdateBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdUpdateBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdUpdateBuffer", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdUpdateBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdUpdateBuffer", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
-	auto __fn = tl_deviceHookTable.table->vkCmdFillBuffer;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdFillBuffer) {
-		__fn = tl_deviceHookTable.replace->vkCmdFillBuffer;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdFillBuffer;
+	if (__info.replace && __info.replace->vkCmdFillBuffer) {
+		__fn = __info.replace->vkCmdFillBuffer;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdFillBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdFillBuffer", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, dstBuffer, dstOffset, size, data);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdFillBuffer", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdFillBuffer", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {
-	auto __fn = tl_deviceHookTable.table->vkCmdClearColorImage;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdClearColorImage) {
-		__fn = tl_deviceHookTable.replace->vkCmdClearColorImage;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdClearColorImage;
+	if (__info.replace && __info.replace->vkCmdClearColorImage) {
+		__fn = __info.replace->vkCmdClearColorImage;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdClearColorImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdClearColorImage", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdClearColorImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdClearColorImage", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {
-	auto __fn = tl_deviceHookTable.table->vkCmdClearDepthStencilImage;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdClearDepthStencilImage) {
-		__fn = tl_deviceHookTable.replace->vkCmdClearDepthStencilImage;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdClearDepthStencilImage;
+	if (__info.replace && __info.replace->vkCmdClearDepthStencilImage) {
+		__fn = __info.replace->vkCmdClearDepthStencilImage;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdClearDepthStencilImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdClearDepthStencilImage", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdClearDepthStencilImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdClearDepthStencilImage", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects) {
-	auto __fn = tl_deviceHookTable.table->vkCmdClearAttachments;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdClearAttachments) {
-		__fn = tl_deviceHookTable.replace->vkCmdClearAttachments;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdClearAttachments;
+	if (__info.replace && __info.replace->vkCmdClearAttachments) {
+		__fn = __info.replace->vkCmdClearAttachments;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdClearAttachments", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdClearAttachments", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdClearAttachments", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdClearAttachments", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions) {
-	auto __fn = tl_deviceHookTable.table->vkCmdResolveImage;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdResolveImage) {
-		__fn = tl_deviceHookTable.replace->vkCmdResolveImage;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdResolveImage;
+	if (__info.replace && __info.replace->vkCmdResolveImage) {
+		__fn = __info.replace->vkCmdResolveImage;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdResolveImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdResolveImage", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdResolveImage", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdResolveImage", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetEvent;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetEvent) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetEvent;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetEvent;
+	if (__info.replace && __info.replace->vkCmdSetEvent) {
+		__fn = __info.replace->vkCmdSetEvent;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetEvent", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, event, stageMask);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetEvent", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
-	auto __fn = tl_deviceHookTable.table->vkCmdResetEvent;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdResetEvent) {
-		__fn = tl_deviceHookTable.replace->vkCmdResetEvent;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdResetEvent;
+	if (__info.replace && __info.replace->vkCmdResetEvent) {
+		__fn = __info.replace->vkCmdResetEvent;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdResetEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdResetEvent", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, event, stageMask);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdResetEvent", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdResetEvent", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWaitEvents;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWaitEvents) {
-		__fn = tl_deviceHookTable.replace->vkCmdWaitEvents;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWaitEvents;
+	if (__info.replace && __info.replace->vkCmdWaitEvents) {
+		__fn = __info.replace->vkCmdWaitEvents;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWaitEvents", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWaitEvents", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWaitEvents", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWaitEvents", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
-	auto __fn = tl_deviceHookTable.table->vkCmdPipelineBarrier;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdPipelineBarrier) {
-		__fn = tl_deviceHookTable.replace->vkCmdPipelineBarrier;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdPipelineBarrier;
+	if (__info.replace && __info.replace->vkCmdPipelineBarrier) {
+		__fn = __info.replace->vkCmdPipelineBarrier;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdPipelineBarrier", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdPipelineBarrier", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdPipelineBarrier", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdPipelineBarrier", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginQuery;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginQuery) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginQuery;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginQuery;
+	if (__info.replace && __info.replace->vkCmdBeginQuery) {
+		__fn = __info.replace->vkCmdBeginQuery;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginQuery", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginQuery", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, queryPool, query, flags);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginQuery", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginQuery", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndQuery;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndQuery) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndQuery;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndQuery;
+	if (__info.replace && __info.replace->vkCmdEndQuery) {
+		__fn = __info.replace->vkCmdEndQuery;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndQuery", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndQuery", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, queryPool, query);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndQuery", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndQuery", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
-	auto __fn = tl_deviceHookTable.table->vkCmdResetQueryPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdResetQueryPool) {
-		__fn = tl_deviceHookTable.replace->vkCmdResetQueryPool;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdResetQueryPool;
+	if (__info.replace && __info.replace->vkCmdResetQueryPool) {
+		__fn = __info.replace->vkCmdResetQueryPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdResetQueryPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdResetQueryPool", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, queryPool, firstQuery, queryCount);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdResetQueryPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdResetQueryPool", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWriteTimestamp;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWriteTimestamp) {
-		__fn = tl_deviceHookTable.replace->vkCmdWriteTimestamp;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWriteTimestamp;
+	if (__info.replace && __info.replace->vkCmdWriteTimestamp) {
+		__fn = __info.replace->vkCmdWriteTimestamp;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWriteTimestamp", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWriteTimestamp", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pipelineStage, queryPool, query);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWriteTimestamp", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWriteTimestamp", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyQueryPoolResults;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyQueryPoolResults) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyQueryPoolResults;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyQueryPoolResults;
+	if (__info.replace && __info.replace->vkCmdCopyQueryPoolResults) {
+		__fn = __info.replace->vkCmdCopyQueryPoolResults;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) {
-	auto __fn = tl_deviceHookTable.table->vkCmdPushConstants;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdPushConstants) {
-		__fn = tl_deviceHookTable.replace->vkCmdPushConstants;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdPushConstants;
+	if (__info.replace && __info.replace->vkCmdPushConstants) {
+		__fn = __info.replace->vkCmdPushConstants;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdPushConstants", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdPushConstants", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, layout, stageFlags, offset, size, pValues);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdPushConstants", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdPushConstants", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginRenderPass;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginRenderPass) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginRenderPass;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginRenderPass;
+	if (__info.replace && __info.replace->vkCmdBeginRenderPass) {
+		__fn = __info.replace->vkCmdBeginRenderPass;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginRenderPass", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginRenderPass", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pRenderPassBegin, contents);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginRenderPass", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginRenderPass", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
-	auto __fn = tl_deviceHookTable.table->vkCmdNextSubpass;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdNextSubpass) {
-		__fn = tl_deviceHookTable.replace->vkCmdNextSubpass;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdNextSubpass;
+	if (__info.replace && __info.replace->vkCmdNextSubpass) {
+		__fn = __info.replace->vkCmdNextSubpass;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdNextSubpass", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdNextSubpass", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, contents);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdNextSubpass", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdNextSubpass", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndRenderPass(VkCommandBuffer commandBuffer) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndRenderPass;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndRenderPass) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndRenderPass;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndRenderPass;
+	if (__info.replace && __info.replace->vkCmdEndRenderPass) {
+		__fn = __info.replace->vkCmdEndRenderPass;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndRenderPass", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndRenderPass", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndRenderPass", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndRenderPass", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
-	auto __fn = tl_deviceHookTable.table->vkCmdExecuteCommands;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdExecuteCommands) {
-		__fn = tl_deviceHookTable.replace->vkCmdExecuteCommands;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdExecuteCommands;
+	if (__info.replace && __info.replace->vkCmdExecuteCommands) {
+		__fn = __info.replace->vkCmdExecuteCommands;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdExecuteCommands", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdExecuteCommands", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, commandBufferCount, pCommandBuffers);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdExecuteCommands", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdExecuteCommands", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_VERSION_1_0) */
@@ -3532,167 +3701,183 @@ static void xl_hook_tl_deviceHookTable_vkCmdExecuteCommands(VkCommandBuffer comm
 #if defined(VK_VERSION_1_1)
 
 static VkResult xl_hook_tl_deviceHookTable_vkBindBufferMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo* pBindInfos) {
-	auto __fn = tl_deviceHookTable.table->vkBindBufferMemory2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBindBufferMemory2) {
-		__fn = tl_deviceHookTable.replace->vkBindBufferMemory2;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkBindBufferMemory2;
+	if (__info.replace && __info.replace->vkBindBufferMemory2) {
+		__fn = __info.replace->vkBindBufferMemory2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBindBufferMemory2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBindBufferMemory2", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, bindInfoCount, pBindInfos);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBindBufferMemory2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBindBufferMemory2", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkBindImageMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo* pBindInfos) {
-	auto __fn = tl_deviceHookTable.table->vkBindImageMemory2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBindImageMemory2) {
-		__fn = tl_deviceHookTable.replace->vkBindImageMemory2;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkBindImageMemory2;
+	if (__info.replace && __info.replace->vkBindImageMemory2) {
+		__fn = __info.replace->vkBindImageMemory2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBindImageMemory2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBindImageMemory2", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, bindInfoCount, pBindInfos);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBindImageMemory2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBindImageMemory2", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceGroupPeerMemoryFeatures(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceGroupPeerMemoryFeatures;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceGroupPeerMemoryFeatures) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceGroupPeerMemoryFeatures;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceGroupPeerMemoryFeatures;
+	if (__info.replace && __info.replace->vkGetDeviceGroupPeerMemoryFeatures) {
+		__fn = __info.replace->vkGetDeviceGroupPeerMemoryFeatures;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupPeerMemoryFeatures", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceGroupPeerMemoryFeatures", (PFN_vkVoidFunction)__fn); }
 	__fn(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupPeerMemoryFeatures", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceGroupPeerMemoryFeatures", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDeviceMask;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDeviceMask) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDeviceMask;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDeviceMask;
+	if (__info.replace && __info.replace->vkCmdSetDeviceMask) {
+		__fn = __info.replace->vkCmdSetDeviceMask;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDeviceMask", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDeviceMask", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, deviceMask);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDeviceMask", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDeviceMask", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDispatchBase;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDispatchBase) {
-		__fn = tl_deviceHookTable.replace->vkCmdDispatchBase;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDispatchBase;
+	if (__info.replace && __info.replace->vkCmdDispatchBase) {
+		__fn = __info.replace->vkCmdDispatchBase;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDispatchBase", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDispatchBase", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDispatchBase", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDispatchBase", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageMemoryRequirements2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageMemoryRequirements2) {
-		__fn = tl_deviceHookTable.replace->vkGetImageMemoryRequirements2;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageMemoryRequirements2;
+	if (__info.replace && __info.replace->vkGetImageMemoryRequirements2) {
+		__fn = __info.replace->vkGetImageMemoryRequirements2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetBufferMemoryRequirements2(VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetBufferMemoryRequirements2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetBufferMemoryRequirements2) {
-		__fn = tl_deviceHookTable.replace->vkGetBufferMemoryRequirements2;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetBufferMemoryRequirements2;
+	if (__info.replace && __info.replace->vkGetBufferMemoryRequirements2) {
+		__fn = __info.replace->vkGetBufferMemoryRequirements2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetBufferMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetBufferMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetBufferMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetBufferMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetImageSparseMemoryRequirements2(VkDevice device, const VkImageSparseMemoryRequirementsInfo2* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageSparseMemoryRequirements2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageSparseMemoryRequirements2) {
-		__fn = tl_deviceHookTable.replace->vkGetImageSparseMemoryRequirements2;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageSparseMemoryRequirements2;
+	if (__info.replace && __info.replace->vkGetImageSparseMemoryRequirements2) {
+		__fn = __info.replace->vkGetImageSparseMemoryRequirements2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageSparseMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageSparseMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageSparseMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageSparseMemoryRequirements2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkTrimCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) {
-	auto __fn = tl_deviceHookTable.table->vkTrimCommandPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkTrimCommandPool) {
-		__fn = tl_deviceHookTable.replace->vkTrimCommandPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkTrimCommandPool;
+	if (__info.replace && __info.replace->vkTrimCommandPool) {
+		__fn = __info.replace->vkTrimCommandPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkTrimCommandPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkTrimCommandPool", (PFN_vkVoidFunction)__fn); }
 	__fn(device, commandPool, flags);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkTrimCommandPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkTrimCommandPool", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceQueue2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceQueue2) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceQueue2;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceQueue2;
+	if (__info.replace && __info.replace->vkGetDeviceQueue2) {
+		__fn = __info.replace->vkGetDeviceQueue2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceQueue2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceQueue2", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pQueueInfo, pQueue);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceQueue2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceQueue2", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateSamplerYcbcrConversion(VkDevice device, const VkSamplerYcbcrConversionCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion) {
-	auto __fn = tl_deviceHookTable.table->vkCreateSamplerYcbcrConversion;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateSamplerYcbcrConversion) {
-		__fn = tl_deviceHookTable.replace->vkCreateSamplerYcbcrConversion;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateSamplerYcbcrConversion;
+	if (__info.replace && __info.replace->vkCreateSamplerYcbcrConversion) {
+		__fn = __info.replace->vkCreateSamplerYcbcrConversion;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateSamplerYcbcrConversion", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateSamplerYcbcrConversion", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pYcbcrConversion);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateSamplerYcbcrConversion", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateSamplerYcbcrConversion", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroySamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroySamplerYcbcrConversion;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroySamplerYcbcrConversion) {
-		__fn = tl_deviceHookTable.replace->vkDestroySamplerYcbcrConversion;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroySamplerYcbcrConversion;
+	if (__info.replace && __info.replace->vkDestroySamplerYcbcrConversion) {
+		__fn = __info.replace->vkDestroySamplerYcbcrConversion;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroySamplerYcbcrConversion", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroySamplerYcbcrConversion", (PFN_vkVoidFunction)__fn); }
 	__fn(device, ycbcrConversion, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroySamplerYcbcrConversion", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroySamplerYcbcrConversion", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateDescriptorUpdateTemplate(VkDevice device, const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
-	auto __fn = tl_deviceHookTable.table->vkCreateDescriptorUpdateTemplate;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateDescriptorUpdateTemplate) {
-		__fn = tl_deviceHookTable.replace->vkCreateDescriptorUpdateTemplate;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateDescriptorUpdateTemplate;
+	if (__info.replace && __info.replace->vkCreateDescriptorUpdateTemplate) {
+		__fn = __info.replace->vkCreateDescriptorUpdateTemplate;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateDescriptorUpdateTemplate", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateDescriptorUpdateTemplate", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateDescriptorUpdateTemplate", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateDescriptorUpdateTemplate", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyDescriptorUpdateTemplate;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyDescriptorUpdateTemplate) {
-		__fn = tl_deviceHookTable.replace->vkDestroyDescriptorUpdateTemplate;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyDescriptorUpdateTemplate;
+	if (__info.replace && __info.replace->vkDestroyDescriptorUpdateTemplate) {
+		__fn = __info.replace->vkDestroyDescriptorUpdateTemplate;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyDescriptorUpdateTemplate", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyDescriptorUpdateTemplate", (PFN_vkVoidFunction)__fn); }
 	__fn(device, descriptorUpdateTemplate, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyDescriptorUpdateTemplate", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyDescriptorUpdateTemplate", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkUpdateDescriptorSetWithTemplate;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkUpdateDescriptorSetWithTemplate) {
-		__fn = tl_deviceHookTable.replace->vkUpdateDescriptorSetWithTemplate;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkUpdateDescriptorSetWithTemplate;
+	if (__info.replace && __info.replace->vkUpdateDescriptorSetWithTemplate) {
+		__fn = __info.replace->vkUpdateDescriptorSetWithTemplate;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkUpdateDescriptorSetWithTemplate", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkUpdateDescriptorSetWithTemplate", (PFN_vkVoidFunction)__fn); }
 	__fn(device, descriptorSet, descriptorUpdateTemplate, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkUpdateDescriptorSetWithTemplate", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkUpdateDescriptorSetWithTemplate", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDescriptorSetLayoutSupport(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport) {
-	auto __fn = tl_deviceHookTable.table->vkGetDescriptorSetLayoutSupport;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDescriptorSetLayoutSupport) {
-		__fn = tl_deviceHookTable.replace->vkGetDescriptorSetLayoutSupport;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDescriptorSetLayoutSupport;
+	if (__info.replace && __info.replace->vkGetDescriptorSetLayoutSupport) {
+		__fn = __info.replace->vkGetDescriptorSetLayoutSupport;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDescriptorSetLayoutSupport", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDescriptorSetLayoutSupport", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pCreateInfo, pSupport);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDescriptorSetLayoutSupport", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDescriptorSetLayoutSupport", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_VERSION_1_1) */
@@ -3700,139 +3885,152 @@ static void xl_hook_tl_deviceHookTable_vkGetDescriptorSetLayoutSupport(VkDevice
 #if defined(VK_VERSION_1_2)
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndirectCount;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndirectCount) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndirectCount;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndirectCount;
+	if (__info.replace && __info.replace->vkCmdDrawIndirectCount) {
+		__fn = __info.replace->vkCmdDrawIndirectCount;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirectCount", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndirectCount", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirectCount", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndirectCount", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndexedIndirectCount;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndexedIndirectCount) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndexedIndirectCount;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndexedIndirectCount;
+	if (__info.replace && __info.replace->vkCmdDrawIndexedIndirectCount) {
+		__fn = __info.replace->vkCmdDrawIndexedIndirectCount;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexedIndirectCount", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndexedIndirectCount", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexedIndirectCount", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndexedIndirectCount", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
-	auto __fn = tl_deviceHookTable.table->vkCreateRenderPass2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateRenderPass2) {
-		__fn = tl_deviceHookTable.replace->vkCreateRenderPass2;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateRenderPass2;
+	if (__info.replace && __info.replace->vkCreateRenderPass2) {
+		__fn = __info.replace->vkCreateRenderPass2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateRenderPass2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateRenderPass2", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pRenderPass);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateRenderPass2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateRenderPass2", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfo* pSubpassBeginInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginRenderPass2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginRenderPass2) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginRenderPass2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginRenderPass2;
+	if (__info.replace && __info.replace->vkCmdBeginRenderPass2) {
+		__fn = __info.replace->vkCmdBeginRenderPass2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginRenderPass2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginRenderPass2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginRenderPass2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginRenderPass2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo, const VkSubpassEndInfo* pSubpassEndInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdNextSubpass2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdNextSubpass2) {
-		__fn = tl_deviceHookTable.replace->vkCmdNextSubpass2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdNextSubpass2;
+	if (__info.replace && __info.replace->vkCmdNextSubpass2) {
+		__fn = __info.replace->vkCmdNextSubpass2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdNextSubpass2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdNextSubpass2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdNextSubpass2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdNextSubpass2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndRenderPass2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndRenderPass2) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndRenderPass2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndRenderPass2;
+	if (__info.replace && __info.replace->vkCmdEndRenderPass2) {
+		__fn = __info.replace->vkCmdEndRenderPass2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndRenderPass2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndRenderPass2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pSubpassEndInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndRenderPass2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndRenderPass2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
-	auto __fn = tl_deviceHookTable.table->vkResetQueryPool;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkResetQueryPool) {
-		__fn = tl_deviceHookTable.replace->vkResetQueryPool;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkResetQueryPool;
+	if (__info.replace && __info.replace->vkResetQueryPool) {
+		__fn = __info.replace->vkResetQueryPool;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkResetQueryPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkResetQueryPool", (PFN_vkVoidFunction)__fn); }
 	__fn(device, queryPool, firstQuery, queryCount);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkResetQueryPool", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkResetQueryPool", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
-	auto __fn = tl_deviceHookTable.table->vkGetSemaphoreCounterValue;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetSemaphoreCounterValue) {
-		__fn = tl_deviceHookTable.replace->vkGetSemaphoreCounterValue;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetSemaphoreCounterValue;
+	if (__info.replace && __info.replace->vkGetSemaphoreCounterValue) {
+		__fn = __info.replace->vkGetSemaphoreCounterValue;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetSemaphoreCounterValue", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetSemaphoreCounterValue", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, semaphore, pValue);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetSemaphoreCounterValue", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetSemaphoreCounterValue", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
-	auto __fn = tl_deviceHookTable.table->vkWaitSemaphores;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkWaitSemaphores) {
-		__fn = tl_deviceHookTable.replace->vkWaitSemaphores;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkWaitSemaphores;
+	if (__info.replace && __info.replace->vkWaitSemaphores) {
+		__fn = __info.replace->vkWaitSemaphores;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkWaitSemaphores", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkWaitSemaphores", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pWaitInfo, timeout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkWaitSemaphores", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkWaitSemaphores", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkSignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
-	auto __fn = tl_deviceHookTable.table->vkSignalSemaphore;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSignalSemaphore) {
-		__fn = tl_deviceHookTable.replace->vkSignalSemaphore;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSignalSemaphore;
+	if (__info.replace && __info.replace->vkSignalSemaphore) {
+		__fn = __info.replace->vkSignalSemaphore;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSignalSemaphore", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSignalSemaphore", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pSignalInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSignalSemaphore", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSignalSemaphore", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkDeviceAddress xl_hook_tl_deviceHookTable_vkGetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetBufferDeviceAddress;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetBufferDeviceAddress) {
-		__fn = tl_deviceHookTable.replace->vkGetBufferDeviceAddress;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetBufferDeviceAddress;
+	if (__info.replace && __info.replace->vkGetBufferDeviceAddress) {
+		__fn = __info.replace->vkGetBufferDeviceAddress;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetBufferDeviceAddress", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetBufferDeviceAddress", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetBufferDeviceAddress", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetBufferDeviceAddress", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static uint64_t xl_hook_tl_deviceHookTable_vkGetBufferOpaqueCaptureAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetBufferOpaqueCaptureAddress;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetBufferOpaqueCaptureAddress) {
-		__fn = tl_deviceHookTable.replace->vkGetBufferOpaqueCaptureAddress;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetBufferOpaqueCaptureAddress;
+	if (__info.replace && __info.replace->vkGetBufferOpaqueCaptureAddress) {
+		__fn = __info.replace->vkGetBufferOpaqueCaptureAddress;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetBufferOpaqueCaptureAddress", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetBufferOpaqueCaptureAddress", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetBufferOpaqueCaptureAddress", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetBufferOpaqueCaptureAddress", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static uint64_t xl_hook_tl_deviceHookTable_vkGetDeviceMemoryOpaqueCaptureAddress(VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceMemoryOpaqueCaptureAddress;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceMemoryOpaqueCaptureAddress) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceMemoryOpaqueCaptureAddress;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceMemoryOpaqueCaptureAddress;
+	if (__info.replace && __info.replace->vkGetDeviceMemoryOpaqueCaptureAddress) {
+		__fn = __info.replace->vkGetDeviceMemoryOpaqueCaptureAddress;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceMemoryOpaqueCaptureAddress", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceMemoryOpaqueCaptureAddress", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceMemoryOpaqueCaptureAddress", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceMemoryOpaqueCaptureAddress", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -3841,366 +4039,402 @@ static uint64_t xl_hook_tl_deviceHookTable_vkGetDeviceMemoryOpaqueCaptureAddress
 #if defined(VK_VERSION_1_3)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreatePrivateDataSlot(VkDevice device, const VkPrivateDataSlotCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPrivateDataSlot* pPrivateDataSlot) {
-	auto __fn = tl_deviceHookTable.table->vkCreatePrivateDataSlot;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreatePrivateDataSlot) {
-		__fn = tl_deviceHookTable.replace->vkCreatePrivateDataSlot;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreatePrivateDataSlot;
+	if (__info.replace && __info.replace->vkCreatePrivateDataSlot) {
+		__fn = __info.replace->vkCreatePrivateDataSlot;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreatePrivateDataSlot", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreatePrivateDataSlot", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pPrivateDataSlot);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreatePrivateDataSlot", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreatePrivateDataSlot", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyPrivateDataSlot(VkDevice device, VkPrivateDataSlot privateDataSlot, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyPrivateDataSlot;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyPrivateDataSlot) {
-		__fn = tl_deviceHookTable.replace->vkDestroyPrivateDataSlot;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyPrivateDataSlot;
+	if (__info.replace && __info.replace->vkDestroyPrivateDataSlot) {
+		__fn = __info.replace->vkDestroyPrivateDataSlot;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyPrivateDataSlot", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyPrivateDataSlot", (PFN_vkVoidFunction)__fn); }
 	__fn(device, privateDataSlot, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyPrivateDataSlot", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyPrivateDataSlot", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkSetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t data) {
-	auto __fn = tl_deviceHookTable.table->vkSetPrivateData;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSetPrivateData) {
-		__fn = tl_deviceHookTable.replace->vkSetPrivateData;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSetPrivateData;
+	if (__info.replace && __info.replace->vkSetPrivateData) {
+		__fn = __info.replace->vkSetPrivateData;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSetPrivateData", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSetPrivateData", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, objectType, objectHandle, privateDataSlot, data);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSetPrivateData", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSetPrivateData", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t* pData) {
-	auto __fn = tl_deviceHookTable.table->vkGetPrivateData;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetPrivateData) {
-		__fn = tl_deviceHookTable.replace->vkGetPrivateData;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetPrivateData;
+	if (__info.replace && __info.replace->vkGetPrivateData) {
+		__fn = __info.replace->vkGetPrivateData;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetPrivateData", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetPrivateData", (PFN_vkVoidFunction)__fn); }
 	__fn(device, objectType, objectHandle, privateDataSlot, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetPrivateData", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetPrivateData", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo* pDependencyInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetEvent2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetEvent2) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetEvent2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetEvent2;
+	if (__info.replace && __info.replace->vkCmdSetEvent2) {
+		__fn = __info.replace->vkCmdSetEvent2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetEvent2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetEvent2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, event, pDependencyInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetEvent2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetEvent2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
-	auto __fn = tl_deviceHookTable.table->vkCmdResetEvent2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdResetEvent2) {
-		__fn = tl_deviceHookTable.replace->vkCmdResetEvent2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdResetEvent2;
+	if (__info.replace && __info.replace->vkCmdResetEvent2) {
+		__fn = __info.replace->vkCmdResetEvent2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdResetEvent2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdResetEvent2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, event, stageMask);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdResetEvent2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdResetEvent2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfo* pDependencyInfos) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWaitEvents2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWaitEvents2) {
-		__fn = tl_deviceHookTable.replace->vkCmdWaitEvents2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWaitEvents2;
+	if (__info.replace && __info.replace->vkCmdWaitEvents2) {
+		__fn = __info.replace->vkCmdWaitEvents2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWaitEvents2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWaitEvents2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, eventCount, pEvents, pDependencyInfos);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWaitEvents2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWaitEvents2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdPipelineBarrier2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdPipelineBarrier2) {
-		__fn = tl_deviceHookTable.replace->vkCmdPipelineBarrier2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdPipelineBarrier2;
+	if (__info.replace && __info.replace->vkCmdPipelineBarrier2) {
+		__fn = __info.replace->vkCmdPipelineBarrier2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdPipelineBarrier2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdPipelineBarrier2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pDependencyInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdPipelineBarrier2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdPipelineBarrier2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWriteTimestamp2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWriteTimestamp2) {
-		__fn = tl_deviceHookTable.replace->vkCmdWriteTimestamp2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWriteTimestamp2;
+	if (__info.replace && __info.replace->vkCmdWriteTimestamp2) {
+		__fn = __info.replace->vkCmdWriteTimestamp2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWriteTimestamp2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWriteTimestamp2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, stage, queryPool, query);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWriteTimestamp2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWriteTimestamp2", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
-	auto __fn = tl_deviceHookTable.table->vkQueueSubmit2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkQueueSubmit2) {
-		__fn = tl_deviceHookTable.replace->vkQueueSubmit2;
+	auto __info = DeviceTable_getHookInfo(queue);
+	auto __fn = __info.table->vkQueueSubmit2;
+	if (__info.replace && __info.replace->vkQueueSubmit2) {
+		__fn = __info.replace->vkQueueSubmit2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkQueueSubmit2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkQueueSubmit2", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(queue, submitCount, pSubmits, fence);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkQueueSubmit2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkQueueSubmit2", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyBuffer2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyBuffer2) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyBuffer2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyBuffer2;
+	if (__info.replace && __info.replace->vkCmdCopyBuffer2) {
+		__fn = __info.replace->vkCmdCopyBuffer2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyBuffer2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyBuffer2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCopyBufferInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyBuffer2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyBuffer2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2* pCopyImageInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyImage2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyImage2) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyImage2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyImage2;
+	if (__info.replace && __info.replace->vkCmdCopyImage2) {
+		__fn = __info.replace->vkCmdCopyImage2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyImage2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyImage2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCopyImageInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyImage2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyImage2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyBufferToImage2(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyBufferToImage2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyBufferToImage2) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyBufferToImage2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyBufferToImage2;
+	if (__info.replace && __info.replace->vkCmdCopyBufferToImage2) {
+		__fn = __info.replace->vkCmdCopyBufferToImage2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyBufferToImage2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyBufferToImage2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCopyBufferToImageInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyBufferToImage2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyBufferToImage2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyImageToBuffer2(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyImageToBuffer2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyImageToBuffer2) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyImageToBuffer2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyImageToBuffer2;
+	if (__info.replace && __info.replace->vkCmdCopyImageToBuffer2) {
+		__fn = __info.replace->vkCmdCopyImageToBuffer2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyImageToBuffer2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyImageToBuffer2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCopyImageToBufferInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyImageToBuffer2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyImageToBuffer2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2* pBlitImageInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBlitImage2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBlitImage2) {
-		__fn = tl_deviceHookTable.replace->vkCmdBlitImage2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBlitImage2;
+	if (__info.replace && __info.replace->vkCmdBlitImage2) {
+		__fn = __info.replace->vkCmdBlitImage2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBlitImage2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBlitImage2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pBlitImageInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBlitImage2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBlitImage2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdResolveImage2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdResolveImage2) {
-		__fn = tl_deviceHookTable.replace->vkCmdResolveImage2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdResolveImage2;
+	if (__info.replace && __info.replace->vkCmdResolveImage2) {
+		__fn = __info.replace->vkCmdResolveImage2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdResolveImage2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdResolveImage2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pResolveImageInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdResolveImage2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdResolveImage2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginRendering;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginRendering) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginRendering;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginRendering;
+	if (__info.replace && __info.replace->vkCmdBeginRendering) {
+		__fn = __info.replace->vkCmdBeginRendering;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginRendering", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginRendering", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pRenderingInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginRendering", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginRendering", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndRendering(VkCommandBuffer commandBuffer) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndRendering;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndRendering) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndRendering;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndRendering;
+	if (__info.replace && __info.replace->vkCmdEndRendering) {
+		__fn = __info.replace->vkCmdEndRendering;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndRendering", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndRendering", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndRendering", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndRendering", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetCullMode;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetCullMode) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetCullMode;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetCullMode;
+	if (__info.replace && __info.replace->vkCmdSetCullMode) {
+		__fn = __info.replace->vkCmdSetCullMode;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetCullMode", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetCullMode", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, cullMode);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetCullMode", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetCullMode", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetFrontFace;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetFrontFace) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetFrontFace;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetFrontFace;
+	if (__info.replace && __info.replace->vkCmdSetFrontFace) {
+		__fn = __info.replace->vkCmdSetFrontFace;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetFrontFace", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetFrontFace", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, frontFace);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetFrontFace", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetFrontFace", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetPrimitiveTopology(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetPrimitiveTopology;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetPrimitiveTopology) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetPrimitiveTopology;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetPrimitiveTopology;
+	if (__info.replace && __info.replace->vkCmdSetPrimitiveTopology) {
+		__fn = __info.replace->vkCmdSetPrimitiveTopology;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetPrimitiveTopology", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetPrimitiveTopology", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, primitiveTopology);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetPrimitiveTopology", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetPrimitiveTopology", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport* pViewports) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetViewportWithCount;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetViewportWithCount) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetViewportWithCount;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetViewportWithCount;
+	if (__info.replace && __info.replace->vkCmdSetViewportWithCount) {
+		__fn = __info.replace->vkCmdSetViewportWithCount;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetViewportWithCount", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetViewportWithCount", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, viewportCount, pViewports);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetViewportWithCount", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetViewportWithCount", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetScissorWithCount;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetScissorWithCount) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetScissorWithCount;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetScissorWithCount;
+	if (__info.replace && __info.replace->vkCmdSetScissorWithCount) {
+		__fn = __info.replace->vkCmdSetScissorWithCount;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetScissorWithCount", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetScissorWithCount", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, scissorCount, pScissors);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetScissorWithCount", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetScissorWithCount", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindVertexBuffers2;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindVertexBuffers2) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindVertexBuffers2;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindVertexBuffers2;
+	if (__info.replace && __info.replace->vkCmdBindVertexBuffers2) {
+		__fn = __info.replace->vkCmdBindVertexBuffers2;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindVertexBuffers2", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindVertexBuffers2", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindVertexBuffers2", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindVertexBuffers2", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthTestEnable;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthTestEnable) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthTestEnable;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthTestEnable;
+	if (__info.replace && __info.replace->vkCmdSetDepthTestEnable) {
+		__fn = __info.replace->vkCmdSetDepthTestEnable;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthTestEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthTestEnable", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthTestEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthTestEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthTestEnable", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthWriteEnable;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthWriteEnable) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthWriteEnable;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthWriteEnable;
+	if (__info.replace && __info.replace->vkCmdSetDepthWriteEnable) {
+		__fn = __info.replace->vkCmdSetDepthWriteEnable;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthWriteEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthWriteEnable", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthWriteEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthWriteEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthWriteEnable", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthCompareOp;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthCompareOp) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthCompareOp;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthCompareOp;
+	if (__info.replace && __info.replace->vkCmdSetDepthCompareOp) {
+		__fn = __info.replace->vkCmdSetDepthCompareOp;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthCompareOp", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthCompareOp", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthCompareOp);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthCompareOp", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthCompareOp", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthBoundsTestEnable;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthBoundsTestEnable) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthBoundsTestEnable;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthBoundsTestEnable;
+	if (__info.replace && __info.replace->vkCmdSetDepthBoundsTestEnable) {
+		__fn = __info.replace->vkCmdSetDepthBoundsTestEnable;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBoundsTestEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthBoundsTestEnable", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthBoundsTestEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBoundsTestEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthBoundsTestEnable", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetStencilTestEnable;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetStencilTestEnable) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetStencilTestEnable;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetStencilTestEnable;
+	if (__info.replace && __info.replace->vkCmdSetStencilTestEnable) {
+		__fn = __info.replace->vkCmdSetStencilTestEnable;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetStencilTestEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetStencilTestEnable", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, stencilTestEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetStencilTestEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetStencilTestEnable", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetStencilOp;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetStencilOp) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetStencilOp;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetStencilOp;
+	if (__info.replace && __info.replace->vkCmdSetStencilOp) {
+		__fn = __info.replace->vkCmdSetStencilOp;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetStencilOp", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetStencilOp", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetStencilOp", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetStencilOp", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetRasterizerDiscardEnable;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetRasterizerDiscardEnable) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetRasterizerDiscardEnable;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetRasterizerDiscardEnable;
+	if (__info.replace && __info.replace->vkCmdSetRasterizerDiscardEnable) {
+		__fn = __info.replace->vkCmdSetRasterizerDiscardEnable;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetRasterizerDiscardEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetRasterizerDiscardEnable", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, rasterizerDiscardEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetRasterizerDiscardEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetRasterizerDiscardEnable", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthBiasEnable;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthBiasEnable) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthBiasEnable;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthBiasEnable;
+	if (__info.replace && __info.replace->vkCmdSetDepthBiasEnable) {
+		__fn = __info.replace->vkCmdSetDepthBiasEnable;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBiasEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthBiasEnable", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthBiasEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBiasEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthBiasEnable", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetPrimitiveRestartEnable;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetPrimitiveRestartEnable) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetPrimitiveRestartEnable;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetPrimitiveRestartEnable;
+	if (__info.replace && __info.replace->vkCmdSetPrimitiveRestartEnable) {
+		__fn = __info.replace->vkCmdSetPrimitiveRestartEnable;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetPrimitiveRestartEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetPrimitiveRestartEnable", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, primitiveRestartEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetPrimitiveRestartEnable", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetPrimitiveRestartEnable", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceBufferMemoryRequirements(VkDevice device, const VkDeviceBufferMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceBufferMemoryRequirements;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceBufferMemoryRequirements) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceBufferMemoryRequirements;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceBufferMemoryRequirements;
+	if (__info.replace && __info.replace->vkGetDeviceBufferMemoryRequirements) {
+		__fn = __info.replace->vkGetDeviceBufferMemoryRequirements;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceBufferMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceBufferMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceBufferMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceBufferMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceImageMemoryRequirements(VkDevice device, const VkDeviceImageMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceImageMemoryRequirements;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceImageMemoryRequirements) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceImageMemoryRequirements;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceImageMemoryRequirements;
+	if (__info.replace && __info.replace->vkGetDeviceImageMemoryRequirements) {
+		__fn = __info.replace->vkGetDeviceImageMemoryRequirements;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceImageMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceImageMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceImageMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceImageMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceImageSparseMemoryRequirements(VkDevice device, const VkDeviceImageMemoryRequirements* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceImageSparseMemoryRequirements;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceImageSparseMemoryRequirements) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceImageSparseMemoryRequirements;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceImageSparseMemoryRequirements;
+	if (__info.replace && __info.replace->vkGetDeviceImageSparseMemoryRequirements) {
+		__fn = __info.replace->vkGetDeviceImageSparseMemoryRequirements;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceImageSparseMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceImageSparseMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceImageSparseMemoryRequirements", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceImageSparseMemoryRequirements", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_VERSION_1_3) */
@@ -4208,56 +4442,61 @@ static void xl_hook_tl_deviceHookTable_vkGetDeviceImageSparseMemoryRequirements(
 #if defined(VK_KHR_swapchain)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) {
-	auto __fn = tl_deviceHookTable.table->vkCreateSwapchainKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateSwapchainKHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateSwapchainKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateSwapchainKHR;
+	if (__info.replace && __info.replace->vkCreateSwapchainKHR) {
+		__fn = __info.replace->vkCreateSwapchainKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateSwapchainKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateSwapchainKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pSwapchain);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateSwapchainKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateSwapchainKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroySwapchainKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroySwapchainKHR) {
-		__fn = tl_deviceHookTable.replace->vkDestroySwapchainKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroySwapchainKHR;
+	if (__info.replace && __info.replace->vkDestroySwapchainKHR) {
+		__fn = __info.replace->vkDestroySwapchainKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroySwapchainKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroySwapchainKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, swapchain, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroySwapchainKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroySwapchainKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) {
-	auto __fn = tl_deviceHookTable.table->vkGetSwapchainImagesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetSwapchainImagesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetSwapchainImagesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetSwapchainImagesKHR;
+	if (__info.replace && __info.replace->vkGetSwapchainImagesKHR) {
+		__fn = __info.replace->vkGetSwapchainImagesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetSwapchainImagesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetSwapchainImagesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchain, pSwapchainImageCount, pSwapchainImages);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetSwapchainImagesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetSwapchainImagesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
-	auto __fn = tl_deviceHookTable.table->vkAcquireNextImageKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkAcquireNextImageKHR) {
-		__fn = tl_deviceHookTable.replace->vkAcquireNextImageKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkAcquireNextImageKHR;
+	if (__info.replace && __info.replace->vkAcquireNextImageKHR) {
+		__fn = __info.replace->vkAcquireNextImageKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkAcquireNextImageKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkAcquireNextImageKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchain, timeout, semaphore, fence, pImageIndex);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkAcquireNextImageKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkAcquireNextImageKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) {
-	auto __fn = tl_deviceHookTable.table->vkQueuePresentKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkQueuePresentKHR) {
-		__fn = tl_deviceHookTable.replace->vkQueuePresentKHR;
+	auto __info = DeviceTable_getHookInfo(queue);
+	auto __fn = __info.table->vkQueuePresentKHR;
+	if (__info.replace && __info.replace->vkQueuePresentKHR) {
+		__fn = __info.replace->vkQueuePresentKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkQueuePresentKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkQueuePresentKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(queue, pPresentInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkQueuePresentKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkQueuePresentKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4266,24 +4505,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkQueuePresentKHR(VkQueue queue, cons
 #if (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_device_group) && defined(VK_KHR_surface))
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetDeviceGroupPresentCapabilitiesKHR(VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceGroupPresentCapabilitiesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceGroupPresentCapabilitiesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceGroupPresentCapabilitiesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceGroupPresentCapabilitiesKHR;
+	if (__info.replace && __info.replace->vkGetDeviceGroupPresentCapabilitiesKHR) {
+		__fn = __info.replace->vkGetDeviceGroupPresentCapabilitiesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupPresentCapabilitiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceGroupPresentCapabilitiesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pDeviceGroupPresentCapabilities);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupPresentCapabilitiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceGroupPresentCapabilitiesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetDeviceGroupSurfacePresentModesKHR(VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceGroupSurfacePresentModesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceGroupSurfacePresentModesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceGroupSurfacePresentModesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceGroupSurfacePresentModesKHR;
+	if (__info.replace && __info.replace->vkGetDeviceGroupSurfacePresentModesKHR) {
+		__fn = __info.replace->vkGetDeviceGroupSurfacePresentModesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupSurfacePresentModesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceGroupSurfacePresentModesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, surface, pModes);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupSurfacePresentModesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceGroupSurfacePresentModesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4292,13 +4533,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetDeviceGroupSurfacePresentModesKH
 #if (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain))
 
 static VkResult xl_hook_tl_deviceHookTable_vkAcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex) {
-	auto __fn = tl_deviceHookTable.table->vkAcquireNextImage2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkAcquireNextImage2KHR) {
-		__fn = tl_deviceHookTable.replace->vkAcquireNextImage2KHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkAcquireNextImage2KHR;
+	if (__info.replace && __info.replace->vkAcquireNextImage2KHR) {
+		__fn = __info.replace->vkAcquireNextImage2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkAcquireNextImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkAcquireNextImage2KHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pAcquireInfo, pImageIndex);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkAcquireNextImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkAcquireNextImage2KHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4307,13 +4549,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkAcquireNextImage2KHR(VkDevice devic
 #if defined(VK_KHR_display_swapchain)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) {
-	auto __fn = tl_deviceHookTable.table->vkCreateSharedSwapchainsKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateSharedSwapchainsKHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateSharedSwapchainsKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateSharedSwapchainsKHR;
+	if (__info.replace && __info.replace->vkCreateSharedSwapchainsKHR) {
+		__fn = __info.replace->vkCreateSharedSwapchainsKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateSharedSwapchainsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateSharedSwapchainsKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateSharedSwapchainsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateSharedSwapchainsKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4322,55 +4565,60 @@ static VkResult xl_hook_tl_deviceHookTable_vkCreateSharedSwapchainsKHR(VkDevice
 #if defined(VK_EXT_debug_marker)
 
 static VkResult xl_hook_tl_deviceHookTable_vkDebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo) {
-	auto __fn = tl_deviceHookTable.table->vkDebugMarkerSetObjectTagEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDebugMarkerSetObjectTagEXT) {
-		__fn = tl_deviceHookTable.replace->vkDebugMarkerSetObjectTagEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDebugMarkerSetObjectTagEXT;
+	if (__info.replace && __info.replace->vkDebugMarkerSetObjectTagEXT) {
+		__fn = __info.replace->vkDebugMarkerSetObjectTagEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDebugMarkerSetObjectTagEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDebugMarkerSetObjectTagEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pTagInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDebugMarkerSetObjectTagEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDebugMarkerSetObjectTagEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkDebugMarkerSetObjectNameEXT(VkDevice device, const VkDebugMarkerObjectNameInfoEXT* pNameInfo) {
-	auto __fn = tl_deviceHookTable.table->vkDebugMarkerSetObjectNameEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDebugMarkerSetObjectNameEXT) {
-		__fn = tl_deviceHookTable.replace->vkDebugMarkerSetObjectNameEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDebugMarkerSetObjectNameEXT;
+	if (__info.replace && __info.replace->vkDebugMarkerSetObjectNameEXT) {
+		__fn = __info.replace->vkDebugMarkerSetObjectNameEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDebugMarkerSetObjectNameEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDebugMarkerSetObjectNameEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pNameInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDebugMarkerSetObjectNameEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDebugMarkerSetObjectNameEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDebugMarkerBeginEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDebugMarkerBeginEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdDebugMarkerBeginEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDebugMarkerBeginEXT;
+	if (__info.replace && __info.replace->vkCmdDebugMarkerBeginEXT) {
+		__fn = __info.replace->vkCmdDebugMarkerBeginEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDebugMarkerBeginEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDebugMarkerBeginEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pMarkerInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDebugMarkerBeginEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDebugMarkerBeginEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDebugMarkerEndEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDebugMarkerEndEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdDebugMarkerEndEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDebugMarkerEndEXT;
+	if (__info.replace && __info.replace->vkCmdDebugMarkerEndEXT) {
+		__fn = __info.replace->vkCmdDebugMarkerEndEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDebugMarkerEndEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDebugMarkerEndEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDebugMarkerEndEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDebugMarkerEndEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDebugMarkerInsertEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDebugMarkerInsertEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdDebugMarkerInsertEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDebugMarkerInsertEXT;
+	if (__info.replace && __info.replace->vkCmdDebugMarkerInsertEXT) {
+		__fn = __info.replace->vkCmdDebugMarkerInsertEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDebugMarkerInsertEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDebugMarkerInsertEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pMarkerInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDebugMarkerInsertEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDebugMarkerInsertEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_debug_marker) */
@@ -4378,108 +4626,118 @@ static void xl_hook_tl_deviceHookTable_vkCmdDebugMarkerInsertEXT(VkCommandBuffer
 #if defined(VK_KHR_video_queue)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateVideoSessionKHR(VkDevice device, const VkVideoSessionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionKHR* pVideoSession) {
-	auto __fn = tl_deviceHookTable.table->vkCreateVideoSessionKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateVideoSessionKHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateVideoSessionKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateVideoSessionKHR;
+	if (__info.replace && __info.replace->vkCreateVideoSessionKHR) {
+		__fn = __info.replace->vkCreateVideoSessionKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateVideoSessionKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateVideoSessionKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pVideoSession);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateVideoSessionKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateVideoSessionKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyVideoSessionKHR(VkDevice device, VkVideoSessionKHR videoSession, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyVideoSessionKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyVideoSessionKHR) {
-		__fn = tl_deviceHookTable.replace->vkDestroyVideoSessionKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyVideoSessionKHR;
+	if (__info.replace && __info.replace->vkDestroyVideoSessionKHR) {
+		__fn = __info.replace->vkDestroyVideoSessionKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyVideoSessionKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyVideoSessionKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, videoSession, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyVideoSessionKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyVideoSessionKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetVideoSessionMemoryRequirementsKHR(VkDevice device, VkVideoSessionKHR videoSession, uint32_t* pVideoSessionMemoryRequirementsCount, VkVideoGetMemoryPropertiesKHR* pVideoSessionMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetVideoSessionMemoryRequirementsKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetVideoSessionMemoryRequirementsKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetVideoSessionMemoryRequirementsKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetVideoSessionMemoryRequirementsKHR;
+	if (__info.replace && __info.replace->vkGetVideoSessionMemoryRequirementsKHR) {
+		__fn = __info.replace->vkGetVideoSessionMemoryRequirementsKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetVideoSessionMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetVideoSessionMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, videoSession, pVideoSessionMemoryRequirementsCount, pVideoSessionMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetVideoSessionMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetVideoSessionMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkBindVideoSessionMemoryKHR(VkDevice device, VkVideoSessionKHR videoSession, uint32_t videoSessionBindMemoryCount, const VkVideoBindMemoryKHR* pVideoSessionBindMemories) {
-	auto __fn = tl_deviceHookTable.table->vkBindVideoSessionMemoryKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBindVideoSessionMemoryKHR) {
-		__fn = tl_deviceHookTable.replace->vkBindVideoSessionMemoryKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkBindVideoSessionMemoryKHR;
+	if (__info.replace && __info.replace->vkBindVideoSessionMemoryKHR) {
+		__fn = __info.replace->vkBindVideoSessionMemoryKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBindVideoSessionMemoryKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBindVideoSessionMemoryKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, videoSession, videoSessionBindMemoryCount, pVideoSessionBindMemories);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBindVideoSessionMemoryKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBindVideoSessionMemoryKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateVideoSessionParametersKHR(VkDevice device, const VkVideoSessionParametersCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionParametersKHR* pVideoSessionParameters) {
-	auto __fn = tl_deviceHookTable.table->vkCreateVideoSessionParametersKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateVideoSessionParametersKHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateVideoSessionParametersKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateVideoSessionParametersKHR;
+	if (__info.replace && __info.replace->vkCreateVideoSessionParametersKHR) {
+		__fn = __info.replace->vkCreateVideoSessionParametersKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pVideoSessionParameters);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkUpdateVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters, const VkVideoSessionParametersUpdateInfoKHR* pUpdateInfo) {
-	auto __fn = tl_deviceHookTable.table->vkUpdateVideoSessionParametersKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkUpdateVideoSessionParametersKHR) {
-		__fn = tl_deviceHookTable.replace->vkUpdateVideoSessionParametersKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkUpdateVideoSessionParametersKHR;
+	if (__info.replace && __info.replace->vkUpdateVideoSessionParametersKHR) {
+		__fn = __info.replace->vkUpdateVideoSessionParametersKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkUpdateVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkUpdateVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, videoSessionParameters, pUpdateInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkUpdateVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkUpdateVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyVideoSessionParametersKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyVideoSessionParametersKHR) {
-		__fn = tl_deviceHookTable.replace->vkDestroyVideoSessionParametersKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyVideoSessionParametersKHR;
+	if (__info.replace && __info.replace->vkDestroyVideoSessionParametersKHR) {
+		__fn = __info.replace->vkDestroyVideoSessionParametersKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, videoSessionParameters, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyVideoSessionParametersKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoBeginCodingInfoKHR* pBeginInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginVideoCodingKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginVideoCodingKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginVideoCodingKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginVideoCodingKHR;
+	if (__info.replace && __info.replace->vkCmdBeginVideoCodingKHR) {
+		__fn = __info.replace->vkCmdBeginVideoCodingKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pBeginInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoEndCodingInfoKHR* pEndCodingInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndVideoCodingKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndVideoCodingKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndVideoCodingKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndVideoCodingKHR;
+	if (__info.replace && __info.replace->vkCmdEndVideoCodingKHR) {
+		__fn = __info.replace->vkCmdEndVideoCodingKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pEndCodingInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdControlVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoCodingControlInfoKHR* pCodingControlInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdControlVideoCodingKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdControlVideoCodingKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdControlVideoCodingKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdControlVideoCodingKHR;
+	if (__info.replace && __info.replace->vkCmdControlVideoCodingKHR) {
+		__fn = __info.replace->vkCmdControlVideoCodingKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdControlVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdControlVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCodingControlInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdControlVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdControlVideoCodingKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_video_queue) */
@@ -4487,13 +4745,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdControlVideoCodingKHR(VkCommandBuffe
 #if defined(VK_KHR_video_decode_queue)
 
 static void xl_hook_tl_deviceHookTable_vkCmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR* pFrameInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDecodeVideoKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDecodeVideoKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdDecodeVideoKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDecodeVideoKHR;
+	if (__info.replace && __info.replace->vkCmdDecodeVideoKHR) {
+		__fn = __info.replace->vkCmdDecodeVideoKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDecodeVideoKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDecodeVideoKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pFrameInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDecodeVideoKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDecodeVideoKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_video_decode_queue) */
@@ -4501,63 +4760,69 @@ static void xl_hook_tl_deviceHookTable_vkCmdDecodeVideoKHR(VkCommandBuffer comma
 #if defined(VK_EXT_transform_feedback)
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindTransformFeedbackBuffersEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindTransformFeedbackBuffersEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindTransformFeedbackBuffersEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindTransformFeedbackBuffersEXT;
+	if (__info.replace && __info.replace->vkCmdBindTransformFeedbackBuffersEXT) {
+		__fn = __info.replace->vkCmdBindTransformFeedbackBuffersEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindTransformFeedbackBuffersEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindTransformFeedbackBuffersEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindTransformFeedbackBuffersEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindTransformFeedbackBuffersEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginTransformFeedbackEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginTransformFeedbackEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginTransformFeedbackEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginTransformFeedbackEXT;
+	if (__info.replace && __info.replace->vkCmdBeginTransformFeedbackEXT) {
+		__fn = __info.replace->vkCmdBeginTransformFeedbackEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginTransformFeedbackEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginTransformFeedbackEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginTransformFeedbackEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginTransformFeedbackEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndTransformFeedbackEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndTransformFeedbackEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndTransformFeedbackEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndTransformFeedbackEXT;
+	if (__info.replace && __info.replace->vkCmdEndTransformFeedbackEXT) {
+		__fn = __info.replace->vkCmdEndTransformFeedbackEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndTransformFeedbackEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndTransformFeedbackEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndTransformFeedbackEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndTransformFeedbackEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags, uint32_t index) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginQueryIndexedEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginQueryIndexedEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginQueryIndexedEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginQueryIndexedEXT;
+	if (__info.replace && __info.replace->vkCmdBeginQueryIndexedEXT) {
+		__fn = __info.replace->vkCmdBeginQueryIndexedEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginQueryIndexedEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginQueryIndexedEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, queryPool, query, flags, index);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginQueryIndexedEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginQueryIndexedEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, uint32_t index) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndQueryIndexedEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndQueryIndexedEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndQueryIndexedEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndQueryIndexedEXT;
+	if (__info.replace && __info.replace->vkCmdEndQueryIndexedEXT) {
+		__fn = __info.replace->vkCmdEndQueryIndexedEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndQueryIndexedEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndQueryIndexedEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, queryPool, query, index);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndQueryIndexedEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndQueryIndexedEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndirectByteCountEXT(VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance, VkBuffer counterBuffer, VkDeviceSize counterBufferOffset, uint32_t counterOffset, uint32_t vertexStride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndirectByteCountEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndirectByteCountEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndirectByteCountEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndirectByteCountEXT;
+	if (__info.replace && __info.replace->vkCmdDrawIndirectByteCountEXT) {
+		__fn = __info.replace->vkCmdDrawIndirectByteCountEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirectByteCountEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndirectByteCountEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirectByteCountEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndirectByteCountEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_transform_feedback) */
@@ -4565,55 +4830,60 @@ static void xl_hook_tl_deviceHookTable_vkCmdDrawIndirectByteCountEXT(VkCommandBu
 #if defined(VK_NVX_binary_import)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateCuModuleNVX(VkDevice device, const VkCuModuleCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCuModuleNVX* pModule) {
-	auto __fn = tl_deviceHookTable.table->vkCreateCuModuleNVX;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateCuModuleNVX) {
-		__fn = tl_deviceHookTable.replace->vkCreateCuModuleNVX;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateCuModuleNVX;
+	if (__info.replace && __info.replace->vkCreateCuModuleNVX) {
+		__fn = __info.replace->vkCreateCuModuleNVX;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateCuModuleNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateCuModuleNVX", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pModule);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateCuModuleNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateCuModuleNVX", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateCuFunctionNVX(VkDevice device, const VkCuFunctionCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCuFunctionNVX* pFunction) {
-	auto __fn = tl_deviceHookTable.table->vkCreateCuFunctionNVX;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateCuFunctionNVX) {
-		__fn = tl_deviceHookTable.replace->vkCreateCuFunctionNVX;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateCuFunctionNVX;
+	if (__info.replace && __info.replace->vkCreateCuFunctionNVX) {
+		__fn = __info.replace->vkCreateCuFunctionNVX;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateCuFunctionNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateCuFunctionNVX", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pFunction);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateCuFunctionNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateCuFunctionNVX", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyCuModuleNVX(VkDevice device, VkCuModuleNVX module, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyCuModuleNVX;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyCuModuleNVX) {
-		__fn = tl_deviceHookTable.replace->vkDestroyCuModuleNVX;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyCuModuleNVX;
+	if (__info.replace && __info.replace->vkDestroyCuModuleNVX) {
+		__fn = __info.replace->vkDestroyCuModuleNVX;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyCuModuleNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyCuModuleNVX", (PFN_vkVoidFunction)__fn); }
 	__fn(device, module, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyCuModuleNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyCuModuleNVX", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyCuFunctionNVX(VkDevice device, VkCuFunctionNVX function, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyCuFunctionNVX;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyCuFunctionNVX) {
-		__fn = tl_deviceHookTable.replace->vkDestroyCuFunctionNVX;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyCuFunctionNVX;
+	if (__info.replace && __info.replace->vkDestroyCuFunctionNVX) {
+		__fn = __info.replace->vkDestroyCuFunctionNVX;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyCuFunctionNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyCuFunctionNVX", (PFN_vkVoidFunction)__fn); }
 	__fn(device, function, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyCuFunctionNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyCuFunctionNVX", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, const VkCuLaunchInfoNVX* pLaunchInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCuLaunchKernelNVX;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCuLaunchKernelNVX) {
-		__fn = tl_deviceHookTable.replace->vkCmdCuLaunchKernelNVX;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCuLaunchKernelNVX;
+	if (__info.replace && __info.replace->vkCmdCuLaunchKernelNVX) {
+		__fn = __info.replace->vkCmdCuLaunchKernelNVX;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCuLaunchKernelNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCuLaunchKernelNVX", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pLaunchInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCuLaunchKernelNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCuLaunchKernelNVX", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_NVX_binary_import) */
@@ -4621,24 +4891,26 @@ static void xl_hook_tl_deviceHookTable_vkCmdCuLaunchKernelNVX(VkCommandBuffer co
 #if defined(VK_NVX_image_view_handle)
 
 static uint32_t xl_hook_tl_deviceHookTable_vkGetImageViewHandleNVX(VkDevice device, const VkImageViewHandleInfoNVX* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageViewHandleNVX;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageViewHandleNVX) {
-		__fn = tl_deviceHookTable.replace->vkGetImageViewHandleNVX;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageViewHandleNVX;
+	if (__info.replace && __info.replace->vkGetImageViewHandleNVX) {
+		__fn = __info.replace->vkGetImageViewHandleNVX;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageViewHandleNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageViewHandleNVX", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageViewHandleNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageViewHandleNVX", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetImageViewAddressNVX(VkDevice device, VkImageView imageView, VkImageViewAddressPropertiesNVX* pProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageViewAddressNVX;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageViewAddressNVX) {
-		__fn = tl_deviceHookTable.replace->vkGetImageViewAddressNVX;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageViewAddressNVX;
+	if (__info.replace && __info.replace->vkGetImageViewAddressNVX) {
+		__fn = __info.replace->vkGetImageViewAddressNVX;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageViewAddressNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageViewAddressNVX", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, imageView, pProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageViewAddressNVX", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageViewAddressNVX", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4647,23 +4919,25 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetImageViewAddressNVX(VkDevice dev
 #if defined(VK_AMD_draw_indirect_count)
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndirectCountAMD;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndirectCountAMD) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndirectCountAMD;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndirectCountAMD;
+	if (__info.replace && __info.replace->vkCmdDrawIndirectCountAMD) {
+		__fn = __info.replace->vkCmdDrawIndirectCountAMD;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirectCountAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndirectCountAMD", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirectCountAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndirectCountAMD", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndexedIndirectCountAMD;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndexedIndirectCountAMD) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndexedIndirectCountAMD;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndexedIndirectCountAMD;
+	if (__info.replace && __info.replace->vkCmdDrawIndexedIndirectCountAMD) {
+		__fn = __info.replace->vkCmdDrawIndexedIndirectCountAMD;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexedIndirectCountAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndexedIndirectCountAMD", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexedIndirectCountAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndexedIndirectCountAMD", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_AMD_draw_indirect_count) */
@@ -4671,13 +4945,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdDrawIndexedIndirectCountAMD(VkComman
 #if defined(VK_AMD_shader_info)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetShaderInfoAMD;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetShaderInfoAMD) {
-		__fn = tl_deviceHookTable.replace->vkGetShaderInfoAMD;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetShaderInfoAMD;
+	if (__info.replace && __info.replace->vkGetShaderInfoAMD) {
+		__fn = __info.replace->vkGetShaderInfoAMD;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetShaderInfoAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetShaderInfoAMD", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetShaderInfoAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetShaderInfoAMD", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4686,23 +4961,25 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetShaderInfoAMD(VkDevice device, V
 #if defined(VK_KHR_dynamic_rendering)
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfoKHR* pRenderingInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginRenderingKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginRenderingKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginRenderingKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginRenderingKHR;
+	if (__info.replace && __info.replace->vkCmdBeginRenderingKHR) {
+		__fn = __info.replace->vkCmdBeginRenderingKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginRenderingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginRenderingKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pRenderingInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginRenderingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginRenderingKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndRenderingKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndRenderingKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndRenderingKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndRenderingKHR;
+	if (__info.replace && __info.replace->vkCmdEndRenderingKHR) {
+		__fn = __info.replace->vkCmdEndRenderingKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndRenderingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndRenderingKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndRenderingKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndRenderingKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_dynamic_rendering) */
@@ -4710,13 +4987,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdEndRenderingKHR(VkCommandBuffer comm
 #if defined(VK_NV_external_memory_win32)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryWin32HandleNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryWin32HandleNV) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryWin32HandleNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryWin32HandleNV;
+	if (__info.replace && __info.replace->vkGetMemoryWin32HandleNV) {
+		__fn = __info.replace->vkGetMemoryWin32HandleNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryWin32HandleNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryWin32HandleNV", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, memory, handleType, pHandle);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryWin32HandleNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryWin32HandleNV", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4725,33 +5003,36 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryWin32HandleNV(VkDevice dev
 #if defined(VK_KHR_device_group)
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceGroupPeerMemoryFeaturesKHR(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlagsKHR* pPeerMemoryFeatures) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceGroupPeerMemoryFeaturesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceGroupPeerMemoryFeaturesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceGroupPeerMemoryFeaturesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceGroupPeerMemoryFeaturesKHR;
+	if (__info.replace && __info.replace->vkGetDeviceGroupPeerMemoryFeaturesKHR) {
+		__fn = __info.replace->vkGetDeviceGroupPeerMemoryFeaturesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupPeerMemoryFeaturesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceGroupPeerMemoryFeaturesKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupPeerMemoryFeaturesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceGroupPeerMemoryFeaturesKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDeviceMaskKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDeviceMaskKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDeviceMaskKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDeviceMaskKHR;
+	if (__info.replace && __info.replace->vkCmdSetDeviceMaskKHR) {
+		__fn = __info.replace->vkCmdSetDeviceMaskKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDeviceMaskKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDeviceMaskKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, deviceMask);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDeviceMaskKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDeviceMaskKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDispatchBaseKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDispatchBaseKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdDispatchBaseKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDispatchBaseKHR;
+	if (__info.replace && __info.replace->vkCmdDispatchBaseKHR) {
+		__fn = __info.replace->vkCmdDispatchBaseKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDispatchBaseKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDispatchBaseKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDispatchBaseKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDispatchBaseKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_device_group) */
@@ -4759,13 +5040,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdDispatchBaseKHR(VkCommandBuffer comm
 #if defined(VK_KHR_maintenance1)
 
 static void xl_hook_tl_deviceHookTable_vkTrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) {
-	auto __fn = tl_deviceHookTable.table->vkTrimCommandPoolKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkTrimCommandPoolKHR) {
-		__fn = tl_deviceHookTable.replace->vkTrimCommandPoolKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkTrimCommandPoolKHR;
+	if (__info.replace && __info.replace->vkTrimCommandPoolKHR) {
+		__fn = __info.replace->vkTrimCommandPoolKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkTrimCommandPoolKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkTrimCommandPoolKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, commandPool, flags);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkTrimCommandPoolKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkTrimCommandPoolKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_maintenance1) */
@@ -4773,24 +5055,26 @@ static void xl_hook_tl_deviceHookTable_vkTrimCommandPoolKHR(VkDevice device, VkC
 #if defined(VK_KHR_external_memory_win32)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryWin32HandleKHR(VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryWin32HandleKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryWin32HandleKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryWin32HandleKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryWin32HandleKHR;
+	if (__info.replace && __info.replace->vkGetMemoryWin32HandleKHR) {
+		__fn = __info.replace->vkGetMemoryWin32HandleKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pGetWin32HandleInfo, pHandle);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryWin32HandlePropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, HANDLE handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryWin32HandlePropertiesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryWin32HandlePropertiesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryWin32HandlePropertiesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryWin32HandlePropertiesKHR;
+	if (__info.replace && __info.replace->vkGetMemoryWin32HandlePropertiesKHR) {
+		__fn = __info.replace->vkGetMemoryWin32HandlePropertiesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryWin32HandlePropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryWin32HandlePropertiesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, handleType, handle, pMemoryWin32HandleProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryWin32HandlePropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryWin32HandlePropertiesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4799,24 +5083,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryWin32HandlePropertiesKHR(V
 #if defined(VK_KHR_external_memory_fd)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryFdKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryFdKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryFdKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryFdKHR;
+	if (__info.replace && __info.replace->vkGetMemoryFdKHR) {
+		__fn = __info.replace->vkGetMemoryFdKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryFdKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pGetFdInfo, pFd);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryFdKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryFdPropertiesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryFdPropertiesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryFdPropertiesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryFdPropertiesKHR;
+	if (__info.replace && __info.replace->vkGetMemoryFdPropertiesKHR) {
+		__fn = __info.replace->vkGetMemoryFdPropertiesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryFdPropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryFdPropertiesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, handleType, fd, pMemoryFdProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryFdPropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryFdPropertiesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4825,24 +5111,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryFdPropertiesKHR(VkDevice d
 #if defined(VK_KHR_external_semaphore_win32)
 
 static VkResult xl_hook_tl_deviceHookTable_vkImportSemaphoreWin32HandleKHR(VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) {
-	auto __fn = tl_deviceHookTable.table->vkImportSemaphoreWin32HandleKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkImportSemaphoreWin32HandleKHR) {
-		__fn = tl_deviceHookTable.replace->vkImportSemaphoreWin32HandleKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkImportSemaphoreWin32HandleKHR;
+	if (__info.replace && __info.replace->vkImportSemaphoreWin32HandleKHR) {
+		__fn = __info.replace->vkImportSemaphoreWin32HandleKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkImportSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkImportSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pImportSemaphoreWin32HandleInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkImportSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkImportSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetSemaphoreWin32HandleKHR(VkDevice device, const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
-	auto __fn = tl_deviceHookTable.table->vkGetSemaphoreWin32HandleKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetSemaphoreWin32HandleKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetSemaphoreWin32HandleKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetSemaphoreWin32HandleKHR;
+	if (__info.replace && __info.replace->vkGetSemaphoreWin32HandleKHR) {
+		__fn = __info.replace->vkGetSemaphoreWin32HandleKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pGetWin32HandleInfo, pHandle);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4851,24 +5139,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetSemaphoreWin32HandleKHR(VkDevice
 #if defined(VK_KHR_external_semaphore_fd)
 
 static VkResult xl_hook_tl_deviceHookTable_vkImportSemaphoreFdKHR(VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) {
-	auto __fn = tl_deviceHookTable.table->vkImportSemaphoreFdKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkImportSemaphoreFdKHR) {
-		__fn = tl_deviceHookTable.replace->vkImportSemaphoreFdKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkImportSemaphoreFdKHR;
+	if (__info.replace && __info.replace->vkImportSemaphoreFdKHR) {
+		__fn = __info.replace->vkImportSemaphoreFdKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkImportSemaphoreFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkImportSemaphoreFdKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pImportSemaphoreFdInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkImportSemaphoreFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkImportSemaphoreFdKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) {
-	auto __fn = tl_deviceHookTable.table->vkGetSemaphoreFdKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetSemaphoreFdKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetSemaphoreFdKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetSemaphoreFdKHR;
+	if (__info.replace && __info.replace->vkGetSemaphoreFdKHR) {
+		__fn = __info.replace->vkGetSemaphoreFdKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetSemaphoreFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetSemaphoreFdKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pGetFdInfo, pFd);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetSemaphoreFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetSemaphoreFdKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -4877,13 +5167,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetSemaphoreFdKHR(VkDevice device,
 #if defined(VK_KHR_push_descriptor)
 
 static void xl_hook_tl_deviceHookTable_vkCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) {
-	auto __fn = tl_deviceHookTable.table->vkCmdPushDescriptorSetKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdPushDescriptorSetKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdPushDescriptorSetKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdPushDescriptorSetKHR;
+	if (__info.replace && __info.replace->vkCmdPushDescriptorSetKHR) {
+		__fn = __info.replace->vkCmdPushDescriptorSetKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdPushDescriptorSetKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdPushDescriptorSetKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdPushDescriptorSetKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdPushDescriptorSetKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_push_descriptor) */
@@ -4891,13 +5182,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdPushDescriptorSetKHR(VkCommandBuffer
 #if (defined(VK_KHR_push_descriptor) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)) || (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor))
 
 static void xl_hook_tl_deviceHookTable_vkCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkCmdPushDescriptorSetWithTemplateKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdPushDescriptorSetWithTemplateKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdPushDescriptorSetWithTemplateKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdPushDescriptorSetWithTemplateKHR;
+	if (__info.replace && __info.replace->vkCmdPushDescriptorSetWithTemplateKHR) {
+		__fn = __info.replace->vkCmdPushDescriptorSetWithTemplateKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdPushDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdPushDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdPushDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdPushDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* (defined(VK_KHR_push_descriptor) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)) || (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) */
@@ -4905,23 +5197,25 @@ static void xl_hook_tl_deviceHookTable_vkCmdPushDescriptorSetWithTemplateKHR(VkC
 #if defined(VK_EXT_conditional_rendering)
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginConditionalRenderingEXT(VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginConditionalRenderingEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginConditionalRenderingEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginConditionalRenderingEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginConditionalRenderingEXT;
+	if (__info.replace && __info.replace->vkCmdBeginConditionalRenderingEXT) {
+		__fn = __info.replace->vkCmdBeginConditionalRenderingEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginConditionalRenderingEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginConditionalRenderingEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pConditionalRenderingBegin);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginConditionalRenderingEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginConditionalRenderingEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndConditionalRenderingEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndConditionalRenderingEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndConditionalRenderingEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndConditionalRenderingEXT;
+	if (__info.replace && __info.replace->vkCmdEndConditionalRenderingEXT) {
+		__fn = __info.replace->vkCmdEndConditionalRenderingEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndConditionalRenderingEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndConditionalRenderingEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndConditionalRenderingEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndConditionalRenderingEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_conditional_rendering) */
@@ -4929,34 +5223,37 @@ static void xl_hook_tl_deviceHookTable_vkCmdEndConditionalRenderingEXT(VkCommand
 #if defined(VK_KHR_descriptor_update_template)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateDescriptorUpdateTemplateKHR(VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplateKHR* pDescriptorUpdateTemplate) {
-	auto __fn = tl_deviceHookTable.table->vkCreateDescriptorUpdateTemplateKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateDescriptorUpdateTemplateKHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateDescriptorUpdateTemplateKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateDescriptorUpdateTemplateKHR;
+	if (__info.replace && __info.replace->vkCreateDescriptorUpdateTemplateKHR) {
+		__fn = __info.replace->vkCreateDescriptorUpdateTemplateKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyDescriptorUpdateTemplateKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyDescriptorUpdateTemplateKHR) {
-		__fn = tl_deviceHookTable.replace->vkDestroyDescriptorUpdateTemplateKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyDescriptorUpdateTemplateKHR;
+	if (__info.replace && __info.replace->vkDestroyDescriptorUpdateTemplateKHR) {
+		__fn = __info.replace->vkDestroyDescriptorUpdateTemplateKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, descriptorUpdateTemplate, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkUpdateDescriptorSetWithTemplateKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkUpdateDescriptorSetWithTemplateKHR) {
-		__fn = tl_deviceHookTable.replace->vkUpdateDescriptorSetWithTemplateKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkUpdateDescriptorSetWithTemplateKHR;
+	if (__info.replace && __info.replace->vkUpdateDescriptorSetWithTemplateKHR) {
+		__fn = __info.replace->vkUpdateDescriptorSetWithTemplateKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkUpdateDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkUpdateDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, descriptorSet, descriptorUpdateTemplate, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkUpdateDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkUpdateDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_descriptor_update_template) */
@@ -4964,13 +5261,14 @@ static void xl_hook_tl_deviceHookTable_vkUpdateDescriptorSetWithTemplateKHR(VkDe
 #if defined(VK_NV_clip_space_w_scaling)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV* pViewportWScalings) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetViewportWScalingNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetViewportWScalingNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetViewportWScalingNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetViewportWScalingNV;
+	if (__info.replace && __info.replace->vkCmdSetViewportWScalingNV) {
+		__fn = __info.replace->vkCmdSetViewportWScalingNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetViewportWScalingNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetViewportWScalingNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetViewportWScalingNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetViewportWScalingNV", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_NV_clip_space_w_scaling) */
@@ -4978,46 +5276,50 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetViewportWScalingNV(VkCommandBuffe
 #if defined(VK_EXT_display_control)
 
 static VkResult xl_hook_tl_deviceHookTable_vkDisplayPowerControlEXT(VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo) {
-	auto __fn = tl_deviceHookTable.table->vkDisplayPowerControlEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDisplayPowerControlEXT) {
-		__fn = tl_deviceHookTable.replace->vkDisplayPowerControlEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDisplayPowerControlEXT;
+	if (__info.replace && __info.replace->vkDisplayPowerControlEXT) {
+		__fn = __info.replace->vkDisplayPowerControlEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDisplayPowerControlEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDisplayPowerControlEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, display, pDisplayPowerInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDisplayPowerControlEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDisplayPowerControlEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkRegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
-	auto __fn = tl_deviceHookTable.table->vkRegisterDeviceEventEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkRegisterDeviceEventEXT) {
-		__fn = tl_deviceHookTable.replace->vkRegisterDeviceEventEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkRegisterDeviceEventEXT;
+	if (__info.replace && __info.replace->vkRegisterDeviceEventEXT) {
+		__fn = __info.replace->vkRegisterDeviceEventEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkRegisterDeviceEventEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkRegisterDeviceEventEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pDeviceEventInfo, pAllocator, pFence);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkRegisterDeviceEventEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkRegisterDeviceEventEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkRegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
-	auto __fn = tl_deviceHookTable.table->vkRegisterDisplayEventEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkRegisterDisplayEventEXT) {
-		__fn = tl_deviceHookTable.replace->vkRegisterDisplayEventEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkRegisterDisplayEventEXT;
+	if (__info.replace && __info.replace->vkRegisterDisplayEventEXT) {
+		__fn = __info.replace->vkRegisterDisplayEventEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkRegisterDisplayEventEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkRegisterDisplayEventEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, display, pDisplayEventInfo, pAllocator, pFence);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkRegisterDisplayEventEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkRegisterDisplayEventEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) {
-	auto __fn = tl_deviceHookTable.table->vkGetSwapchainCounterEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetSwapchainCounterEXT) {
-		__fn = tl_deviceHookTable.replace->vkGetSwapchainCounterEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetSwapchainCounterEXT;
+	if (__info.replace && __info.replace->vkGetSwapchainCounterEXT) {
+		__fn = __info.replace->vkGetSwapchainCounterEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetSwapchainCounterEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetSwapchainCounterEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchain, counter, pCounterValue);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetSwapchainCounterEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetSwapchainCounterEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5026,24 +5328,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetSwapchainCounterEXT(VkDevice dev
 #if defined(VK_GOOGLE_display_timing)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetRefreshCycleDurationGOOGLE;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetRefreshCycleDurationGOOGLE) {
-		__fn = tl_deviceHookTable.replace->vkGetRefreshCycleDurationGOOGLE;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetRefreshCycleDurationGOOGLE;
+	if (__info.replace && __info.replace->vkGetRefreshCycleDurationGOOGLE) {
+		__fn = __info.replace->vkGetRefreshCycleDurationGOOGLE;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetRefreshCycleDurationGOOGLE", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetRefreshCycleDurationGOOGLE", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchain, pDisplayTimingProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetRefreshCycleDurationGOOGLE", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetRefreshCycleDurationGOOGLE", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetPastPresentationTimingGOOGLE(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings) {
-	auto __fn = tl_deviceHookTable.table->vkGetPastPresentationTimingGOOGLE;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetPastPresentationTimingGOOGLE) {
-		__fn = tl_deviceHookTable.replace->vkGetPastPresentationTimingGOOGLE;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetPastPresentationTimingGOOGLE;
+	if (__info.replace && __info.replace->vkGetPastPresentationTimingGOOGLE) {
+		__fn = __info.replace->vkGetPastPresentationTimingGOOGLE;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetPastPresentationTimingGOOGLE", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetPastPresentationTimingGOOGLE", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchain, pPresentationTimingCount, pPresentationTimings);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetPastPresentationTimingGOOGLE", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetPastPresentationTimingGOOGLE", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5052,13 +5356,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetPastPresentationTimingGOOGLE(VkD
 #if defined(VK_EXT_discard_rectangles)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDiscardRectangleEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDiscardRectangleEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDiscardRectangleEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDiscardRectangleEXT;
+	if (__info.replace && __info.replace->vkCmdSetDiscardRectangleEXT) {
+		__fn = __info.replace->vkCmdSetDiscardRectangleEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDiscardRectangleEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDiscardRectangleEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDiscardRectangleEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDiscardRectangleEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_discard_rectangles) */
@@ -5066,13 +5371,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetDiscardRectangleEXT(VkCommandBuff
 #if defined(VK_EXT_hdr_metadata)
 
 static void xl_hook_tl_deviceHookTable_vkSetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata) {
-	auto __fn = tl_deviceHookTable.table->vkSetHdrMetadataEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSetHdrMetadataEXT) {
-		__fn = tl_deviceHookTable.replace->vkSetHdrMetadataEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSetHdrMetadataEXT;
+	if (__info.replace && __info.replace->vkSetHdrMetadataEXT) {
+		__fn = __info.replace->vkSetHdrMetadataEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSetHdrMetadataEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSetHdrMetadataEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(device, swapchainCount, pSwapchains, pMetadata);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSetHdrMetadataEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSetHdrMetadataEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_hdr_metadata) */
@@ -5080,44 +5386,48 @@ static void xl_hook_tl_deviceHookTable_vkSetHdrMetadataEXT(VkDevice device, uint
 #if defined(VK_KHR_create_renderpass2)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
-	auto __fn = tl_deviceHookTable.table->vkCreateRenderPass2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateRenderPass2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateRenderPass2KHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateRenderPass2KHR;
+	if (__info.replace && __info.replace->vkCreateRenderPass2KHR) {
+		__fn = __info.replace->vkCreateRenderPass2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pRenderPass);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfoKHR* pSubpassBeginInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBeginRenderPass2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBeginRenderPass2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdBeginRenderPass2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBeginRenderPass2KHR;
+	if (__info.replace && __info.replace->vkCmdBeginRenderPass2KHR) {
+		__fn = __info.replace->vkCmdBeginRenderPass2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBeginRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBeginRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBeginRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBeginRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfoKHR* pSubpassBeginInfo, const VkSubpassEndInfoKHR* pSubpassEndInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdNextSubpass2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdNextSubpass2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdNextSubpass2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdNextSubpass2KHR;
+	if (__info.replace && __info.replace->vkCmdNextSubpass2KHR) {
+		__fn = __info.replace->vkCmdNextSubpass2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdNextSubpass2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdNextSubpass2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdNextSubpass2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdNextSubpass2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfoKHR* pSubpassEndInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEndRenderPass2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEndRenderPass2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdEndRenderPass2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEndRenderPass2KHR;
+	if (__info.replace && __info.replace->vkCmdEndRenderPass2KHR) {
+		__fn = __info.replace->vkCmdEndRenderPass2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEndRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEndRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pSubpassEndInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEndRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEndRenderPass2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_create_renderpass2) */
@@ -5125,13 +5435,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdEndRenderPass2KHR(VkCommandBuffer co
 #if defined(VK_KHR_shared_presentable_image)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain) {
-	auto __fn = tl_deviceHookTable.table->vkGetSwapchainStatusKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetSwapchainStatusKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetSwapchainStatusKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetSwapchainStatusKHR;
+	if (__info.replace && __info.replace->vkGetSwapchainStatusKHR) {
+		__fn = __info.replace->vkGetSwapchainStatusKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetSwapchainStatusKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetSwapchainStatusKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchain);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetSwapchainStatusKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetSwapchainStatusKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5140,24 +5451,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetSwapchainStatusKHR(VkDevice devi
 #if defined(VK_KHR_external_fence_win32)
 
 static VkResult xl_hook_tl_deviceHookTable_vkImportFenceWin32HandleKHR(VkDevice device, const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) {
-	auto __fn = tl_deviceHookTable.table->vkImportFenceWin32HandleKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkImportFenceWin32HandleKHR) {
-		__fn = tl_deviceHookTable.replace->vkImportFenceWin32HandleKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkImportFenceWin32HandleKHR;
+	if (__info.replace && __info.replace->vkImportFenceWin32HandleKHR) {
+		__fn = __info.replace->vkImportFenceWin32HandleKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkImportFenceWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkImportFenceWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pImportFenceWin32HandleInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkImportFenceWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkImportFenceWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetFenceWin32HandleKHR(VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
-	auto __fn = tl_deviceHookTable.table->vkGetFenceWin32HandleKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetFenceWin32HandleKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetFenceWin32HandleKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetFenceWin32HandleKHR;
+	if (__info.replace && __info.replace->vkGetFenceWin32HandleKHR) {
+		__fn = __info.replace->vkGetFenceWin32HandleKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetFenceWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetFenceWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pGetWin32HandleInfo, pHandle);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetFenceWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetFenceWin32HandleKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5166,24 +5479,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetFenceWin32HandleKHR(VkDevice dev
 #if defined(VK_KHR_external_fence_fd)
 
 static VkResult xl_hook_tl_deviceHookTable_vkImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo) {
-	auto __fn = tl_deviceHookTable.table->vkImportFenceFdKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkImportFenceFdKHR) {
-		__fn = tl_deviceHookTable.replace->vkImportFenceFdKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkImportFenceFdKHR;
+	if (__info.replace && __info.replace->vkImportFenceFdKHR) {
+		__fn = __info.replace->vkImportFenceFdKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkImportFenceFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkImportFenceFdKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pImportFenceFdInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkImportFenceFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkImportFenceFdKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) {
-	auto __fn = tl_deviceHookTable.table->vkGetFenceFdKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetFenceFdKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetFenceFdKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetFenceFdKHR;
+	if (__info.replace && __info.replace->vkGetFenceFdKHR) {
+		__fn = __info.replace->vkGetFenceFdKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetFenceFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetFenceFdKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pGetFdInfo, pFd);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetFenceFdKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetFenceFdKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5192,24 +5507,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetFenceFdKHR(VkDevice device, cons
 #if defined(VK_KHR_performance_query)
 
 static VkResult xl_hook_tl_deviceHookTable_vkAcquireProfilingLockKHR(VkDevice device, const VkAcquireProfilingLockInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkAcquireProfilingLockKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkAcquireProfilingLockKHR) {
-		__fn = tl_deviceHookTable.replace->vkAcquireProfilingLockKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkAcquireProfilingLockKHR;
+	if (__info.replace && __info.replace->vkAcquireProfilingLockKHR) {
+		__fn = __info.replace->vkAcquireProfilingLockKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkAcquireProfilingLockKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkAcquireProfilingLockKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkAcquireProfilingLockKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkAcquireProfilingLockKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkReleaseProfilingLockKHR(VkDevice device) {
-	auto __fn = tl_deviceHookTable.table->vkReleaseProfilingLockKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkReleaseProfilingLockKHR) {
-		__fn = tl_deviceHookTable.replace->vkReleaseProfilingLockKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkReleaseProfilingLockKHR;
+	if (__info.replace && __info.replace->vkReleaseProfilingLockKHR) {
+		__fn = __info.replace->vkReleaseProfilingLockKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkReleaseProfilingLockKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkReleaseProfilingLockKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkReleaseProfilingLockKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkReleaseProfilingLockKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_performance_query) */
@@ -5217,24 +5534,26 @@ static void xl_hook_tl_deviceHookTable_vkReleaseProfilingLockKHR(VkDevice device
 #if defined(VK_ANDROID_external_memory_android_hardware_buffer)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetAndroidHardwareBufferPropertiesANDROID(VkDevice device, const struct AHardwareBuffer* buffer, VkAndroidHardwareBufferPropertiesANDROID* pProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetAndroidHardwareBufferPropertiesANDROID;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetAndroidHardwareBufferPropertiesANDROID) {
-		__fn = tl_deviceHookTable.replace->vkGetAndroidHardwareBufferPropertiesANDROID;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetAndroidHardwareBufferPropertiesANDROID;
+	if (__info.replace && __info.replace->vkGetAndroidHardwareBufferPropertiesANDROID) {
+		__fn = __info.replace->vkGetAndroidHardwareBufferPropertiesANDROID;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetAndroidHardwareBufferPropertiesANDROID", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetAndroidHardwareBufferPropertiesANDROID", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, buffer, pProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetAndroidHardwareBufferPropertiesANDROID", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetAndroidHardwareBufferPropertiesANDROID", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryAndroidHardwareBufferANDROID(VkDevice device, const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo, struct AHardwareBuffer** pBuffer) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryAndroidHardwareBufferANDROID;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryAndroidHardwareBufferANDROID) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryAndroidHardwareBufferANDROID;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryAndroidHardwareBufferANDROID;
+	if (__info.replace && __info.replace->vkGetMemoryAndroidHardwareBufferANDROID) {
+		__fn = __info.replace->vkGetMemoryAndroidHardwareBufferANDROID;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryAndroidHardwareBufferANDROID", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryAndroidHardwareBufferANDROID", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo, pBuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryAndroidHardwareBufferANDROID", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryAndroidHardwareBufferANDROID", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5243,13 +5562,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryAndroidHardwareBufferANDRO
 #if defined(VK_EXT_sample_locations)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetSampleLocationsEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetSampleLocationsEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetSampleLocationsEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetSampleLocationsEXT;
+	if (__info.replace && __info.replace->vkCmdSetSampleLocationsEXT) {
+		__fn = __info.replace->vkCmdSetSampleLocationsEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetSampleLocationsEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetSampleLocationsEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pSampleLocationsInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetSampleLocationsEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetSampleLocationsEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_sample_locations) */
@@ -5257,33 +5577,36 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetSampleLocationsEXT(VkCommandBuffe
 #if defined(VK_KHR_get_memory_requirements2)
 
 static void xl_hook_tl_deviceHookTable_vkGetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageMemoryRequirements2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageMemoryRequirements2KHR) {
-		__fn = tl_deviceHookTable.replace->vkGetImageMemoryRequirements2KHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageMemoryRequirements2KHR;
+	if (__info.replace && __info.replace->vkGetImageMemoryRequirements2KHR) {
+		__fn = __info.replace->vkGetImageMemoryRequirements2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetBufferMemoryRequirements2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetBufferMemoryRequirements2KHR) {
-		__fn = tl_deviceHookTable.replace->vkGetBufferMemoryRequirements2KHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetBufferMemoryRequirements2KHR;
+	if (__info.replace && __info.replace->vkGetBufferMemoryRequirements2KHR) {
+		__fn = __info.replace->vkGetBufferMemoryRequirements2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetBufferMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetBufferMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetBufferMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetBufferMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetImageSparseMemoryRequirements2KHR(VkDevice device, const VkImageSparseMemoryRequirementsInfo2KHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageSparseMemoryRequirements2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageSparseMemoryRequirements2KHR) {
-		__fn = tl_deviceHookTable.replace->vkGetImageSparseMemoryRequirements2KHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageSparseMemoryRequirements2KHR;
+	if (__info.replace && __info.replace->vkGetImageSparseMemoryRequirements2KHR) {
+		__fn = __info.replace->vkGetImageSparseMemoryRequirements2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageSparseMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageSparseMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageSparseMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageSparseMemoryRequirements2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_get_memory_requirements2) */
@@ -5291,170 +5614,186 @@ static void xl_hook_tl_deviceHookTable_vkGetImageSparseMemoryRequirements2KHR(Vk
 #if defined(VK_KHR_acceleration_structure)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateAccelerationStructureKHR(VkDevice device, const VkAccelerationStructureCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureKHR* pAccelerationStructure) {
-	auto __fn = tl_deviceHookTable.table->vkCreateAccelerationStructureKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateAccelerationStructureKHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateAccelerationStructureKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateAccelerationStructureKHR;
+	if (__info.replace && __info.replace->vkCreateAccelerationStructureKHR) {
+		__fn = __info.replace->vkCreateAccelerationStructureKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pAccelerationStructure);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyAccelerationStructureKHR(VkDevice device, VkAccelerationStructureKHR accelerationStructure, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyAccelerationStructureKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyAccelerationStructureKHR) {
-		__fn = tl_deviceHookTable.replace->vkDestroyAccelerationStructureKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyAccelerationStructureKHR;
+	if (__info.replace && __info.replace->vkDestroyAccelerationStructureKHR) {
+		__fn = __info.replace->vkDestroyAccelerationStructureKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, accelerationStructure, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBuildAccelerationStructuresKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBuildAccelerationStructuresKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdBuildAccelerationStructuresKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBuildAccelerationStructuresKHR;
+	if (__info.replace && __info.replace->vkCmdBuildAccelerationStructuresKHR) {
+		__fn = __info.replace->vkCmdBuildAccelerationStructuresKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBuildAccelerationStructuresKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBuildAccelerationStructuresKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBuildAccelerationStructuresKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBuildAccelerationStructuresKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkDeviceAddress* pIndirectDeviceAddresses, const uint32_t* pIndirectStrides, const uint32_t* const*             ppMaxPrimitiveCounts) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBuildAccelerationStructuresIndirectKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBuildAccelerationStructuresIndirectKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdBuildAccelerationStructuresIndirectKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBuildAccelerationStructuresIndirectKHR;
+	if (__info.replace && __info.replace->vkCmdBuildAccelerationStructuresIndirectKHR) {
+		__fn = __info.replace->vkCmdBuildAccelerationStructuresIndirectKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBuildAccelerationStructuresIndirectKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBuildAccelerationStructuresIndirectKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBuildAccelerationStructuresIndirectKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBuildAccelerationStructuresIndirectKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkBuildAccelerationStructuresKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
-	auto __fn = tl_deviceHookTable.table->vkBuildAccelerationStructuresKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBuildAccelerationStructuresKHR) {
-		__fn = tl_deviceHookTable.replace->vkBuildAccelerationStructuresKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkBuildAccelerationStructuresKHR;
+	if (__info.replace && __info.replace->vkBuildAccelerationStructuresKHR) {
+		__fn = __info.replace->vkBuildAccelerationStructuresKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBuildAccelerationStructuresKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBuildAccelerationStructuresKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBuildAccelerationStructuresKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBuildAccelerationStructuresKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCopyAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCopyAccelerationStructureKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCopyAccelerationStructureKHR) {
-		__fn = tl_deviceHookTable.replace->vkCopyAccelerationStructureKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCopyAccelerationStructureKHR;
+	if (__info.replace && __info.replace->vkCopyAccelerationStructureKHR) {
+		__fn = __info.replace->vkCopyAccelerationStructureKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCopyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCopyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, deferredOperation, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCopyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCopyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCopyAccelerationStructureToMemoryKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCopyAccelerationStructureToMemoryKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCopyAccelerationStructureToMemoryKHR) {
-		__fn = tl_deviceHookTable.replace->vkCopyAccelerationStructureToMemoryKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCopyAccelerationStructureToMemoryKHR;
+	if (__info.replace && __info.replace->vkCopyAccelerationStructureToMemoryKHR) {
+		__fn = __info.replace->vkCopyAccelerationStructureToMemoryKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCopyAccelerationStructureToMemoryKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCopyAccelerationStructureToMemoryKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, deferredOperation, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCopyAccelerationStructureToMemoryKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCopyAccelerationStructureToMemoryKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCopyMemoryToAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCopyMemoryToAccelerationStructureKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCopyMemoryToAccelerationStructureKHR) {
-		__fn = tl_deviceHookTable.replace->vkCopyMemoryToAccelerationStructureKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCopyMemoryToAccelerationStructureKHR;
+	if (__info.replace && __info.replace->vkCopyMemoryToAccelerationStructureKHR) {
+		__fn = __info.replace->vkCopyMemoryToAccelerationStructureKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCopyMemoryToAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCopyMemoryToAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, deferredOperation, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCopyMemoryToAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCopyMemoryToAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkWriteAccelerationStructuresPropertiesKHR(VkDevice device, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, size_t dataSize, void* pData, size_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkWriteAccelerationStructuresPropertiesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkWriteAccelerationStructuresPropertiesKHR) {
-		__fn = tl_deviceHookTable.replace->vkWriteAccelerationStructuresPropertiesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkWriteAccelerationStructuresPropertiesKHR;
+	if (__info.replace && __info.replace->vkWriteAccelerationStructuresPropertiesKHR) {
+		__fn = __info.replace->vkWriteAccelerationStructuresPropertiesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkWriteAccelerationStructuresPropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkWriteAccelerationStructuresPropertiesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkWriteAccelerationStructuresPropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkWriteAccelerationStructuresPropertiesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyAccelerationStructureKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyAccelerationStructureKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyAccelerationStructureKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyAccelerationStructureKHR;
+	if (__info.replace && __info.replace->vkCmdCopyAccelerationStructureKHR) {
+		__fn = __info.replace->vkCmdCopyAccelerationStructureKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyAccelerationStructureToMemoryKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyAccelerationStructureToMemoryKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyAccelerationStructureToMemoryKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyAccelerationStructureToMemoryKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyAccelerationStructureToMemoryKHR;
+	if (__info.replace && __info.replace->vkCmdCopyAccelerationStructureToMemoryKHR) {
+		__fn = __info.replace->vkCmdCopyAccelerationStructureToMemoryKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyAccelerationStructureToMemoryKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyAccelerationStructureToMemoryKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyAccelerationStructureToMemoryKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyAccelerationStructureToMemoryKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyMemoryToAccelerationStructureKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyMemoryToAccelerationStructureKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyMemoryToAccelerationStructureKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyMemoryToAccelerationStructureKHR;
+	if (__info.replace && __info.replace->vkCmdCopyMemoryToAccelerationStructureKHR) {
+		__fn = __info.replace->vkCmdCopyMemoryToAccelerationStructureKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyMemoryToAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyMemoryToAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyMemoryToAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyMemoryToAccelerationStructureKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkDeviceAddress xl_hook_tl_deviceHookTable_vkGetAccelerationStructureDeviceAddressKHR(VkDevice device, const VkAccelerationStructureDeviceAddressInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetAccelerationStructureDeviceAddressKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetAccelerationStructureDeviceAddressKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetAccelerationStructureDeviceAddressKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetAccelerationStructureDeviceAddressKHR;
+	if (__info.replace && __info.replace->vkGetAccelerationStructureDeviceAddressKHR) {
+		__fn = __info.replace->vkGetAccelerationStructureDeviceAddressKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetAccelerationStructureDeviceAddressKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetAccelerationStructureDeviceAddressKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetAccelerationStructureDeviceAddressKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetAccelerationStructureDeviceAddressKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWriteAccelerationStructuresPropertiesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWriteAccelerationStructuresPropertiesKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdWriteAccelerationStructuresPropertiesKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWriteAccelerationStructuresPropertiesKHR;
+	if (__info.replace && __info.replace->vkCmdWriteAccelerationStructuresPropertiesKHR) {
+		__fn = __info.replace->vkCmdWriteAccelerationStructuresPropertiesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWriteAccelerationStructuresPropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWriteAccelerationStructuresPropertiesKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWriteAccelerationStructuresPropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWriteAccelerationStructuresPropertiesKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceAccelerationStructureCompatibilityKHR(VkDevice device, const VkAccelerationStructureVersionInfoKHR* pVersionInfo, VkAccelerationStructureCompatibilityKHR* pCompatibility) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceAccelerationStructureCompatibilityKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceAccelerationStructureCompatibilityKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceAccelerationStructureCompatibilityKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceAccelerationStructureCompatibilityKHR;
+	if (__info.replace && __info.replace->vkGetDeviceAccelerationStructureCompatibilityKHR) {
+		__fn = __info.replace->vkGetDeviceAccelerationStructureCompatibilityKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceAccelerationStructureCompatibilityKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceAccelerationStructureCompatibilityKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pVersionInfo, pCompatibility);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceAccelerationStructureCompatibilityKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceAccelerationStructureCompatibilityKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetAccelerationStructureBuildSizesKHR(VkDevice device, VkAccelerationStructureBuildTypeKHR buildType, const VkAccelerationStructureBuildGeometryInfoKHR* pBuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR* pSizeInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetAccelerationStructureBuildSizesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetAccelerationStructureBuildSizesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetAccelerationStructureBuildSizesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetAccelerationStructureBuildSizesKHR;
+	if (__info.replace && __info.replace->vkGetAccelerationStructureBuildSizesKHR) {
+		__fn = __info.replace->vkGetAccelerationStructureBuildSizesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetAccelerationStructureBuildSizesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetAccelerationStructureBuildSizesKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetAccelerationStructureBuildSizesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetAccelerationStructureBuildSizesKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_acceleration_structure) */
@@ -5462,77 +5801,84 @@ static void xl_hook_tl_deviceHookTable_vkGetAccelerationStructureBuildSizesKHR(V
 #if defined(VK_KHR_ray_tracing_pipeline)
 
 static void xl_hook_tl_deviceHookTable_vkCmdTraceRaysKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, uint32_t width, uint32_t height, uint32_t depth) {
-	auto __fn = tl_deviceHookTable.table->vkCmdTraceRaysKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdTraceRaysKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdTraceRaysKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdTraceRaysKHR;
+	if (__info.replace && __info.replace->vkCmdTraceRaysKHR) {
+		__fn = __info.replace->vkCmdTraceRaysKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdTraceRaysKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdTraceRaysKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdTraceRaysKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdTraceRaysKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateRayTracingPipelinesKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-	auto __fn = tl_deviceHookTable.table->vkCreateRayTracingPipelinesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateRayTracingPipelinesKHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateRayTracingPipelinesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateRayTracingPipelinesKHR;
+	if (__info.replace && __info.replace->vkCreateRayTracingPipelinesKHR) {
+		__fn = __info.replace->vkCreateRayTracingPipelinesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateRayTracingPipelinesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateRayTracingPipelinesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateRayTracingPipelinesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateRayTracingPipelinesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetRayTracingShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkGetRayTracingShaderGroupHandlesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetRayTracingShaderGroupHandlesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetRayTracingShaderGroupHandlesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetRayTracingShaderGroupHandlesKHR;
+	if (__info.replace && __info.replace->vkGetRayTracingShaderGroupHandlesKHR) {
+		__fn = __info.replace->vkGetRayTracingShaderGroupHandlesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetRayTracingShaderGroupHandlesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetRayTracingShaderGroupHandlesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipeline, firstGroup, groupCount, dataSize, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetRayTracingShaderGroupHandlesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetRayTracingShaderGroupHandlesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+	if (__info.replace && __info.replace->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR) {
+		__fn = __info.replace->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipeline, firstGroup, groupCount, dataSize, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress) {
-	auto __fn = tl_deviceHookTable.table->vkCmdTraceRaysIndirectKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdTraceRaysIndirectKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdTraceRaysIndirectKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdTraceRaysIndirectKHR;
+	if (__info.replace && __info.replace->vkCmdTraceRaysIndirectKHR) {
+		__fn = __info.replace->vkCmdTraceRaysIndirectKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdTraceRaysIndirectKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdTraceRaysIndirectKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdTraceRaysIndirectKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdTraceRaysIndirectKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkDeviceSize xl_hook_tl_deviceHookTable_vkGetRayTracingShaderGroupStackSizeKHR(VkDevice device, VkPipeline pipeline, uint32_t group, VkShaderGroupShaderKHR groupShader) {
-	auto __fn = tl_deviceHookTable.table->vkGetRayTracingShaderGroupStackSizeKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetRayTracingShaderGroupStackSizeKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetRayTracingShaderGroupStackSizeKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetRayTracingShaderGroupStackSizeKHR;
+	if (__info.replace && __info.replace->vkGetRayTracingShaderGroupStackSizeKHR) {
+		__fn = __info.replace->vkGetRayTracingShaderGroupStackSizeKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetRayTracingShaderGroupStackSizeKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetRayTracingShaderGroupStackSizeKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipeline, group, groupShader);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetRayTracingShaderGroupStackSizeKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetRayTracingShaderGroupStackSizeKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer, uint32_t pipelineStackSize) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetRayTracingPipelineStackSizeKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetRayTracingPipelineStackSizeKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetRayTracingPipelineStackSizeKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetRayTracingPipelineStackSizeKHR;
+	if (__info.replace && __info.replace->vkCmdSetRayTracingPipelineStackSizeKHR) {
+		__fn = __info.replace->vkCmdSetRayTracingPipelineStackSizeKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetRayTracingPipelineStackSizeKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetRayTracingPipelineStackSizeKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pipelineStackSize);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetRayTracingPipelineStackSizeKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetRayTracingPipelineStackSizeKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_ray_tracing_pipeline) */
@@ -5540,24 +5886,26 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetRayTracingPipelineStackSizeKHR(Vk
 #if defined(VK_KHR_sampler_ycbcr_conversion)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateSamplerYcbcrConversionKHR(VkDevice device, const VkSamplerYcbcrConversionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversionKHR* pYcbcrConversion) {
-	auto __fn = tl_deviceHookTable.table->vkCreateSamplerYcbcrConversionKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateSamplerYcbcrConversionKHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateSamplerYcbcrConversionKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateSamplerYcbcrConversionKHR;
+	if (__info.replace && __info.replace->vkCreateSamplerYcbcrConversionKHR) {
+		__fn = __info.replace->vkCreateSamplerYcbcrConversionKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateSamplerYcbcrConversionKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateSamplerYcbcrConversionKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pYcbcrConversion);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateSamplerYcbcrConversionKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateSamplerYcbcrConversionKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversionKHR ycbcrConversion, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroySamplerYcbcrConversionKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroySamplerYcbcrConversionKHR) {
-		__fn = tl_deviceHookTable.replace->vkDestroySamplerYcbcrConversionKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroySamplerYcbcrConversionKHR;
+	if (__info.replace && __info.replace->vkDestroySamplerYcbcrConversionKHR) {
+		__fn = __info.replace->vkDestroySamplerYcbcrConversionKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroySamplerYcbcrConversionKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroySamplerYcbcrConversionKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, ycbcrConversion, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroySamplerYcbcrConversionKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroySamplerYcbcrConversionKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_sampler_ycbcr_conversion) */
@@ -5565,24 +5913,26 @@ static void xl_hook_tl_deviceHookTable_vkDestroySamplerYcbcrConversionKHR(VkDevi
 #if defined(VK_KHR_bind_memory2)
 
 static VkResult xl_hook_tl_deviceHookTable_vkBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfoKHR* pBindInfos) {
-	auto __fn = tl_deviceHookTable.table->vkBindBufferMemory2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBindBufferMemory2KHR) {
-		__fn = tl_deviceHookTable.replace->vkBindBufferMemory2KHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkBindBufferMemory2KHR;
+	if (__info.replace && __info.replace->vkBindBufferMemory2KHR) {
+		__fn = __info.replace->vkBindBufferMemory2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBindBufferMemory2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBindBufferMemory2KHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, bindInfoCount, pBindInfos);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBindBufferMemory2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBindBufferMemory2KHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfoKHR* pBindInfos) {
-	auto __fn = tl_deviceHookTable.table->vkBindImageMemory2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBindImageMemory2KHR) {
-		__fn = tl_deviceHookTable.replace->vkBindImageMemory2KHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkBindImageMemory2KHR;
+	if (__info.replace && __info.replace->vkBindImageMemory2KHR) {
+		__fn = __info.replace->vkBindImageMemory2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBindImageMemory2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBindImageMemory2KHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, bindInfoCount, pBindInfos);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBindImageMemory2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBindImageMemory2KHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5591,13 +5941,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkBindImageMemory2KHR(VkDevice device
 #if defined(VK_EXT_image_drm_format_modifier)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetImageDrmFormatModifierPropertiesEXT(VkDevice device, VkImage image, VkImageDrmFormatModifierPropertiesEXT* pProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetImageDrmFormatModifierPropertiesEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetImageDrmFormatModifierPropertiesEXT) {
-		__fn = tl_deviceHookTable.replace->vkGetImageDrmFormatModifierPropertiesEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetImageDrmFormatModifierPropertiesEXT;
+	if (__info.replace && __info.replace->vkGetImageDrmFormatModifierPropertiesEXT) {
+		__fn = __info.replace->vkGetImageDrmFormatModifierPropertiesEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetImageDrmFormatModifierPropertiesEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetImageDrmFormatModifierPropertiesEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, image, pProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetImageDrmFormatModifierPropertiesEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetImageDrmFormatModifierPropertiesEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5606,45 +5957,49 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetImageDrmFormatModifierProperties
 #if defined(VK_EXT_validation_cache)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache) {
-	auto __fn = tl_deviceHookTable.table->vkCreateValidationCacheEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateValidationCacheEXT) {
-		__fn = tl_deviceHookTable.replace->vkCreateValidationCacheEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateValidationCacheEXT;
+	if (__info.replace && __info.replace->vkCreateValidationCacheEXT) {
+		__fn = __info.replace->vkCreateValidationCacheEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateValidationCacheEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateValidationCacheEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pValidationCache);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateValidationCacheEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateValidationCacheEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyValidationCacheEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyValidationCacheEXT) {
-		__fn = tl_deviceHookTable.replace->vkDestroyValidationCacheEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyValidationCacheEXT;
+	if (__info.replace && __info.replace->vkDestroyValidationCacheEXT) {
+		__fn = __info.replace->vkDestroyValidationCacheEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyValidationCacheEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyValidationCacheEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(device, validationCache, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyValidationCacheEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyValidationCacheEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkMergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches) {
-	auto __fn = tl_deviceHookTable.table->vkMergeValidationCachesEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkMergeValidationCachesEXT) {
-		__fn = tl_deviceHookTable.replace->vkMergeValidationCachesEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkMergeValidationCachesEXT;
+	if (__info.replace && __info.replace->vkMergeValidationCachesEXT) {
+		__fn = __info.replace->vkMergeValidationCachesEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkMergeValidationCachesEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkMergeValidationCachesEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, dstCache, srcCacheCount, pSrcCaches);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkMergeValidationCachesEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkMergeValidationCachesEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize, void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkGetValidationCacheDataEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetValidationCacheDataEXT) {
-		__fn = tl_deviceHookTable.replace->vkGetValidationCacheDataEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetValidationCacheDataEXT;
+	if (__info.replace && __info.replace->vkGetValidationCacheDataEXT) {
+		__fn = __info.replace->vkGetValidationCacheDataEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetValidationCacheDataEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetValidationCacheDataEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, validationCache, pDataSize, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetValidationCacheDataEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetValidationCacheDataEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5653,33 +6008,36 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetValidationCacheDataEXT(VkDevice
 #if defined(VK_NV_shading_rate_image)
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindShadingRateImageNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindShadingRateImageNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindShadingRateImageNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindShadingRateImageNV;
+	if (__info.replace && __info.replace->vkCmdBindShadingRateImageNV) {
+		__fn = __info.replace->vkCmdBindShadingRateImageNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindShadingRateImageNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindShadingRateImageNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, imageView, imageLayout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindShadingRateImageNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindShadingRateImageNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetViewportShadingRatePaletteNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkShadingRatePaletteNV* pShadingRatePalettes) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetViewportShadingRatePaletteNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetViewportShadingRatePaletteNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetViewportShadingRatePaletteNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetViewportShadingRatePaletteNV;
+	if (__info.replace && __info.replace->vkCmdSetViewportShadingRatePaletteNV) {
+		__fn = __info.replace->vkCmdSetViewportShadingRatePaletteNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetViewportShadingRatePaletteNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetViewportShadingRatePaletteNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetViewportShadingRatePaletteNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetViewportShadingRatePaletteNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuffer, VkCoarseSampleOrderTypeNV sampleOrderType, uint32_t customSampleOrderCount, const VkCoarseSampleOrderCustomNV* pCustomSampleOrders) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetCoarseSampleOrderNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetCoarseSampleOrderNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetCoarseSampleOrderNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetCoarseSampleOrderNV;
+	if (__info.replace && __info.replace->vkCmdSetCoarseSampleOrderNV) {
+		__fn = __info.replace->vkCmdSetCoarseSampleOrderNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetCoarseSampleOrderNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetCoarseSampleOrderNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetCoarseSampleOrderNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetCoarseSampleOrderNV", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_NV_shading_rate_image) */
@@ -5687,128 +6045,140 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetCoarseSampleOrderNV(VkCommandBuff
 #if defined(VK_NV_ray_tracing)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateAccelerationStructureNV(VkDevice device, const VkAccelerationStructureCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureNV* pAccelerationStructure) {
-	auto __fn = tl_deviceHookTable.table->vkCreateAccelerationStructureNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateAccelerationStructureNV) {
-		__fn = tl_deviceHookTable.replace->vkCreateAccelerationStructureNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateAccelerationStructureNV;
+	if (__info.replace && __info.replace->vkCreateAccelerationStructureNV) {
+		__fn = __info.replace->vkCreateAccelerationStructureNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pAccelerationStructure);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyAccelerationStructureNV(VkDevice device, VkAccelerationStructureNV accelerationStructure, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyAccelerationStructureNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyAccelerationStructureNV) {
-		__fn = tl_deviceHookTable.replace->vkDestroyAccelerationStructureNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyAccelerationStructureNV;
+	if (__info.replace && __info.replace->vkDestroyAccelerationStructureNV) {
+		__fn = __info.replace->vkDestroyAccelerationStructureNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
 	__fn(device, accelerationStructure, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetAccelerationStructureMemoryRequirementsNV(VkDevice device, const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetAccelerationStructureMemoryRequirementsNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetAccelerationStructureMemoryRequirementsNV) {
-		__fn = tl_deviceHookTable.replace->vkGetAccelerationStructureMemoryRequirementsNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetAccelerationStructureMemoryRequirementsNV;
+	if (__info.replace && __info.replace->vkGetAccelerationStructureMemoryRequirementsNV) {
+		__fn = __info.replace->vkGetAccelerationStructureMemoryRequirementsNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetAccelerationStructureMemoryRequirementsNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetAccelerationStructureMemoryRequirementsNV", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetAccelerationStructureMemoryRequirementsNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetAccelerationStructureMemoryRequirementsNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkBindAccelerationStructureMemoryNV(VkDevice device, uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoNV* pBindInfos) {
-	auto __fn = tl_deviceHookTable.table->vkBindAccelerationStructureMemoryNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkBindAccelerationStructureMemoryNV) {
-		__fn = tl_deviceHookTable.replace->vkBindAccelerationStructureMemoryNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkBindAccelerationStructureMemoryNV;
+	if (__info.replace && __info.replace->vkBindAccelerationStructureMemoryNV) {
+		__fn = __info.replace->vkBindAccelerationStructureMemoryNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkBindAccelerationStructureMemoryNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkBindAccelerationStructureMemoryNV", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, bindInfoCount, pBindInfos);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkBindAccelerationStructureMemoryNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkBindAccelerationStructureMemoryNV", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBuildAccelerationStructureNV(VkCommandBuffer commandBuffer, const VkAccelerationStructureInfoNV* pInfo, VkBuffer instanceData, VkDeviceSize instanceOffset, VkBool32 update, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkBuffer scratch, VkDeviceSize scratchOffset) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBuildAccelerationStructureNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBuildAccelerationStructureNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdBuildAccelerationStructureNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBuildAccelerationStructureNV;
+	if (__info.replace && __info.replace->vkCmdBuildAccelerationStructureNV) {
+		__fn = __info.replace->vkCmdBuildAccelerationStructureNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBuildAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBuildAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBuildAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBuildAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkCopyAccelerationStructureModeKHR mode) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyAccelerationStructureNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyAccelerationStructureNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyAccelerationStructureNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyAccelerationStructureNV;
+	if (__info.replace && __info.replace->vkCmdCopyAccelerationStructureNV) {
+		__fn = __info.replace->vkCmdCopyAccelerationStructureNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, dst, src, mode);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyAccelerationStructureNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer, VkDeviceSize raygenShaderBindingOffset, VkBuffer missShaderBindingTableBuffer, VkDeviceSize missShaderBindingOffset, VkDeviceSize missShaderBindingStride, VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset, VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer, VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride, uint32_t width, uint32_t height, uint32_t depth) {
-	auto __fn = tl_deviceHookTable.table->vkCmdTraceRaysNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdTraceRaysNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdTraceRaysNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdTraceRaysNV;
+	if (__info.replace && __info.replace->vkCmdTraceRaysNV) {
+		__fn = __info.replace->vkCmdTraceRaysNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdTraceRaysNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdTraceRaysNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdTraceRaysNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdTraceRaysNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateRayTracingPipelinesNV(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-	auto __fn = tl_deviceHookTable.table->vkCreateRayTracingPipelinesNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateRayTracingPipelinesNV) {
-		__fn = tl_deviceHookTable.replace->vkCreateRayTracingPipelinesNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateRayTracingPipelinesNV;
+	if (__info.replace && __info.replace->vkCreateRayTracingPipelinesNV) {
+		__fn = __info.replace->vkCreateRayTracingPipelinesNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateRayTracingPipelinesNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateRayTracingPipelinesNV", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateRayTracingPipelinesNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateRayTracingPipelinesNV", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetRayTracingShaderGroupHandlesNV(VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkGetRayTracingShaderGroupHandlesNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetRayTracingShaderGroupHandlesNV) {
-		__fn = tl_deviceHookTable.replace->vkGetRayTracingShaderGroupHandlesNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetRayTracingShaderGroupHandlesNV;
+	if (__info.replace && __info.replace->vkGetRayTracingShaderGroupHandlesNV) {
+		__fn = __info.replace->vkGetRayTracingShaderGroupHandlesNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetRayTracingShaderGroupHandlesNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetRayTracingShaderGroupHandlesNV", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipeline, firstGroup, groupCount, dataSize, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetRayTracingShaderGroupHandlesNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetRayTracingShaderGroupHandlesNV", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetAccelerationStructureHandleNV(VkDevice device, VkAccelerationStructureNV accelerationStructure, size_t dataSize, void* pData) {
-	auto __fn = tl_deviceHookTable.table->vkGetAccelerationStructureHandleNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetAccelerationStructureHandleNV) {
-		__fn = tl_deviceHookTable.replace->vkGetAccelerationStructureHandleNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetAccelerationStructureHandleNV;
+	if (__info.replace && __info.replace->vkGetAccelerationStructureHandleNV) {
+		__fn = __info.replace->vkGetAccelerationStructureHandleNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetAccelerationStructureHandleNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetAccelerationStructureHandleNV", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, accelerationStructure, dataSize, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetAccelerationStructureHandleNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetAccelerationStructureHandleNV", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdWriteAccelerationStructuresPropertiesNV(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureNV* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWriteAccelerationStructuresPropertiesNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWriteAccelerationStructuresPropertiesNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdWriteAccelerationStructuresPropertiesNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWriteAccelerationStructuresPropertiesNV;
+	if (__info.replace && __info.replace->vkCmdWriteAccelerationStructuresPropertiesNV) {
+		__fn = __info.replace->vkCmdWriteAccelerationStructuresPropertiesNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWriteAccelerationStructuresPropertiesNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWriteAccelerationStructuresPropertiesNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWriteAccelerationStructuresPropertiesNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWriteAccelerationStructuresPropertiesNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCompileDeferredNV(VkDevice device, VkPipeline pipeline, uint32_t shader) {
-	auto __fn = tl_deviceHookTable.table->vkCompileDeferredNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCompileDeferredNV) {
-		__fn = tl_deviceHookTable.replace->vkCompileDeferredNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCompileDeferredNV;
+	if (__info.replace && __info.replace->vkCompileDeferredNV) {
+		__fn = __info.replace->vkCompileDeferredNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCompileDeferredNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCompileDeferredNV", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pipeline, shader);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCompileDeferredNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCompileDeferredNV", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5817,13 +6187,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkCompileDeferredNV(VkDevice device,
 #if defined(VK_KHR_maintenance3)
 
 static void xl_hook_tl_deviceHookTable_vkGetDescriptorSetLayoutSupportKHR(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupportKHR* pSupport) {
-	auto __fn = tl_deviceHookTable.table->vkGetDescriptorSetLayoutSupportKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDescriptorSetLayoutSupportKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDescriptorSetLayoutSupportKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDescriptorSetLayoutSupportKHR;
+	if (__info.replace && __info.replace->vkGetDescriptorSetLayoutSupportKHR) {
+		__fn = __info.replace->vkGetDescriptorSetLayoutSupportKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDescriptorSetLayoutSupportKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDescriptorSetLayoutSupportKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pCreateInfo, pSupport);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDescriptorSetLayoutSupportKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDescriptorSetLayoutSupportKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_maintenance3) */
@@ -5831,23 +6202,25 @@ static void xl_hook_tl_deviceHookTable_vkGetDescriptorSetLayoutSupportKHR(VkDevi
 #if defined(VK_KHR_draw_indirect_count)
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndirectCountKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndirectCountKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndirectCountKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndirectCountKHR;
+	if (__info.replace && __info.replace->vkCmdDrawIndirectCountKHR) {
+		__fn = __info.replace->vkCmdDrawIndirectCountKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirectCountKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndirectCountKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndirectCountKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndirectCountKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawIndexedIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawIndexedIndirectCountKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawIndexedIndirectCountKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawIndexedIndirectCountKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawIndexedIndirectCountKHR;
+	if (__info.replace && __info.replace->vkCmdDrawIndexedIndirectCountKHR) {
+		__fn = __info.replace->vkCmdDrawIndexedIndirectCountKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexedIndirectCountKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawIndexedIndirectCountKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawIndexedIndirectCountKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawIndexedIndirectCountKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_draw_indirect_count) */
@@ -5855,13 +6228,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdDrawIndexedIndirectCountKHR(VkComman
 #if defined(VK_EXT_external_memory_host)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryHostPointerPropertiesEXT(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryHostPointerPropertiesEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryHostPointerPropertiesEXT) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryHostPointerPropertiesEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryHostPointerPropertiesEXT;
+	if (__info.replace && __info.replace->vkGetMemoryHostPointerPropertiesEXT) {
+		__fn = __info.replace->vkGetMemoryHostPointerPropertiesEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryHostPointerPropertiesEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryHostPointerPropertiesEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, handleType, pHostPointer, pMemoryHostPointerProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryHostPointerPropertiesEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryHostPointerPropertiesEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5870,13 +6244,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryHostPointerPropertiesEXT(V
 #if defined(VK_AMD_buffer_marker)
 
 static void xl_hook_tl_deviceHookTable_vkCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWriteBufferMarkerAMD;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWriteBufferMarkerAMD) {
-		__fn = tl_deviceHookTable.replace->vkCmdWriteBufferMarkerAMD;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWriteBufferMarkerAMD;
+	if (__info.replace && __info.replace->vkCmdWriteBufferMarkerAMD) {
+		__fn = __info.replace->vkCmdWriteBufferMarkerAMD;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWriteBufferMarkerAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWriteBufferMarkerAMD", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWriteBufferMarkerAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWriteBufferMarkerAMD", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_AMD_buffer_marker) */
@@ -5884,13 +6259,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdWriteBufferMarkerAMD(VkCommandBuffer
 #if defined(VK_EXT_calibrated_timestamps)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetCalibratedTimestampsEXT(VkDevice device, uint32_t timestampCount, const VkCalibratedTimestampInfoEXT* pTimestampInfos, uint64_t* pTimestamps, uint64_t* pMaxDeviation) {
-	auto __fn = tl_deviceHookTable.table->vkGetCalibratedTimestampsEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetCalibratedTimestampsEXT) {
-		__fn = tl_deviceHookTable.replace->vkGetCalibratedTimestampsEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetCalibratedTimestampsEXT;
+	if (__info.replace && __info.replace->vkGetCalibratedTimestampsEXT) {
+		__fn = __info.replace->vkGetCalibratedTimestampsEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetCalibratedTimestampsEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetCalibratedTimestampsEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetCalibratedTimestampsEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetCalibratedTimestampsEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -5899,33 +6275,36 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetCalibratedTimestampsEXT(VkDevice
 #if defined(VK_NV_mesh_shader)
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawMeshTasksNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawMeshTasksNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawMeshTasksNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawMeshTasksNV;
+	if (__info.replace && __info.replace->vkCmdDrawMeshTasksNV) {
+		__fn = __info.replace->vkCmdDrawMeshTasksNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawMeshTasksNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawMeshTasksNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, taskCount, firstTask);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawMeshTasksNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawMeshTasksNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawMeshTasksIndirectNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawMeshTasksIndirectNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawMeshTasksIndirectNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawMeshTasksIndirectNV;
+	if (__info.replace && __info.replace->vkCmdDrawMeshTasksIndirectNV) {
+		__fn = __info.replace->vkCmdDrawMeshTasksIndirectNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawMeshTasksIndirectNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawMeshTasksIndirectNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, drawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawMeshTasksIndirectNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawMeshTasksIndirectNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawMeshTasksIndirectCountNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawMeshTasksIndirectCountNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawMeshTasksIndirectCountNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawMeshTasksIndirectCountNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawMeshTasksIndirectCountNV;
+	if (__info.replace && __info.replace->vkCmdDrawMeshTasksIndirectCountNV) {
+		__fn = __info.replace->vkCmdDrawMeshTasksIndirectCountNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawMeshTasksIndirectCountNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawMeshTasksIndirectCountNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawMeshTasksIndirectCountNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawMeshTasksIndirectCountNV", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_NV_mesh_shader) */
@@ -5933,13 +6312,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdDrawMeshTasksIndirectCountNV(VkComma
 #if defined(VK_NV_scissor_exclusive)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount, const VkRect2D* pExclusiveScissors) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetExclusiveScissorNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetExclusiveScissorNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetExclusiveScissorNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetExclusiveScissorNV;
+	if (__info.replace && __info.replace->vkCmdSetExclusiveScissorNV) {
+		__fn = __info.replace->vkCmdSetExclusiveScissorNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetExclusiveScissorNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetExclusiveScissorNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetExclusiveScissorNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetExclusiveScissorNV", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_NV_scissor_exclusive) */
@@ -5947,23 +6327,25 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetExclusiveScissorNV(VkCommandBuffe
 #if defined(VK_NV_device_diagnostic_checkpoints)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void* pCheckpointMarker) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetCheckpointNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetCheckpointNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetCheckpointNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetCheckpointNV;
+	if (__info.replace && __info.replace->vkCmdSetCheckpointNV) {
+		__fn = __info.replace->vkCmdSetCheckpointNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetCheckpointNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetCheckpointNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCheckpointMarker);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetCheckpointNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetCheckpointNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetQueueCheckpointDataNV(VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointDataNV* pCheckpointData) {
-	auto __fn = tl_deviceHookTable.table->vkGetQueueCheckpointDataNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetQueueCheckpointDataNV) {
-		__fn = tl_deviceHookTable.replace->vkGetQueueCheckpointDataNV;
+	auto __info = DeviceTable_getHookInfo(queue);
+	auto __fn = __info.table->vkGetQueueCheckpointDataNV;
+	if (__info.replace && __info.replace->vkGetQueueCheckpointDataNV) {
+		__fn = __info.replace->vkGetQueueCheckpointDataNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetQueueCheckpointDataNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetQueueCheckpointDataNV", (PFN_vkVoidFunction)__fn); }
 	__fn(queue, pCheckpointDataCount, pCheckpointData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetQueueCheckpointDataNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetQueueCheckpointDataNV", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_NV_device_diagnostic_checkpoints) */
@@ -5971,35 +6353,38 @@ static void xl_hook_tl_deviceHookTable_vkGetQueueCheckpointDataNV(VkQueue queue,
 #if defined(VK_KHR_timeline_semaphore)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
-	auto __fn = tl_deviceHookTable.table->vkGetSemaphoreCounterValueKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetSemaphoreCounterValueKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetSemaphoreCounterValueKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetSemaphoreCounterValueKHR;
+	if (__info.replace && __info.replace->vkGetSemaphoreCounterValueKHR) {
+		__fn = __info.replace->vkGetSemaphoreCounterValueKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetSemaphoreCounterValueKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetSemaphoreCounterValueKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, semaphore, pValue);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetSemaphoreCounterValueKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetSemaphoreCounterValueKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfoKHR* pWaitInfo, uint64_t timeout) {
-	auto __fn = tl_deviceHookTable.table->vkWaitSemaphoresKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkWaitSemaphoresKHR) {
-		__fn = tl_deviceHookTable.replace->vkWaitSemaphoresKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkWaitSemaphoresKHR;
+	if (__info.replace && __info.replace->vkWaitSemaphoresKHR) {
+		__fn = __info.replace->vkWaitSemaphoresKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkWaitSemaphoresKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkWaitSemaphoresKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pWaitInfo, timeout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkWaitSemaphoresKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkWaitSemaphoresKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkSignalSemaphoreKHR(VkDevice device, const VkSemaphoreSignalInfoKHR* pSignalInfo) {
-	auto __fn = tl_deviceHookTable.table->vkSignalSemaphoreKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSignalSemaphoreKHR) {
-		__fn = tl_deviceHookTable.replace->vkSignalSemaphoreKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSignalSemaphoreKHR;
+	if (__info.replace && __info.replace->vkSignalSemaphoreKHR) {
+		__fn = __info.replace->vkSignalSemaphoreKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSignalSemaphoreKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSignalSemaphoreKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pSignalInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSignalSemaphoreKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSignalSemaphoreKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6008,100 +6393,109 @@ static VkResult xl_hook_tl_deviceHookTable_vkSignalSemaphoreKHR(VkDevice device,
 #if defined(VK_INTEL_performance_query)
 
 static VkResult xl_hook_tl_deviceHookTable_vkInitializePerformanceApiINTEL(VkDevice device, const VkInitializePerformanceApiInfoINTEL* pInitializeInfo) {
-	auto __fn = tl_deviceHookTable.table->vkInitializePerformanceApiINTEL;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkInitializePerformanceApiINTEL) {
-		__fn = tl_deviceHookTable.replace->vkInitializePerformanceApiINTEL;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkInitializePerformanceApiINTEL;
+	if (__info.replace && __info.replace->vkInitializePerformanceApiINTEL) {
+		__fn = __info.replace->vkInitializePerformanceApiINTEL;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkInitializePerformanceApiINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkInitializePerformanceApiINTEL", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInitializeInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkInitializePerformanceApiINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkInitializePerformanceApiINTEL", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkUninitializePerformanceApiINTEL(VkDevice device) {
-	auto __fn = tl_deviceHookTable.table->vkUninitializePerformanceApiINTEL;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkUninitializePerformanceApiINTEL) {
-		__fn = tl_deviceHookTable.replace->vkUninitializePerformanceApiINTEL;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkUninitializePerformanceApiINTEL;
+	if (__info.replace && __info.replace->vkUninitializePerformanceApiINTEL) {
+		__fn = __info.replace->vkUninitializePerformanceApiINTEL;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkUninitializePerformanceApiINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkUninitializePerformanceApiINTEL", (PFN_vkVoidFunction)__fn); }
 	__fn(device);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkUninitializePerformanceApiINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkUninitializePerformanceApiINTEL", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceMarkerInfoINTEL* pMarkerInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetPerformanceMarkerINTEL;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetPerformanceMarkerINTEL) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetPerformanceMarkerINTEL;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetPerformanceMarkerINTEL;
+	if (__info.replace && __info.replace->vkCmdSetPerformanceMarkerINTEL) {
+		__fn = __info.replace->vkCmdSetPerformanceMarkerINTEL;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetPerformanceMarkerINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetPerformanceMarkerINTEL", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(commandBuffer, pMarkerInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetPerformanceMarkerINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetPerformanceMarkerINTEL", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCmdSetPerformanceStreamMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceStreamMarkerInfoINTEL* pMarkerInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetPerformanceStreamMarkerINTEL;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetPerformanceStreamMarkerINTEL) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetPerformanceStreamMarkerINTEL;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetPerformanceStreamMarkerINTEL;
+	if (__info.replace && __info.replace->vkCmdSetPerformanceStreamMarkerINTEL) {
+		__fn = __info.replace->vkCmdSetPerformanceStreamMarkerINTEL;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetPerformanceStreamMarkerINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetPerformanceStreamMarkerINTEL", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(commandBuffer, pMarkerInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetPerformanceStreamMarkerINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetPerformanceStreamMarkerINTEL", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer, const VkPerformanceOverrideInfoINTEL* pOverrideInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetPerformanceOverrideINTEL;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetPerformanceOverrideINTEL) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetPerformanceOverrideINTEL;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetPerformanceOverrideINTEL;
+	if (__info.replace && __info.replace->vkCmdSetPerformanceOverrideINTEL) {
+		__fn = __info.replace->vkCmdSetPerformanceOverrideINTEL;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetPerformanceOverrideINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetPerformanceOverrideINTEL", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(commandBuffer, pOverrideInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetPerformanceOverrideINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetPerformanceOverrideINTEL", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkAcquirePerformanceConfigurationINTEL(VkDevice device, const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo, VkPerformanceConfigurationINTEL* pConfiguration) {
-	auto __fn = tl_deviceHookTable.table->vkAcquirePerformanceConfigurationINTEL;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkAcquirePerformanceConfigurationINTEL) {
-		__fn = tl_deviceHookTable.replace->vkAcquirePerformanceConfigurationINTEL;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkAcquirePerformanceConfigurationINTEL;
+	if (__info.replace && __info.replace->vkAcquirePerformanceConfigurationINTEL) {
+		__fn = __info.replace->vkAcquirePerformanceConfigurationINTEL;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkAcquirePerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkAcquirePerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pAcquireInfo, pConfiguration);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkAcquirePerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkAcquirePerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkReleasePerformanceConfigurationINTEL(VkDevice device, VkPerformanceConfigurationINTEL configuration) {
-	auto __fn = tl_deviceHookTable.table->vkReleasePerformanceConfigurationINTEL;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkReleasePerformanceConfigurationINTEL) {
-		__fn = tl_deviceHookTable.replace->vkReleasePerformanceConfigurationINTEL;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkReleasePerformanceConfigurationINTEL;
+	if (__info.replace && __info.replace->vkReleasePerformanceConfigurationINTEL) {
+		__fn = __info.replace->vkReleasePerformanceConfigurationINTEL;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkReleasePerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkReleasePerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, configuration);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkReleasePerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkReleasePerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkQueueSetPerformanceConfigurationINTEL(VkQueue queue, VkPerformanceConfigurationINTEL configuration) {
-	auto __fn = tl_deviceHookTable.table->vkQueueSetPerformanceConfigurationINTEL;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkQueueSetPerformanceConfigurationINTEL) {
-		__fn = tl_deviceHookTable.replace->vkQueueSetPerformanceConfigurationINTEL;
+	auto __info = DeviceTable_getHookInfo(queue);
+	auto __fn = __info.table->vkQueueSetPerformanceConfigurationINTEL;
+	if (__info.replace && __info.replace->vkQueueSetPerformanceConfigurationINTEL) {
+		__fn = __info.replace->vkQueueSetPerformanceConfigurationINTEL;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkQueueSetPerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkQueueSetPerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(queue, configuration);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkQueueSetPerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkQueueSetPerformanceConfigurationINTEL", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetPerformanceParameterINTEL(VkDevice device, VkPerformanceParameterTypeINTEL parameter, VkPerformanceValueINTEL* pValue) {
-	auto __fn = tl_deviceHookTable.table->vkGetPerformanceParameterINTEL;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetPerformanceParameterINTEL) {
-		__fn = tl_deviceHookTable.replace->vkGetPerformanceParameterINTEL;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetPerformanceParameterINTEL;
+	if (__info.replace && __info.replace->vkGetPerformanceParameterINTEL) {
+		__fn = __info.replace->vkGetPerformanceParameterINTEL;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetPerformanceParameterINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetPerformanceParameterINTEL", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, parameter, pValue);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetPerformanceParameterINTEL", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetPerformanceParameterINTEL", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6110,13 +6504,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetPerformanceParameterINTEL(VkDevi
 #if defined(VK_AMD_display_native_hdr)
 
 static void xl_hook_tl_deviceHookTable_vkSetLocalDimmingAMD(VkDevice device, VkSwapchainKHR swapChain, VkBool32 localDimmingEnable) {
-	auto __fn = tl_deviceHookTable.table->vkSetLocalDimmingAMD;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSetLocalDimmingAMD) {
-		__fn = tl_deviceHookTable.replace->vkSetLocalDimmingAMD;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSetLocalDimmingAMD;
+	if (__info.replace && __info.replace->vkSetLocalDimmingAMD) {
+		__fn = __info.replace->vkSetLocalDimmingAMD;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSetLocalDimmingAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSetLocalDimmingAMD", (PFN_vkVoidFunction)__fn); }
 	__fn(device, swapChain, localDimmingEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSetLocalDimmingAMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSetLocalDimmingAMD", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_AMD_display_native_hdr) */
@@ -6124,13 +6519,14 @@ static void xl_hook_tl_deviceHookTable_vkSetLocalDimmingAMD(VkDevice device, VkS
 #if defined(VK_KHR_fragment_shading_rate)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize, const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetFragmentShadingRateKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetFragmentShadingRateKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetFragmentShadingRateKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetFragmentShadingRateKHR;
+	if (__info.replace && __info.replace->vkCmdSetFragmentShadingRateKHR) {
+		__fn = __info.replace->vkCmdSetFragmentShadingRateKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetFragmentShadingRateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetFragmentShadingRateKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pFragmentSize, combinerOps);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetFragmentShadingRateKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetFragmentShadingRateKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_fragment_shading_rate) */
@@ -6138,13 +6534,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetFragmentShadingRateKHR(VkCommandB
 #if defined(VK_EXT_buffer_device_address)
 
 static VkDeviceAddress xl_hook_tl_deviceHookTable_vkGetBufferDeviceAddressEXT(VkDevice device, const VkBufferDeviceAddressInfoEXT* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetBufferDeviceAddressEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetBufferDeviceAddressEXT) {
-		__fn = tl_deviceHookTable.replace->vkGetBufferDeviceAddressEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetBufferDeviceAddressEXT;
+	if (__info.replace && __info.replace->vkGetBufferDeviceAddressEXT) {
+		__fn = __info.replace->vkGetBufferDeviceAddressEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetBufferDeviceAddressEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetBufferDeviceAddressEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetBufferDeviceAddressEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetBufferDeviceAddressEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6153,13 +6550,14 @@ static VkDeviceAddress xl_hook_tl_deviceHookTable_vkGetBufferDeviceAddressEXT(Vk
 #if defined(VK_KHR_present_wait)
 
 static VkResult xl_hook_tl_deviceHookTable_vkWaitForPresentKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout) {
-	auto __fn = tl_deviceHookTable.table->vkWaitForPresentKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkWaitForPresentKHR) {
-		__fn = tl_deviceHookTable.replace->vkWaitForPresentKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkWaitForPresentKHR;
+	if (__info.replace && __info.replace->vkWaitForPresentKHR) {
+		__fn = __info.replace->vkWaitForPresentKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkWaitForPresentKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkWaitForPresentKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchain, presentId, timeout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkWaitForPresentKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkWaitForPresentKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6168,24 +6566,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkWaitForPresentKHR(VkDevice device,
 #if defined(VK_EXT_full_screen_exclusive)
 
 static VkResult xl_hook_tl_deviceHookTable_vkAcquireFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) {
-	auto __fn = tl_deviceHookTable.table->vkAcquireFullScreenExclusiveModeEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkAcquireFullScreenExclusiveModeEXT) {
-		__fn = tl_deviceHookTable.replace->vkAcquireFullScreenExclusiveModeEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkAcquireFullScreenExclusiveModeEXT;
+	if (__info.replace && __info.replace->vkAcquireFullScreenExclusiveModeEXT) {
+		__fn = __info.replace->vkAcquireFullScreenExclusiveModeEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkAcquireFullScreenExclusiveModeEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkAcquireFullScreenExclusiveModeEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchain);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkAcquireFullScreenExclusiveModeEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkAcquireFullScreenExclusiveModeEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkReleaseFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) {
-	auto __fn = tl_deviceHookTable.table->vkReleaseFullScreenExclusiveModeEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkReleaseFullScreenExclusiveModeEXT) {
-		__fn = tl_deviceHookTable.replace->vkReleaseFullScreenExclusiveModeEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkReleaseFullScreenExclusiveModeEXT;
+	if (__info.replace && __info.replace->vkReleaseFullScreenExclusiveModeEXT) {
+		__fn = __info.replace->vkReleaseFullScreenExclusiveModeEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkReleaseFullScreenExclusiveModeEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkReleaseFullScreenExclusiveModeEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, swapchain);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkReleaseFullScreenExclusiveModeEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkReleaseFullScreenExclusiveModeEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6194,13 +6594,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkReleaseFullScreenExclusiveModeEXT(V
 #if (defined(VK_EXT_full_screen_exclusive) && defined(VK_KHR_device_group)) || (defined(VK_EXT_full_screen_exclusive) && defined(VK_VERSION_1_1))
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetDeviceGroupSurfacePresentModes2EXT(VkDevice device, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkDeviceGroupPresentModeFlagsKHR* pModes) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceGroupSurfacePresentModes2EXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceGroupSurfacePresentModes2EXT) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceGroupSurfacePresentModes2EXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceGroupSurfacePresentModes2EXT;
+	if (__info.replace && __info.replace->vkGetDeviceGroupSurfacePresentModes2EXT) {
+		__fn = __info.replace->vkGetDeviceGroupSurfacePresentModes2EXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupSurfacePresentModes2EXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceGroupSurfacePresentModes2EXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pSurfaceInfo, pModes);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceGroupSurfacePresentModes2EXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceGroupSurfacePresentModes2EXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6209,35 +6610,38 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetDeviceGroupSurfacePresentModes2E
 #if defined(VK_KHR_buffer_device_address)
 
 static VkDeviceAddress xl_hook_tl_deviceHookTable_vkGetBufferDeviceAddressKHR(VkDevice device, const VkBufferDeviceAddressInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetBufferDeviceAddressKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetBufferDeviceAddressKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetBufferDeviceAddressKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetBufferDeviceAddressKHR;
+	if (__info.replace && __info.replace->vkGetBufferDeviceAddressKHR) {
+		__fn = __info.replace->vkGetBufferDeviceAddressKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetBufferDeviceAddressKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetBufferDeviceAddressKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetBufferDeviceAddressKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetBufferDeviceAddressKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static uint64_t xl_hook_tl_deviceHookTable_vkGetBufferOpaqueCaptureAddressKHR(VkDevice device, const VkBufferDeviceAddressInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetBufferOpaqueCaptureAddressKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetBufferOpaqueCaptureAddressKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetBufferOpaqueCaptureAddressKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetBufferOpaqueCaptureAddressKHR;
+	if (__info.replace && __info.replace->vkGetBufferOpaqueCaptureAddressKHR) {
+		__fn = __info.replace->vkGetBufferOpaqueCaptureAddressKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetBufferOpaqueCaptureAddressKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetBufferOpaqueCaptureAddressKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetBufferOpaqueCaptureAddressKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetBufferOpaqueCaptureAddressKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static uint64_t xl_hook_tl_deviceHookTable_vkGetDeviceMemoryOpaqueCaptureAddressKHR(VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfoKHR* pInfo) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceMemoryOpaqueCaptureAddressKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceMemoryOpaqueCaptureAddressKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+	if (__info.replace && __info.replace->vkGetDeviceMemoryOpaqueCaptureAddressKHR) {
+		__fn = __info.replace->vkGetDeviceMemoryOpaqueCaptureAddressKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceMemoryOpaqueCaptureAddressKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceMemoryOpaqueCaptureAddressKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceMemoryOpaqueCaptureAddressKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceMemoryOpaqueCaptureAddressKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6246,13 +6650,14 @@ static uint64_t xl_hook_tl_deviceHookTable_vkGetDeviceMemoryOpaqueCaptureAddress
 #if defined(VK_EXT_line_rasterization)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetLineStippleEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetLineStippleEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetLineStippleEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetLineStippleEXT;
+	if (__info.replace && __info.replace->vkCmdSetLineStippleEXT) {
+		__fn = __info.replace->vkCmdSetLineStippleEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetLineStippleEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetLineStippleEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, lineStippleFactor, lineStipplePattern);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetLineStippleEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetLineStippleEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_line_rasterization) */
@@ -6260,13 +6665,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetLineStippleEXT(VkCommandBuffer co
 #if defined(VK_EXT_host_query_reset)
 
 static void xl_hook_tl_deviceHookTable_vkResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
-	auto __fn = tl_deviceHookTable.table->vkResetQueryPoolEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkResetQueryPoolEXT) {
-		__fn = tl_deviceHookTable.replace->vkResetQueryPoolEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkResetQueryPoolEXT;
+	if (__info.replace && __info.replace->vkResetQueryPoolEXT) {
+		__fn = __info.replace->vkResetQueryPoolEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkResetQueryPoolEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkResetQueryPoolEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(device, queryPool, firstQuery, queryCount);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkResetQueryPoolEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkResetQueryPoolEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_host_query_reset) */
@@ -6274,123 +6680,135 @@ static void xl_hook_tl_deviceHookTable_vkResetQueryPoolEXT(VkDevice device, VkQu
 #if defined(VK_EXT_extended_dynamic_state)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetCullModeEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetCullModeEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetCullModeEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetCullModeEXT;
+	if (__info.replace && __info.replace->vkCmdSetCullModeEXT) {
+		__fn = __info.replace->vkCmdSetCullModeEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetCullModeEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetCullModeEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, cullMode);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetCullModeEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetCullModeEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetFrontFaceEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetFrontFaceEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetFrontFaceEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetFrontFaceEXT;
+	if (__info.replace && __info.replace->vkCmdSetFrontFaceEXT) {
+		__fn = __info.replace->vkCmdSetFrontFaceEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetFrontFaceEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetFrontFaceEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, frontFace);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetFrontFaceEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetFrontFaceEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetPrimitiveTopologyEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetPrimitiveTopologyEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetPrimitiveTopologyEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetPrimitiveTopologyEXT;
+	if (__info.replace && __info.replace->vkCmdSetPrimitiveTopologyEXT) {
+		__fn = __info.replace->vkCmdSetPrimitiveTopologyEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetPrimitiveTopologyEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetPrimitiveTopologyEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, primitiveTopology);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetPrimitiveTopologyEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetPrimitiveTopologyEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport* pViewports) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetViewportWithCountEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetViewportWithCountEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetViewportWithCountEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetViewportWithCountEXT;
+	if (__info.replace && __info.replace->vkCmdSetViewportWithCountEXT) {
+		__fn = __info.replace->vkCmdSetViewportWithCountEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetViewportWithCountEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetViewportWithCountEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, viewportCount, pViewports);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetViewportWithCountEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetViewportWithCountEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetScissorWithCountEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetScissorWithCountEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetScissorWithCountEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetScissorWithCountEXT;
+	if (__info.replace && __info.replace->vkCmdSetScissorWithCountEXT) {
+		__fn = __info.replace->vkCmdSetScissorWithCountEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetScissorWithCountEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetScissorWithCountEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, scissorCount, pScissors);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetScissorWithCountEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetScissorWithCountEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindVertexBuffers2EXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindVertexBuffers2EXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindVertexBuffers2EXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindVertexBuffers2EXT;
+	if (__info.replace && __info.replace->vkCmdBindVertexBuffers2EXT) {
+		__fn = __info.replace->vkCmdBindVertexBuffers2EXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindVertexBuffers2EXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindVertexBuffers2EXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindVertexBuffers2EXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindVertexBuffers2EXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthTestEnableEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthTestEnableEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthTestEnableEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthTestEnableEXT;
+	if (__info.replace && __info.replace->vkCmdSetDepthTestEnableEXT) {
+		__fn = __info.replace->vkCmdSetDepthTestEnableEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthTestEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthTestEnableEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthTestEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthTestEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthTestEnableEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthWriteEnableEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthWriteEnableEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthWriteEnableEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthWriteEnableEXT;
+	if (__info.replace && __info.replace->vkCmdSetDepthWriteEnableEXT) {
+		__fn = __info.replace->vkCmdSetDepthWriteEnableEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthWriteEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthWriteEnableEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthWriteEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthWriteEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthWriteEnableEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthCompareOpEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthCompareOpEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthCompareOpEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthCompareOpEXT;
+	if (__info.replace && __info.replace->vkCmdSetDepthCompareOpEXT) {
+		__fn = __info.replace->vkCmdSetDepthCompareOpEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthCompareOpEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthCompareOpEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthCompareOp);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthCompareOpEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthCompareOpEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthBoundsTestEnableEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthBoundsTestEnableEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthBoundsTestEnableEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthBoundsTestEnableEXT;
+	if (__info.replace && __info.replace->vkCmdSetDepthBoundsTestEnableEXT) {
+		__fn = __info.replace->vkCmdSetDepthBoundsTestEnableEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBoundsTestEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthBoundsTestEnableEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthBoundsTestEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBoundsTestEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthBoundsTestEnableEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetStencilTestEnableEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetStencilTestEnableEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetStencilTestEnableEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetStencilTestEnableEXT;
+	if (__info.replace && __info.replace->vkCmdSetStencilTestEnableEXT) {
+		__fn = __info.replace->vkCmdSetStencilTestEnableEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetStencilTestEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetStencilTestEnableEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, stencilTestEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetStencilTestEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetStencilTestEnableEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetStencilOpEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetStencilOpEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetStencilOpEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetStencilOpEXT;
+	if (__info.replace && __info.replace->vkCmdSetStencilOpEXT) {
+		__fn = __info.replace->vkCmdSetStencilOpEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetStencilOpEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetStencilOpEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetStencilOpEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetStencilOpEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_extended_dynamic_state) */
@@ -6398,56 +6816,61 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetStencilOpEXT(VkCommandBuffer comm
 #if defined(VK_KHR_deferred_host_operations)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateDeferredOperationKHR(VkDevice device, const VkAllocationCallbacks* pAllocator, VkDeferredOperationKHR* pDeferredOperation) {
-	auto __fn = tl_deviceHookTable.table->vkCreateDeferredOperationKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateDeferredOperationKHR) {
-		__fn = tl_deviceHookTable.replace->vkCreateDeferredOperationKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateDeferredOperationKHR;
+	if (__info.replace && __info.replace->vkCreateDeferredOperationKHR) {
+		__fn = __info.replace->vkCreateDeferredOperationKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateDeferredOperationKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateDeferredOperationKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pAllocator, pDeferredOperation);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateDeferredOperationKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateDeferredOperationKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyDeferredOperationKHR(VkDevice device, VkDeferredOperationKHR operation, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyDeferredOperationKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyDeferredOperationKHR) {
-		__fn = tl_deviceHookTable.replace->vkDestroyDeferredOperationKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyDeferredOperationKHR;
+	if (__info.replace && __info.replace->vkDestroyDeferredOperationKHR) {
+		__fn = __info.replace->vkDestroyDeferredOperationKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyDeferredOperationKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyDeferredOperationKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, operation, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyDeferredOperationKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyDeferredOperationKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static uint32_t xl_hook_tl_deviceHookTable_vkGetDeferredOperationMaxConcurrencyKHR(VkDevice device, VkDeferredOperationKHR operation) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeferredOperationMaxConcurrencyKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeferredOperationMaxConcurrencyKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeferredOperationMaxConcurrencyKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeferredOperationMaxConcurrencyKHR;
+	if (__info.replace && __info.replace->vkGetDeferredOperationMaxConcurrencyKHR) {
+		__fn = __info.replace->vkGetDeferredOperationMaxConcurrencyKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeferredOperationMaxConcurrencyKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeferredOperationMaxConcurrencyKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, operation);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeferredOperationMaxConcurrencyKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeferredOperationMaxConcurrencyKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetDeferredOperationResultKHR(VkDevice device, VkDeferredOperationKHR operation) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeferredOperationResultKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeferredOperationResultKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeferredOperationResultKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeferredOperationResultKHR;
+	if (__info.replace && __info.replace->vkGetDeferredOperationResultKHR) {
+		__fn = __info.replace->vkGetDeferredOperationResultKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeferredOperationResultKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeferredOperationResultKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, operation);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeferredOperationResultKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeferredOperationResultKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkDeferredOperationJoinKHR(VkDevice device, VkDeferredOperationKHR operation) {
-	auto __fn = tl_deviceHookTable.table->vkDeferredOperationJoinKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDeferredOperationJoinKHR) {
-		__fn = tl_deviceHookTable.replace->vkDeferredOperationJoinKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDeferredOperationJoinKHR;
+	if (__info.replace && __info.replace->vkDeferredOperationJoinKHR) {
+		__fn = __info.replace->vkDeferredOperationJoinKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDeferredOperationJoinKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDeferredOperationJoinKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, operation);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDeferredOperationJoinKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDeferredOperationJoinKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6456,35 +6879,38 @@ static VkResult xl_hook_tl_deviceHookTable_vkDeferredOperationJoinKHR(VkDevice d
 #if defined(VK_KHR_pipeline_executable_properties)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetPipelineExecutablePropertiesKHR(VkDevice device, const VkPipelineInfoKHR* pPipelineInfo, uint32_t* pExecutableCount, VkPipelineExecutablePropertiesKHR* pProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetPipelineExecutablePropertiesKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetPipelineExecutablePropertiesKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetPipelineExecutablePropertiesKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetPipelineExecutablePropertiesKHR;
+	if (__info.replace && __info.replace->vkGetPipelineExecutablePropertiesKHR) {
+		__fn = __info.replace->vkGetPipelineExecutablePropertiesKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetPipelineExecutablePropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetPipelineExecutablePropertiesKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pPipelineInfo, pExecutableCount, pProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetPipelineExecutablePropertiesKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetPipelineExecutablePropertiesKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetPipelineExecutableStatisticsKHR(VkDevice device, const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pStatisticCount, VkPipelineExecutableStatisticKHR* pStatistics) {
-	auto __fn = tl_deviceHookTable.table->vkGetPipelineExecutableStatisticsKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetPipelineExecutableStatisticsKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetPipelineExecutableStatisticsKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetPipelineExecutableStatisticsKHR;
+	if (__info.replace && __info.replace->vkGetPipelineExecutableStatisticsKHR) {
+		__fn = __info.replace->vkGetPipelineExecutableStatisticsKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetPipelineExecutableStatisticsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetPipelineExecutableStatisticsKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pExecutableInfo, pStatisticCount, pStatistics);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetPipelineExecutableStatisticsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetPipelineExecutableStatisticsKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetPipelineExecutableInternalRepresentationsKHR(VkDevice device, const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pInternalRepresentationCount, VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) {
-	auto __fn = tl_deviceHookTable.table->vkGetPipelineExecutableInternalRepresentationsKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetPipelineExecutableInternalRepresentationsKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetPipelineExecutableInternalRepresentationsKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetPipelineExecutableInternalRepresentationsKHR;
+	if (__info.replace && __info.replace->vkGetPipelineExecutableInternalRepresentationsKHR) {
+		__fn = __info.replace->vkGetPipelineExecutableInternalRepresentationsKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetPipelineExecutableInternalRepresentationsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetPipelineExecutableInternalRepresentationsKHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetPipelineExecutableInternalRepresentationsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetPipelineExecutableInternalRepresentationsKHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6493,64 +6919,70 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetPipelineExecutableInternalRepres
 #if defined(VK_NV_device_generated_commands)
 
 static void xl_hook_tl_deviceHookTable_vkGetGeneratedCommandsMemoryRequirementsNV(VkDevice device, const VkGeneratedCommandsMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetGeneratedCommandsMemoryRequirementsNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetGeneratedCommandsMemoryRequirementsNV) {
-		__fn = tl_deviceHookTable.replace->vkGetGeneratedCommandsMemoryRequirementsNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetGeneratedCommandsMemoryRequirementsNV;
+	if (__info.replace && __info.replace->vkGetGeneratedCommandsMemoryRequirementsNV) {
+		__fn = __info.replace->vkGetGeneratedCommandsMemoryRequirementsNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetGeneratedCommandsMemoryRequirementsNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetGeneratedCommandsMemoryRequirementsNV", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetGeneratedCommandsMemoryRequirementsNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetGeneratedCommandsMemoryRequirementsNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdPreprocessGeneratedCommandsNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdPreprocessGeneratedCommandsNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdPreprocessGeneratedCommandsNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdPreprocessGeneratedCommandsNV;
+	if (__info.replace && __info.replace->vkCmdPreprocessGeneratedCommandsNV) {
+		__fn = __info.replace->vkCmdPreprocessGeneratedCommandsNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdPreprocessGeneratedCommandsNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdPreprocessGeneratedCommandsNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pGeneratedCommandsInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdPreprocessGeneratedCommandsNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdPreprocessGeneratedCommandsNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdExecuteGeneratedCommandsNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdExecuteGeneratedCommandsNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdExecuteGeneratedCommandsNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdExecuteGeneratedCommandsNV;
+	if (__info.replace && __info.replace->vkCmdExecuteGeneratedCommandsNV) {
+		__fn = __info.replace->vkCmdExecuteGeneratedCommandsNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdExecuteGeneratedCommandsNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdExecuteGeneratedCommandsNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdExecuteGeneratedCommandsNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdExecuteGeneratedCommandsNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline, uint32_t groupIndex) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindPipelineShaderGroupNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindPipelineShaderGroupNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindPipelineShaderGroupNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindPipelineShaderGroupNV;
+	if (__info.replace && __info.replace->vkCmdBindPipelineShaderGroupNV) {
+		__fn = __info.replace->vkCmdBindPipelineShaderGroupNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindPipelineShaderGroupNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindPipelineShaderGroupNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindPipelineShaderGroupNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindPipelineShaderGroupNV", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateIndirectCommandsLayoutNV(VkDevice device, const VkIndirectCommandsLayoutCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNV* pIndirectCommandsLayout) {
-	auto __fn = tl_deviceHookTable.table->vkCreateIndirectCommandsLayoutNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateIndirectCommandsLayoutNV) {
-		__fn = tl_deviceHookTable.replace->vkCreateIndirectCommandsLayoutNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateIndirectCommandsLayoutNV;
+	if (__info.replace && __info.replace->vkCreateIndirectCommandsLayoutNV) {
+		__fn = __info.replace->vkCreateIndirectCommandsLayoutNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateIndirectCommandsLayoutNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateIndirectCommandsLayoutNV", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateIndirectCommandsLayoutNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateIndirectCommandsLayoutNV", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyIndirectCommandsLayoutNV(VkDevice device, VkIndirectCommandsLayoutNV indirectCommandsLayout, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyIndirectCommandsLayoutNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyIndirectCommandsLayoutNV) {
-		__fn = tl_deviceHookTable.replace->vkDestroyIndirectCommandsLayoutNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyIndirectCommandsLayoutNV;
+	if (__info.replace && __info.replace->vkDestroyIndirectCommandsLayoutNV) {
+		__fn = __info.replace->vkDestroyIndirectCommandsLayoutNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyIndirectCommandsLayoutNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyIndirectCommandsLayoutNV", (PFN_vkVoidFunction)__fn); }
 	__fn(device, indirectCommandsLayout, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyIndirectCommandsLayoutNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyIndirectCommandsLayoutNV", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_NV_device_generated_commands) */
@@ -6558,45 +6990,49 @@ static void xl_hook_tl_deviceHookTable_vkDestroyIndirectCommandsLayoutNV(VkDevic
 #if defined(VK_EXT_private_data)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreatePrivateDataSlotEXT(VkDevice device, const VkPrivateDataSlotCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPrivateDataSlotEXT* pPrivateDataSlot) {
-	auto __fn = tl_deviceHookTable.table->vkCreatePrivateDataSlotEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreatePrivateDataSlotEXT) {
-		__fn = tl_deviceHookTable.replace->vkCreatePrivateDataSlotEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreatePrivateDataSlotEXT;
+	if (__info.replace && __info.replace->vkCreatePrivateDataSlotEXT) {
+		__fn = __info.replace->vkCreatePrivateDataSlotEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreatePrivateDataSlotEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreatePrivateDataSlotEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pPrivateDataSlot);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreatePrivateDataSlotEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreatePrivateDataSlotEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyPrivateDataSlotEXT(VkDevice device, VkPrivateDataSlotEXT privateDataSlot, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyPrivateDataSlotEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyPrivateDataSlotEXT) {
-		__fn = tl_deviceHookTable.replace->vkDestroyPrivateDataSlotEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyPrivateDataSlotEXT;
+	if (__info.replace && __info.replace->vkDestroyPrivateDataSlotEXT) {
+		__fn = __info.replace->vkDestroyPrivateDataSlotEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyPrivateDataSlotEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyPrivateDataSlotEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(device, privateDataSlot, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyPrivateDataSlotEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyPrivateDataSlotEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkSetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t data) {
-	auto __fn = tl_deviceHookTable.table->vkSetPrivateDataEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSetPrivateDataEXT) {
-		__fn = tl_deviceHookTable.replace->vkSetPrivateDataEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSetPrivateDataEXT;
+	if (__info.replace && __info.replace->vkSetPrivateDataEXT) {
+		__fn = __info.replace->vkSetPrivateDataEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSetPrivateDataEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSetPrivateDataEXT", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, objectType, objectHandle, privateDataSlot, data);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSetPrivateDataEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSetPrivateDataEXT", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t* pData) {
-	auto __fn = tl_deviceHookTable.table->vkGetPrivateDataEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetPrivateDataEXT) {
-		__fn = tl_deviceHookTable.replace->vkGetPrivateDataEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetPrivateDataEXT;
+	if (__info.replace && __info.replace->vkGetPrivateDataEXT) {
+		__fn = __info.replace->vkGetPrivateDataEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetPrivateDataEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetPrivateDataEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(device, objectType, objectHandle, privateDataSlot, pData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetPrivateDataEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetPrivateDataEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_private_data) */
@@ -6604,13 +7040,14 @@ static void xl_hook_tl_deviceHookTable_vkGetPrivateDataEXT(VkDevice device, VkOb
 #if defined(VK_KHR_video_encode_queue)
 
 static void xl_hook_tl_deviceHookTable_vkCmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR* pEncodeInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdEncodeVideoKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdEncodeVideoKHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdEncodeVideoKHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdEncodeVideoKHR;
+	if (__info.replace && __info.replace->vkCmdEncodeVideoKHR) {
+		__fn = __info.replace->vkCmdEncodeVideoKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdEncodeVideoKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdEncodeVideoKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pEncodeInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdEncodeVideoKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdEncodeVideoKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_video_encode_queue) */
@@ -6618,63 +7055,69 @@ static void xl_hook_tl_deviceHookTable_vkCmdEncodeVideoKHR(VkCommandBuffer comma
 #if defined(VK_KHR_synchronization2)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfoKHR* pDependencyInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetEvent2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetEvent2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetEvent2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetEvent2KHR;
+	if (__info.replace && __info.replace->vkCmdSetEvent2KHR) {
+		__fn = __info.replace->vkCmdSetEvent2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetEvent2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetEvent2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, event, pDependencyInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetEvent2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetEvent2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2KHR stageMask) {
-	auto __fn = tl_deviceHookTable.table->vkCmdResetEvent2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdResetEvent2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdResetEvent2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdResetEvent2KHR;
+	if (__info.replace && __info.replace->vkCmdResetEvent2KHR) {
+		__fn = __info.replace->vkCmdResetEvent2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdResetEvent2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdResetEvent2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, event, stageMask);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdResetEvent2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdResetEvent2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfoKHR* pDependencyInfos) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWaitEvents2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWaitEvents2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdWaitEvents2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWaitEvents2KHR;
+	if (__info.replace && __info.replace->vkCmdWaitEvents2KHR) {
+		__fn = __info.replace->vkCmdWaitEvents2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWaitEvents2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWaitEvents2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, eventCount, pEvents, pDependencyInfos);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWaitEvents2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWaitEvents2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdPipelineBarrier2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdPipelineBarrier2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdPipelineBarrier2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdPipelineBarrier2KHR;
+	if (__info.replace && __info.replace->vkCmdPipelineBarrier2KHR) {
+		__fn = __info.replace->vkCmdPipelineBarrier2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdPipelineBarrier2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdPipelineBarrier2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pDependencyInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdPipelineBarrier2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdPipelineBarrier2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkQueryPool queryPool, uint32_t query) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWriteTimestamp2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWriteTimestamp2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdWriteTimestamp2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWriteTimestamp2KHR;
+	if (__info.replace && __info.replace->vkCmdWriteTimestamp2KHR) {
+		__fn = __info.replace->vkCmdWriteTimestamp2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWriteTimestamp2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWriteTimestamp2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, stage, queryPool, query);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWriteTimestamp2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWriteTimestamp2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence) {
-	auto __fn = tl_deviceHookTable.table->vkQueueSubmit2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkQueueSubmit2KHR) {
-		__fn = tl_deviceHookTable.replace->vkQueueSubmit2KHR;
+	auto __info = DeviceTable_getHookInfo(queue);
+	auto __fn = __info.table->vkQueueSubmit2KHR;
+	if (__info.replace && __info.replace->vkQueueSubmit2KHR) {
+		__fn = __info.replace->vkQueueSubmit2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkQueueSubmit2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkQueueSubmit2KHR", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(queue, submitCount, pSubmits, fence);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkQueueSubmit2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkQueueSubmit2KHR", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6683,13 +7126,14 @@ static VkResult xl_hook_tl_deviceHookTable_vkQueueSubmit2KHR(VkQueue queue, uint
 #if defined(VK_KHR_synchronization2) && defined(VK_AMD_buffer_marker)
 
 static void xl_hook_tl_deviceHookTable_vkCmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {
-	auto __fn = tl_deviceHookTable.table->vkCmdWriteBufferMarker2AMD;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdWriteBufferMarker2AMD) {
-		__fn = tl_deviceHookTable.replace->vkCmdWriteBufferMarker2AMD;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdWriteBufferMarker2AMD;
+	if (__info.replace && __info.replace->vkCmdWriteBufferMarker2AMD) {
+		__fn = __info.replace->vkCmdWriteBufferMarker2AMD;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdWriteBufferMarker2AMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdWriteBufferMarker2AMD", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, stage, dstBuffer, dstOffset, marker);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdWriteBufferMarker2AMD", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdWriteBufferMarker2AMD", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_synchronization2) && defined(VK_AMD_buffer_marker) */
@@ -6697,13 +7141,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdWriteBufferMarker2AMD(VkCommandBuffe
 #if defined(VK_KHR_synchronization2) && defined(VK_NV_device_diagnostic_checkpoints)
 
 static void xl_hook_tl_deviceHookTable_vkGetQueueCheckpointData2NV(VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointData2NV* pCheckpointData) {
-	auto __fn = tl_deviceHookTable.table->vkGetQueueCheckpointData2NV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetQueueCheckpointData2NV) {
-		__fn = tl_deviceHookTable.replace->vkGetQueueCheckpointData2NV;
+	auto __info = DeviceTable_getHookInfo(queue);
+	auto __fn = __info.table->vkGetQueueCheckpointData2NV;
+	if (__info.replace && __info.replace->vkGetQueueCheckpointData2NV) {
+		__fn = __info.replace->vkGetQueueCheckpointData2NV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetQueueCheckpointData2NV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetQueueCheckpointData2NV", (PFN_vkVoidFunction)__fn); }
 	__fn(queue, pCheckpointDataCount, pCheckpointData);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetQueueCheckpointData2NV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetQueueCheckpointData2NV", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_synchronization2) && defined(VK_NV_device_diagnostic_checkpoints) */
@@ -6711,13 +7156,14 @@ static void xl_hook_tl_deviceHookTable_vkGetQueueCheckpointData2NV(VkQueue queue
 #if defined(VK_NV_fragment_shading_rate_enums)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate, const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetFragmentShadingRateEnumNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetFragmentShadingRateEnumNV) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetFragmentShadingRateEnumNV;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetFragmentShadingRateEnumNV;
+	if (__info.replace && __info.replace->vkCmdSetFragmentShadingRateEnumNV) {
+		__fn = __info.replace->vkCmdSetFragmentShadingRateEnumNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetFragmentShadingRateEnumNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetFragmentShadingRateEnumNV", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, shadingRate, combinerOps);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetFragmentShadingRateEnumNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetFragmentShadingRateEnumNV", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_NV_fragment_shading_rate_enums) */
@@ -6725,63 +7171,69 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetFragmentShadingRateEnumNV(VkComma
 #if defined(VK_KHR_copy_commands2)
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyBuffer2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyBuffer2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyBuffer2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyBuffer2KHR;
+	if (__info.replace && __info.replace->vkCmdCopyBuffer2KHR) {
+		__fn = __info.replace->vkCmdCopyBuffer2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyBuffer2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyBuffer2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCopyBufferInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyBuffer2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyBuffer2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR* pCopyImageInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyImage2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyImage2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyImage2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyImage2KHR;
+	if (__info.replace && __info.replace->vkCmdCopyImage2KHR) {
+		__fn = __info.replace->vkCmdCopyImage2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyImage2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCopyImageInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyImage2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2KHR* pCopyBufferToImageInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyBufferToImage2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyBufferToImage2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyBufferToImage2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyBufferToImage2KHR;
+	if (__info.replace && __info.replace->vkCmdCopyBufferToImage2KHR) {
+		__fn = __info.replace->vkCmdCopyBufferToImage2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyBufferToImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyBufferToImage2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCopyBufferToImageInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyBufferToImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyBufferToImage2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2KHR* pCopyImageToBufferInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdCopyImageToBuffer2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdCopyImageToBuffer2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdCopyImageToBuffer2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdCopyImageToBuffer2KHR;
+	if (__info.replace && __info.replace->vkCmdCopyImageToBuffer2KHR) {
+		__fn = __info.replace->vkCmdCopyImageToBuffer2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdCopyImageToBuffer2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdCopyImageToBuffer2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pCopyImageToBufferInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdCopyImageToBuffer2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdCopyImageToBuffer2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdBlitImage2KHR(VkCommandBuffer commandBuffer, const VkBlitImageInfo2KHR* pBlitImageInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBlitImage2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBlitImage2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdBlitImage2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBlitImage2KHR;
+	if (__info.replace && __info.replace->vkCmdBlitImage2KHR) {
+		__fn = __info.replace->vkCmdBlitImage2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBlitImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBlitImage2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pBlitImageInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBlitImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBlitImage2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdResolveImage2KHR(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR* pResolveImageInfo) {
-	auto __fn = tl_deviceHookTable.table->vkCmdResolveImage2KHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdResolveImage2KHR) {
-		__fn = tl_deviceHookTable.replace->vkCmdResolveImage2KHR;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdResolveImage2KHR;
+	if (__info.replace && __info.replace->vkCmdResolveImage2KHR) {
+		__fn = __info.replace->vkCmdResolveImage2KHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdResolveImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdResolveImage2KHR", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, pResolveImageInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdResolveImage2KHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdResolveImage2KHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_copy_commands2) */
@@ -6789,13 +7241,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdResolveImage2KHR(VkCommandBuffer com
 #if defined(VK_EXT_vertex_input_dynamic_state)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetVertexInputEXT(VkCommandBuffer commandBuffer, uint32_t vertexBindingDescriptionCount, const VkVertexInputBindingDescription2EXT* pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount, const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetVertexInputEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetVertexInputEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetVertexInputEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetVertexInputEXT;
+	if (__info.replace && __info.replace->vkCmdSetVertexInputEXT) {
+		__fn = __info.replace->vkCmdSetVertexInputEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetVertexInputEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetVertexInputEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetVertexInputEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetVertexInputEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_vertex_input_dynamic_state) */
@@ -6803,24 +7256,26 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetVertexInputEXT(VkCommandBuffer co
 #if defined(VK_FUCHSIA_external_memory)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryZirconHandleFUCHSIA(VkDevice device, const VkMemoryGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, zx_handle_t* pZirconHandle) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryZirconHandleFUCHSIA;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryZirconHandleFUCHSIA) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryZirconHandleFUCHSIA;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryZirconHandleFUCHSIA;
+	if (__info.replace && __info.replace->vkGetMemoryZirconHandleFUCHSIA) {
+		__fn = __info.replace->vkGetMemoryZirconHandleFUCHSIA;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pGetZirconHandleInfo, pZirconHandle);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryZirconHandlePropertiesFUCHSIA(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, zx_handle_t zirconHandle, VkMemoryZirconHandlePropertiesFUCHSIA* pMemoryZirconHandleProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryZirconHandlePropertiesFUCHSIA;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryZirconHandlePropertiesFUCHSIA) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryZirconHandlePropertiesFUCHSIA;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryZirconHandlePropertiesFUCHSIA;
+	if (__info.replace && __info.replace->vkGetMemoryZirconHandlePropertiesFUCHSIA) {
+		__fn = __info.replace->vkGetMemoryZirconHandlePropertiesFUCHSIA;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryZirconHandlePropertiesFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryZirconHandlePropertiesFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryZirconHandlePropertiesFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryZirconHandlePropertiesFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6829,24 +7284,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryZirconHandlePropertiesFUCH
 #if defined(VK_FUCHSIA_external_semaphore)
 
 static VkResult xl_hook_tl_deviceHookTable_vkImportSemaphoreZirconHandleFUCHSIA(VkDevice device, const VkImportSemaphoreZirconHandleInfoFUCHSIA* pImportSemaphoreZirconHandleInfo) {
-	auto __fn = tl_deviceHookTable.table->vkImportSemaphoreZirconHandleFUCHSIA;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkImportSemaphoreZirconHandleFUCHSIA) {
-		__fn = tl_deviceHookTable.replace->vkImportSemaphoreZirconHandleFUCHSIA;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkImportSemaphoreZirconHandleFUCHSIA;
+	if (__info.replace && __info.replace->vkImportSemaphoreZirconHandleFUCHSIA) {
+		__fn = __info.replace->vkImportSemaphoreZirconHandleFUCHSIA;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkImportSemaphoreZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkImportSemaphoreZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pImportSemaphoreZirconHandleInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkImportSemaphoreZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkImportSemaphoreZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetSemaphoreZirconHandleFUCHSIA(VkDevice device, const VkSemaphoreGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, zx_handle_t* pZirconHandle) {
-	auto __fn = tl_deviceHookTable.table->vkGetSemaphoreZirconHandleFUCHSIA;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetSemaphoreZirconHandleFUCHSIA) {
-		__fn = tl_deviceHookTable.replace->vkGetSemaphoreZirconHandleFUCHSIA;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetSemaphoreZirconHandleFUCHSIA;
+	if (__info.replace && __info.replace->vkGetSemaphoreZirconHandleFUCHSIA) {
+		__fn = __info.replace->vkGetSemaphoreZirconHandleFUCHSIA;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetSemaphoreZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetSemaphoreZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pGetZirconHandleInfo, pZirconHandle);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetSemaphoreZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetSemaphoreZirconHandleFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6855,56 +7312,61 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetSemaphoreZirconHandleFUCHSIA(VkD
 #if defined(VK_FUCHSIA_buffer_collection)
 
 static VkResult xl_hook_tl_deviceHookTable_vkCreateBufferCollectionFUCHSIA(VkDevice device, const VkBufferCollectionCreateInfoFUCHSIA* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferCollectionFUCHSIA* pCollection) {
-	auto __fn = tl_deviceHookTable.table->vkCreateBufferCollectionFUCHSIA;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCreateBufferCollectionFUCHSIA) {
-		__fn = tl_deviceHookTable.replace->vkCreateBufferCollectionFUCHSIA;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkCreateBufferCollectionFUCHSIA;
+	if (__info.replace && __info.replace->vkCreateBufferCollectionFUCHSIA) {
+		__fn = __info.replace->vkCreateBufferCollectionFUCHSIA;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCreateBufferCollectionFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCreateBufferCollectionFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pCreateInfo, pAllocator, pCollection);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCreateBufferCollectionFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCreateBufferCollectionFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkSetBufferCollectionImageConstraintsFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, const VkImageConstraintsInfoFUCHSIA* pImageConstraintsInfo) {
-	auto __fn = tl_deviceHookTable.table->vkSetBufferCollectionImageConstraintsFUCHSIA;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSetBufferCollectionImageConstraintsFUCHSIA) {
-		__fn = tl_deviceHookTable.replace->vkSetBufferCollectionImageConstraintsFUCHSIA;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSetBufferCollectionImageConstraintsFUCHSIA;
+	if (__info.replace && __info.replace->vkSetBufferCollectionImageConstraintsFUCHSIA) {
+		__fn = __info.replace->vkSetBufferCollectionImageConstraintsFUCHSIA;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSetBufferCollectionImageConstraintsFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSetBufferCollectionImageConstraintsFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, collection, pImageConstraintsInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSetBufferCollectionImageConstraintsFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSetBufferCollectionImageConstraintsFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkSetBufferCollectionBufferConstraintsFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, const VkBufferConstraintsInfoFUCHSIA* pBufferConstraintsInfo) {
-	auto __fn = tl_deviceHookTable.table->vkSetBufferCollectionBufferConstraintsFUCHSIA;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSetBufferCollectionBufferConstraintsFUCHSIA) {
-		__fn = tl_deviceHookTable.replace->vkSetBufferCollectionBufferConstraintsFUCHSIA;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSetBufferCollectionBufferConstraintsFUCHSIA;
+	if (__info.replace && __info.replace->vkSetBufferCollectionBufferConstraintsFUCHSIA) {
+		__fn = __info.replace->vkSetBufferCollectionBufferConstraintsFUCHSIA;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSetBufferCollectionBufferConstraintsFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSetBufferCollectionBufferConstraintsFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, collection, pBufferConstraintsInfo);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSetBufferCollectionBufferConstraintsFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSetBufferCollectionBufferConstraintsFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkDestroyBufferCollectionFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, const VkAllocationCallbacks* pAllocator) {
-	auto __fn = tl_deviceHookTable.table->vkDestroyBufferCollectionFUCHSIA;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkDestroyBufferCollectionFUCHSIA) {
-		__fn = tl_deviceHookTable.replace->vkDestroyBufferCollectionFUCHSIA;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkDestroyBufferCollectionFUCHSIA;
+	if (__info.replace && __info.replace->vkDestroyBufferCollectionFUCHSIA) {
+		__fn = __info.replace->vkDestroyBufferCollectionFUCHSIA;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkDestroyBufferCollectionFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkDestroyBufferCollectionFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	__fn(device, collection, pAllocator);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkDestroyBufferCollectionFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkDestroyBufferCollectionFUCHSIA", (PFN_vkVoidFunction)__fn); }
 }
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetBufferCollectionPropertiesFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, VkBufferCollectionPropertiesFUCHSIA* pProperties) {
-	auto __fn = tl_deviceHookTable.table->vkGetBufferCollectionPropertiesFUCHSIA;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetBufferCollectionPropertiesFUCHSIA) {
-		__fn = tl_deviceHookTable.replace->vkGetBufferCollectionPropertiesFUCHSIA;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetBufferCollectionPropertiesFUCHSIA;
+	if (__info.replace && __info.replace->vkGetBufferCollectionPropertiesFUCHSIA) {
+		__fn = __info.replace->vkGetBufferCollectionPropertiesFUCHSIA;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetBufferCollectionPropertiesFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetBufferCollectionPropertiesFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, collection, pProperties);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetBufferCollectionPropertiesFUCHSIA", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetBufferCollectionPropertiesFUCHSIA", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6913,24 +7375,26 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetBufferCollectionPropertiesFUCHSI
 #if defined(VK_HUAWEI_subpass_shading)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkDevice device, VkRenderPass renderpass, VkExtent2D* pMaxWorkgroupSize) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+	if (__info.replace && __info.replace->vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI) {
+		__fn = __info.replace->vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, renderpass, pMaxWorkgroupSize);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSubpassShadingHUAWEI;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSubpassShadingHUAWEI) {
-		__fn = tl_deviceHookTable.replace->vkCmdSubpassShadingHUAWEI;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSubpassShadingHUAWEI;
+	if (__info.replace && __info.replace->vkCmdSubpassShadingHUAWEI) {
+		__fn = __info.replace->vkCmdSubpassShadingHUAWEI;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSubpassShadingHUAWEI", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSubpassShadingHUAWEI", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSubpassShadingHUAWEI", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSubpassShadingHUAWEI", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_HUAWEI_subpass_shading) */
@@ -6938,13 +7402,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdSubpassShadingHUAWEI(VkCommandBuffer
 #if defined(VK_HUAWEI_invocation_mask)
 
 static void xl_hook_tl_deviceHookTable_vkCmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) {
-	auto __fn = tl_deviceHookTable.table->vkCmdBindInvocationMaskHUAWEI;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdBindInvocationMaskHUAWEI) {
-		__fn = tl_deviceHookTable.replace->vkCmdBindInvocationMaskHUAWEI;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdBindInvocationMaskHUAWEI;
+	if (__info.replace && __info.replace->vkCmdBindInvocationMaskHUAWEI) {
+		__fn = __info.replace->vkCmdBindInvocationMaskHUAWEI;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdBindInvocationMaskHUAWEI", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdBindInvocationMaskHUAWEI", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, imageView, imageLayout);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdBindInvocationMaskHUAWEI", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdBindInvocationMaskHUAWEI", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_HUAWEI_invocation_mask) */
@@ -6952,13 +7417,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdBindInvocationMaskHUAWEI(VkCommandBu
 #if defined(VK_NV_external_memory_rdma)
 
 static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryRemoteAddressNV(VkDevice device, const VkMemoryGetRemoteAddressInfoNV* pMemoryGetRemoteAddressInfo, VkRemoteAddressNV* pAddress) {
-	auto __fn = tl_deviceHookTable.table->vkGetMemoryRemoteAddressNV;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetMemoryRemoteAddressNV) {
-		__fn = tl_deviceHookTable.replace->vkGetMemoryRemoteAddressNV;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetMemoryRemoteAddressNV;
+	if (__info.replace && __info.replace->vkGetMemoryRemoteAddressNV) {
+		__fn = __info.replace->vkGetMemoryRemoteAddressNV;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetMemoryRemoteAddressNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetMemoryRemoteAddressNV", (PFN_vkVoidFunction)__fn); }
 	auto ret = __fn(device, pMemoryGetRemoteAddressInfo, pAddress);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetMemoryRemoteAddressNV", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetMemoryRemoteAddressNV", (PFN_vkVoidFunction)__fn); }
 	return ret;
 }
 
@@ -6967,53 +7433,58 @@ static VkResult xl_hook_tl_deviceHookTable_vkGetMemoryRemoteAddressNV(VkDevice d
 #if defined(VK_EXT_extended_dynamic_state2)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_t patchControlPoints) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetPatchControlPointsEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetPatchControlPointsEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetPatchControlPointsEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetPatchControlPointsEXT;
+	if (__info.replace && __info.replace->vkCmdSetPatchControlPointsEXT) {
+		__fn = __info.replace->vkCmdSetPatchControlPointsEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetPatchControlPointsEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetPatchControlPointsEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, patchControlPoints);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetPatchControlPointsEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetPatchControlPointsEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetRasterizerDiscardEnableEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetRasterizerDiscardEnableEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetRasterizerDiscardEnableEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetRasterizerDiscardEnableEXT;
+	if (__info.replace && __info.replace->vkCmdSetRasterizerDiscardEnableEXT) {
+		__fn = __info.replace->vkCmdSetRasterizerDiscardEnableEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetRasterizerDiscardEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetRasterizerDiscardEnableEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, rasterizerDiscardEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetRasterizerDiscardEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetRasterizerDiscardEnableEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetDepthBiasEnableEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetDepthBiasEnableEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetDepthBiasEnableEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetDepthBiasEnableEXT;
+	if (__info.replace && __info.replace->vkCmdSetDepthBiasEnableEXT) {
+		__fn = __info.replace->vkCmdSetDepthBiasEnableEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBiasEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetDepthBiasEnableEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, depthBiasEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetDepthBiasEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetDepthBiasEnableEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetLogicOpEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetLogicOpEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetLogicOpEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetLogicOpEXT;
+	if (__info.replace && __info.replace->vkCmdSetLogicOpEXT) {
+		__fn = __info.replace->vkCmdSetLogicOpEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetLogicOpEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetLogicOpEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, logicOp);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetLogicOpEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetLogicOpEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetPrimitiveRestartEnableEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetPrimitiveRestartEnableEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetPrimitiveRestartEnableEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetPrimitiveRestartEnableEXT;
+	if (__info.replace && __info.replace->vkCmdSetPrimitiveRestartEnableEXT) {
+		__fn = __info.replace->vkCmdSetPrimitiveRestartEnableEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetPrimitiveRestartEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetPrimitiveRestartEnableEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, primitiveRestartEnable);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetPrimitiveRestartEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetPrimitiveRestartEnableEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_extended_dynamic_state2) */
@@ -7021,13 +7492,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetPrimitiveRestartEnableEXT(VkComma
 #if defined(VK_EXT_color_write_enable)
 
 static void xl_hook_tl_deviceHookTable_vkCmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkBool32* pColorWriteEnables) {
-	auto __fn = tl_deviceHookTable.table->vkCmdSetColorWriteEnableEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdSetColorWriteEnableEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdSetColorWriteEnableEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdSetColorWriteEnableEXT;
+	if (__info.replace && __info.replace->vkCmdSetColorWriteEnableEXT) {
+		__fn = __info.replace->vkCmdSetColorWriteEnableEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdSetColorWriteEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdSetColorWriteEnableEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, attachmentCount, pColorWriteEnables);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdSetColorWriteEnableEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdSetColorWriteEnableEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_color_write_enable) */
@@ -7035,23 +7507,25 @@ static void xl_hook_tl_deviceHookTable_vkCmdSetColorWriteEnableEXT(VkCommandBuff
 #if defined(VK_EXT_multi_draw)
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawMultiEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawMultiEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawMultiEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawMultiEXT;
+	if (__info.replace && __info.replace->vkCmdDrawMultiEXT) {
+		__fn = __info.replace->vkCmdDrawMultiEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawMultiEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawMultiEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawMultiEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawMultiEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkCmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawIndexedInfoEXT* pIndexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride, const int32_t* pVertexOffset) {
-	auto __fn = tl_deviceHookTable.table->vkCmdDrawMultiIndexedEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkCmdDrawMultiIndexedEXT) {
-		__fn = tl_deviceHookTable.replace->vkCmdDrawMultiIndexedEXT;
+	auto __info = DeviceTable_getHookInfo(commandBuffer);
+	auto __fn = __info.table->vkCmdDrawMultiIndexedEXT;
+	if (__info.replace && __info.replace->vkCmdDrawMultiIndexedEXT) {
+		__fn = __info.replace->vkCmdDrawMultiIndexedEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkCmdDrawMultiIndexedEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkCmdDrawMultiIndexedEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkCmdDrawMultiIndexedEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkCmdDrawMultiIndexedEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_multi_draw) */
@@ -7059,13 +7533,14 @@ static void xl_hook_tl_deviceHookTable_vkCmdDrawMultiIndexedEXT(VkCommandBuffer
 #if defined(VK_EXT_pageable_device_local_memory)
 
 static void xl_hook_tl_deviceHookTable_vkSetDeviceMemoryPriorityEXT(VkDevice device, VkDeviceMemory memory, float priority) {
-	auto __fn = tl_deviceHookTable.table->vkSetDeviceMemoryPriorityEXT;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkSetDeviceMemoryPriorityEXT) {
-		__fn = tl_deviceHookTable.replace->vkSetDeviceMemoryPriorityEXT;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkSetDeviceMemoryPriorityEXT;
+	if (__info.replace && __info.replace->vkSetDeviceMemoryPriorityEXT) {
+		__fn = __info.replace->vkSetDeviceMemoryPriorityEXT;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkSetDeviceMemoryPriorityEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkSetDeviceMemoryPriorityEXT", (PFN_vkVoidFunction)__fn); }
 	__fn(device, memory, priority);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkSetDeviceMemoryPriorityEXT", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkSetDeviceMemoryPriorityEXT", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_EXT_pageable_device_local_memory) */
@@ -7073,33 +7548,36 @@ static void xl_hook_tl_deviceHookTable_vkSetDeviceMemoryPriorityEXT(VkDevice dev
 #if defined(VK_KHR_maintenance4)
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceBufferMemoryRequirementsKHR(VkDevice device, const VkDeviceBufferMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceBufferMemoryRequirementsKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceBufferMemoryRequirementsKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceBufferMemoryRequirementsKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceBufferMemoryRequirementsKHR;
+	if (__info.replace && __info.replace->vkGetDeviceBufferMemoryRequirementsKHR) {
+		__fn = __info.replace->vkGetDeviceBufferMemoryRequirementsKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceBufferMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceBufferMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceBufferMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceBufferMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceImageMemoryRequirementsKHR(VkDevice device, const VkDeviceImageMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceImageMemoryRequirementsKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceImageMemoryRequirementsKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceImageMemoryRequirementsKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceImageMemoryRequirementsKHR;
+	if (__info.replace && __info.replace->vkGetDeviceImageMemoryRequirementsKHR) {
+		__fn = __info.replace->vkGetDeviceImageMemoryRequirementsKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceImageMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceImageMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceImageMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceImageMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 static void xl_hook_tl_deviceHookTable_vkGetDeviceImageSparseMemoryRequirementsKHR(VkDevice device, const VkDeviceImageMemoryRequirementsKHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) {
-	auto __fn = tl_deviceHookTable.table->vkGetDeviceImageSparseMemoryRequirementsKHR;
-	if (tl_deviceHookTable.replace && tl_deviceHookTable.replace->vkGetDeviceImageSparseMemoryRequirementsKHR) {
-		__fn = tl_deviceHookTable.replace->vkGetDeviceImageSparseMemoryRequirementsKHR;
+	auto __info = DeviceTable_getHookInfo(device);
+	auto __fn = __info.table->vkGetDeviceImageSparseMemoryRequirementsKHR;
+	if (__info.replace && __info.replace->vkGetDeviceImageSparseMemoryRequirementsKHR) {
+		__fn = __info.replace->vkGetDeviceImageSparseMemoryRequirementsKHR;
 	}
-	if (tl_deviceHookTable.preCall) { tl_deviceHookTable.preCall(tl_deviceHookTable.ctx, "vkGetDeviceImageSparseMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.preCall) { __info.preCall(__info.ctx, "vkGetDeviceImageSparseMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
 	__fn(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-	if (tl_deviceHookTable.postCall) { tl_deviceHookTable.postCall(tl_deviceHookTable.ctx, "vkGetDeviceImageSparseMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
+	if (__info.postCall) { __info.postCall(__info.ctx, "vkGetDeviceImageSparseMemoryRequirementsKHR", (PFN_vkVoidFunction)__fn); }
 }
 
 #endif /* defined(VK_KHR_maintenance4) */
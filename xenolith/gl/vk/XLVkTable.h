@@ -879,6 +879,14 @@ void setDeviceHookThreadContext(
 		void (*preCall) (void *, const char *, PFN_vkVoidFunction),
 		void (*postCall) (void *, const char *, PFN_vkVoidFunction),
 		const DeviceTable *table, const DeviceTable *replace, void *ctx);
+
+// original table and hook callbacks of device, used by device hooks on any thread
+void registerDeviceHookTable(VkDevice, const DeviceTable *);
+void setDeviceHookContext(VkDevice,
+		void (*preCall) (void *, const char *, PFN_vkVoidFunction),
+		void (*postCall) (void *, const char *, PFN_vkVoidFunction),
+		const DeviceTable *replace, void *ctx);
+void unregisterDeviceHookTable(VkDevice);
 #endif
 
 }
@@ -62,6 +62,9 @@ void TextureSetLayout::invalidate(Device &dev) {
 	_emptyImageView = nullptr;
 	_solidImage = nullptr;
 	_solidImageView = nullptr;
+
+	std::unique_lock<Mutex> lock(_mutex);
+	_sets.clear();
 }
 
 bool TextureSetLayout::compile(Device &dev, const Vector<VkSampler> &samplers) {
@@ -126,21 +129,49 @@ bool TextureSetLayout::compile(Device &dev, const Vector<VkSampler> &samplers) {
 	return true;
 }
 
-Rc<TextureSet> TextureSetLayout::acquireSet(Device &dev) {
+Rc<TextureSet> TextureSetLayout::acquireSet(Device &dev, uint64_t tag) {
+	Vector<Rc<TextureSet>> released;
+
 	std::unique_lock<Mutex> lock(_mutex);
-	if (_sets.empty()) {
+	auto order = ++ _acquireOrder;
+
+	Rc<TextureSet> ret;
+	auto it = _sets.begin();
+	while (it != _sets.end()) {
+		if ((*it)->getReferenceCount() == 1) {
+			if ((*it)->getTag() == tag) {
+				ret = *it;
+			} else if (order - (*it)->getAcquireOrder() > SetIdleLimit) {
+				// set is not used by any frame, so its descriptor pool can be destroyed
+				released.emplace_back(move(*it));
+				it = _sets.erase(it);
+				continue;
+			} else if (!ret) {
+				ret = *it;
+			}
+		}
+		++ it;
+	}
+
+	if (ret) {
+		ret->setTag(tag);
+		ret->setAcquireOrder(order);
 		lock.unlock();
-		return Rc<TextureSet>::create(dev, *this);
-	} else {
-		auto v = move(_sets.back());
-		_sets.pop_back();
-		return v;
+		return ret;
 	}
-}
 
-void TextureSetLayout::releaseSet(Rc<TextureSet> &&set) {
-	std::unique_lock<Mutex> lock(_mutex);
-	_sets.emplace_back(move(set));
+	lock.unlock();
+	released.clear();
+
+	ret = Rc<TextureSet>::create(dev, *this);
+	if (ret) {
+		ret->setTag(tag);
+		ret->setAcquireOrder(order);
+
+		lock.lock();
+		_sets.emplace_back(ret);
+	}
+	return ret;
 }
 
 void TextureSetLayout::initDefault(Device &dev, Loop &loop, Function<void(bool)> &&cb) {
@@ -505,6 +536,7 @@ void TextureSet::write(const gl::MaterialLayout &set) {
 
 void TextureSet::dropPendingBarriers() {
 	_pendingImageBarriers.clear();
+	_pendingBufferBarriers.clear();
 }
 
 Device *TextureSet::getDevice() const {
@@ -621,9 +653,9 @@ void TextureSet::writeBuffers(Vector<VkWriteDescriptorSet> &writes, const gl::Ma
 	});
 
 	if (_partiallyBound) {
-		_layoutBuffers.resize(set.usedBufferSlots, nullptr);
+		_layoutBuffers.resize(set.usedBufferSlots);
 	} else {
-		_layoutBuffers.resize(set.bufferSlots.size(), nullptr);
+		_layoutBuffers.resize(set.bufferSlots.size());
 	}
 
 	auto pushWritten = [&] {
@@ -642,7 +674,7 @@ void TextureSet::writeBuffers(Vector<VkWriteDescriptorSet> &writes, const gl::Ma
 	};
 
 	for (uint32_t i = 0; i < set.usedBufferSlots; ++ i) {
-		if (set.bufferSlots[i].buffer && _layoutBuffers[i] != set.bufferSlots[i].buffer) {
+		if (set.bufferSlots[i].buffer && _layoutBuffers[i].get() != set.bufferSlots[i].buffer.get()) {
 			// replace old buffer in descriptor
 			if (!localBuffers) {
 				localBuffers = &bufferList.emplace_front(Vector<VkDescriptorBufferInfo>());
@@ -659,7 +691,7 @@ void TextureSet::writeBuffers(Vector<VkWriteDescriptorSet> &writes, const gl::Ma
 			}
 			_layoutBuffers[i] = set.bufferSlots[i].buffer;
 			++ bufferWriteData.descriptorCount;
-		} else if (!_partiallyBound && !set.bufferSlots[i].buffer && _layoutBuffers[i] != _layout->getEmptyBuffer()) {
+		} else if (!_partiallyBound && !set.bufferSlots[i].buffer && _layoutBuffers[i].get() != _layout->getEmptyBuffer().get()) {
 			// if partiallyBound feature is not available, drop old buffers to preallocated empty buffer
 			if (!localBuffers) {
 				localBuffers = &bufferList.emplace_front(Vector<VkDescriptorBufferInfo>());
@@ -667,7 +699,7 @@ void TextureSet::writeBuffers(Vector<VkWriteDescriptorSet> &writes, const gl::Ma
 			localBuffers->emplace_back(VkDescriptorBufferInfo({
 				_layout->getEmptyBuffer()->getBuffer(), 0, VK_WHOLE_SIZE
 			}));
-			_layoutBuffers[i] = _layout->getEmptyBuffer();
+			_layoutBuffers[i] = Rc<gl::BufferObject>(_layout->getEmptyBuffer().get());
 			++ bufferWriteData.descriptorCount;
 		} else {
 			// descriptor was not changed, no need to write, push written
@@ -681,14 +713,14 @@ void TextureSet::writeBuffers(Vector<VkWriteDescriptorSet> &writes, const gl::Ma
 	if (!_partiallyBound) {
 		// write empty buffers into empty descriptors
 		for (uint32_t i = set.usedBufferSlots; i < _count; ++ i) {
-			if (_layoutBuffers[i] != _layout->getEmptyBuffer()) {
+			if (_layoutBuffers[i].get() != _layout->getEmptyBuffer().get()) {
 				if (!localBuffers) {
 					localBuffers = &bufferList.emplace_front(Vector<VkDescriptorBufferInfo>());
 				}
 				localBuffers->emplace_back(VkDescriptorBufferInfo({
 					_layout->getEmptyBuffer()->getBuffer(), 0, VK_WHOLE_SIZE
 				}));
-				_layoutBuffers[i] = _layout->getEmptyBuffer();
+				_layoutBuffers[i] = Rc<gl::BufferObject>(_layout->getEmptyBuffer().get());
 				++ bufferWriteData.descriptorCount;
 			} else {
 				// no need to write, push written
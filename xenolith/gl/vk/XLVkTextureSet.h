@@ -37,6 +37,10 @@ class TextureSetLayout : public Ref {
 public:
 	using AttachmentLayout = renderqueue::AttachmentLayout;
 
+	// free set, that was not acquired within this number of acquisitions, is released
+	// with its descriptor pool and retained buffers
+	static constexpr uint64_t SetIdleLimit = 256;
+
 	virtual ~TextureSetLayout() { }
 
 	bool init(Device &dev, uint32_t imageCount, uint32_t bufferLimit);
@@ -52,8 +56,10 @@ public:
 	const Rc<ImageView> &getSolidImageView() const { return _solidImageView; }
 	const Rc<Buffer> &getEmptyBuffer() const { return _emptyBuffer; }
 
-	Rc<TextureSet> acquireSet(Device &dev);
-	void releaseSet(Rc<TextureSet> &&);
+	// Acquire set, that is not used by any material set (and so, by any frame in flight)
+	// Sets are reused in ring manner, set, previously written with the same tag is preferred,
+	// so, only changed descriptors should be rewritten
+	Rc<TextureSet> acquireSet(Device &dev, uint64_t tag = 0);
 
 	void initDefault(Device &dev, Loop &, Function<void(bool)> &&);
 
@@ -85,7 +91,10 @@ protected:
 	Rc<Buffer> _emptyBuffer;
 
 	mutable Mutex _mutex;
+
+	// all sets, allocated from layout; set is free, when layout holds the only reference
 	Vector<Rc<TextureSet>> _sets;
+	uint64_t _acquireOrder = 0;
 };
 
 class TextureSet : public gl::TextureSet {
@@ -96,6 +105,12 @@ public:
 
 	VkDescriptorSet getSet() const { return _set; }
 
+	uint64_t getTag() const { return _tag; }
+	void setTag(uint64_t tag) { _tag = tag; }
+
+	uint64_t getAcquireOrder() const { return _acquireOrder; }
+	void setAcquireOrder(uint64_t value) { _acquireOrder = value; }
+
 	virtual void write(const gl::MaterialLayout &) override;
 
 	const Vector<ImageMemoryBarrier> &getPendingImageBarriers() const { return _pendingImageBarriers; }
@@ -116,6 +131,8 @@ protected:
 	bool _partiallyBound = false;
 	const TextureSetLayout *_layout = nullptr;
 	uint32_t _count = 0;
+	uint64_t _tag = 0;
+	uint64_t _acquireOrder = 0;
 	VkDescriptorSet _set = VK_NULL_HANDLE;
 	VkDescriptorPool _pool = VK_NULL_HANDLE;
 	Vector<ImageMemoryBarrier> _pendingImageBarriers;
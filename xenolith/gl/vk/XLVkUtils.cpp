@@ -397,6 +397,8 @@ static ExtensionFlags getFlagForExtension(const char *name) {
 		return ExtensionFlags::GetMemoryRequirements2;
 	} else if (strcmp(name, VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME) == 0) {
 		return ExtensionFlags::DedicatedAllocation;
+	} else if (strcmp(name, VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME) == 0) {
+		return ExtensionFlags::IncrementalPresent;
 #if __APPLE__
 	} else if (strcmp(name, VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) == 0) {
 		return ExtensionFlags::Portability;
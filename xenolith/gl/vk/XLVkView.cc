@@ -82,6 +82,10 @@ void View::threadDispose() {
 	clearImages();
 	_running = false;
 
+	_loop->performOnGlThread([loop = _loop, view = this] {
+		loop->getFrameCache()->setViewExtent(view, Extent2(0, 0));
+	});
+
 	if (_options.renderImageOffscreen) {
 		// offscreen does not need swapchain outside of view thread
 		_swapchain->invalidate();
@@ -134,7 +138,13 @@ void View::update(bool displayLink) {
 		}
 	}
 
-	if (_swapchain && _options.renderOnDemand && _scheduledTime < clock && _framesInProgress == 0 && _swapchain->getAcquiredImagesCount() == 0) {
+	if (_scheduledFrameStart && _scheduledFrameStart <= clock) {
+		_scheduledFrameStart = 0;
+		scheduleNextImage(0, false);
+	}
+
+	if (_swapchain && _options.renderOnDemand && _scheduledTime < clock && !_scheduledFrameStart
+			&& _framesInProgress == 0 && _swapchain->getAcquiredImagesCount() == 0) {
 		scheduleNextImage(0, true);
 	}
 }
@@ -275,7 +285,7 @@ bool View::present(Rc<ImageStorage> &&object) {
 		performOnThread([this, object = move(object), gen] () mutable {
 			presentImmediate(move(object), [this, gen] (bool success) {
 				if (gen == _gen) {
-					scheduleNextImage(0, false);
+					schedulePacedImage();
 				}
 			});
 			if (_swapchain->isDeprecated()) {
@@ -428,6 +438,9 @@ bool View::presentImmediate(Rc<ImageStorage> &&object, Function<void(bool)> &&sc
 	auto result = _swapchain->present(*queue, targetImage);
 	updateFrameInterval();
 
+	_lastPresentTime = platform::device::_clock(platform::device::ClockType::Monotonic);
+	updateInputLatency(object->getInputTime(), _lastPresentTime);
+
 	XL_VKAPI_LOG("[PresentImmediate] [present] [", platform::device::_clock(platform::device::Monotonic) - t, "]");
 
 	if (result == VK_SUCCESS) {
@@ -437,18 +450,18 @@ bool View::presentImmediate(Rc<ImageStorage> &&object, Function<void(bool)> &&sc
 		}
 		if (scheduleCb) {
 			pool->autorelease(object);
-			presentFence->addRelease([dev, pool = pool ? move(pool) : nullptr, scheduleCb = move(scheduleCb), object = move(object), loop] (bool success) mutable {
+			presentFence->addRelease([this, dev, pool = pool ? move(pool) : nullptr, scheduleCb = move(scheduleCb), object = move(object)] (bool success) mutable {
 				if (pool) {
 					dev->releaseCommandPoolUnsafe(move(pool));
 				}
-				loop->releaseImage(move(object));
+				releaseOffscreenImage(move(object));
 				scheduleCb(success);
 			}, this, "View::presentImmediate::releaseCommandPoolUnsafe");
 			scheduleFence(move(presentFence));
 		} else {
 			presentFence->check(*((Loop *)_loop.get()), false);
 			dev->releaseCommandPoolUnsafe(move(pool));
-			loop->releaseImage(move(object));
+			releaseOffscreenImage(move(object));
 		}
 		XL_VKAPI_LOG("[PresentImmediate] [presentFence] [", platform::device::_clock(platform::device::Monotonic) - t, "]");
 		presentFence = nullptr;
@@ -499,31 +512,53 @@ void View::captureImage(StringView name, const Rc<gl::ImageObject> &image, Attac
 	auto str = name.str<Interface>();
 	_device->getTextureSetLayout()->readImage(*_device, *(Loop *)_loop.get(), (Image *)image.get(), l,
 		[str] (const gl::ImageInfo &info, BytesView view) mutable {
-			if (!StringView(str).ends_with(".png")) {
-				str = str + String(".png");
-			}
-			if (!view.empty()) {
-				auto fmt = gl::getImagePixelFormat(info.format);
-				bitmap::PixelFormat pixelFormat = bitmap::PixelFormat::Auto;
-				switch (fmt) {
-				case gl::PixelFormat::A: pixelFormat = bitmap::PixelFormat::A8; break;
-				case gl::PixelFormat::IA: pixelFormat = bitmap::PixelFormat::IA88; break;
-				case gl::PixelFormat::RGB: pixelFormat = bitmap::PixelFormat::RGB888; break;
-				case gl::PixelFormat::RGBA: pixelFormat = bitmap::PixelFormat::RGBA8888; break;
-				default: break;
-				}
-				if (pixelFormat != bitmap::PixelFormat::Auto) {
-					Bitmap bmp(view.data(), info.extent.width, info.extent.height, pixelFormat);
-					bmp.save(str);
+			saveImage(str, info, view);
+		});
+}
+
+bool View::saveImage(StringView name, const gl::ImageInfo &info, BytesView view) {
+	auto str = name.str<Interface>();
+	if (!StringView(str).ends_with(".png")) {
+		str = str + String(".png");
+	}
+	if (!view.empty()) {
+		auto fmt = gl::getImagePixelFormat(info.format);
+		bitmap::PixelFormat pixelFormat = bitmap::PixelFormat::Auto;
+		switch (fmt) {
+		case gl::PixelFormat::A: pixelFormat = bitmap::PixelFormat::A8; break;
+		case gl::PixelFormat::IA: pixelFormat = bitmap::PixelFormat::IA88; break;
+		case gl::PixelFormat::RGB: pixelFormat = bitmap::PixelFormat::RGB888; break;
+		case gl::PixelFormat::RGBA: pixelFormat = bitmap::PixelFormat::RGBA8888; break;
+		default: break;
+		}
+		if (pixelFormat != bitmap::PixelFormat::Auto) {
+			Bitmap bmp(view.data(), info.extent.width, info.extent.height, pixelFormat);
+			switch (info.format) {
+			case gl::ImageFormat::B8G8R8A8_UNORM:
+			case gl::ImageFormat::B8G8R8A8_SRGB: {
+				// swapchain-compatible images are in BGRA order
+				auto data = bmp.dataPtr();
+				for (size_t i = 0; i < size_t(info.extent.width) * info.extent.height; ++ i) {
+					std::swap(data[i * 4], data[i * 4 + 2]);
 				}
+				break;
 			}
-		});
+			default: break;
+			}
+			return bmp.save(str);
+		}
+	}
+	return false;
 }
 
 void View::captureImage(Function<void(const gl::ImageInfo &info, BytesView view)> &&cb, const Rc<gl::ImageObject> &image, AttachmentLayout l) const {
 	_device->getTextureSetLayout()->readImage(*_device, *(Loop *)_loop.get(), (Image *)image.get(), l, move(cb));
 }
 
+void View::releaseOffscreenImage(Rc<ImageStorage> &&image) {
+	((Loop *)_loop.get())->releaseImage(move(image));
+}
+
 void View::scheduleFence(Rc<Fence> &&fence) {
 	if (_running.load()) {
 		performOnThread([this, fence = move(fence)] () mutable {
@@ -546,6 +581,43 @@ void View::mapWindow() {
 	scheduleNextImage(_frameInterval, false);
 }
 
+void View::setFramePacing(FramePacing pacing, uint64_t interval) {
+	_options.framePacing = pacing;
+	if (interval) {
+		_options.framePacingInterval = interval;
+	}
+}
+
+void View::setDamageTracking(bool value) {
+	performOnThread([this, value] {
+		_options.enableDamageTracking = value;
+		if (_swapchain) {
+			_swapchain->setDamageTracking(_options.enableDamageTracking && !_options.renderImageOffscreen);
+		}
+	}, this, true);
+}
+
+void View::getDamageTrackingInfo(Function<void(const DamageTrackingInfo &)> &&cb) {
+	performOnThread([this, cb = move(cb)] {
+		DamageTrackingInfo info;
+		info.requested = _options.enableDamageTracking;
+		info.offscreen = _options.renderImageOffscreen;
+		if (_swapchain) {
+			auto stat = _swapchain->getDamageStat();
+			auto &extent = _swapchain->getImageInfo().extent;
+
+			info.active = _swapchain->isDamageTrackingEnabled();
+			info.incrementalPresent = _swapchain->isIncrementalPresent();
+			info.extent = Extent2(extent.width, extent.height);
+			info.frames = stat.frames;
+			info.partialFrames = stat.partialFrames;
+			info.lastArea = URect{uint32_t(stat.lastArea.offset.x), uint32_t(stat.lastArea.offset.y),
+				stat.lastArea.extent.width, stat.lastArea.extent.height};
+		}
+		cb(info);
+	}, this, true);
+}
+
 void View::setReadyForNextFrame() {
 	performOnThread([this] {
 		if (!_readyForNextFrame) {
@@ -573,6 +645,7 @@ void View::invalidate() {
 void View::scheduleNextImage(uint64_t windowOffset, bool immediately) {
 	performOnThread([this, windowOffset, immediately] {
 		_scheduledTime = platform::device::_clock(platform::device::ClockType::Monotonic) + _frameInterval + config::OnDemandFrameInterval;
+		_scheduledFrameStart = 0;
 		if (!_options.renderOnDemand || _readyForNextFrame || immediately) {
 			_frameEmitter->setEnableBarrier(_options.enableFrameEmitterBarrier);
 
@@ -589,18 +662,51 @@ void View::scheduleNextImage(uint64_t windowOffset, bool immediately) {
 	}, this, true);
 }
 
+void View::schedulePacedImage() {
+	performOnThread([this] {
+		auto now = platform::device::_clock(platform::device::ClockType::Monotonic);
+		auto start = now;
+
+		switch (_options.framePacing) {
+		case FramePacing::Throughput:
+			break;
+		case FramePacing::LowLatency: {
+			// expected time from frame start to present with some headroom for frame time variation
+			auto frameTime = _frameEmitter->getAvgFrameTime() + getUpdateInterval() + _frameInterval / 10;
+			if (frameTime < _frameInterval) {
+				start = _lastPresentTime + _frameInterval - frameTime;
+			}
+			break;
+		}
+		case FramePacing::Fixed:
+			start = _frameStartTime + _options.framePacingInterval;
+			break;
+		}
+
+		if (start <= now) {
+			scheduleNextImage(0, false);
+		} else {
+			// will be started with update()
+			_scheduledFrameStart = start;
+		}
+	}, this, true);
+}
+
 void View::scheduleSwapchainImage(uint64_t windowOffset, ScheduleImageMode mode) {
 	Rc<SwapchainImage> swapchainImage;
 	Rc<FrameRequest> newFrameRequest;
 	auto constraints = _constraints;
 
+	_frameStartTime = platform::device::_clock(platform::device::ClockType::Monotonic);
+
 	if (mode != ScheduleImageMode::AcquireOffscreenImage) {
         if (!_swapchain) {
             return;
         }
 
+		// paced frames are started in time, so they should be presented as soon as possible
 		auto fullOffset = getUpdateInterval() + windowOffset;
-		if (fullOffset > _frameInterval) {
+		if (fullOffset > _frameInterval || _options.framePacing != FramePacing::Throughput) {
 			swapchainImage = Rc<SwapchainImage>::create(Rc<SwapchainHandle>(_swapchain), _frameOrder, 0);
 		} else {
 			auto presentWindow = platform::device::_clock(platform::device::ClockType::Monotonic) + _frameInterval - getUpdateInterval() - windowOffset;
@@ -618,7 +724,11 @@ void View::scheduleSwapchainImage(uint64_t windowOffset, ScheduleImageMode mode)
 	// make new frame request immediately
 	_loop->getApplication()->performOnMainThread([this, req = move(newFrameRequest), swapchainImage] () mutable {
 		if (_director->acquireFrame(req)) {
-			_loop->performOnGlThread([this, req = move(req), swapchainImage = move(swapchainImage)] () mutable {
+			// input, handled before this point, was sampled by frame
+			auto inputTime = _inputTime;
+			_inputTime = 0;
+
+			_loop->performOnGlThread([this, req = move(req), swapchainImage = move(swapchainImage), inputTime] () mutable {
 				if (_loop->isRunning() && _swapchain) {
 					auto &queue = req->getQueue();
 					auto a = queue->getPresentImageOutput();
@@ -632,9 +742,10 @@ void View::scheduleSwapchainImage(uint64_t windowOffset, ScheduleImageMode mode)
 					}
 
 					req->setRenderTarget(a, Rc<ImageStorage>(swapchainImage));
-					req->setOutput(a, this, [this] (const Rc<gl::View> &, renderqueue::FrameAttachmentData &data, bool success) {
+					req->setOutput(a, this, [this, inputTime] (const Rc<gl::View> &, renderqueue::FrameAttachmentData &data, bool success) {
 						-- _framesInProgress;
 						if (success) {
+							data.image->setInputTime(inputTime);
 							return present(move(data.image));
 						} else {
 							invalidateTarget(move(data.image));
@@ -861,6 +972,8 @@ bool View::createSwapchain(const gl::SurfaceInfo &info, gl::SwapchainConfig &&cf
 			_constraints.extent = cfg.extent;
 			_constraints.transform = cfg.transform;
 
+			_swapchain->setDamageTracking(_options.enableDamageTracking && !_options.renderImageOffscreen);
+
 			Vector<uint64_t> ids;
 			auto &cache = _loop->getFrameCache();
 			for (auto &it : _swapchain->getImages()) {
@@ -875,11 +988,12 @@ bool View::createSwapchain(const gl::SurfaceInfo &info, gl::SwapchainConfig &&cf
 				}
 			}
 
-			_loop->performOnGlThread([loop = _loop, ids] {
+			_loop->performOnGlThread([loop = _loop, ids, view = this, extent = cfg.extent] {
 				auto &cache = loop->getFrameCache();
 				for (auto &id : ids) {
 					cache->addImageView(id);
 				}
+				cache->setViewExtent(view, extent);
 			});
 		}
 
@@ -983,8 +1097,13 @@ void View::runScheduledPresent(Rc<SwapchainImage> &&object) {
 }
 
 void View::presentWithQueue(DeviceQueue &queue, Rc<ImageStorage> &&image) {
+	auto inputTime = image->getInputTime();
 	auto res = _swapchain->present(queue, move(image));
 	auto dt = updateFrameInterval();
+
+	_lastPresentTime = platform::device::_clock(platform::device::ClockType::Monotonic);
+	updateInputLatency(inputTime, _lastPresentTime);
+
 	if (res == VK_SUBOPTIMAL_KHR || res == VK_ERROR_OUT_OF_DATE_KHR) {
 		_swapchain->deprecate(false);
 	}
@@ -1009,6 +1128,10 @@ void View::presentWithQueue(DeviceQueue &queue, Rc<ImageStorage> &&image) {
 				scheduleNextImage(0, true);
 				return;
 			}
+			if (_options.framePacing != FramePacing::Throughput) {
+				schedulePacedImage();
+				return;
+			}
 			if (_options.flattenFrameRate) {
 				const auto maxWindow = _frameInterval - getUpdateInterval() + _frameInterval / 20;
 				const auto currentWindow = std::max(dt.first, dt.second);
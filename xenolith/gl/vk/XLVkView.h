@@ -32,6 +32,18 @@ namespace stappler::xenolith::vk {
 
 class View : public gl::View {
 public:
+	enum class FramePacing {
+		// start next frame as soon as previous one was presented
+		Throughput,
+
+		// delay start of the next frame, so it's ready just in time for the next present interval;
+		// delay is based on measured frame time (including GPU time), input is sampled as late as possible
+		LowLatency,
+
+		// start frames no more often then framePacingInterval
+		Fixed,
+	};
+
 	struct EngineOptions {
 		// on some systems, we can not acquire next image until queue operations on previous image is finished
 		// on this system, we wait on last swapchain pass fence before acquire swapchain image
@@ -70,6 +82,18 @@ public:
 
 		// Запускать следующий кадр только по запросу либо наличию действий в процессе
 		bool renderOnDemand = true;
+
+		// Redraw only damaged area of swapchain image (see Scene damage tracking), keeping the rest of image
+		// from the last frame, rendered into it. Damaged area is passed to presentation engine,
+		// if VK_KHR_incremental_present is supported. Requires, that presentation engine preserves
+		// swapchain images contents, so it's disabled by default
+		bool enableDamageTracking = false;
+
+		// Frame pacing mode (ignored with followDisplayLink, where display link drives frames)
+		FramePacing framePacing = FramePacing::Throughput;
+
+		// Minimal interval between frame starts for FramePacing::Fixed, in microseconds
+		uint64_t framePacingInterval = 1'000'000 / 30;
 	};
 
 	virtual ~View();
@@ -99,6 +123,9 @@ public:
 	virtual void captureImage(Function<void(const gl::ImageInfo &info, BytesView view)> &&,
 			const Rc<gl::ImageObject> &image, AttachmentLayout l) const override;
 
+	// write image data, read with captureImage, as png file
+	static bool saveImage(StringView, const gl::ImageInfo &info, BytesView view);
+
 	void scheduleFence(Rc<Fence> &&);
 
 	virtual uint64_t getUpdateInterval() const { return 0; }
@@ -109,6 +136,29 @@ public:
 
 	virtual void setReadyForNextFrame() override;
 
+	// should be called before view's thread is started or on view's thread
+	void setFramePacing(FramePacing, uint64_t interval = 0);
+	FramePacing getFramePacing() const { return _options.framePacing; }
+	uint64_t getFramePacingInterval() const { return _options.framePacingInterval; }
+
+	struct DamageTrackingInfo {
+		bool requested = false; // EngineOptions::enableDamageTracking
+		bool offscreen = false; // images are rendered offscreen, damage tracking can not be used
+		bool active = false; // current swapchain tracks damage
+		bool incrementalPresent = false; // damaged area is passed to presentation engine
+		Extent2 extent; // swapchain image extent
+		uint64_t frames = 0; // frames, rendered with damage tracking
+		uint64_t partialFrames = 0; // frames, rendered only within damaged area
+		URect lastArea; // area, redrawn by last partial frame, in framebuffer pixels
+	};
+
+	// can be called from any thread, applied to current swapchain on view's thread
+	void setDamageTracking(bool);
+	bool isDamageTrackingEnabled() const { return _options.enableDamageTracking; }
+
+	// callback is called on view's thread with damage tracking state of current swapchain
+	void getDamageTrackingInfo(Function<void(const DamageTrackingInfo &)> &&);
+
 protected:
 	using gl::View::init;
 
@@ -126,6 +176,9 @@ protected:
 
 	void scheduleNextImage(uint64_t windowOffset, bool immediately);
 
+	// schedule next frame start according to framePacing option
+	void schedulePacedImage();
+
 	// Начать подготовку нового изображения для презентации
 	// Создает объект кадра и начинает сбор данных для его рисования
 	// Создает объект изображения и начинает цикл его захвата
@@ -152,6 +205,11 @@ protected:
 	void runScheduledPresent(Rc<SwapchainImage> &&);
 
 	virtual void presentWithQueue(DeviceQueue &, Rc<ImageStorage> &&);
+
+	// offscreen image was copied into swapchain image, and can be returned into frame cache
+	// image is in TransferSrcOptimal layout at this moment
+	virtual void releaseOffscreenImage(Rc<ImageStorage> &&);
+
 	void invalidateSwapchainImage(Rc<ImageStorage> &&);
 
 	Pair<uint64_t, uint64_t> updateFrameInterval();
@@ -173,6 +231,9 @@ protected:
 	uint64_t _frameOrder = 0;
 	uint64_t _onDemandOrder = 1;
 	uint64_t _scheduledTime = 0;
+	uint64_t _scheduledFrameStart = 0; // delayed frame start for paced modes
+	uint64_t _frameStartTime = 0;
+	uint64_t _lastPresentTime = 0;
 	Rc<Surface> _surface;
 	Rc<Instance> _instance;
 	Rc<Device> _device;
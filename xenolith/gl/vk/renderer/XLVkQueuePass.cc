@@ -31,6 +31,7 @@
 #include "XLVkDevice.h"
 #include "XLVkTextureSet.h"
 #include "XLVkView.h"
+#include "XLVkObject.h"
 #include "XLGlLoop.h"
 
 namespace stappler::xenolith::vk {
@@ -109,6 +110,11 @@ void QueuePassHandle::invalidate() {
 		_pool = nullptr;
 	}
 
+	for (auto &it : _secondaryPools) {
+		_device->releaseCommandPoolUnsafe(move(it));
+	}
+	_secondaryPools.clear();
+
 	if (_queue) {
 		_device->releaseQueue(move(_queue));
 		_queue = nullptr;
@@ -121,7 +127,8 @@ bool QueuePassHandle::prepare(FrameQueue &q, Function<void(bool)> &&cb) {
 	_onPrepared = move(cb);
 	_loop = (Loop *)q.getLoop();
 	_device = (Device *)q.getFrame()->getDevice();
-	_pool = _device->acquireCommandPool(getQueueOps());
+	_queueOps = _device->getPassQueueOps(getQueueOps());
+	_pool = _device->acquireCommandPool(_queueOps);
 
 	_constraints = q.getFrame()->getFrameConstraints();
 
@@ -130,6 +137,14 @@ bool QueuePassHandle::prepare(FrameQueue &q, Function<void(bool)> &&cb) {
 		return false;
 	}
 
+	_queueFamilyIdx = _pool->getFamilyIdx();
+
+	if (_loop->isGpuTimestampsEnabled()) {
+		if (auto family = _device->getQueueFamily(_pool->getFamilyIdx())) {
+			_timestampBits = family->timestampValidBits;
+		}
+	}
+
 	// If updateAfterBind feature supported for all renderpass bindings
 	// - we can use separate thread to update them
 	// (ordering of bind|update is not defined in this case)
@@ -167,6 +182,7 @@ bool QueuePassHandle::prepare(FrameQueue &q, Function<void(bool)> &&cb) {
 
 		auto ret = doPrepareCommands(frame);
 		if (!ret.empty()) {
+			writeTimestamps(ret);
 			_buffers = move(ret);
 			return true;
 		}
@@ -202,18 +218,29 @@ void QueuePassHandle::submit(FrameQueue &q, Rc<FrameSync> &&sync, Function<void(
 
 	_fence->setTag(getName());
 
-	_fence->addRelease([dev = _device, pool = _pool, loop = q.getLoop()] (bool success) {
+	_fence->addRelease([dev = _device, pool = _pool, pools = move(_secondaryPools), loop = q.getLoop()] (bool success) mutable {
 		dev->releaseCommandPool(*loop, Rc<CommandPool>(pool));
+		for (auto &it : pools) {
+			dev->releaseCommandPool(*loop, move(it));
+		}
 	}, nullptr, "RenderPassHandle::submit dev->releaseCommandPool");
+	_secondaryPools.clear();
 	_fence->addRelease([this, func = move(onComplete), q = &q] (bool success) mutable {
+		resolveTimestamps(*q);
 		doComplete(*q, move(func), success);
 	}, this, "RenderPassHandle::submit onComplete");
 
 	_sync = move(sync);
 
-	auto ops = getQueueOps();
+	if (_queueOps == QueueOperations::None) {
+		// command pool was acquired by subclass
+		_queueOps = getQueueOps();
+		_queueFamilyIdx = _pool->getFamilyIdx();
+	}
+
+	addQueueSemaphores(q);
 
-	_device->acquireQueue(ops, *f.get(), [this, onSubmited = move(onSubmited)]  (FrameHandle &frame, const Rc<DeviceQueue> &queue) mutable {
+	_device->acquireQueue(_queueOps, *f.get(), [this, onSubmited = move(onSubmited)]  (FrameHandle &frame, const Rc<DeviceQueue> &queue) mutable {
 		_queue = queue;
 
 		frame.performInQueue([this, onSubmited = move(onSubmited)] (FrameHandle &frame) mutable {
@@ -236,6 +263,70 @@ QueueOperations QueuePassHandle::getQueueOps() const {
 	return ((QueuePass *)_renderPass.get())->getQueueOps();
 }
 
+void QueuePassHandle::addQueueSemaphores(FrameQueue &q) {
+	auto data = q.getRenderPass(_data);
+	if (!data) {
+		return;
+	}
+
+	// wait for required passes, that signaled semaphores for us (other queue family or forced semaphores)
+	// (required pass is already submitted at this point, so its semaphores are defined)
+	for (auto &it : data->required) {
+		if (toInt(it.requiredState) < toInt(renderqueue::FrameRenderPassState::Submitted)) {
+			continue;
+		}
+
+		auto handle = dynamic_cast<QueuePassHandle *>(it.data->handle.get());
+		if (!handle) {
+			continue;
+		}
+
+		for (auto &sem : handle->_queueSemaphores) {
+			if (sem.first != _data) {
+				continue;
+			}
+
+			renderqueue::PipelineStage stages = renderqueue::PipelineStage::None;
+			for (auto &a : data->attachments) {
+				auto &passes = a.second->passes;
+				if (std::find(passes.begin(), passes.end(), it.data) != passes.end()) {
+					stages |= a.first->dependency.initialUsageStage;
+				}
+			}
+
+			if (stages == renderqueue::PipelineStage::None) {
+				stages = renderqueue::PipelineStage::AllCommands;
+			}
+
+			_sync->waitAttachments.emplace_back(renderqueue::FrameSyncAttachment{nullptr, sem.second, nullptr, stages});
+		}
+	}
+
+	// signal semaphores for dependent passes, that will be submitted into other queue family
+	// (or for passes with other queue operations, when semaphores are forced)
+	for (auto &it : data->waiters) {
+		if (toInt(it.first) < toInt(renderqueue::FrameRenderPassState::Submitted)) {
+			continue;
+		}
+
+		for (auto &waiter : it.second) {
+			auto handle = dynamic_cast<QueuePassHandle *>(waiter->handle.get());
+			if (!handle) {
+				continue;
+			}
+
+			auto family = _device->getQueueFamily(_device->getPassQueueOps(handle->getQueueOps()));
+			if (family && (family->index != _queueFamilyIdx
+					|| (_device->isQueueSemaphoresForced() && handle->getQueueOps() != getQueueOps()))) {
+				auto sem = _loop->makeSemaphore();
+				_sync->signalAttachments.emplace_back(renderqueue::FrameSyncAttachment{nullptr, sem, nullptr});
+				_queueSemaphores.emplace_back(waiter->handle->getData(), move(sem));
+				_device->addQueueSemaphore();
+			}
+		}
+	}
+}
+
 Vector<const CommandBuffer *> QueuePassHandle::doPrepareCommands(FrameHandle &) {
 	auto buf = _pool->recordBuffer(*_device, [&] (CommandBuffer &buf) {
 		_data->impl.cast<RenderPassImpl>()->perform(*this, buf, [&] {
@@ -314,6 +405,59 @@ void QueuePassHandle::doComplete(FrameQueue &, Function<void(bool)> &&func, bool
 	func(success);
 }
 
+void QueuePassHandle::writeTimestamps(Vector<const CommandBuffer *> &buffers) {
+	if (_timestampBits == 0) {
+		return;
+	}
+
+	_queryPool = _device->acquireQueryPool();
+	if (!_queryPool) {
+		return;
+	}
+
+	auto table = _device->getTable();
+	auto pool = _queryPool->getPool();
+
+	auto begin = _pool->recordBuffer(*_device, [&] (CommandBuffer &buf) {
+		table->vkCmdResetQueryPool(buf.getBuffer(), pool, 0, _queryPool->getCount());
+		table->vkCmdWriteTimestamp(buf.getBuffer(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pool, 0);
+		return true;
+	});
+
+	auto end = _pool->recordBuffer(*_device, [&] (CommandBuffer &buf) {
+		table->vkCmdWriteTimestamp(buf.getBuffer(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pool, 1);
+		return true;
+	});
+
+	if (!begin || !end) {
+		_device->releaseQueryPool(move(_queryPool));
+		_queryPool = nullptr;
+		return;
+	}
+
+	buffers.emplace(buffers.begin(), begin);
+	buffers.emplace_back(end);
+}
+
+void QueuePassHandle::resolveTimestamps(FrameQueue &q) {
+	if (!_queryPool) {
+		return;
+	}
+
+	uint64_t data[2] = { 0, 0 };
+	auto result = _device->getTable()->vkGetQueryPoolResults(_device->getDevice(), _queryPool->getPool(), 0, 2,
+			sizeof(data), data, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+
+	if (result == VK_SUCCESS) {
+		uint64_t mask = (_timestampBits >= 64) ? maxOf<uint64_t>() : ((uint64_t(1) << _timestampBits) - 1);
+		auto ticks = ((data[1] & mask) - (data[0] & mask)) & mask;
+		q.getFrame()->addPassTime(getName(), uint64_t(double(ticks) * _device->getTimestampPeriod()));
+	}
+
+	_device->releaseQueryPool(move(_queryPool));
+	_queryPool = nullptr;
+}
+
 auto QueuePassHandle::updateMaterials(FrameHandle &frame, const Rc<gl::MaterialSet> &data, const Vector<Rc<gl::Material>> &materials,
 		SpanView<gl::MaterialId> dynamicMaterials, SpanView<gl::MaterialId> materialsToRemove) -> MaterialBuffers {
 	MaterialBuffers ret;
@@ -327,14 +471,18 @@ auto QueuePassHandle::updateMaterials(FrameHandle &frame, const Rc<gl::MaterialS
 		return MaterialBuffers();
 	}
 
+	uint64_t layoutIndex = 0;
 	for (auto &it : data->getLayouts()) {
-		frame.performRequiredTask([layout, data, target = &it] (FrameHandle &handle) {
+		// tag set with owner and layout index, so, sets from previous generations of this layout will be reused
+		auto tag = (uint64_t(reinterpret_cast<uintptr_t>(data->getOwner())) << 16) | layoutIndex;
+		frame.performRequiredTask([layout, data, target = &it, tag] (FrameHandle &handle) {
 			auto dev = (Device *)handle.getDevice();
 
-			target->set = Rc<gl::TextureSet>(layout->acquireSet(*dev));
+			target->set = Rc<gl::TextureSet>(layout->acquireSet(*dev, tag));
 			target->set->write(*target);
 			return true;
 		}, this, "RenderPassHandle::updateMaterials");
+		++ layoutIndex;
 	}
 
 	auto &bufferInfo = data->getInfo();
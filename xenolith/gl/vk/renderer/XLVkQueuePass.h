@@ -39,6 +39,7 @@ class SwapchainAttachmentHandle;
 class Framebuffer;
 class VertexBufferAttachment;
 class VertexBufferAttachmentHandle;
+class QueryPool;
 
 class QueuePass : public renderqueue::Pass {
 public:
@@ -69,6 +70,10 @@ public:
 	virtual QueueOperations getQueueOps() const;
 
 protected:
+	// passes on different queue families are not ordered by submission order,
+	// so dependent passes are synchronized with per-frame semaphores
+	void addQueueSemaphores(FrameQueue &);
+
 	virtual Vector<const CommandBuffer *> doPrepareCommands(FrameHandle &);
 	virtual bool doSubmit(FrameHandle &frame, Function<void(bool)> &&onSubmited);
 
@@ -89,6 +94,12 @@ protected:
 	virtual void doFinalizeTransfer(gl::MaterialSet * materials,
 			Vector<ImageMemoryBarrier> &outputImageBarriers, Vector<BufferMemoryBarrier> &outputBufferBarriers);
 
+	// surround pass commands with timestamp writes, if timestamps are enabled on loop
+	void writeTimestamps(Vector<const CommandBuffer *> &);
+
+	// read timestamps when fence is signaled, and send pass time into frame
+	void resolveTimestamps(FrameQueue &);
+
 	Function<void(bool)> _onPrepared;
 	bool _valid = true;
 	bool _commandsReady = false;
@@ -98,10 +109,21 @@ protected:
 	Loop *_loop = nullptr;
 	Rc<Fence> _fence;
 	Rc<CommandPool> _pool;
+	Vector<Rc<CommandPool>> _secondaryPools; // pools for secondary buffers, released with primary pool
 	Rc<DeviceQueue> _queue;
 	Vector<const CommandBuffer *> _buffers;
 	Rc<FrameSync> _sync;
 	gl::FrameContraints _constraints;
+
+	// operations and family of the queue, actually used for submission
+	QueueOperations _queueOps = QueueOperations::None;
+	uint32_t _queueFamilyIdx = maxOf<uint32_t>();
+
+	// semaphores, signaled for dependent passes on other queue families
+	Vector<Pair<const renderqueue::PassData *, Rc<gl::Semaphore>>> _queueSemaphores;
+
+	Rc<QueryPool> _queryPool;
+	uint32_t _timestampBits = 0;
 };
 
 }
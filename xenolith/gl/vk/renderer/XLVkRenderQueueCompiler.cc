@@ -93,6 +93,103 @@ protected:
 	RenderQueueAttachmentHandle *_attachment;
 };
 
+// Queue-internal image attachments, that discard their contents on first use, can share device memory,
+// if last pass of one attachment is guaranteed to be executed before first pass of another one.
+// Execution order within frame is defined by attachment chains, so lifetimes compared by pass reachability
+static void RenderQueueCompiler_assignAliasGroups(renderqueue::Queue &queue) {
+	using namespace renderqueue;
+
+	struct AliasCandidate {
+		AttachmentData *attachment;
+		const PassData *first;
+		const PassData *last;
+	};
+
+	Map<const PassData *, Set<const PassData *>> next;
+	Vector<AliasCandidate> candidates;
+
+	for (auto &it : queue.getAttachments()) {
+		it->aliasGroup = maxOf<uint32_t>();
+		for (size_t i = 1; i < it->passes.size(); ++ i) {
+			next[it->passes[i - 1]->pass].emplace(it->passes[i]->pass);
+		}
+
+		if (it->type == AttachmentType::Image && it->usage == AttachmentUsage::None && !it->passes.empty()
+				&& it->passes.front()->initialLayout == AttachmentLayout::Undefined) {
+			candidates.emplace_back(AliasCandidate{it, it->passes.front()->pass, it->passes.back()->pass});
+		}
+	}
+
+	if (candidates.size() < 2) {
+		return;
+	}
+
+	auto isExecutedBefore = [&] (const PassData *from, const PassData *to) {
+		Vector<const PassData *> stack;
+		Set<const PassData *> visited;
+		stack.emplace_back(from);
+		while (!stack.empty()) {
+			auto pass = stack.back();
+			stack.pop_back();
+
+			auto it = next.find(pass);
+			if (it == next.end()) {
+				continue;
+			}
+
+			for (auto &n : it->second) {
+				if (n == to) {
+					return true;
+				}
+				if (visited.emplace(n).second) {
+					stack.emplace_back(n);
+				}
+			}
+		}
+		return false;
+	};
+
+	std::sort(candidates.begin(), candidates.end(), [] (const AliasCandidate &l, const AliasCandidate &r) {
+		if (l.first->ordering != r.first->ordering) {
+			return l.first->ordering < r.first->ordering;
+		}
+		return l.attachment->key < r.attachment->key;
+	});
+
+	// greedy interval assignment: place attachment into first group, that is already released at the moment
+	Vector<Vector<AliasCandidate *>> groups;
+	for (auto &it : candidates) {
+		bool found = false;
+		for (auto &group : groups) {
+			if (isExecutedBefore(group.back()->last, it.first)) {
+				group.emplace_back(&it);
+				found = true;
+				break;
+			}
+		}
+		if (!found) {
+			groups.emplace_back(Vector<AliasCandidate *>{&it});
+		}
+	}
+
+	uint32_t groupIndex = 0;
+	size_t aliased = 0;
+	for (auto &group : groups) {
+		if (group.size() > 1) {
+			for (auto &it : group) {
+				it->attachment->aliasGroup = groupIndex;
+			}
+			aliased += group.size();
+			++ groupIndex;
+		}
+	}
+
+	if (groupIndex > 0) {
+		log::vtext("vk::RenderQueueCompiler", "Queue '", queue.getName(), "': ", aliased, " of ", candidates.size(),
+				" internal attachments share ", groupIndex, " memory regions");
+	}
+}
+
 RenderQueueCompiler::~RenderQueueCompiler() { }
 
 bool RenderQueueCompiler::init(Device &dev) {
@@ -213,6 +310,8 @@ void RenderQueueAttachmentHandle::runShaders(FrameHandle &frame) {
 
 	_input->queue->prepare(*_device);
 
+	RenderQueueCompiler_assignAliasGroups(*_input->queue);
+
 	for (auto &it : _input->queue->getPasses()) {
 		frame.performRequiredTask([this, req = it] (FrameHandle &frame) -> bool {
 			auto ret = Rc<RenderPassImpl>::create(*_device, *req);
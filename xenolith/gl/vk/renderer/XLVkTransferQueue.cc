@@ -24,6 +24,7 @@
 #include "XLVkTransferQueue.h"
 #include "XLVkDevice.h"
 #include "XLVkObject.h"
+#include "XLVkLoop.h"
 
 namespace stappler::xenolith::vk {
 
@@ -67,15 +68,182 @@ class TransferRenderPassHandle : public QueuePassHandle {
 public:
 	virtual ~TransferRenderPassHandle();
 
+	virtual bool prepare(FrameQueue &, Function<void(bool)> &&) override;
+
+	virtual QueueOperations getQueueOps() const override;
+
 protected:
 	virtual Vector<const CommandBuffer *> doPrepareCommands(FrameHandle &) override;
 	virtual void doComplete(FrameQueue &, Function<void(bool)> &&, bool) override;
+
+	TransferAttachmentHandle *getTransferHandle() const;
+
+	TransferQueue *_transferQueue = nullptr;
 };
 
+StagingRing::~StagingRing() { }
+
+bool StagingRing::init(Device &dev, VkDeviceSize size) {
+	auto alloc = dev.getAllocator();
+	auto table = dev.getTable();
+
+	_nonCoherentAtomSize = std::max(VkDeviceSize(1), alloc->getNonCoherentAtomSize());
+	_size = math::align<VkDeviceSize>(size, _nonCoherentAtomSize);
+
+	VkBufferCreateInfo info{};
+	info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	info.size = _size;
+	info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	VkBuffer buffer = VK_NULL_HANDLE;
+	if (table->vkCreateBuffer(dev.getDevice(), &info, nullptr, &buffer) != VK_SUCCESS) {
+		log::vtext("Vk-Error", "Fail to create staging ring buffer");
+		return false;
+	}
+
+	auto req = alloc->getBufferMemoryRequirements(buffer);
+	auto type = alloc->findMemoryType(alloc->getInitialTypeMask() & req.requirements.memoryTypeBits,
+			AllocationUsage::HostTransitionSource);
+	if (!type) {
+		log::vtext("Vk-Error", "Fail to find memory type for staging ring");
+		table->vkDestroyBuffer(dev.getDevice(), buffer, nullptr);
+		return false;
+	}
+
+	VkMemoryAllocateInfo allocInfo{};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.pNext = nullptr;
+	allocInfo.allocationSize = req.requirements.size;
+	allocInfo.memoryTypeIndex = type->idx;
+
+	VkDeviceMemory memory = VK_NULL_HANDLE;
+	if (table->vkAllocateMemory(dev.getDevice(), &allocInfo, nullptr, &memory) != VK_SUCCESS) {
+		log::vtext("Vk-Error", "Fail to allocate memory for staging ring");
+		table->vkDestroyBuffer(dev.getDevice(), buffer, nullptr);
+		return false;
+	}
+
+	table->vkBindBufferMemory(dev.getDevice(), buffer, memory, 0);
+
+	void *mapped = nullptr;
+	if (table->vkMapMemory(dev.getDevice(), memory, 0, VK_WHOLE_SIZE, 0, &mapped) != VK_SUCCESS) {
+		log::vtext("Vk-Error", "Fail to map staging ring memory");
+		table->vkDestroyBuffer(dev.getDevice(), buffer, nullptr);
+		table->vkFreeMemory(dev.getDevice(), memory, nullptr);
+		return false;
+	}
+
+	// memory remains mapped for the whole lifetime of the ring, vkFreeMemory unmaps it implicitly
+	_device = &dev;
+	_mapped = (uint8_t *)mapped;
+	_memorySize = req.requirements.size;
+	_coherent = type->isHostCoherent();
+	_buffer = Rc<Buffer>::create(dev, buffer, gl::BufferInfo(gl::ForceBufferUsage(gl::BufferUsage::TransferSrc), uint64_t(_size)),
+			Rc<DeviceMemory>::create(dev, memory, type->idx, req.requirements.size));
+	return _buffer != nullptr;
+}
+
+auto StagingRing::acquire(VkDeviceSize size, VkDeviceSize minSize, VkDeviceSize alignment) -> Region {
+	std::unique_lock<Mutex> lock(_mutex);
+
+	alignment = std::max(alignment, _nonCoherentAtomSize);
+
+	auto tryRange = [&] (VkDeviceSize begin, VkDeviceSize end) -> Region {
+		auto offset = math::align<VkDeviceSize>(begin, alignment);
+		if (offset >= end || end - offset < minSize) {
+			return Region();
+		}
+
+		Region ret;
+		ret.id = _nextId ++;
+		ret.offset = offset;
+		ret.size = std::min(size, end - offset);
+		ret.ptr = _mapped + offset;
+
+		_inflight.emplace_back(Span{ret.id, offset, offset + ret.size, false});
+		_head = offset + ret.size;
+		_streamed += ret.size;
+		return ret;
+	};
+
+	if (_inflight.empty()) {
+		_head = _tail = 0;
+		return tryRange(0, _size);
+	} else if (_head > _tail) {
+		// free space is [head, size) and [0, tail)
+		if (auto ret = tryRange(_head, _size)) {
+			return ret;
+		}
+		return tryRange(0, _tail);
+	} else {
+		// ring is wrapped, free space is [head, tail)
+		return tryRange(_head, _tail);
+	}
+}
+
+void StagingRing::flush(const Region &region) const {
+	if (_coherent || !region) {
+		return;
+	}
+
+	VkMappedMemoryRange range;
+	range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+	range.pNext = nullptr;
+	range.memory = _buffer->getMemory()->getMemory();
+	range.offset = region.offset - region.offset % _nonCoherentAtomSize;
+	range.size = math::align<VkDeviceSize>(region.offset + region.size, _nonCoherentAtomSize) - range.offset;
+	if (range.offset + range.size >= _memorySize) {
+		range.size = VK_WHOLE_SIZE;
+	}
+	_device->getTable()->vkFlushMappedMemoryRanges(_device->getDevice(), 1, &range);
+}
+
+void StagingRing::retire(const Region &region) {
+	std::unique_lock<Mutex> lock(_mutex);
+	for (auto &it : _inflight) {
+		if (it.id == region.id) {
+			it.retired = true;
+			break;
+		}
+	}
+
+	auto it = _inflight.begin();
+	while (it != _inflight.end() && it->retired) {
+		++ it;
+	}
+	_inflight.erase(_inflight.begin(), it);
+
+	if (_inflight.empty()) {
+		_head = _tail = 0;
+	} else {
+		_tail = _inflight.front().begin;
+	}
+}
+
+VkBuffer StagingRing::getBuffer() const {
+	return _buffer->getBuffer();
+}
+
+StagingRing::Stat StagingRing::getStat() const {
+	std::unique_lock<Mutex> lock(_mutex);
+	return Stat{_size, getUsed(), _inflight.size(), _streamed};
+}
+
+VkDeviceSize StagingRing::getUsed() const {
+	if (_inflight.empty()) {
+		return 0;
+	} else if (_head > _tail) {
+		return _head - _tail;
+	} else {
+		return _size - _tail + _head;
+	}
+}
+
 
 TransferQueue::~TransferQueue() { }
 
-bool TransferQueue::init() {
+bool TransferQueue::init(VkDeviceSize stagingSize, VkDeviceSize uploadBudget) {
 	using namespace renderqueue;
 	Queue::Builder builder("Transfer");
 
@@ -91,6 +259,8 @@ bool TransferQueue::init() {
 
 	if (renderqueue::Queue::init(move(builder))) {
 		_attachment = attachment;
+		_stagingSize = stagingSize;
+		_uploadBudget = uploadBudget;
 		return true;
 	}
 	return false;
@@ -102,6 +272,43 @@ auto TransferQueue::makeRequest(Rc<TransferResource> &&req)-> Rc<FrameRequest> {
 	return ret;
 }
 
+Rc<StagingRing> TransferQueue::acquireStagingRing(Device &dev) {
+	std::unique_lock<Mutex> lock(_ringMutex);
+	if (!_ring && !_ringFailed && _stagingSize > 0) {
+		_ring = Rc<StagingRing>::create(dev, _stagingSize);
+		if (!_ring) {
+			// do not retry, use dedicated staging buffers instead
+			log::vtext("vk::TransferQueue", "Fail to create staging ring, fallback to per-resource staging");
+			_ringFailed = true;
+		}
+	}
+	return _ring;
+}
+
+void TransferQueue::setUploadBudget(VkDeviceSize value) {
+	_uploadBudget = value;
+}
+
+VkDeviceSize TransferQueue::acquireUploadBudget(uint64_t clock) {
+	std::unique_lock<Mutex> lock(_budgetMutex);
+	if (_budgetClock != clock) {
+		_budgetClock = clock;
+		_budgetRemains = _uploadBudget.load();
+	}
+
+	// concurrent passes within the same iteration receive nothing until budget is returned
+	auto ret = _budgetRemains;
+	_budgetRemains = 0;
+	return ret;
+}
+
+void TransferQueue::releaseUploadBudget(uint64_t clock, VkDeviceSize unused) {
+	std::unique_lock<Mutex> lock(_budgetMutex);
+	if (_budgetClock == clock) {
+		_budgetRemains += unused;
+	}
+}
+
 TransferResource::BufferAllocInfo::BufferAllocInfo(gl::BufferData *d) {
 	data = d;
 	info.flags = VkBufferCreateFlags(d->flags);
@@ -121,6 +328,9 @@ TransferResource::ImageAllocInfo::ImageAllocInfo(gl::ImageData *d) {
 	info.samples = VkSampleCountFlagBits(data->samples);
 	info.tiling = VkImageTiling(data->tiling);
 	info.usage = VkImageUsageFlags(data->usage) | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+	if ((data->hints & gl::ImageHints::GenerateMipmaps) != gl::ImageHints::None) {
+		info.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+	}
 	info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 	if (data->tiling == gl::ImageTiling::Optimal) {
 		info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
@@ -129,6 +339,14 @@ TransferResource::ImageAllocInfo::ImageAllocInfo(gl::ImageData *d) {
 	}
 }
 
+uint32_t TransferResource::ImageAllocInfo::getDataLevels() const {
+	return std::max(std::min(data->dataLevels, info.mipLevels), uint32_t(1));
+}
+
+VkDeviceSize TransferResource::ImageAllocInfo::getDataSize() const {
+	return gl::getImageDataSize(gl::ImageFormat(info.format), data->extent, getDataLevels(), info.arrayLayers);
+}
+
 TransferResource::~TransferResource() {
 	if (_alloc) {
 		invalidate(*_alloc->getDevice());
@@ -162,6 +380,8 @@ void TransferResource::invalidate(Device &dev) {
 	}
 
 	dropStaging(_stagingBuffer);
+	retireStaging();
+	_ring = nullptr;
 
 	if (_callback) {
 		_callback(false);
@@ -217,6 +437,66 @@ bool TransferResource::initialize(AllocationUsage usage) {
 		_images.emplace_back(it);
 	}
 
+	for (auto &it : _images) {
+		if (!gl::isCompressedFormat(it.data->format) || it.info.tiling != VK_IMAGE_TILING_OPTIMAL) {
+			continue;
+		}
+
+		auto props = dev->getFormatProperties(it.info.format);
+		auto required = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+		if ((props.optimalTilingFeatures & required) == required
+				&& (it.data->hints & gl::ImageHints::Transcode) == gl::ImageHints::None) {
+			continue;
+		}
+
+		auto fmt = gl::getTranscodeFormat(it.data->format);
+		if (fmt == gl::ImageFormat::Undefined) {
+			log::vtext("DeviceResourceTransfer", "Compressed format ", gl::getImageFormatName(it.data->format),
+					" is not supported by device and can not be transcoded: ", it.data->key);
+			continue;
+		}
+
+		// transcoded data is uploaded as uncompressed image of the same extent
+		it.transcode = true;
+		it.sourceFormat = it.data->format;
+		it.info.format = VkFormat(fmt);
+	}
+
+	for (auto &it : _images) {
+		if ((it.data->hints & gl::ImageHints::GenerateMipmaps) == gl::ImageHints::None || it.info.mipLevels <= 1) {
+			continue;
+		}
+
+		auto props = dev->getFormatProperties(it.info.format);
+		auto required = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
+		if (it.info.tiling == VK_IMAGE_TILING_OPTIMAL && (props.optimalTilingFeatures & required) == required) {
+			it.generateMipmaps = true;
+			if ((props.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) == 0) {
+				it.mipmapFilter = VK_FILTER_NEAREST;
+			}
+		} else {
+			// mip levels can not be filled, so, use only base level
+			log::vtext("DeviceResourceTransfer", "Mipmaps generation is not supported for ", it.data->key,
+					" (", gl::getImageFormatName(gl::ImageFormat(it.info.format)), "), only base level will be used");
+			it.info.mipLevels = 1;
+		}
+	}
+
+	for (auto &it : _images) {
+		if (it.data->data.empty()) {
+			continue;
+		}
+
+		// staging region and copy commands are built for full data size, partial data can not be uploaded
+		auto expectedSize = it.transcode
+				? gl::getImageDataSize(it.sourceFormat, it.data->extent, it.getDataLevels(), it.info.arrayLayers)
+				: it.getDataSize();
+		if (it.data->data.size() < expectedSize) {
+			return cleanup(toString("Image data for ", it.data->key, " is too short: ",
+					it.data->data.size(), " bytes, expected ", expectedSize));
+		}
+	}
+
 	// pre-create objects
 	auto mask = _alloc->getInitialTypeMask();
 	for (auto &it : _buffers) {
@@ -365,40 +645,207 @@ bool TransferResource::allocate() {
 
 bool TransferResource::upload() {
 	size_t stagingSize = preTransferData();
-	if (stagingSize == 0) {
-		return true;
-	}
-
 	if (stagingSize == maxOf<size_t>()) {
 		invalidate(*_alloc->getDevice());
 		return false; // failed with error
 	}
 
-	if (createStagingBuffer(_stagingBuffer, stagingSize)) {
+	// staging data is written later, either into dedicated buffer or into staging ring
+	_stagingSize = stagingSize;
+	return true;
+}
+
+bool TransferResource::uploadStaging() {
+	if (_stagingUploaded || _stagingSize == 0) {
+		return true;
+	}
+
+	if (createStagingBuffer(_stagingBuffer, _stagingSize)) {
 		if (writeStaging(_stagingBuffer)) {
+			_stagingUploaded = true;
 			return true;
 		}
 	}
 
 	dropStaging(_stagingBuffer);
-	invalidate(*_alloc->getDevice());
 	return false;
 }
 
+bool TransferResource::prepareStream(StagingRing &ring) {
+	_ring = &ring;
+	_streamPrepared = true;
+
+	auto chunkLimit = ring.getSize() / 2;
+	VkDeviceSize alignment = std::max(VkDeviceSize(0x10), _alloc->getNonCoherentAtomSize());
+	VkDeviceSize stagingSize = 0;
+
+	// targets, that can not be split into chunks fitted into ring, use dedicated staging buffer
+	auto addStaging = [&] (VkDeviceSize &offset, VkDeviceSize size) {
+		stagingSize = math::align<VkDeviceSize>(stagingSize, alignment);
+		offset = stagingSize;
+		stagingSize += size;
+	};
+
+	for (auto &it : _images) {
+		if (!it.useStaging) {
+			continue;
+		}
+
+		auto blockSize = getFormatBlockSize(it.info.format);
+		auto expectedSize = it.getDataSize();
+
+		StreamCopy copy;
+		copy.targetImage = &it;
+		if (!it.data->data.empty() && !it.transcode) {
+			copy.size = std::min(VkDeviceSize(it.data->data.size()), VkDeviceSize(expectedSize));
+			copy.source = it.data->data.sub(0, copy.size);
+			if (copy.size == expectedSize && it.info.extent.depth == 1 && it.info.arrayLayers == 1
+					&& it.getDataLevels() == 1 && !gl::isCompressedFormat(gl::ImageFormat(it.info.format))) {
+				// chunk is a single row of texels
+				copy.chunk = blockSize * it.info.extent.width;
+			} else {
+				copy.chunk = copy.size;
+			}
+		} else {
+			copy.size = expectedSize;
+			copy.chunk = expectedSize;
+		}
+
+		if (copy.chunk > chunkLimit) {
+			addStaging(it.stagingOffset, expectedSize);
+		} else {
+			it.useRing = true;
+			_stream.emplace_back(copy);
+		}
+	}
+
+	for (auto &it : _buffers) {
+		if (!it.useStaging) {
+			continue;
+		}
+
+		StreamCopy copy;
+		copy.targetBuffer = &it;
+		if (!it.data->data.empty()) {
+			copy.size = std::min(VkDeviceSize(it.data->data.size()), VkDeviceSize(it.data->size));
+			copy.source = it.data->data.sub(0, copy.size);
+			copy.chunk = std::min(copy.size, alignment);
+		} else {
+			copy.size = it.data->size;
+			copy.chunk = it.data->size;
+		}
+
+		if (copy.chunk > chunkLimit) {
+			addStaging(it.stagingOffset, it.data->size);
+		} else {
+			it.useRing = true;
+			_stream.emplace_back(copy);
+		}
+	}
+
+	_stagingSize = stagingSize;
+	return uploadStaging();
+}
+
+size_t TransferResource::writeChunk(uint8_t *mem, StreamCopy &copy, VkDeviceSize offset, VkDeviceSize size) {
+	if (copy.source.empty()) {
+		if (copy.targetImage) {
+			return writeData(mem, *copy.targetImage);
+		} else {
+			return writeData(mem, *copy.targetBuffer);
+		}
+	}
+
+	memcpy(mem, copy.source.data() + offset, size);
+	return size;
+}
+
+struct TransferResource::WriteBatch : public Ref {
+	virtual ~WriteBatch() { }
+
+	WriteBatch(TransferResource *res, DataWrite *writes, size_t count) : resource(res), writes(writes), count(count) { }
+
+	// Same as DeferredManager::Batch: workers pull writes from shared counter
+	void runThread() {
+		size_t target = current.fetch_add(1);
+		while (target < count) {
+			writes[target].result = resource->writeData(writes[target]);
+			if (complete.fetch_add(1) == count - 1) {
+				std::unique_lock<Mutex> lock(mutex);
+				cond.notify_all();
+			}
+			target = current.fetch_add(1);
+		}
+	}
+
+	void wait() {
+		std::unique_lock<Mutex> lock(mutex);
+		cond.wait(lock, [&] {
+			return complete.load() == count;
+		});
+	}
+
+	TransferResource *resource = nullptr;
+	DataWrite *writes = nullptr;
+	size_t count = 0;
+	std::atomic<size_t> current = 0;
+	std::atomic<size_t> complete = 0;
+	Mutex mutex;
+	std::condition_variable cond;
+};
+
+void TransferResource::writeParallel(Vector<DataWrite> &writes) {
+	if (!_loop || writes.size() <= 1) {
+		for (auto &it : writes) {
+			it.result = writeData(it);
+		}
+		return;
+	}
+
+	auto batch = Rc<WriteBatch>::alloc(this, writes.data(), writes.size());
+
+	// calling thread also takes writes, so batch is completed even if workers are busy
+	auto nthreads = std::min(uint32_t(writes.size() - 1), uint32_t(config::getGlThreadCount()));
+	for (uint32_t i = 0; i < nthreads; ++ i) {
+		_loop->performInQueue([batch] () {
+			batch->runThread();
+		}, batch);
+	}
+
+	batch->runThread();
+	batch->wait();
+}
+
+size_t TransferResource::writeData(DataWrite &write) {
+	if (write.stream) {
+		return writeChunk(write.target, *write.stream, write.offset, write.size);
+	} else if (write.targetImage) {
+		return writeData(write.target, *write.targetImage);
+	} else if (write.targetBuffer) {
+		return writeData(write.target, *write.targetBuffer);
+	}
+	return 0;
+}
+
 bool TransferResource::compile() {
 	Rc<DeviceMemory> mem;
 	if (_memory) {
-		mem = Rc<DeviceMemory>::create(*_alloc->getDevice(), _memory);
+		mem = Rc<DeviceMemory>::create(*_alloc->getDevice(), _memory, _memType->idx, _requiredMemory);
 	}
 
 	for (auto &it : _images) {
+		// format and levels can be changed by transfer (transcoding, mipmaps fallback), shared data remains as provided
+		gl::ImageInfo info = *it.data;
+		info.format = gl::ImageFormat(it.info.format);
+		info.mipLevels = gl::MipLevels(it.info.mipLevels);
+
 		Rc<Image> img;
 		if (it.dedicated) {
-			auto dedicated = Rc<DeviceMemory>::create(*_alloc->getDevice(), it.dedicated);
-			img = Rc<Image>::create(*_alloc->getDevice(), it.image, *it.data, move(dedicated), Rc<gl::DataAtlas>(it.data->atlas));
+			auto dedicated = Rc<DeviceMemory>::create(*_alloc->getDevice(), it.dedicated, it.dedicatedMemType, it.req.requirements.size);
+			img = Rc<Image>::create(*_alloc->getDevice(), it.image, info, move(dedicated), Rc<gl::DataAtlas>(it.data->atlas));
 			it.dedicated = VK_NULL_HANDLE;
 		} else {
-			img = Rc<Image>::create(*_alloc->getDevice(), it.image, *it.data, Rc<DeviceMemory>(mem), Rc<gl::DataAtlas>(it.data->atlas));
+			img = Rc<Image>::create(*_alloc->getDevice(), it.image, info, Rc<DeviceMemory>(mem), Rc<gl::DataAtlas>(it.data->atlas));
 		}
 		if (it.barrier) {
 			img->setPendingBarrier(it.barrier.value());
@@ -410,7 +857,7 @@ bool TransferResource::compile() {
 	for (auto &it : _buffers) {
 		Rc<Buffer> buf;
 		if (it.dedicated) {
-			auto dedicated = Rc<DeviceMemory>::create(*_alloc->getDevice(), it.dedicated);
+			auto dedicated = Rc<DeviceMemory>::create(*_alloc->getDevice(), it.dedicated, it.dedicatedMemType, it.req.requirements.size);
 			buf = Rc<Buffer>::create(*_alloc->getDevice(), it.buffer, *it.data, move(dedicated));
 			it.dedicated = VK_NULL_HANDLE;
 		} else {
@@ -466,12 +913,141 @@ static VkImageAspectFlagBits getFormatAspectFlags(VkFormat fmt, bool separateDep
 
 bool TransferResource::prepareCommands(uint32_t idx, VkCommandBuffer buf,
 		Vector<VkImageMemoryBarrier> &outputImageBarriers, Vector<VkBufferMemoryBarrier> &outputBufferBarriers) {
+	if (!uploadStaging()) {
+		log::vtext("Vk-Error", "Fail to write staging data for static resource: ", _resource->getName());
+		return false;
+	}
+
+	Vector<CopyCommand> commands;
+	commands.reserve(_stagingBuffer.copyData.size());
+
+	for (auto &it : _stagingBuffer.copyData) {
+		auto &cmd = commands.emplace_back(CopyCommand{_stagingBuffer.buffer.buffer, it.sourceOffet, it.sourceSize,
+			it.targetImage, it.targetBuffer});
+		if (it.targetImage) {
+			cmd.imageExtent = it.targetImage->info.extent;
+		}
+	}
+
+	return recordCommands(idx, buf, commands, outputImageBarriers, outputBufferBarriers);
+}
+
+bool TransferResource::prepareCommands(uint32_t idx, VkCommandBuffer buf, StagingRing &ring, VkDeviceSize budget,
+		Vector<VkImageMemoryBarrier> &outputImageBarriers, Vector<VkBufferMemoryBarrier> &outputBufferBarriers) {
+	Vector<CopyCommand> commands;
+
+	if (!_streamPrepared) {
+		if (!prepareStream(ring)) {
+			log::vtext("Vk-Error", "Fail to write staging data for static resource: ", _resource->getName());
+			return false;
+		}
+
+		// oversized targets are transferred with dedicated staging buffer within first submission
+		for (auto &it : _stagingBuffer.copyData) {
+			auto &cmd = commands.emplace_back(CopyCommand{_stagingBuffer.buffer.buffer, it.sourceOffet, it.sourceSize,
+				it.targetImage, it.targetBuffer});
+			if (it.targetImage) {
+				cmd.imageExtent = it.targetImage->info.extent;
+			}
+		}
+	}
+
+	VkDeviceSize alignment = std::max(VkDeviceSize(0x10), _alloc->getNonCoherentAtomSize());
+	VkDeviceSize written = 0;
+
+	Vector<DataWrite> writes;
+	Vector<size_t> writeCommands;
+
+	while (_streamIndex < _stream.size()) {
+		auto &it = _stream[_streamIndex];
+		auto remains = it.size - it.offset;
+		if (remains == 0) {
+			// nothing to copy, but target still requires layout transition
+			commands.emplace_back(CopyCommand{VK_NULL_HANDLE, 0, 0, it.targetImage, it.targetBuffer});
+			++ _streamIndex;
+			continue;
+		}
+
+		auto minSize = std::min(remains, it.chunk);
+		auto maxSize = std::min(remains, budget > written ? budget - written : VkDeviceSize(0));
+		if (maxSize < minSize) {
+			if (written > 0 || budget == 0) {
+				break; // budget exhausted
+			}
+			maxSize = minSize; // always transfer at least one chunk, if budget is not empty
+		}
+
+		auto regionAlignment = alignment;
+		if (it.targetImage) {
+			// bufferOffset should be multiple of texel block size
+			auto blockSize = getFormatBlockSize(it.targetImage->info.format);
+			if (blockSize > 0 && regionAlignment % blockSize != 0) {
+				regionAlignment *= blockSize;
+			}
+		}
+
+		auto region = ring.acquire(maxSize, minSize, regionAlignment);
+		if (!region) {
+			break; // ring is full, continue when previous transfers are retired
+		}
+
+		auto size = std::min(remains, region.size);
+		if (size < remains) {
+			size -= size % it.chunk;
+		}
+
+		_regions.emplace_back(region);
+
+		// chunk is written after all regions are acquired, copy size will be updated with written size
+		writes.emplace_back(DataWrite{region.ptr, nullptr, nullptr, &it, it.offset, size});
+		writeCommands.emplace_back(commands.size());
+
+		auto &cmd = commands.emplace_back(CopyCommand{ring.getBuffer(), region.offset, size,
+			it.targetImage, it.targetBuffer});
+		cmd.first = (it.offset == 0);
+		cmd.last = (it.offset + size == it.size);
+
+		if (it.targetImage) {
+			cmd.imageExtent = it.targetImage->info.extent;
+			if (it.chunk < it.size) {
+				// chunk contains whole rows of 2D image
+				cmd.imageOffset.y = int32_t(it.offset / it.chunk);
+				cmd.imageExtent.height = uint32_t(size / it.chunk);
+			}
+		} else {
+			cmd.targetOffset = it.offset;
+		}
+
+		it.offset += size;
+		written += size;
+		_streamedSize += size;
+
+		if (it.offset == it.size) {
+			++ _streamIndex;
+		}
+	}
+
+	writeParallel(writes);
+
+	for (size_t i = 0; i < writes.size(); ++ i) {
+		commands[writeCommands[i]].size = writes[i].result;
+	}
+
+	for (size_t i = _regions.size() - writes.size(); i < _regions.size(); ++ i) {
+		ring.flush(_regions[i]);
+	}
+
+	return recordCommands(idx, buf, commands, outputImageBarriers, outputBufferBarriers);
+}
+
+bool TransferResource::recordCommands(uint32_t idx, VkCommandBuffer buf, SpanView<CopyCommand> commands,
+		Vector<VkImageMemoryBarrier> &outputImageBarriers, Vector<VkBufferMemoryBarrier> &outputBufferBarriers) {
 	auto dev = _alloc->getDevice();
 	auto table = _alloc->getDevice()->getTable();
 
 	Vector<VkImageMemoryBarrier> inputImageBarriers;
-	for (auto &it : _stagingBuffer.copyData) {
-		if (it.targetImage) {
+	for (auto &it : commands) {
+		if (it.targetImage && it.first) {
 			inputImageBarriers.emplace_back(VkImageMemoryBarrier({
 				VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
 				VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
@@ -479,7 +1055,7 @@ bool TransferResource::prepareCommands(uint32_t idx, VkCommandBuffer buf,
 				VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
 				it.targetImage->image, VkImageSubresourceRange({
 					getFormatAspectFlags(it.targetImage->info.format, false),
-					0, it.targetImage->data->mipLevels.get(), 0, it.targetImage->data->arrayLayers.get()
+					0, it.targetImage->info.mipLevels, 0, it.targetImage->info.arrayLayers
 				})
 			}));
 		}
@@ -490,30 +1066,84 @@ bool TransferResource::prepareCommands(uint32_t idx, VkCommandBuffer buf,
 			0, nullptr, // bufferBarriers.size(), bufferBarriers.data(),
 			inputImageBarriers.size(), inputImageBarriers.data());
 
-	for (auto &it : _stagingBuffer.copyData) {
+	for (auto &it : commands) {
+		if (it.size == 0) {
+			continue;
+		}
+
 		if (it.targetBuffer) {
 			VkBufferCopy copyRegion{};
-			copyRegion.srcOffset = it.sourceOffet;
-			copyRegion.dstOffset = 0;
-			copyRegion.size = it.sourceSize;
-			table->vkCmdCopyBuffer(buf, _stagingBuffer.buffer.buffer, it.targetBuffer->buffer, 1, &copyRegion);
+			copyRegion.srcOffset = it.sourceOffset;
+			copyRegion.dstOffset = it.targetOffset;
+			copyRegion.size = it.size;
+			table->vkCmdCopyBuffer(buf, it.source, it.targetBuffer->buffer, 1, &copyRegion);
 		} else if (it.targetImage) {
-			VkBufferImageCopy copyRegion{};
-			copyRegion.bufferOffset = it.sourceOffet;
-			copyRegion.bufferRowLength = 0; // If either of these values is zero, that aspect of the buffer memory
-			copyRegion.bufferImageHeight = 0; // is considered to be tightly packed according to the imageExtent
-			copyRegion.imageSubresource = VkImageSubresourceLayers({
-				getFormatAspectFlags(it.targetImage->info.format, false), 0, 0, it.targetImage->data->arrayLayers.get()
-			});
-			copyRegion.imageOffset = VkOffset3D({0, 0, 0});
-			copyRegion.imageExtent = it.targetImage->info.extent;
+			auto aspect = getFormatAspectFlags(it.targetImage->info.format, false);
+			auto levels = it.targetImage->getDataLevels();
+			if (levels > 1 && it.first && it.last) {
+				// whole image with mip levels, packed one after another, starting from level 0
+				auto fmt = gl::ImageFormat(it.targetImage->info.format);
+				auto extent = it.targetImage->data->extent;
+				auto layers = it.targetImage->info.arrayLayers;
+
+				Vector<VkBufferImageCopy> regions; regions.reserve(levels);
+				VkDeviceSize offset = 0;
+				for (uint32_t level = 0; level < levels; ++ level) {
+					auto levelSize = gl::getImageLevelSize(fmt, extent, level, layers);
+					if (offset + levelSize > it.size) {
+						break;
+					}
+
+					auto levelExtent = gl::getImageLevelExtent(extent, level);
+					regions.emplace_back(VkBufferImageCopy({
+						it.sourceOffset + offset, 0, 0,
+						VkImageSubresourceLayers({ aspect, level, 0, layers }),
+						VkOffset3D({ 0, 0, 0 }),
+						VkExtent3D({ levelExtent.width, levelExtent.height, levelExtent.depth })
+					}));
+					offset += levelSize;
+				}
 
-			table->vkCmdCopyBufferToImage(buf, _stagingBuffer.buffer.buffer, it.targetImage->image,
-					VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyRegion);
+				table->vkCmdCopyBufferToImage(buf, it.source, it.targetImage->image,
+						VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, regions.size(), regions.data());
+			} else {
+				VkBufferImageCopy copyRegion{};
+				copyRegion.bufferOffset = it.sourceOffset;
+				copyRegion.bufferRowLength = 0; // If either of these values is zero, that aspect of the buffer memory
+				copyRegion.bufferImageHeight = 0; // is considered to be tightly packed according to the imageExtent
+				copyRegion.imageSubresource = VkImageSubresourceLayers({
+					aspect, 0, 0, it.targetImage->data->arrayLayers.get()
+				});
+				copyRegion.imageOffset = it.imageOffset;
+				copyRegion.imageExtent = it.imageExtent;
+
+				table->vkCmdCopyBufferToImage(buf, it.source, it.targetImage->image,
+						VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyRegion);
+			}
 		}
 	}
 
-	for (auto &it : _stagingBuffer.copyData) {
+	bool hasGraphics = false;
+	if (auto q = dev->getQueueFamily(idx)) {
+		hasGraphics = (q->ops & QueueOperations::Graphics) != QueueOperations::None;
+	}
+
+	for (auto &it : commands) {
+		if (it.last && it.targetImage && it.targetImage->generateMipmaps) {
+			if (hasGraphics) {
+				recordMipmaps(buf, *it.targetImage);
+			} else {
+				log::vtext("DeviceResourceTransfer", "Fail to generate mipmaps for ", it.targetImage->data->key,
+						": queue without graphics capabilities was used");
+			}
+		}
+	}
+
+	for (auto &it : commands) {
+		if (!it.last) {
+			continue;
+		}
+
 		if (it.targetImage) {
 			if (auto q = dev->getQueueFamily(getQueueOperations(it.targetImage->data->type))) {
 				uint32_t srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
@@ -531,7 +1161,7 @@ bool TransferResource::prepareCommands(uint32_t idx, VkCommandBuffer buf,
 					srcQueueFamilyIndex, dstQueueFamilyIndex,
 					it.targetImage->image, VkImageSubresourceRange({
 						getFormatAspectFlags(it.targetImage->info.format, false),
-						0, it.targetImage->data->mipLevels.get(), 0, it.targetImage->data->arrayLayers.get()
+						0, it.targetImage->info.mipLevels, 0, it.targetImage->info.arrayLayers
 					})
 				}));
 
@@ -591,6 +1221,79 @@ bool TransferResource::transfer(const Rc<DeviceQueue> &queue, const Rc<CommandPo
 	return false;
 }
 
+void TransferResource::recordMipmaps(VkCommandBuffer buf, ImageAllocInfo &image) const {
+	auto table = _alloc->getDevice()->getTable();
+	auto aspect = getFormatAspectFlags(image.info.format, false);
+	auto levels = image.info.mipLevels;
+	auto layers = image.info.arrayLayers;
+
+	VkImageMemoryBarrier barrier({
+		VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+		VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+		image.image, VkImageSubresourceRange({ VkImageAspectFlags(aspect), 0, 1, 0, layers })
+	});
+
+	int32_t width = image.info.extent.width;
+	int32_t height = image.info.extent.height;
+	int32_t depth = image.info.extent.depth;
+
+	for (uint32_t level = 1; level < levels; ++ level) {
+		// previous level was written with copy or blit, use it as source
+		barrier.subresourceRange.baseMipLevel = level - 1;
+		table->vkCmdPipelineBarrier(buf, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+				0, nullptr, 0, nullptr, 1, &barrier);
+
+		auto nextWidth = std::max(width / 2, 1);
+		auto nextHeight = std::max(height / 2, 1);
+		auto nextDepth = std::max(depth / 2, 1);
+
+		VkImageBlit blit;
+		blit.srcSubresource = VkImageSubresourceLayers({ VkImageAspectFlags(aspect), level - 1, 0, layers });
+		blit.srcOffsets[0] = VkOffset3D({ 0, 0, 0 });
+		blit.srcOffsets[1] = VkOffset3D({ width, height, depth });
+		blit.dstSubresource = VkImageSubresourceLayers({ VkImageAspectFlags(aspect), level, 0, layers });
+		blit.dstOffsets[0] = VkOffset3D({ 0, 0, 0 });
+		blit.dstOffsets[1] = VkOffset3D({ nextWidth, nextHeight, nextDepth });
+
+		table->vkCmdBlitImage(buf, image.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+				image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, image.mipmapFilter);
+
+		width = nextWidth;
+		height = nextHeight;
+		depth = nextDepth;
+	}
+
+	// return source levels into TRANSFER_DST layout, so, all levels can be transitioned with common output barrier
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+	barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+	barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	barrier.subresourceRange.baseMipLevel = 0;
+	barrier.subresourceRange.levelCount = levels - 1;
+	table->vkCmdPipelineBarrier(buf, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+			0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+bool TransferResource::isMipmapGenerationRequired() const {
+	for (auto &it : _images) {
+		if (it.generateMipmaps && it.useStaging) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void TransferResource::retireStaging() {
+	if (_ring) {
+		for (auto &it : _regions) {
+			_ring->retire(it);
+		}
+	}
+	_regions.clear();
+}
+
 void TransferResource::dropStaging(StagingBuffer &buffer) const {
 	auto dev = _alloc->getDevice();
 	auto table = _alloc->getDevice()->getTable();
@@ -681,24 +1384,65 @@ size_t TransferResource::writeData(uint8_t *mem, BufferAllocInfo &info) {
 	return 0;
 }
 
+// image region is copied as a whole, so data should not be written past it, and short data is padded with zeroes
+static size_t TransferResource_writeImageData(uint8_t *mem, BytesView data, uint64_t expectedSize) {
+	auto size = std::min(uint64_t(data.size()), expectedSize);
+	memcpy(mem, data.data(), size);
+	if (size < expectedSize) {
+		memset(mem + size, 0, expectedSize - size);
+	}
+	return expectedSize;
+}
+
 size_t TransferResource::writeData(uint8_t *mem, ImageAllocInfo &info) {
-	uint64_t expectedSize = getFormatBlockSize(info.data->format) * info.data->extent.width * info.data->extent.height * info.data->extent.depth;
-	if (!info.data->data.empty()) {
-		auto size = info.data->data.size();
-		memcpy(mem, info.data->data.data(), size);
+	uint64_t expectedSize = info.getDataSize();
+	if (info.transcode) {
+		auto levels = info.getDataLevels();
+		auto transcode = [&] (BytesView data) -> size_t {
+			if (gl::transcodeImage(info.sourceFormat, info.data->extent, levels, info.info.arrayLayers, data, mem, expectedSize)) {
+				return expectedSize;
+			}
+			log::vtext("DeviceResourceTransfer", "Fail to transcode image: ", info.data->key);
+			return 0;
+		};
+
+		if (!info.data->data.empty()) {
+			return transcode(info.data->data);
+		}
+
+		// source data is compressed, load it into temporary buffer
+		Bytes tmp; tmp.resize(gl::getImageDataSize(info.sourceFormat, info.data->extent, levels, info.info.arrayLayers));
+		size_t size = 0;
+		bool written = true; // callback writes directly into buffer, unless data callback was used
+		auto cb = [&] (BytesView data) {
+			written = false;
+			size = transcode(data);
+		};
+		if (info.data->memCallback) {
+			info.data->memCallback(tmp.data(), tmp.size(), cb);
+		} else if (info.data->stdCallback) {
+			info.data->stdCallback(tmp.data(), tmp.size(), cb);
+		} else {
+			written = false;
+		}
+		if (written) {
+			size = transcode(tmp);
+		}
 		return size;
+	}
+
+	if (!info.data->data.empty()) {
+		return TransferResource_writeImageData(mem, info.data->data, expectedSize);
 	} else if (info.data->memCallback) {
 		size_t size = expectedSize;
 		info.data->memCallback(mem, expectedSize, [&] (BytesView data) {
-			size = data.size();
-			memcpy(mem, data.data(), size);
+			size = TransferResource_writeImageData(mem, data, expectedSize);
 		});
 		return size;
 	} else if (info.data->stdCallback) {
 		size_t size = expectedSize;
 		info.data->stdCallback(mem, expectedSize, [&] (BytesView data) {
-			size = data.size();
-			memcpy(mem, data.data(), size);
+			size = TransferResource_writeImageData(mem, data, expectedSize);
 		});
 		return size;
 	}
@@ -722,6 +1466,8 @@ size_t TransferResource::preTransferData() {
 	size_t alignment = std::max(VkDeviceSize(0x10), _alloc->getNonCoherentAtomSize());
 	size_t stagingSize = 0;
 
+	Vector<DataWrite> writes;
+
 	for (auto &it : _images) {
 		if (it.dedicated && _alloc->getType(it.dedicatedMemType)->isHostVisible() && it.info.tiling != VK_IMAGE_TILING_OPTIMAL) {
 			void *targetMem = nullptr;
@@ -744,9 +1490,9 @@ size_t TransferResource::preTransferData() {
 			it.useStaging = true;
 			stagingSize = math::align<VkDeviceSize>(stagingSize, alignment);
 			it.stagingOffset = stagingSize;
-			stagingSize += getFormatBlockSize(it.info.format) * it.info.extent.width * it.info.extent.height * it.info.extent.depth;
+			stagingSize += it.getDataSize();
 		} else {
-			writeData(generalMem + it.offset, it);
+			writes.emplace_back(DataWrite{generalMem + it.offset, &it});
 		}
 	}
 
@@ -774,10 +1520,12 @@ size_t TransferResource::preTransferData() {
 			it.stagingOffset = stagingSize;
 			stagingSize += it.data->size;
 		} else {
-			writeData(generalMem + it.offset, it);
+			writes.emplace_back(DataWrite{generalMem + it.offset, nullptr, &it});
 		}
 	}
 
+	writeParallel(writes);
+
 	if (generalMem) {
 		table->vkUnmapMemory(dev->getDevice(), _memory);
 		if (!_memType->isHostCoherent()) {
@@ -883,30 +1631,40 @@ bool TransferResource::writeStaging(StagingBuffer &buffer) {
 		return false;
 	}
 
+	Vector<DataWrite> writes;
+
 	for (auto &it : _images) {
-		if (it.useStaging) {
-			auto size = writeData(stagingMem + it.stagingOffset, it);
-			buffer.copyData.emplace_back(StagingCopy({it.stagingOffset, size, &it, nullptr}));
+		if (it.useStaging && !it.useRing) {
+			writes.emplace_back(DataWrite{stagingMem + it.stagingOffset, &it});
 		}
 	}
 
 	for (auto &it : _buffers) {
-		if (it.useStaging) {
-			auto size = writeData(stagingMem + it.stagingOffset, it);
-			buffer.copyData.emplace_back(StagingCopy({it.stagingOffset, size, nullptr, &it}));
+		if (it.useStaging && !it.useRing) {
+			writes.emplace_back(DataWrite{stagingMem + it.stagingOffset, nullptr, &it});
+		}
+	}
+
+	writeParallel(writes);
+
+	for (auto &it : writes) {
+		if (it.targetImage) {
+			buffer.copyData.emplace_back(StagingCopy({it.targetImage->stagingOffset, it.result, it.targetImage, nullptr}));
+		} else {
+			buffer.copyData.emplace_back(StagingCopy({it.targetBuffer->stagingOffset, it.result, nullptr, it.targetBuffer}));
 		}
 	}
 
-	table->vkUnmapMemory(dev->getDevice(), buffer.buffer.dedicated);
 	if (!_alloc->getType(buffer.memoryTypeIndex)->isHostCoherent()) {
 		VkMappedMemoryRange range;
 		range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
 		range.pNext = nullptr;
-		range.memory = _memory;
+		range.memory = buffer.buffer.dedicated;
 		range.offset = 0;
 		range.size = VK_WHOLE_SIZE;
 		table->vkFlushMappedMemoryRanges(dev->getDevice(), 1, &range);
 	}
+	table->vkUnmapMemory(dev->getDevice(), buffer.buffer.dedicated);
 
 	return true;
 }
@@ -938,6 +1696,7 @@ void TransferAttachmentHandle::submitInput(FrameQueue &q, Rc<gl::AttachmentInput
 		}
 
 		handle.performInQueue([this] (FrameHandle &frame) -> bool {
+			_resource->setLoop(frame.getLoop());
 			if (_resource->initialize()) {
 				return true;
 			}
@@ -965,26 +1724,59 @@ auto TransferPass::makeFrameHandle(const FrameQueue &handle) -> Rc<PassHandle> {
 
 TransferRenderPassHandle::~TransferRenderPassHandle() { }
 
-Vector<const CommandBuffer *> TransferRenderPassHandle::doPrepareCommands(FrameHandle &) {
-	auto pass = (TransferPass *)_renderPass.get();
-	TransferAttachmentHandle *transfer = nullptr;
-	for (auto &it : _queueData->attachments) {
-		if (it.first->attachment == pass->getAttachment()) {
-			transfer = (TransferAttachmentHandle *)it.second->handle.get();
+bool TransferRenderPassHandle::prepare(FrameQueue &q, Function<void(bool)> &&cb) {
+	_transferQueue = (TransferQueue *)q.getRenderQueue().get();
+	return QueuePassHandle::prepare(q, move(cb));
+}
+
+QueueOperations TransferRenderPassHandle::getQueueOps() const {
+	if (auto transfer = getTransferHandle()) {
+		if (transfer->getResource() && transfer->getResource()->isMipmapGenerationRequired()) {
+			// vkCmdBlitImage is not available on transfer-only queues
+			return QueueOperations::Graphics;
 		}
 	}
+	return QueuePassHandle::getQueueOps();
+}
 
+Vector<const CommandBuffer *> TransferRenderPassHandle::doPrepareCommands(FrameHandle &frame) {
+	auto transfer = getTransferHandle();
 	if (!transfer) {
 		return Vector<const CommandBuffer *>();
 	}
 
+	transfer->getResource()->setLoop(frame.getLoop());
+
+	Rc<StagingRing> ring;
+	if (_transferQueue) {
+		ring = _transferQueue->acquireStagingRing(*_device);
+	}
+
 	auto table = _device->getTable();
 	auto buf = _pool->recordBuffer(*_device, [&] (CommandBuffer &buf) {
 		Vector<VkImageMemoryBarrier> outputImageBarriers;
 		Vector<VkBufferMemoryBarrier> outputBufferBarriers;
 
-		if (!transfer->getResource()->prepareCommands(_pool->getFamilyIdx(), buf.getBuffer(), outputImageBarriers, outputBufferBarriers)) {
-			return false;
+		if (ring) {
+			// budget is shared between all transfer passes within loop iteration
+			auto &res = transfer->getResource();
+			auto clock = ((Loop *)frame.getLoop())->getClock();
+			auto budget = _transferQueue->acquireUploadBudget(clock);
+			auto streamed = res->getStreamedSize();
+
+			auto success = res->prepareCommands(_pool->getFamilyIdx(), buf.getBuffer(), *ring,
+					budget, outputImageBarriers, outputBufferBarriers);
+
+			streamed = res->getStreamedSize() - streamed;
+			_transferQueue->releaseUploadBudget(clock, budget > streamed ? budget - streamed : 0);
+			if (!success) {
+				return false;
+			}
+		} else {
+			if (!transfer->getResource()->prepareCommands(_pool->getFamilyIdx(), buf.getBuffer(),
+					outputImageBarriers, outputBufferBarriers)) {
+				return false;
+			}
 		}
 
 		VkPipelineStageFlags targetMask = 0;
@@ -1009,18 +1801,38 @@ Vector<const CommandBuffer *> TransferRenderPassHandle::doPrepareCommands(FrameH
 }
 
 void TransferRenderPassHandle::doComplete(FrameQueue &queue, Function<void(bool)> &&func, bool success) {
-	if (success) {
-		auto pass = (TransferPass *)_renderPass.get();
-		TransferAttachmentHandle *transfer = nullptr;
-		for (auto &it : _queueData->attachments) {
-			if (it.first->attachment == pass->getAttachment()) {
-				transfer = (TransferAttachmentHandle *)it.second->handle.get();
+	if (auto transfer = getTransferHandle()) {
+		auto &res = transfer->getResource();
+
+		// commands are completed, staging ring space can be reused
+		res->retireStaging();
+
+		if (success) {
+			if (res->isStreamComplete()) {
+				res->compile();
+			} else if (_transferQueue) {
+				// upload next chunk within next transfer frame
+				auto loop = (Loop *)queue.getLoop();
+				loop->performOnGlThread([loop, q = Rc<TransferQueue>(_transferQueue), res = res] () mutable {
+					if (auto h = loop->makeFrame(q->makeRequest(move(res)), 0)) {
+						h->update(true);
+					}
+				}, this, false);
 			}
 		}
-		transfer->getResource()->compile();
 	}
 
 	QueuePassHandle::doComplete(queue, move(func), success);
 }
 
+TransferAttachmentHandle *TransferRenderPassHandle::getTransferHandle() const {
+	auto pass = (TransferPass *)_renderPass.get();
+	for (auto &it : _queueData->attachments) {
+		if (it.first->attachment == pass->getAttachment()) {
+			return (TransferAttachmentHandle *)it.second->handle.get();
+		}
+	}
+	return nullptr;
+}
+
 }
@@ -33,6 +33,75 @@ namespace stappler::xenolith::vk {
 class DeviceQueue;
 class CommandPool;
 class TransferAttachment;
+class Buffer;
+
+/* Persistent host-visible staging buffer for streaming uploads
+ *
+ * Regions are acquired sequentially from the head of the ring, and can be retired in any order.
+ * Space is reclaimed from the tail only when the oldest region is retired, so region memory
+ * is reused only after all earlier transfers was completed on GPU
+ */
+class StagingRing : public Ref {
+public:
+	struct Region {
+		uint64_t id = 0;
+		VkDeviceSize offset = 0;
+		VkDeviceSize size = 0;
+		uint8_t *ptr = nullptr;
+
+		explicit operator bool () const { return size > 0; }
+	};
+
+	struct Stat {
+		VkDeviceSize size = 0;
+		VkDeviceSize used = 0;
+		uint64_t regions = 0; // regions in flight
+		uint64_t streamed = 0; // total bytes, passed through ring
+	};
+
+	virtual ~StagingRing();
+
+	bool init(Device &, VkDeviceSize);
+
+	// acquire no more then `size` and no less then `minSize` bytes
+	// returns empty region if there is no space available
+	Region acquire(VkDeviceSize size, VkDeviceSize minSize, VkDeviceSize alignment);
+
+	// make host writes visible for device, noop for coherent memory
+	void flush(const Region &) const;
+
+	void retire(const Region &);
+
+	VkBuffer getBuffer() const;
+	VkDeviceSize getSize() const { return _size; }
+
+	Stat getStat() const;
+
+protected:
+	struct Span {
+		uint64_t id;
+		VkDeviceSize begin;
+		VkDeviceSize end;
+		bool retired;
+	};
+
+	VkDeviceSize getUsed() const;
+
+	mutable Mutex _mutex;
+	Device *_device = nullptr;
+	Rc<Buffer> _buffer;
+	uint8_t *_mapped = nullptr;
+	VkDeviceSize _size = 0;
+	VkDeviceSize _memorySize = 0;
+	VkDeviceSize _nonCoherentAtomSize = 1;
+	bool _coherent = true;
+
+	VkDeviceSize _head = 0;
+	VkDeviceSize _tail = 0;
+	uint64_t _nextId = 1;
+	uint64_t _streamed = 0;
+	Vector<Span> _inflight;
+};
 
 class TransferResource final : public gl::AttachmentInputData {
 public:
@@ -47,6 +116,7 @@ public:
 		uint32_t dedicatedMemType = 0;
 		std::optional<VkBufferMemoryBarrier> barrier;
 		bool useStaging = false;
+		bool useRing = false;
 
 		BufferAllocInfo() = default;
 		BufferAllocInfo(gl::BufferData *);
@@ -63,9 +133,20 @@ public:
 		uint32_t dedicatedMemType = 0;
 		std::optional<VkImageMemoryBarrier> barrier;
 		bool useStaging = false;
+		bool useRing = false;
+		bool generateMipmaps = false; // fill mip levels with vkCmdBlitImage after level 0 was copied
+		VkFilter mipmapFilter = VK_FILTER_LINEAR;
+		bool transcode = false; // compressed format is not supported by device, data is transcoded on CPU
+		gl::ImageFormat sourceFormat = gl::ImageFormat::Undefined;
 
 		ImageAllocInfo() = default;
 		ImageAllocInfo(gl::ImageData *);
+
+		// number of levels, provided with image data
+		uint32_t getDataLevels() const;
+
+		// size of data for all provided levels in target format
+		VkDeviceSize getDataSize() const;
 	};
 
 	struct StagingCopy {
@@ -83,6 +164,41 @@ public:
 		Vector<StagingCopy> copyData;
 	};
 
+	struct StreamCopy {
+		ImageAllocInfo *targetImage = nullptr;
+		BufferAllocInfo *targetBuffer = nullptr;
+		BytesView source; // empty if data should be acquired with callback
+		VkDeviceSize size = 0; // total bytes to transfer
+		VkDeviceSize offset = 0; // bytes already transferred
+		VkDeviceSize chunk = 0; // minimal transferable unit: image row, or whole target for callback data
+	};
+
+	struct CopyCommand {
+		VkBuffer source = VK_NULL_HANDLE;
+		VkDeviceSize sourceOffset = 0;
+		VkDeviceSize size = 0;
+		ImageAllocInfo *targetImage = nullptr;
+		BufferAllocInfo *targetBuffer = nullptr;
+		VkDeviceSize targetOffset = 0; // for buffers
+		VkOffset3D imageOffset = { 0, 0, 0 };
+		VkExtent3D imageExtent = { 0, 0, 0 };
+		bool first = true; // first copy into target, layout transition required
+		bool last = true; // last copy into target, output barrier required
+	};
+
+	// single data write (image decoding, buffer copy or streamed chunk) into mapped memory
+	struct DataWrite {
+		uint8_t *target = nullptr;
+		ImageAllocInfo *targetImage = nullptr;
+		BufferAllocInfo *targetBuffer = nullptr;
+		StreamCopy *stream = nullptr;
+		VkDeviceSize offset = 0; // for streamed chunks
+		VkDeviceSize size = 0;
+		size_t result = 0; // bytes written
+	};
+
+	struct WriteBatch;
+
 	virtual ~TransferResource();
 	void invalidate(Device &dev);
 
@@ -92,12 +208,31 @@ public:
 	bool initialize(AllocationUsage = AllocationUsage::DeviceLocal);
 	bool compile();
 
+	// transfer all data in single submission with dedicated staging buffer
 	bool prepareCommands(uint32_t idx, VkCommandBuffer buf,
 			Vector<VkImageMemoryBarrier> &outputImageBarriers, Vector<VkBufferMemoryBarrier> &outputBufferBarriers);
+
+	// transfer no more then `budget` bytes through persistent staging ring, nothing is streamed with zero budget
+	// retireStaging should be called when submission is completed, then, if isStreamComplete is false,
+	// resource should be submitted again to transfer next chunk
+	bool prepareCommands(uint32_t idx, VkCommandBuffer buf, StagingRing &, VkDeviceSize budget,
+			Vector<VkImageMemoryBarrier> &outputImageBarriers, Vector<VkBufferMemoryBarrier> &outputBufferBarriers);
+
 	bool transfer(const Rc<DeviceQueue> &, const Rc<CommandPool> &, const Rc<Fence> &);
 
+	void retireStaging();
+
 	bool isValid() const { return _alloc != nullptr; }
-	bool isStagingRequired() const { return !_stagingBuffer.copyData.empty(); }
+	bool isStagingRequired() const { return _stagingSize > 0; }
+	bool isStreamComplete() const { return _streamIndex >= _stream.size(); }
+
+	// blit commands for mipmaps generation requires queue with graphics capabilities
+	bool isMipmapGenerationRequired() const;
+
+	VkDeviceSize getStreamedSize() const { return _streamedSize; }
+
+	// images are decoded in parallel with loop's thread pool; without loop, data is written on calling thread
+	void setLoop(gl::Loop *loop) { _loop = loop; }
 
 protected:
 	bool allocate();
@@ -112,6 +247,18 @@ protected:
 	// calculate offsets, size and transfer if no staging needed
 	size_t preTransferData();
 
+	bool uploadStaging();
+	bool prepareStream(StagingRing &);
+	size_t writeChunk(uint8_t *, StreamCopy &, VkDeviceSize offset, VkDeviceSize size);
+
+	// perform writes on calling thread and loop's workers, returns when all writes are completed
+	void writeParallel(Vector<DataWrite> &);
+	size_t writeData(DataWrite &);
+
+	bool recordCommands(uint32_t idx, VkCommandBuffer buf, SpanView<CopyCommand>,
+			Vector<VkImageMemoryBarrier> &outputImageBarriers, Vector<VkBufferMemoryBarrier> &outputBufferBarriers);
+	void recordMipmaps(VkCommandBuffer buf, ImageAllocInfo &) const;
+
 	bool createStagingBuffer(StagingBuffer &buffer, size_t) const;
 	bool writeStaging(StagingBuffer &);
 	void dropStaging(StagingBuffer &) const;
@@ -125,24 +272,60 @@ protected:
 	Vector<ImageAllocInfo> _images;
 	VkDeviceSize _nonCoherentAtomSize = 1;
 	StagingBuffer _stagingBuffer;
+	VkDeviceSize _stagingSize = 0;
+	bool _stagingUploaded = false;
 	Function<void(bool)> _callback;
 
+	Rc<StagingRing> _ring;
+	Vector<StreamCopy> _stream;
+	Vector<StagingRing::Region> _regions;
+	size_t _streamIndex = 0;
+	VkDeviceSize _streamedSize = 0;
+	bool _streamPrepared = false;
+
 	bool _initialized = false;
 	AllocationUsage _targetUsage = AllocationUsage::DeviceLocal;
+	gl::Loop *_loop = nullptr;
 };
 
 class TransferQueue : public renderqueue::Queue {
 public:
+	static constexpr VkDeviceSize DefaultStagingSize = 32 * 1024 * 1024;
+	static constexpr VkDeviceSize DefaultUploadBudget = 8 * 1024 * 1024;
+
 	virtual ~TransferQueue();
 
-	bool init();
+	bool init(VkDeviceSize stagingSize = DefaultStagingSize, VkDeviceSize uploadBudget = DefaultUploadBudget);
 
 	Rc<FrameRequest> makeRequest(Rc<TransferResource> &&);
 
+	// persistent staging ring, allocated on first use; nullptr if allocation failed
+	Rc<StagingRing> acquireStagingRing(Device &);
+
+	// max bytes, transferred through staging ring within one loop iteration by all transfer passes
+	void setUploadBudget(VkDeviceSize);
+	VkDeviceSize getUploadBudget() const { return _uploadBudget.load(); }
+
+	// takes remaining upload budget for loop iteration; unused part should be returned with releaseUploadBudget
+	VkDeviceSize acquireUploadBudget(uint64_t clock);
+	void releaseUploadBudget(uint64_t clock, VkDeviceSize);
+
+	VkDeviceSize getStagingSize() const { return _stagingSize; }
+
 protected:
 	using renderqueue::Queue::init;
 
 	const AttachmentData *_attachment = nullptr;
+
+	Mutex _ringMutex;
+	Rc<StagingRing> _ring;
+	bool _ringFailed = false;
+	VkDeviceSize _stagingSize = DefaultStagingSize;
+	std::atomic<VkDeviceSize> _uploadBudget = DefaultUploadBudget;
+
+	Mutex _budgetMutex;
+	uint64_t _budgetClock = maxOf<uint64_t>();
+	VkDeviceSize _budgetRemains = 0;
 };
 
 }
@@ -25,6 +25,7 @@
 #include "XLEventListener.h"
 #include "XLApplication.h"
 #include "XLDeferredManager.h"
+#include "XLLabelCache.h"
 #include "XLFontLayout.h"
 
 namespace stappler::xenolith {
@@ -196,6 +197,20 @@ Rc<LabelResult> Label::writeResult(FormatSpec *format, const Color4F &color) {
 	return result;
 }
 
+Rc<LabelResult> Label::writeResult(LabelResult *source, const Color4F &sourceColor, const Color4F &targetColor) {
+	auto result = Rc<LabelResult>::alloc();
+	result->data = source->data;
+	result->colorMap = source->colorMap;
+
+	if (sourceColor != targetColor) {
+		VertexArray array;
+		array.init(result->data.data);
+		array.updateColorQuads(targetColor, result->colorMap);
+		result->data.data = array.pop();
+	}
+	return result;
+}
+
 Label::~Label() {
 	_format = nullptr;
 }
@@ -278,6 +293,8 @@ void Label::updateLabel() {
 		return;
 	}
 
+	_layoutCacheEntry = nullptr;
+
 	if (_string16.empty()) {
 		_format = nullptr;
 		_vertexesDirty = true;
@@ -285,18 +302,36 @@ void Label::updateLabel() {
 		return;
 	}
 
-	auto spec = Rc<font::FormatSpec>::alloc(Rc<font::FontController>(_source), _string16.size(), _compiledStyles.size() + 1);
-
 	_compiledStyles = compileStyle();
 	_style.text.color = _displayedColor.getColor();
 	_style.text.opacity = _displayedColor.getOpacity();
 	_style.text.whiteSpace = font::WhiteSpace::PreWrap;
 
-	if (!updateFormatSpec(spec, _compiledStyles, _labelDensity, _adjustValue)) {
-		return;
+	String cacheKey;
+	auto cache = getLayoutCache();
+	if (cache && _source->isLoaded()) {
+		cacheKey = getFormatSpecKey(_source, _compiledStyles, _labelDensity, _adjustValue);
+		if (!cacheKey.empty()) {
+			_layoutCacheEntry = cache->get(cacheKey);
+		}
 	}
 
-	_format = spec;
+	if (_layoutCacheEntry) {
+		_format = _layoutCacheEntry->getFormat();
+	} else {
+		auto spec = Rc<font::FormatSpec>::alloc(Rc<font::FontController>(_source), _string16.size(), _compiledStyles.size() + 1);
+
+		if (!updateFormatSpec(spec, _compiledStyles, _labelDensity, _adjustValue)) {
+			return;
+		}
+
+		if (!cacheKey.empty()) {
+			_layoutCacheEntry = cache->emplace(move(cacheKey), move(spec), _displayedColor);
+			_format = _layoutCacheEntry->getFormat();
+		} else {
+			_format = spec;
+		}
+	}
 
 	if (_format) {
 		if (_format->chars.empty()) {
@@ -325,7 +360,8 @@ void Label::onGlobalTransformDirty(const Mat4 &parent) {
 }
 
 void Label::updateColor() {
-	if (_format) {
+	// shared layout should not be modified, color will be applied to vertexes directly
+	if (_format && !_layoutCacheEntry) {
 		for (auto &it : _format->ranges) {
 			if (!it.colorDirty) {
 				it.color.r = uint8_t(_displayedColor.r * 255.0f);
@@ -358,6 +394,20 @@ bool Label::checkVertexDirty() const {
 	return _vertexesDirty || _labelDirty;
 }
 
+Rect Label::getDamageBounds() const {
+	if (!_deferred && !_vertexes.empty()) {
+		return Sprite::getDamageBounds();
+	}
+
+	auto bounds = Node::getDamageBounds();
+	if (_format && !_format->chars.empty()) {
+		auto width = _format->width / _labelDensity;
+		auto height = _format->height / _labelDensity;
+		bounds.size = Size2(std::max(bounds.size.width, width), std::max(bounds.size.height, height));
+	}
+	return bounds;
+}
+
 NodeFlags Label::processParentFlags(RenderFrameInfo &info, NodeFlags parentFlags) {
 	if (_labelDirty) {
 		updateLabel();
@@ -463,17 +513,43 @@ void Label::updateVertexes() {
 
 	if (_deferred) {
 		auto &manager = _director->getApplication()->getDeferredManager();
-		_deferredResult = manager->runLabel(_format, _displayedColor);
+		if (_layoutCacheEntry) {
+			_deferredResult = manager->runLabel(_layoutCacheEntry, _displayedColor);
+		} else {
+			_deferredResult = manager->runLabel(_format, _displayedColor);
+		}
 		_vertexes.clear();
 		_vertexColorDirty = false;
 	} else {
 		_deferredResult = nullptr;
-		updateQuadsForeground(_source, _format, _colorMap);
+		if (_layoutCacheEntry) {
+			if (auto res = _layoutCacheEntry->getResult()) {
+				_vertexes.init(res->data.data);
+				_colorMap = res->colorMap;
+			} else {
+				updateQuadsForeground(_source, _format, _colorMap);
+
+				auto res = Rc<LabelResult>::alloc();
+				res->data.mat = Mat4::IDENTITY;
+				res->data.data = _vertexes.pop();
+				res->colorMap = _colorMap;
+				_layoutCacheEntry->setResult(res);
+			}
+		} else {
+			updateQuadsForeground(_source, _format, _colorMap);
+		}
 		_vertexColorDirty = true;
 	}
 }
 
 void Label::onFontSourceUpdated() {
+	if (auto cache = getLayoutCache()) {
+		cache->invalidate(_source);
+	}
+	if (_layoutCacheEntry) {
+		_layoutCacheEntry = nullptr;
+		_labelDirty = true;
+	}
 	_vertexesDirty = true;
 }
 
@@ -552,6 +628,25 @@ void Label::setDeferred(bool val) {
 	}
 }
 
+void Label::setLayoutCacheEnabled(bool val) {
+	if (val != _layoutCacheEnabled) {
+		_layoutCacheEnabled = val;
+		_labelDirty = true;
+	}
+}
+
+LabelCache *Label::getLayoutCache() const {
+	if (!_layoutCacheEnabled) {
+		return nullptr;
+	}
+
+	auto app = Application::getInstance();
+	if (app && app->getDeferredManager()) {
+		return app->getDeferredManager()->getLabelCache();
+	}
+	return nullptr;
+}
+
 LabelDeferredResult::~LabelDeferredResult() {
 	if (_future) {
 		delete _future;
@@ -564,6 +659,12 @@ bool LabelDeferredResult::init(std::future<Rc<LabelResult>> &&future) {
 	return true;
 }
 
+bool LabelDeferredResult::init(Rc<LabelResult> &&result) {
+	_result = move(result);
+	DeferredVertexResult::handleReady();
+	return true;
+}
+
 SpanView<gl::TransformedVertexData> LabelDeferredResult::getData() {
 	std::unique_lock<Mutex> lock(_mutex);
 	if (_future) {
@@ -31,6 +31,8 @@
 namespace stappler::xenolith {
 
 class EventListener;
+class LabelCache;
+class LabelCacheEntry;
 
 struct LabelResult : Ref {
 	gl::TransformedVertexData data;
@@ -42,6 +44,7 @@ public:
 	virtual ~LabelDeferredResult();
 
 	bool init(std::future<Rc<LabelResult>> &&);
+	bool init(Rc<LabelResult> &&);
 
 	virtual SpanView<gl::TransformedVertexData> getData() override;
 
@@ -64,6 +67,9 @@ public:
 	static void writeQuads(VertexArray &vertexes, FormatSpec *format, Vector<ColorMask> &colorMap);
 	static Rc<LabelResult> writeResult(FormatSpec *format, const Color4F &);
 
+	// Makes label-owned copy of shared result, vertex data is shared until modified
+	static Rc<LabelResult> writeResult(LabelResult *, const Color4F &sourceColor, const Color4F &targetColor);
+
 	virtual ~Label();
 
 	virtual bool init() override;
@@ -106,6 +112,10 @@ public:
 	virtual void setDeferred(bool);
 	virtual bool isDeferred() const { return _deferred; }
 
+	// Share layout and vertexes with other labels with the same parameters (enabled by default)
+	virtual void setLayoutCacheEnabled(bool);
+	virtual bool isLayoutCacheEnabled() const { return _layoutCacheEnabled; }
+
 protected:
 	using Sprite::init;
 
@@ -121,12 +131,17 @@ protected:
 
 	virtual bool checkVertexDirty() const override;
 
+	// glyph bounds; layout bounds for deferred labels, which has no local vertexes
+	virtual Rect getDamageBounds() const override;
+
 	virtual NodeFlags processParentFlags(RenderFrameInfo &info, NodeFlags parentFlags) override;
 
 	virtual void pushCommands(RenderFrameInfo &, NodeFlags flags) override;
 
 	void updateLabelScale(const Mat4 &parent);
 
+	LabelCache *getLayoutCache() const;
+
 	EventListener *_listener = nullptr;
 	Time _quadRequestTime;
 	Rc<font::FontController> _source;
@@ -134,11 +149,13 @@ protected:
 	Vector<ColorMask> _colorMap;
 
 	bool _deferred = true;
+	bool _layoutCacheEnabled = true;
 
 	uint8_t _adjustValue = 0;
 	size_t _updateCount = 0;
 
 	Rc<LabelDeferredResult> _deferredResult;
+	Rc<LabelCacheEntry> _layoutCacheEntry;
 
 	/*Map<String, Vector<char16_t>> _standaloneChars;
 	Vector<Rc<cocos2d::Texture2D>> _standaloneTextures;
@@ -0,0 +1,154 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "XLLabelCache.h"
+
+namespace stappler::xenolith {
+
+LabelCacheEntry::LabelCacheEntry(String &&key, Rc<font::FormatSpec> &&format, const Color4F &color)
+: _key(move(key)), _format(move(format)), _color(color) { }
+
+Rc<LabelResult> LabelCacheEntry::getResult() const {
+	std::unique_lock<Mutex> lock(_mutex);
+	return _result;
+}
+
+void LabelCacheEntry::setResult(const Rc<LabelResult> &res) {
+	std::unique_lock<Mutex> lock(_mutex);
+	if (!_result) {
+		_result = res;
+	}
+}
+
+LabelCache::~LabelCache() { }
+
+bool LabelCache::init(size_t capacity) {
+	_capacity = capacity;
+	return true;
+}
+
+Rc<LabelCache::Entry> LabelCache::get(StringView key) {
+	std::unique_lock<Mutex> lock(_mutex);
+	auto it = _entries.find(key);
+	if (it != _entries.end()) {
+		it->second->_access = ++ _clock;
+		++ _stat.hits;
+		return it->second;
+	}
+	++ _stat.misses;
+	return nullptr;
+}
+
+Rc<LabelCache::Entry> LabelCache::emplace(String &&key, Rc<font::FormatSpec> &&format, const Color4F &color) {
+	std::unique_lock<Mutex> lock(_mutex);
+	auto it = _entries.find(key);
+	if (it != _entries.end()) {
+		// somebody already placed the same layout, prefer existing one
+		it->second->_access = ++ _clock;
+		return it->second;
+	}
+
+	auto entry = Rc<Entry>::alloc(move(key), move(format), color);
+	entry->_access = ++ _clock;
+	_entries.emplace(entry->getKey(), entry);
+	_sources[entry->getFormat()->source.get()].emplace(entry.get());
+
+	if (_entries.size() > _capacity) {
+		evict();
+	}
+
+	return entry;
+}
+
+void LabelCache::invalidate(const font::FontController *source) {
+	std::unique_lock<Mutex> lock(_mutex);
+	auto sourceIt = _sources.find(source);
+	if (sourceIt == _sources.end()) {
+		return;
+	}
+
+	for (auto &entry : sourceIt->second) {
+		_entries.erase(entry->getKey());
+	}
+	_sources.erase(sourceIt);
+}
+
+void LabelCache::clear() {
+	std::unique_lock<Mutex> lock(_mutex);
+	_sources.clear();
+	_entries.clear();
+}
+
+void LabelCache::setCapacity(size_t value) {
+	std::unique_lock<Mutex> lock(_mutex);
+	_capacity = value;
+	if (_entries.size() > _capacity) {
+		evict();
+	}
+}
+
+LabelCache::Stat LabelCache::getStat() const {
+	std::unique_lock<Mutex> lock(_mutex);
+	auto ret = _stat;
+	ret.size = _entries.size();
+	return ret;
+}
+
+void LabelCache::evict() {
+	// evict least recently used quarter of capacity in one pass to amortize sorting
+	auto target = _capacity - _capacity / 4;
+	if (_entries.size() <= target) {
+		return;
+	}
+
+	Vector<uint64_t> access; access.reserve(_entries.size());
+	for (auto &it : _entries) {
+		access.emplace_back(it.second->_access);
+	}
+
+	auto nth = access.begin() + (_entries.size() - target - 1);
+	std::nth_element(access.begin(), nth, access.end());
+	auto threshold = *nth;
+
+	auto it = _entries.begin();
+	while (it != _entries.end()) {
+		if (it->second->_access <= threshold) {
+			removeFromSource(it->second.get());
+			it = _entries.erase(it);
+			++ _stat.evictions;
+		} else {
+			++ it;
+		}
+	}
+}
+
+void LabelCache::removeFromSource(Entry *entry) {
+	auto it = _sources.find(entry->getFormat()->source.get());
+	if (it != _sources.end()) {
+		it->second.erase(entry);
+		if (it->second.empty()) {
+			_sources.erase(it);
+		}
+	}
+}
+
+}
@@ -0,0 +1,107 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef XENOLITH_NODES_XLLABELCACHE_H_
+#define XENOLITH_NODES_XLLABELCACHE_H_
+
+#include "XLLabel.h"
+
+namespace stappler::xenolith {
+
+class LabelCacheEntry : public Ref {
+public:
+	virtual ~LabelCacheEntry() { }
+
+	LabelCacheEntry(String &&key, Rc<font::FormatSpec> &&, const Color4F &);
+
+	StringView getKey() const { return _key; }
+
+	// FormatSpec in cache should be considered immutable
+	const Rc<font::FormatSpec> &getFormat() const { return _format; }
+
+	// Color, that was baked into FormatSpec ranges
+	const Color4F &getColor() const { return _color; }
+
+	// Prebuilt vertexes, nullptr until first label was written
+	Rc<LabelResult> getResult() const;
+	void setResult(const Rc<LabelResult> &);
+
+protected:
+	friend class LabelCache;
+
+	mutable Mutex _mutex;
+	String _key;
+	Rc<font::FormatSpec> _format;
+	Rc<LabelResult> _result;
+	Color4F _color;
+	uint64_t _access = 0;
+};
+
+// Shared storage for label layouts
+// Labels with the same style, string, width constraints and density share one FormatSpec
+// and one prebuilt vertex array (VertexData is copy-on-write, so sharing is safe)
+class LabelCache : public Ref {
+public:
+	static constexpr size_t DefaultCapacity = 1024;
+
+	using Entry = LabelCacheEntry;
+
+	struct Stat {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+		size_t size = 0;
+	};
+
+	virtual ~LabelCache();
+
+	bool init(size_t capacity = DefaultCapacity);
+
+	Rc<Entry> get(StringView key);
+	Rc<Entry> emplace(String &&key, Rc<font::FormatSpec> &&, const Color4F &);
+
+	// drop all layouts, produced with font controller (when font set was changed)
+	void invalidate(const font::FontController *);
+	void clear();
+
+	void setCapacity(size_t);
+	size_t getCapacity() const { return _capacity; }
+
+	Stat getStat() const;
+
+protected:
+	void evict();
+	void removeFromSource(Entry *);
+
+	mutable Mutex _mutex;
+	size_t _capacity = DefaultCapacity;
+	uint64_t _clock = 0;
+	HashMap<StringView, Rc<Entry>> _entries;
+
+	// entries by font source, so source update drops only it's own entries
+	Map<const font::FontController *, Set<Entry *>> _sources;
+	Stat _stat;
+};
+
+}
+
+#endif /* XENOLITH_NODES_XLLABELCACHE_H_ */
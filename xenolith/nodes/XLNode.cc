@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "XLInputListener.h"
 #include "XLComponent.h"
 #include "XLScene.h"
+#include "XLRasterCache.h"
 #include "XLDirector.h"
 #include "XLScheduler.h"
 #include "XLActionManager.h"
@@ -251,6 +252,9 @@ void Node::setVisible(bool visible) {
 	_visible = visible;
 	if (_visible) {
 		_contentSizeDirty = _transformInverseDirty = _transformCacheDirty = _transformDirty = true;
+	} else {
+		invalidateRasterized();
+		invalidateDamage();
 	}
 }
 
@@ -355,6 +359,9 @@ void Node::removeChild(Node *child, bool cleanup) {
 
 	auto it = std::find(_children.begin(), _children.end(), child);
 	if (it != _children.end()) {
+		// report damage while child is still on scene
+		child->invalidateDamage();
+
 		if (_running) {
 			child->onExit();
 		}
@@ -366,6 +373,8 @@ void Node::removeChild(Node *child, bool cleanup) {
 		// set parent nil at the end
 		child->setParent(nullptr);
 		_children.erase(it);
+
+		invalidateRasterized();
 	}
 }
 
@@ -382,6 +391,8 @@ void Node::removeChildByTag(uint64_t tag, bool cleanup) {
 
 void Node::removeAllChildren(bool cleanup) {
 	for (const auto &child : _children) {
+		child->invalidateDamage();
+
 		if (_running) {
 			child->onExit();
 		}
@@ -394,6 +405,7 @@ void Node::removeAllChildren(bool cleanup) {
 	}
 
 	_children.clear();
+	invalidateRasterized();
 }
 
 void Node::reorderChild(Node * child, ZOrder localZOrder) {
@@ -655,6 +667,12 @@ void Node::onExit() {
 		_onExitCallback();
 	}
 
+	if (_rasterized && _scene) {
+		if (auto &cache = _scene->getRasterCache()) {
+			cache->remove(this);
+		}
+	}
+
 	// prevent node destruction until update is ended
 	_director->autorelease(this);
 
@@ -987,6 +1005,22 @@ bool Node::visitGeometry(RenderFrameInfo &info, NodeFlags parentFlags) {
 		return false;
 	}
 
+	// dirty flags are consumed on this step, so check rasterized subtree and damage before processing
+	if (_rasterized && !_rasterDirty) {
+		_rasterDirty = (parentFlags & NodeFlags::DirtyMask) != NodeFlags::None || isSubtreeDirty();
+	}
+
+	if (!_damageDirty) {
+		_damageDirty = (parentFlags & NodeFlags::DirtyMask) != NodeFlags::None || isContentDirty();
+	}
+
+	if (_reorderChildDirty) {
+		// draw order within children was changed
+		for (auto &it : _children) {
+			it->_damageDirty = true;
+		}
+	}
+
 	NodeFlags flags = processParentFlags(info, parentFlags);
 	auto order = getLocalZOrder();
 
@@ -1028,39 +1062,59 @@ bool Node::visitDraw(RenderFrameInfo &info, NodeFlags parentFlags) {
 		info.shadowStack.push_back(std::max(info.shadowStack.back(), _shadowIndex));
 	}
 
-	memory::vector< memory::vector<Rc<Component>> * > components;
+	// damage is reported after drawing, when node's vertexes are up to date
+	bool damaged = _damageDirty || (_rasterized && _rasterDirty);
 
-	for (auto &it : _components) {
-		if (it->isEnabled() && it->getFrameTag() != InvalidTag) {
-			components.emplace_back(info.pushComponent(it));
+	bool cached = false;
+	if (_rasterized && info.scene) {
+		if (auto &cache = info.scene->getRasterCache()) {
+			cached = cache->visitDraw(this, info, flags, _rasterDirty);
 		}
+		_rasterDirty = false;
 	}
 
-	size_t i = 0;
-
-	if (!_children.empty()) {
-		sortAllChildren();
-		// draw children zOrder < 0
-		for (; i < _children.size(); i++) {
-			auto node = _children.at(i);
+	if (cached) {
+		// subtree was drawn as a single quad, but it's input listeners should remain active
+		visitInputListeners(info);
+	} else {
+		memory::vector< memory::vector<Rc<Component>> * > components;
 
-			if (node && node->_zOrder < ZOrder(0))
-				node->visitDraw(info, flags);
-			else
-				break;
+		for (auto &it : _components) {
+			if (it->isEnabled() && it->getFrameTag() != InvalidTag) {
+				components.emplace_back(info.pushComponent(it));
+			}
 		}
 
-		visitSelf(info, flags, visibleByCamera);
+		size_t i = 0;
 
-		for (auto it = _children.cbegin() + i; it != _children.cend(); ++it) {
-			(*it)->visitDraw(info, flags);
+		if (!_children.empty()) {
+			sortAllChildren();
+			// draw children zOrder < 0
+			for (; i < _children.size(); i++) {
+				auto node = _children.at(i);
+
+				if (node && node->_zOrder < ZOrder(0))
+					node->visitDraw(info, flags);
+				else
+					break;
+			}
+
+			visitSelf(info, flags, visibleByCamera);
+
+			for (auto it = _children.cbegin() + i; it != _children.cend(); ++it) {
+				(*it)->visitDraw(info, flags);
+			}
+		} else {
+			visitSelf(info, flags, visibleByCamera);
+		}
+
+		for (auto &it : components) {
+			info.popComponent(it);
 		}
-	} else {
-		visitSelf(info, flags, visibleByCamera);
 	}
 
-	for (auto &it : components) {
-		info.popComponent(it);
+	if (damaged) {
+		updateDamage(info);
 	}
 
 	if (_shadowIndex > 0.0f) {
@@ -1160,6 +1214,22 @@ NodeFlags Node::processParentFlags(RenderFrameInfo &info, NodeFlags parentFlags)
 	return flags;
 }
 
+void Node::setRasterized(bool value) {
+	if (_rasterized != value) {
+		_rasterized = value;
+		_rasterDirty = true;
+		if (!_rasterized && _scene) {
+			if (auto &cache = _scene->getRasterCache()) {
+				cache->remove(this);
+			}
+		}
+	}
+}
+
+bool Node::isContentDirty() const {
+	return _transformDirty || _contentSizeDirty || _reorderChildDirty;
+}
+
 void Node::visitSelf(RenderFrameInfo &info, NodeFlags flags, bool visibleByCamera) {
 	for (auto &it : _components) {
 		it->visit(info, flags);
@@ -1177,4 +1247,75 @@ void Node::visitSelf(RenderFrameInfo &info, NodeFlags flags, bool visibleByCamer
 	}
 }
 
+void Node::visitInputListeners(RenderFrameInfo &info) {
+	for (auto &it : _inputEvents) {
+		if (it->isEnabled()) {
+			info.input->addListener(it);
+		}
+	}
+
+	for (auto &it : _children) {
+		if (it->_visible) {
+			it->visitInputListeners(info);
+		}
+	}
+}
+
+bool Node::isSubtreeDirty() const {
+	if (isContentDirty()) {
+		return true;
+	}
+
+	for (auto &it : _children) {
+		if (it->_visible && it->isSubtreeDirty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void Node::invalidateRasterized() {
+	auto node = this;
+	while (node) {
+		if (node->_rasterized) {
+			node->_rasterDirty = true;
+		}
+		node = node->_parent;
+	}
+}
+
+void Node::updateDamage(RenderFrameInfo &info) {
+	auto bounds = TransformRect(getDamageBounds(), _modelViewTransform);
+
+	if (info.commands) {
+		info.commands->addDamage(_damageBounds);
+		info.commands->addDamage(bounds);
+
+		// shadows are resolved for the whole frame, we can not bound them with node's area
+		if (info.shadowStack.back() > 0.0f) {
+			info.commands->setDamageFull();
+		}
+	}
+
+	_damageBounds = bounds;
+	_damageDirty = false;
+}
+
+Rect Node::getDamageBounds() const {
+	return Rect(0, 0, _contentSize.width, _contentSize.height);
+}
+
+void Node::invalidateDamage() {
+	if (_scene && _damageBounds.size.width > 0.0f && _damageBounds.size.height > 0.0f) {
+		_scene->addDamage(_damageBounds);
+	}
+
+	_damageBounds = Rect::ZERO;
+	_damageDirty = true;
+
+	for (auto &it : _children) {
+		it->invalidateDamage();
+	}
+}
+
 }
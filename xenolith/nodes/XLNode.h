@@ -301,6 +301,14 @@ public:
 	virtual void setShadowIndex(float value) { _shadowIndex = value; }
 	virtual float getShadowIndex() const { return _shadowIndex; }
 
+	// Rasterized node renders its subtree into offscreen layer once, then draws it as a single textured quad,
+	// until transform, content or order of any node in subtree changes (see RasterCache for limitations)
+	virtual void setRasterized(bool);
+	virtual bool isRasterized() const { return _rasterized; }
+
+	// Node has changes, that was not drawn yet; used to invalidate rasterized subtrees
+	virtual bool isContentDirty() const;
+
 	virtual void draw(RenderFrameInfo &, NodeFlags flags);
 
 	// visit on unsorted nodes, commit most of geometry changes
@@ -340,6 +348,19 @@ protected:
 	virtual NodeFlags processParentFlags(RenderFrameInfo &info, NodeFlags parentFlags);
 
 	void visitSelf(RenderFrameInfo &, NodeFlags flags, bool visibleByCamera);
+	void visitInputListeners(RenderFrameInfo &);
+
+	bool isSubtreeDirty() const;
+	void invalidateRasterized();
+
+	// report node's area on screen into frame damage region (see CommandList::addDamage)
+	void updateDamage(RenderFrameInfo &);
+
+	// node-space area, affected by node's drawing; content rect by default
+	virtual Rect getDamageBounds() const;
+
+	// report last drawn area of subtree as damaged (when subtree is hidden or removed)
+	void invalidateDamage();
 
 	bool _is3d = false;
 	bool _running = false;
@@ -356,6 +377,12 @@ protected:
 	mutable bool _transformInverseDirty = true; // dynamic value
 	bool _transformDirty = true;
 
+	bool _rasterized = false;
+	bool _rasterDirty = true;
+
+	bool _damageDirty = true;
+	Rect _damageBounds; // last drawn area in world space
+
 	String _name;
 	Value _dataValue;
 
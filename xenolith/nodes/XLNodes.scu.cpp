@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include "XLSprite.cc"
 #include "XLLayer.cc"
 #include "XLLabel.cc"
+#include "XLLabelCache.cc"
 #include "XLVectorCanvas.cc"
 #include "XLVectorSprite.cc"
 #include "components/XLComponent.cc"
@@ -39,3 +40,4 @@ THE SOFTWARE.
 #include "scene/XLSceneLight.cc"
 #include "scene/XLSceneContent.cc"
 #include "scene/XLSceneLayout.cc"
+#include "scene/XLRasterCache.cc"
@@ -175,6 +175,8 @@ void Sprite::draw(RenderFrameInfo &frame, NodeFlags flags) {
 		_vertexColorDirty = false;
 	}
 
+	_instancesDirty = false;
+
 	if (_materialDirty) {
 		updateBlendAndDepth();
 
@@ -186,6 +188,7 @@ void Sprite::draw(RenderFrameInfo &frame, NodeFlags flags) {
 				log::vtext("Sprite", "Material for sprite with texture '", _texture->getName(), "' not found");
 			}
 		}
+		_layerMaterialId = 0;
 		_materialDirty = false;
 	}
 
@@ -193,10 +196,23 @@ void Sprite::draw(RenderFrameInfo &frame, NodeFlags flags) {
 		emplace_ordered(frame.commands->waitDependencies, move(it));
 	}
 
-	pushCommands(frame, flags);
+	if (frame.accumulateAlpha) {
+		// material is replaced only for commands of layer frame
+		auto materialId = _materialId;
+		_materialId = acquireLayerMaterial(frame);
+		pushCommands(frame, flags);
+		_materialId = materialId;
+	} else {
+		pushCommands(frame, flags);
+	}
 	_pendingDependencies.clear();
 }
 
+bool Sprite::isContentDirty() const {
+	return Node::isContentDirty() || checkVertexDirty() || _vertexColorDirty || _materialDirty || _instancesDirty
+			|| !_pendingDependencies.empty() || (_texture && !_texture->isLoaded());
+}
+
 void Sprite::onEnter(Scene *scene) {
 	Node::onEnter(scene);
 
@@ -296,6 +312,25 @@ void Sprite::setTextureLoadedCallback(Function<void()> &&cb) {
 	_textureLoadedCallback = move(cb);
 }
 
+void Sprite::setInstances(Vector<gl::InstanceObject> &&instances) {
+	_instances = move(instances);
+	_instancesDirty = true;
+	_damageDirty = true;
+
+	bool transparent = false;
+	for (auto &it : _instances) {
+		if (it.color.w < 1.0f) {
+			transparent = true;
+			break;
+		}
+	}
+
+	if (transparent != _instancesTransparent) {
+		_instancesTransparent = transparent;
+		updateBlendAndDepth();
+	}
+}
+
 void Sprite::pushShadowCommands(RenderFrameInfo &frame, NodeFlags flags, const Mat4 &t, SpanView<gl::TransformedVertexData> data) {
 	frame.shadows->pushShadowArray(data, frame.shadowStack.back());
 }
@@ -312,6 +347,12 @@ void Sprite::pushCommands(RenderFrameInfo &frame, NodeFlags flags) {
 		newMV = frame.modelTransformStack.back();
 	}
 
+	if (!_instances.empty()) {
+		frame.commands->pushInstanceArray(move(data), frame.viewProjectionStack.back() * newMV, _instances,
+				frame.zPath, _materialId, _realRenderingLevel, frame.shadowStack.back(), _commandFlags);
+		return;
+	}
+
 	if (_shadowIndex > 0.0f) {
 		gl::TransformedVertexData transformData{newMV, data};
 		pushShadowCommands(frame, flags, newMV, makeSpanView(&transformData, 1));
@@ -330,6 +371,33 @@ MaterialInfo Sprite::getMaterialInfo() const {
 	return ret;
 }
 
+uint64_t Sprite::acquireLayerMaterial(RenderFrameInfo &frame) {
+	auto blend = _materialInfo.getBlendInfo();
+	if (!blend.isEnabled() || blend.srcAlpha != toInt(gl::BlendFactor::Zero) || blend.dstAlpha != toInt(gl::BlendFactor::One)) {
+		// solid or custom alpha blending already writes coverage into alpha channel
+		return _materialId;
+	}
+
+	if (_layerMaterialId == 0) {
+		blend.srcAlpha = toInt(gl::BlendFactor::One);
+		blend.dstAlpha = toInt(gl::BlendFactor::OneMinusSrcAlpha);
+
+		auto info = getMaterialInfo();
+		info.pipeline.setBlendInfo(blend);
+
+		_layerMaterialId = frame.scene->getMaterial(info);
+		if (_layerMaterialId == 0) {
+			_layerMaterialId = frame.scene->acquireMaterial(info, getMaterialImages(), isMaterialRevokable());
+			if (_layerMaterialId == 0) {
+				log::vtext("Sprite", "Layer material for sprite with texture '", _texture->getName(), "' not found");
+				_layerMaterialId = _materialId;
+			}
+		}
+	}
+
+	return _layerMaterialId;
+}
+
 Vector<gl::MaterialImage> Sprite::getMaterialImages() const {
 	Vector<gl::MaterialImage> ret;
 	ret.emplace_back(_texture->getMaterialImage());
@@ -457,7 +525,7 @@ void Sprite::updateBlendAndDepth() {
 RenderingLevel Sprite::getRealRenderingLevel() const {
 	auto level = _renderingLevel;
 	if (level == RenderingLevel::Default) {
-		if (_displayedColor.a < 1.0f || !_texture || _materialInfo.getLineWidth() != 0.0f) {
+		if (_displayedColor.a < 1.0f || _instancesTransparent || !_texture || _materialInfo.getLineWidth() != 0.0f) {
 			level = RenderingLevel::Transparent;
 		} else if (_colorMode.getMode() == ColorMode::Solid) {
 			if (_texture->hasAlpha()) {
@@ -494,6 +562,40 @@ bool Sprite::checkVertexDirty() const {
 	return _vertexesDirty;
 }
 
+static Rect Sprite_unionRect(const Rect &a, const Rect &b) {
+	auto minX = std::min(a.origin.x, b.origin.x);
+	auto minY = std::min(a.origin.y, b.origin.y);
+	auto maxX = std::max(a.origin.x + a.size.width, b.origin.x + b.size.width);
+	auto maxY = std::max(a.origin.y + a.size.height, b.origin.y + b.size.height);
+	return Rect(minX, minY, maxX - minX, maxY - minY);
+}
+
+Rect Sprite::getDamageBounds() const {
+	if (_vertexes.empty()) {
+		return Node::getDamageBounds();
+	}
+
+	auto bounds = _vertexes.getBounds();
+	if (!_instances.empty()) {
+		// instance transform is applied in node space, before model-view transform
+		auto vertexBounds = bounds;
+		bounds = TransformRect(vertexBounds, _instances.front().transform);
+		for (auto &it : _instances) {
+			bounds = Sprite_unionRect(bounds, TransformRect(vertexBounds, it.transform));
+		}
+	}
+
+	if (_normalized) {
+		// normalized sprites are drawn with rounded translation
+		bounds.origin.x -= 1.0f;
+		bounds.origin.y -= 1.0f;
+		bounds.size.width += 2.0f;
+		bounds.size.height += 2.0f;
+	}
+
+	return bounds;
+}
+
 bool Sprite::getAutofitParams(Autofit autofit, const Vec2 &autofitPos, const Size2 &contentSize, const Size2 &texSize,
 		Rect &contentRect, Rect &textureRect) {
 
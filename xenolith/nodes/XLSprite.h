@@ -36,6 +36,7 @@ public:
 
 	static constexpr uint16_t SamplerIndexDefaultFilterNearest = 0;
 	static constexpr uint16_t SamplerIndexDefaultFilterLinear = 1;
+	static constexpr uint16_t SamplerIndexDefaultFilterLinearMipmap = 2; // for images with ImageHints::GenerateMipmaps
 
 	Sprite();
 	virtual ~Sprite() { }
@@ -55,6 +56,8 @@ public:
 	virtual bool visitDraw(RenderFrameInfo &, NodeFlags parentFlags) override;
 	virtual void draw(RenderFrameInfo &, NodeFlags flags) override;
 
+	virtual bool isContentDirty() const override;
+
 	virtual void onEnter(Scene *) override;
 	virtual void onExit() override;
 	virtual void onContentSizeDirty() override;
@@ -102,6 +105,12 @@ public:
 
 	virtual void setTextureLoadedCallback(Function<void()> &&);
 
+	// Draw sprite quad once for each instance with single instanced draw call (particles, tile maps, grids)
+	// Instance transform is applied in sprite's node space, instance color is multiplied with sprite color,
+	// texRect is applied to sprite's texture coordinates. Instanced sprite does not cast shadows
+	virtual void setInstances(Vector<gl::InstanceObject> &&);
+	virtual const Vector<gl::InstanceObject> &getInstances() const { return _instances; }
+
 protected:
 	using DynamicStateNode::init;
 
@@ -112,6 +121,10 @@ protected:
 	virtual MaterialInfo getMaterialInfo() const;
 	virtual Vector<gl::MaterialImage> getMaterialImages() const;
 	virtual bool isMaterialRevokable() const;
+
+	// material for frames, that accumulate alpha (offscreen layers), same as sprite material if it writes coverage
+	uint64_t acquireLayerMaterial(RenderFrameInfo &);
+
 	virtual void updateColor() override;
 	virtual void updateVertexesColor();
 	virtual void initVertexes();
@@ -126,6 +139,9 @@ protected:
 
 	virtual bool checkVertexDirty() const;
 
+	// vertex bounds, extended with instance transforms
+	virtual Rect getDamageBounds() const override;
+
 	String _textureName;
 	Rc<Texture> _texture;
 	VertexArray _vertexes;
@@ -154,6 +170,7 @@ protected:
 	RenderingLevel _renderingLevel = RenderingLevel::Default;
 	RenderingLevel _realRenderingLevel = RenderingLevel::Default;
 	uint64_t _materialId = 0;
+	uint64_t _layerMaterialId = 0; // material with accumulated alpha for offscreen layers
 	gl::CommandFlags _commandFlags = gl::CommandFlags::None;
 
 	Color4F _tmpColor;
@@ -161,6 +178,10 @@ protected:
 	BlendInfo _blendInfo;
 	PipelineMaterialInfo _materialInfo;
 
+	Vector<gl::InstanceObject> _instances;
+	bool _instancesTransparent = false;
+	bool _instancesDirty = false;
+
 	Vector<Rc<renderqueue::DependencyEvent>> _pendingDependencies;
 	Function<void()> _textureLoadedCallback;
 };
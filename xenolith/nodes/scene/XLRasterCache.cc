@@ -0,0 +1,464 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "XLRasterCache.h"
+#include "XLScene.h"
+#include "XLSprite.h"
+#include "XLDirector.h"
+#include "XLApplication.h"
+#include "XLInputDispatcher.h"
+#include "XLRenderFrameInfo.h"
+#include "XLRenderQueueFrameCache.h"
+#include "XLRenderQueueImageStorage.h"
+#include "XLVkMaterialShadowPass.h"
+
+namespace stappler::xenolith {
+
+RasterCacheEntry::~RasterCacheEntry() { }
+
+RasterCacheEntry::RasterCacheEntry(Node *node) : _node(node) {
+	_vertexes.init(4, 6);
+}
+
+RasterCache::~RasterCache() { }
+
+bool RasterCache::init(Scene *scene, size_t budget) {
+	_scene = scene;
+	_budget = budget;
+	return true;
+}
+
+bool RasterCache::visitDraw(Node *node, RenderFrameInfo &info, NodeFlags flags, bool dirty) {
+	if (node == _current) {
+		// subtree is drawing into its own layer
+		return false;
+	}
+
+	auto entry = acquireEntry(node);
+	if (!entry) {
+		return false;
+	}
+
+	entry->_access = ++ _clock;
+
+	if (dirty || (flags & NodeFlags::DirtyMask) != NodeFlags::None) {
+		// layer is outdated, draw subtree as usual until it becomes clean
+		// results of the layer frame in progress will be dropped
+		if (entry->_state == Entry::State::Ready || entry->_state == Entry::State::Pending) {
+			entry->_state = Entry::State::Idle;
+		}
+		entry->_dependency = nullptr;
+		++ entry->_gen;
+		return false;
+	}
+
+	switch (entry->_state) {
+	case Entry::State::Compiling:
+	case Entry::State::Pending:
+		break;
+	case Entry::State::Idle:
+		// subtree is clean on this frame, render it into layer, but draw as usual until layer is ready
+		rasterize(entry, node, info);
+		break;
+	case Entry::State::Ready:
+		if (draw(entry, node, info)) {
+			++ _stat.hits;
+			return true;
+		}
+		break;
+	}
+
+	return false;
+}
+
+void RasterCache::remove(Node *node) {
+	auto it = _entries.find(node);
+	if (it != _entries.end()) {
+		removeEntry(it);
+	}
+}
+
+void RasterCache::clear() {
+	while (!_entries.empty()) {
+		removeEntry(_entries.begin());
+	}
+	_usage = 0;
+}
+
+void RasterCache::setBudget(size_t value) {
+	_budget = value;
+	if (_usage > _budget) {
+		evict(_budget, nullptr);
+	}
+}
+
+RasterCache::Stat RasterCache::getStat() const {
+	auto ret = _stat;
+	ret.size = _entries.size();
+	ret.usage = _usage;
+	return ret;
+}
+
+RasterCache::Entry *RasterCache::acquireEntry(Node *node) {
+	auto it = _entries.find(node);
+	if (it != _entries.end()) {
+		return it->second.get();
+	}
+
+	if (!_scene->getDirector()) {
+		return nullptr;
+	}
+
+	auto entry = Rc<Entry>::alloc(node);
+	_entries.emplace(node, entry);
+	compile(entry.get());
+	return entry.get();
+}
+
+void RasterCache::removeEntry(Map<Node *, Rc<Entry>>::iterator it) {
+	auto entry = move(it->second);
+	_entries.erase(it);
+
+	_usage -= entry->_size;
+
+	if (entry->_materialId) {
+		_scene->revokeImages(Vector<uint64_t>{entry->_materialImage});
+	}
+
+	if (entry->_image && entry->_image->getInstance()) {
+		entry->_image->finalize();
+	}
+
+	entry->_state = Entry::State::Idle;
+	entry->_dependency = nullptr;
+	++ entry->_gen;
+}
+
+bool RasterCache::reserve(Entry *entry, size_t size) {
+	if (size > _budget) {
+		return false;
+	}
+
+	if (_usage - entry->_size + size > _budget) {
+		evict(_budget - size + entry->_size, entry);
+		if (_usage - entry->_size + size > _budget) {
+			return false;
+		}
+	}
+
+	_usage = _usage - entry->_size + size;
+	entry->_size = size;
+	return true;
+}
+
+void RasterCache::evict(size_t target, const Entry *keep) {
+	// least recently drawn layers are evicted first
+	while (_usage > target) {
+		auto lru = _entries.end();
+		for (auto it = _entries.begin(); it != _entries.end(); ++ it) {
+			if (it->second.get() != keep && it->second->_size > 0
+					&& (lru == _entries.end() || it->second->_access < lru->second->_access)) {
+				lru = it;
+			}
+		}
+
+		if (lru == _entries.end()) {
+			break;
+		}
+
+		removeEntry(lru);
+		++ _stat.evictions;
+	}
+}
+
+void RasterCache::compile(Entry *entry) {
+	static const uint8_t placeholder[4] = { 255, 255, 255, 255 };
+
+	// layer image is dynamic: it's compiled once with placeholder data,
+	// then every layer frame replaces image instance for all materials, that use it
+	entry->_image = Rc<gl::DynamicImage>::create([] (gl::DynamicImage::Builder &builder) {
+		builder.setImage("RasterCacheLayer",
+			gl::ImageInfo(
+					Extent2(1, 1),
+					gl::ImageUsage::Sampled | gl::ImageUsage::TransferDst,
+					gl::RenderPassType::Graphics,
+					gl::ImageFormat::R8G8B8A8_UNORM
+			), BytesView(placeholder, 4));
+		return true;
+	});
+
+	entry->_texture = Rc<Texture>::create(entry->_image);
+	entry->_state = Entry::State::Compiling;
+
+	Rc<gl::Loop> loop = _scene->getDirector()->getView()->getLoop();
+	loop->compileImage(entry->_image, [cache = Rc<RasterCache>(this), entry = Rc<Entry>(entry), loop] (bool success) {
+		loop->getApplication()->performOnMainThread([cache, entry, success] {
+			auto it = cache->_entries.find(entry->_node);
+			if (it == cache->_entries.end() || it->second.get() != entry.get() || entry->_state != Entry::State::Compiling) {
+				return;
+			}
+
+			if (success) {
+				entry->_state = Entry::State::Idle;
+			} else {
+				log::vtext("RasterCache", "Fail to compile layer image for node: ", entry->_node->getName());
+				entry->_node->setRasterized(false);
+			}
+		}, cache.get());
+	});
+}
+
+void RasterCache::rasterize(Entry *entry, Node *node, RenderFrameInfo &info) {
+	auto &size = node->getContentSize();
+	if (size.width <= 0.0f || size.height <= 0.0f) {
+		return;
+	}
+
+	auto &queue = _scene->getRenderQueue();
+
+	const renderqueue::AttachmentData *output = nullptr;
+	for (auto &it : queue->getOutputAttachments()) {
+		if (auto a = dynamic_cast<renderqueue::ImageAttachment *>(it->attachment.get())) {
+			if ((a->getImageInfo().usage & gl::ImageUsage::ColorAttachment) != gl::ImageUsage::None) {
+				output = it;
+				break;
+			}
+		}
+	}
+
+	if (!output) {
+		return;
+	}
+
+	// layer resolution follows node's global scale, so cached quad is drawn 1:1 with screen pixels
+	auto &transform = info.modelTransformStack.back();
+	Vec3 scale;
+	transform.decompose(&scale, nullptr, nullptr);
+
+	Extent2 extent(std::ceil(size.width * std::abs(scale.x)), std::ceil(size.height * std::abs(scale.y)));
+	if (extent.width == 0 || extent.height == 0) {
+		return;
+	}
+
+	if (!reserve(entry, extent.width * extent.height * 4)) {
+		return;
+	}
+
+	gl::FrameContraints constraints;
+	constraints.extent = extent;
+	constraints.density = _scene->getFrameConstraints().density;
+
+	auto req = Rc<renderqueue::FrameRequest>::create(queue, constraints);
+
+	// layer keeps subtree's coverage in alpha channel
+	req->setClearColor(output, Color4F(0.0f, 0.0f, 0.0f, 0.0f));
+
+	if (auto a = queue->getInputAttachment<vk::ShadowSdfImageAttachment>()) {
+		gl::ImageInfoData sdfInfo = a->getImageInfo();
+		sdfInfo.extent = Extent2(std::ceil((extent.width / constraints.density) * _scene->_shadowDensity),
+				std::ceil((extent.height / constraints.density) * _scene->_shadowDensity));
+		req->addImageSpecialization(a, move(sdfInfo));
+	}
+
+	RenderFrameInfo layerInfo;
+	layerInfo.director = info.director;
+	layerInfo.scene = info.scene;
+	layerInfo.pool = req->getPool()->getPool();
+	layerInfo.currentStateId = 0;
+	layerInfo.accumulateAlpha = true;
+	layerInfo.shadows = Rc<gl::CommandList>::create(req->getPool());
+	layerInfo.commands = Rc<gl::CommandList>::create(req->getPool());
+
+	// layer is not lit, scene lights are applied when layer is composed
+	layerInfo.lights = Rc<gl::ShadowLightInput>::alloc();
+	layerInfo.lights->sceneDensity = constraints.density;
+	layerInfo.lights->shadowDensity = _scene->_shadowDensity;
+	layerInfo.lights->globalColor = Color4F::WHITE;
+
+	// input listeners for subtree are registered with main frame
+	layerInfo.input = Rc<InputListenerStorage>::alloc(req->getPool().get());
+
+	// general projection for node's content rect in node's space
+	Mat4 proj;
+	proj.scale(2.0f / size.width, -2.0f / size.height, -1.0);
+	proj.m[12] = -1.0;
+	proj.m[13] = 1.0f;
+	proj.m[14] = 0.0f;
+	proj.m[15] = 1.0f;
+
+	layerInfo.zPath.reserve(8);
+	layerInfo.viewProjectionStack.reserve(2);
+	layerInfo.viewProjectionStack.push_back(proj * transform.getInversed());
+	layerInfo.modelTransformStack.reserve(8);
+	layerInfo.modelTransformStack.push_back(info.modelTransformStack.at(info.modelTransformStack.size() - 2));
+	layerInfo.shadowStack.reserve(4);
+	layerInfo.shadowStack.push_back(0.0f);
+
+	_current = node;
+	node->visitDraw(layerInfo, NodeFlags::None);
+	_current = nullptr;
+
+	entry->_extent = extent;
+	entry->_state = Entry::State::Pending;
+	entry->_dependency = Rc<renderqueue::DependencyEvent>::alloc();
+	req->addSignalDependency(Rc<renderqueue::DependencyEvent>(entry->_dependency));
+
+	++ _stat.misses;
+
+	Rc<gl::Loop> loop = _scene->getDirector()->getView()->getLoop();
+	loop->performOnGlThread([cache = Rc<RasterCache>(this), entry = Rc<Entry>(entry), gen = entry->_gen,
+			dep = entry->_dependency, req, q = queue, loop, output, extent,
+			commands = move(layerInfo.commands),
+			shadows = move(layerInfo.shadows),
+			lights = move(layerInfo.lights)] () mutable {
+		auto a = static_cast<renderqueue::ImageAttachment *>(output->attachment.get());
+
+		// layer image should be sampled by material pass, so we provide it as render target
+		gl::ImageInfo imageInfo(extent, gl::ImageUsage::ColorAttachment | gl::ImageUsage::Sampled,
+				gl::RenderPassType::Graphics, a->getImageInfo().format);
+		auto views = a->getImageViews(imageInfo);
+
+		auto target = loop->getFrameCache()->acquireImage(imageInfo, views);
+		if (!target) {
+			loop->getApplication()->performOnMainThread([cache, entry, gen] {
+				cache->onRasterized(entry.get(), gen, false);
+			}, cache.get());
+			return;
+		}
+
+		req->setRenderTarget(output, move(target));
+
+		req->addInput(q->getInputAttachment<vk::VertexMaterialAttachment>(), move(commands));
+		req->addInput(q->getInputAttachment<vk::ShadowLightDataAttachment>(), Rc<gl::ShadowLightInput>(lights));
+		req->addInput(q->getInputAttachment<vk::ShadowVertexAttachment>(), move(shadows));
+		req->addInput(q->getInputAttachment<vk::ShadowSdfImageAttachment>(), Rc<gl::ShadowLightInput>(lights));
+
+		req->setOutput(output, [cache, entry, gen, dep, loop] (const Rc<gl::View> &, renderqueue::FrameAttachmentData &data, bool success) {
+			if (!success || !data.image) {
+				loop->getApplication()->performOnMainThread([cache, entry, gen] {
+					cache->onRasterized(entry.get(), gen, false);
+				}, cache.get());
+				return false;
+			}
+
+			Rc<renderqueue::ImageStorage> storage = move(data.image);
+
+			// transition from render pass final layout is performed by material pass, that samples layer first
+			auto image = (vk::Image *)storage->getImage().get();
+			image->setPendingBarrier(vk::ImageMemoryBarrier(image,
+					VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+					VkImageLayout(storage->getLayout()), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL));
+
+			// storage is held by image instance until all materials release it
+			auto obj = storage->getImage();
+			entry->_image->updateInstance(*loop, obj, nullptr, Rc<Ref>(storage),
+					Vector<Rc<renderqueue::DependencyEvent>>{dep});
+
+			loop->getApplication()->performOnMainThread([cache, entry, gen] {
+				cache->onRasterized(entry.get(), gen, true);
+			}, cache.get());
+			return true;
+		});
+
+		loop->runRenderQueue(move(req));
+	}, this);
+}
+
+bool RasterCache::draw(Entry *entry, Node *node, RenderFrameInfo &info) {
+	if (!entry->_texture) {
+		return false;
+	}
+
+	if (entry->_materialId == 0) {
+		MaterialInfo materialInfo;
+		materialInfo.type = gl::MaterialType::Basic2D;
+		materialInfo.images[0] = entry->_texture->getIndex();
+		materialInfo.samplers[0] = Sprite::SamplerIndexDefaultFilterLinear;
+
+		// layer color is premultiplied by subtree's alpha
+		materialInfo.pipeline.setBlendInfo(BlendInfo(gl::BlendFactor::One, gl::BlendFactor::OneMinusSrcAlpha, gl::BlendOp::Add,
+				gl::BlendFactor::One, gl::BlendFactor::OneMinusSrcAlpha, gl::BlendOp::Add));
+		materialInfo.pipeline.setDepthInfo(DepthInfo(false, true, gl::CompareOp::LessOrEqual));
+
+		Vector<gl::MaterialImage> images;
+		images.emplace_back(entry->_texture->getMaterialImage());
+
+		entry->_materialId = _scene->acquireMaterial(materialInfo, move(images), true);
+		if (entry->_materialId == 0) {
+			log::vtext("RasterCache", "Fail to acquire material for node layer: ", node->getName());
+			return false;
+		}
+		entry->_materialImage = materialInfo.images[0];
+	}
+
+	auto &size = node->getContentSize();
+	if (entry->_vertexes.empty() || entry->_vertexesSize != size) {
+		entry->_vertexes.clear();
+		entry->_vertexes.addQuad()
+			.setGeometry(Vec4(0.0f, 0.0f, 0.0f, 1.0f), size)
+			.setTextureRect(Rect(0.0f, 0.0f, 1.0f, 1.0f), 1.0f, 1.0f, false, false)
+			.setColor(Color4F::WHITE);
+		entry->_vertexesSize = size;
+	}
+
+	if (entry->_dependency) {
+		// wait for layer frame and material update on first use
+		emplace_ordered(info.commands->waitDependencies, move(entry->_dependency));
+		entry->_dependency = nullptr;
+	}
+
+	info.commands->pushVertexArray(entry->_vertexes.pop(), info.viewProjectionStack.back() * info.modelTransformStack.back(),
+			info.zPath, entry->_materialId, RenderingLevel::Transparent, info.shadowStack.back());
+	return true;
+}
+
+void RasterCache::onRasterized(Entry *entry, uint32_t gen, bool success) {
+	auto it = _entries.find(entry->_node);
+	if (it == _entries.end() || it->second.get() != entry) {
+		// layer was evicted while frame was in progress, reservation was released with it
+		return;
+	}
+
+	if (success) {
+		// image instance was replaced, even if it's already outdated
+		entry->_rendered = true;
+	}
+
+	if (entry->_gen != gen || entry->_state != Entry::State::Pending) {
+		// layer was invalidated while frame was in progress
+		if (!success && entry->_state != Entry::State::Pending && !entry->_rendered) {
+			// reservation was made for image, that does not exist; next layer frame will reserve it again
+			_usage -= entry->_size;
+			entry->_size = 0;
+		}
+		return;
+	}
+
+	if (success) {
+		entry->_state = Entry::State::Ready;
+	} else {
+		log::vtext("RasterCache", "Fail to render layer for node: ", entry->_node->getName());
+		entry->_node->setRasterized(false);
+	}
+}
+
+}
@@ -0,0 +1,140 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef XENOLITH_NODES_SCENE_XLRASTERCACHE_H_
+#define XENOLITH_NODES_SCENE_XLRASTERCACHE_H_
+
+#include "XLNode.h"
+#include "XLTexture.h"
+#include "XLVertexArray.h"
+#include "XLGlDynamicImage.h"
+
+namespace stappler::xenolith {
+
+class RasterCacheEntry : public Ref {
+public:
+	enum class State {
+		Compiling, // placeholder image is compiling
+		Idle, // no valid layer image
+		Pending, // layer frame was submitted
+		Ready, // layer image can be drawn
+	};
+
+	virtual ~RasterCacheEntry();
+
+	RasterCacheEntry(Node *);
+
+	Node *getNode() const { return _node; }
+	State getState() const { return _state; }
+	Extent2 getExtent() const { return _extent; }
+
+	// VRAM, reserved for layer image
+	size_t getSize() const { return _size; }
+
+protected:
+	friend class RasterCache;
+
+	Node *_node = nullptr;
+	State _state = State::Compiling;
+	uint32_t _gen = 0;
+	uint64_t _access = 0;
+	Extent2 _extent;
+	size_t _size = 0;
+	bool _rendered = false; // image instance was replaced by layer frame at least once
+
+	Rc<gl::DynamicImage> _image;
+	Rc<Texture> _texture;
+	Rc<renderqueue::DependencyEvent> _dependency;
+
+	VertexArray _vertexes;
+	Size2 _vertexesSize;
+	uint64_t _materialId = 0;
+	uint64_t _materialImage = 0;
+};
+
+// Offscreen layers for rasterized nodes (see Node::setRasterized)
+//
+// Clean subtree is rendered once with scene's render queue into its own image, then it's drawn as a single
+// textured quad, until any node in subtree changes its transform, content size, order or content.
+// Layers are limited with VRAM budget, least recently drawn layers are evicted first; subtree,
+// that does not fit into budget, is drawn as usual.
+//
+// Layer is cleared with transparent color and composed as a premultiplied-alpha quad on transparent level,
+// so subtree can have any shape within its content rect. Sprites in layer frame use materials with
+// accumulated alpha (see RenderFrameInfo::accumulateAlpha), on-screen blending is not changed.
+// Cached subtree does not cast shadows and its components are not visited while layer is in use;
+// dynamic state (scissor) within subtree is not supported.
+class RasterCache : public Ref {
+public:
+	static constexpr size_t DefaultBudget = 64 * 1024 * 1024;
+
+	using Entry = RasterCacheEntry;
+
+	struct Stat {
+		uint64_t hits = 0; // frames, drawn with cached layer
+		uint64_t misses = 0; // layer rasterizations
+		uint64_t evictions = 0;
+		size_t size = 0;
+		size_t usage = 0; // VRAM, used by layers
+	};
+
+	virtual ~RasterCache();
+
+	bool init(Scene *, size_t budget = DefaultBudget);
+
+	// called from Node::visitDraw for rasterized node after it's transform was pushed into frame info
+	// returns true if subtree was drawn as cached layer
+	bool visitDraw(Node *, RenderFrameInfo &, NodeFlags flags, bool dirty);
+
+	void remove(Node *);
+	void clear();
+
+	void setBudget(size_t);
+	size_t getBudget() const { return _budget; }
+
+	Stat getStat() const;
+
+protected:
+	Entry *acquireEntry(Node *);
+	void removeEntry(Map<Node *, Rc<Entry>>::iterator);
+
+	bool reserve(Entry *, size_t);
+	void evict(size_t target, const Entry *keep);
+
+	void compile(Entry *);
+	void rasterize(Entry *, Node *, RenderFrameInfo &);
+	bool draw(Entry *, Node *, RenderFrameInfo &);
+
+	void onRasterized(Entry *, uint32_t gen, bool success);
+
+	Scene *_scene = nullptr;
+	Node *_current = nullptr; // node, rendered into layer right now
+	size_t _budget = DefaultBudget;
+	size_t _usage = 0;
+	uint64_t _clock = 0;
+	Map<Node *, Rc<Entry>> _entries;
+	Stat _stat;
+};
+
+}
+
+#endif /* XENOLITH_NODES_SCENE_XLRASTERCACHE_H_ */
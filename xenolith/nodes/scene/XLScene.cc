@@ -30,10 +30,12 @@ THE SOFTWARE.
 #include "XLRenderQueueFrameHandle.h"
 #include "XLVkMaterialShadowPass.h"
 #include "XLSceneContent.h"
+#include "XLRasterCache.h"
 
 namespace stappler::xenolith {
 
 Scene::~Scene() {
+	_rasterCache = nullptr;
 	_queue = nullptr;
 }
 
@@ -46,6 +48,7 @@ bool Scene::init(Application *app, RenderQueue::Builder &&builder, const gl::Fra
 
 	_application = app;
 	_queue = makeQueue(move(builder));
+	_rasterCache = Rc<RasterCache>::create(this);
 
 	_content = addChild(Rc<SceneContent>::create());
 
@@ -178,6 +181,15 @@ void Scene::render(RenderFrameInfo &info) {
 
 	info.input = eventDispatcher->acquireNewStorage();
 
+	info.commands->clearDamage();
+	if (_damageFull) {
+		info.commands->setDamageFull();
+	} else {
+		info.commands->addDamage(_damage);
+	}
+	_damage = Rect::ZERO;
+	_damageFull = false;
+
 	visitGeometry(info, NodeFlags::None);
 	visitDraw(info, NodeFlags::None);
 
@@ -252,6 +264,7 @@ void Scene::onFinished(Director *dir) {
 				cache->removeResource(res->getName());
 			}
 		}
+		_rasterCache->clear();
 		_attachmentsByType.clear();
 		_materials.clear();
 		_pending.clear();
@@ -488,6 +501,7 @@ bool Scene::addLight(SceneLight *light, uint64_t tag, StringView name) {
 		light->_scene = this;
 	}
 
+	invalidateDamage();
 	return true;
 }
 
@@ -554,12 +568,35 @@ void Scene::removeAllLightsByType(SceneLightType type) {
 
 void Scene::setGlobalLight(const Color4F &color) {
 	_globalLight = color;
+	invalidateDamage();
 }
 
 const Color4F & Scene::getGlobalLight() const {
 	return _globalLight;
 }
 
+void Scene::addDamage(const Rect &rect) {
+	if (_damageFull || rect.size.width <= 0.0f || rect.size.height <= 0.0f) {
+		return;
+	}
+
+	if (_damage.size.width <= 0.0f || _damage.size.height <= 0.0f) {
+		_damage = rect;
+		return;
+	}
+
+	auto minX = std::min(_damage.origin.x, rect.origin.x);
+	auto minY = std::min(_damage.origin.y, rect.origin.y);
+	auto maxX = std::max(_damage.origin.x + _damage.size.width, rect.origin.x + rect.size.width);
+	auto maxY = std::max(_damage.origin.y + _damage.size.height, rect.origin.y + rect.size.height);
+
+	_damage = Rect(minX, minY, maxX - minX, maxY - minY);
+}
+
+void Scene::invalidateDamage() {
+	_damageFull = true;
+}
+
 void Scene::setClipContent(bool value) {
 	if (isClipContent() != value) {
 		if (value) {
@@ -731,6 +768,7 @@ Vector<Rc<SceneLight>>::iterator Scene::removeLight(Vector<Rc<SceneLight>>::iter
 	case SceneLightType::Direct: -- _lightsDirectCount; break;
 	}
 
+	invalidateDamage();
 	return _lights.erase(itVec);
 }
 
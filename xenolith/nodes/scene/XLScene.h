@@ -35,6 +35,7 @@ namespace stappler::xenolith {
 
 class SceneLight;
 class SceneContent;
+class RasterCache;
 
 class Scene : public Node {
 public:
@@ -103,7 +104,18 @@ public:
 	virtual void setClipContent(bool);
 	virtual bool isClipContent() const;
 
+	// offscreen layers for rasterized nodes
+	const Rc<RasterCache> &getRasterCache() const { return _rasterCache; }
+
+	// damage outside of visible node tree (removed or hidden nodes, lights), merged into next frame
+	virtual void addDamage(const Rect &);
+
+	// redraw whole next frame
+	virtual void invalidateDamage();
+
 protected:
+	friend class RasterCache;
+
 	using Node::init;
 	using Node::addChild; // запрет добавлять ноды напрямую на сцену
 
@@ -153,6 +165,7 @@ protected:
 	SceneContent *_content = nullptr;
 
 	Rc<RenderQueue> _queue;
+	Rc<RasterCache> _rasterCache;
 
 	Map<gl::MaterialType, AttachmentData> _attachmentsByType;
 	std::unordered_map<uint64_t, Vector<SceneMaterialInfo>> _materials;
@@ -174,6 +187,9 @@ protected:
 	Color4F _globalLight = Color4F(1.0f, 1.0f, 1.0f, 1.0f);
 	gl::FrameContraints _constraints;
 
+	Rect _damage;
+	bool _damageFull = true;
+
 	bool _cacheDirty = false;
 	float _cachedShadowDensity = nan();
 	uint32_t _cachedLightsCount = 0;
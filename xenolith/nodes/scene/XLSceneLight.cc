@@ -21,6 +21,7 @@
  **/
 
 #include "XLSceneLight.h"
+#include "XLScene.h"
 
 namespace stappler::xenolith {
 
@@ -56,14 +57,23 @@ void SceneLight::onExit() {
 
 void SceneLight::setNormal(const Vec4 &vec) {
 	_normal = vec;
+	if (_scene) {
+		_scene->invalidateDamage();
+	}
 }
 
 void SceneLight::setColor(const Color4F &color) {
 	_color = color;
+	if (_scene) {
+		_scene->invalidateDamage();
+	}
 }
 
 void SceneLight::setData(const Vec4 &data) {
 	_data = data;
+	if (_scene) {
+		_scene->invalidateDamage();
+	}
 }
 
 void SceneLight::setName(StringView str) {
@@ -23,6 +23,7 @@
 
 #include "XLUtilScene.h"
 #include "XLLabel.h"
+#include "XLDeferredManager.h"
 #include "XLLayer.h"
 #include "XLDirector.h"
 #include "XLApplication.h"
@@ -89,24 +90,33 @@ void UtilScene::FpsDisplay::update(const UpdateTime &) {
 		auto stat = _director->getDrawStat();
 		auto tm = _director->getDirectorFrameTime();
 		auto vertex = stat.vertexInputTime / float(1000);
+		auto record = stat.commandsRecordTime / float(1000);
+		auto deferred = _director->getApplication()->getDeferredManager()->getStat();
+		auto memory = _director->getMemoryStat();
+		auto &fontController = _director->getApplication()->getFontController();
+		auto fonts = fontController ? fontController->getStat() : font::FontController::Stat();
 
 		if (_label) {
 			String str;
 			switch (_mode) {
 			case Fps:
 				str = toString(std::setprecision(3),
-					"FPS: ", fps, " SPF: ", spf, "\nGPU: ", local, "\nDir: ", tm, " Ver: ", vertex,
+					"FPS: ", fps, " SPF: ", spf, "\nGPU: ", local, "\nDir: ", tm, " Ver: ", vertex, " Rec: ", record,
 					"\nF12 to switch");
 				break;
 			case Vertexes:
 				str = toString(std::setprecision(3),
 					"V:", stat.vertexes, " T:", stat.triangles, "\nZ:", stat.zPaths, " C:", stat.drawCalls, " M: ", stat.materials, "\n",
 					stat.solidCmds, "/", stat.surfaceCmds, "/", stat.transparentCmds,
+					"\nTr: ", stat.transforms, "/", stat.batchedTransforms,
 					"\nF12 to switch");
 				break;
 			case Cache:
 				str = toString(std::setprecision(3),
 					"Cache:", stat.cachedFramebuffers, "/", stat.cachedImages, "/", stat.cachedImageViews,
+					"\nDeferred: ", deferred.queueDepth, " ", deferred.avgLatency / float(1000),
+					"\nFonts: ", fonts.layouts, "/", fonts.unused, " ", fonts.created, "/", fonts.evicted,
+					"\nMem: ", memory.getDeviceUsage() / 1_MiB, "/", memory.getDeviceBudget() / 1_MiB, " MiB",
 					"\nF12 to switch");
 				break;
 			case Full:
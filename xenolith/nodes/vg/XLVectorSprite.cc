@@ -163,6 +163,10 @@ void VectorSprite::onTransformDirty(const Mat4 &parent) {
 	Sprite::onTransformDirty(parent);
 }
 
+bool VectorSprite::isContentDirty() const {
+	return Sprite::isContentDirty() || (_image && _image->isDirty());
+}
+
 bool VectorSprite::visitDraw(RenderFrameInfo &frame, NodeFlags parentFlags) {
 	if (_image && _image->isDirty()) {
 		_vertexesDirty = true;
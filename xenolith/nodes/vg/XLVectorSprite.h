@@ -70,6 +70,8 @@ public:
 
 	virtual bool visitDraw(RenderFrameInfo &, NodeFlags parentFlags) override;
 
+	virtual bool isContentDirty() const override;
+
 	virtual uint32_t getTrianglesCount() const;
 	virtual uint32_t getVertexesCount() const;
 
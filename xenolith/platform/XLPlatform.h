@@ -71,6 +71,13 @@ namespace device {
 	void _sleep(uint64_t microseconds);
 }
 
+namespace file {
+	// Maps file (by resolved native path) into memory in read-only mode, returns empty view on failure
+	// handle should be passed into _unmapFile when data is no longer needed
+	BytesView _mapFile(StringView path, void **handle);
+	void _unmapFile(BytesView, void *handle);
+}
+
 namespace interaction {
 	bool _goToUrl(void *handle, StringView url, bool external);
 	void _makePhoneCall(void *handle, StringView number);
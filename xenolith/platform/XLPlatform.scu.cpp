@@ -23,11 +23,15 @@ THE SOFTWARE.
 
 #include "XLDefine.h"
 
+#include "posix/XLPosixFilesystem.cc"
+
 #include "linux/XLVkViewImpl.cc"
 #include "linux/XLVkViewWayland.cc"
 #include "linux/XLVkViewXcb.cc"
+#include "linux/XLVkViewHeadless.cc"
 #include "linux/XLVulkan.cc"
 #include "linux/XLDevice.cc"
+#include "linux/XLFilesystem.cc"
 #include "linux/XLInteraction.cc"
 #include "linux/XLLinuxDBus.cc"
 #include "linux/XLLinuxWayland.cc"
@@ -36,6 +40,7 @@ THE SOFTWARE.
 #include "linux/XLNetwork.cc"
 
 #include "mac/XLDevice.cc"
+#include "mac/XLFilesystem.cc"
 #include "mac/XLInteraction.cc"
 #include "mac/XLNetwork.cc"
 #include "mac/XLVulkan.cc"
@@ -44,6 +49,7 @@ THE SOFTWARE.
 #include "android/XLKeyMapping.cc"
 #include "android/XLJni.cc"
 #include "android/XLDevice.cc"
+#include "android/XLFilesystem.cc"
 #include "android/XLInteraction.cc"
 #include "android/XLNetwork.cc"
 #include "android/XLVulkan.cc"
@@ -55,6 +55,7 @@ enum class SurfaceType : uint32_t {
 	None,
 	XCB = 1 << 0,
 	Wayland = 1 << 1,
+	Headless = 1 << 2,
 };
 
 SP_DEFINE_ENUM_AS_MASK(SurfaceType)
@@ -148,6 +149,32 @@ public:
 	virtual void commit(uint32_t width, uint32_t height) { }
 };
 
+// Window-less presentation target, based on VK_EXT_headless_surface
+// Used to run full frame pipeline without window system (CI, render farms, benchmarks)
+class HeadlessView : public LinuxViewInterface {
+public:
+	HeadlessView(ViewImpl *, StringView, URect);
+	virtual ~HeadlessView();
+
+	virtual VkSurfaceKHR createWindowSurface(vk::Instance *instance, VkPhysicalDevice dev) const override;
+
+	// no input sources for headless view
+	virtual int getSocketFd() const override { return -1; }
+
+	virtual bool poll(bool frameReady) override { return true; }
+
+	// frames are not limited by display
+	virtual uint64_t getScreenFrameInterval() const override { return 0; }
+
+	virtual void mapWindow() override { }
+
+	virtual void onSurfaceInfo(gl::SurfaceInfo &) const override;
+
+protected:
+	ViewImpl *_view = nullptr;
+	Extent2 _extent;
+};
+
 class ViewImpl : public vk::View {
 public:
 	ViewImpl();
@@ -185,11 +212,18 @@ protected:
 
 	virtual void finalize() override;
 
+	virtual void releaseOffscreenImage(Rc<ImageStorage> &&) override;
+
 	Rc<LinuxViewInterface> _view;
 	URect _rect;
 	String _name;
 	int _eventFd = -1;
 	bool _inputEnabled = false;
+	bool _headless = false;
+
+	String _captureDir;
+	uint32_t _captureInterval = 0;
+	uint64_t _presentedFrames = 0;
 };
 
 }
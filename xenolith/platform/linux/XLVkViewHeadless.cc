@@ -0,0 +1,57 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+
+#include "XLDefine.h"
+
+#if LINUX
+
+#include "XLVkInstance.h"
+#include "XLPlatformLinux.h"
+
+namespace stappler::xenolith::platform {
+
+HeadlessView::HeadlessView(ViewImpl *view, StringView name, URect rect)
+: _view(view), _extent(rect.width, rect.height) { }
+
+HeadlessView::~HeadlessView() { }
+
+VkSurfaceKHR HeadlessView::createWindowSurface(vk::Instance *instance, VkPhysicalDevice dev) const {
+	VkSurfaceKHR surface = VK_NULL_HANDLE;
+	VkHeadlessSurfaceCreateInfoEXT createInfo{VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT, nullptr, 0};
+	if (!instance->vkCreateHeadlessSurfaceEXT
+			|| instance->vkCreateHeadlessSurfaceEXT(instance->getInstance(), &createInfo, nullptr, &surface) != VK_SUCCESS) {
+		return nullptr;
+	}
+	return surface;
+}
+
+void HeadlessView::onSurfaceInfo(gl::SurfaceInfo &info) const {
+	// headless surface has no extent by itself (0xFFFFFFFF), swapchain extent defined by view
+	info.currentExtent = Extent2(
+		std::max(info.minImageExtent.width, std::min(_extent.width, info.maxImageExtent.width)),
+		std::max(info.minImageExtent.height, std::min(_extent.height, info.maxImageExtent.height)));
+}
+
+}
+
+#endif
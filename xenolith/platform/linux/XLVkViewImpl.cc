@@ -46,12 +46,33 @@ bool ViewImpl::init(gl::Loop &loop, gl::Device &dev, gl::ViewInfo &&info) {
 	_rect = info.rect;
 	_name = info.name;
 
-	_constraints.density = loop.getApplication()->getData().density;
+	auto &data = loop.getApplication()->getData();
+
+	_constraints.density = data.density;
+
+	if (data.headless) {
+		// render frames into offscreen images one by one, as fast as possible
+		_headless = true;
+		_options.renderImageOffscreen = true;
+		_options.renderOnDemand = false;
+		_captureDir = data.headlessCapture;
+		_captureInterval = data.headlessCaptureInterval;
+		if (!_captureDir.empty()) {
+			filesystem::mkdir(_captureDir);
+		}
+	}
 
 	if (!View::init(static_cast<vk::Loop &>(loop), static_cast<vk::Device &>(dev), move(info))) {
 		return false;
 	}
 
+	if (_headless) {
+		_frameInterval = 0;
+		if (data.headlessFrameRate > 0.0f) {
+			_director->setFixedFrameInterval(uint64_t(1'000'000.0f / data.headlessFrameRate));
+		}
+	}
+
 	return true;
 }
 
@@ -61,7 +82,18 @@ void ViewImpl::threadInit() {
 
 	auto presentMask = _device->getPresentatonMask();
 
-	if (auto wayland = WaylandLibrary::getInstance()) {
+	if (_headless) {
+		if ((platform::SurfaceType(presentMask) & platform::SurfaceType::Headless) != platform::SurfaceType::None) {
+			_view = Rc<HeadlessView>::alloc(this, _name, _rect);
+			_surface = Rc<vk::Surface>::create(_instance,
+					_view->createWindowSurface(_instance, _device->getPhysicalDevice()), _view);
+			if (_surface) {
+				setFrameInterval(_view->getScreenFrameInterval());
+			} else {
+				_view = nullptr;
+			}
+		}
+	} else if (auto wayland = WaylandLibrary::getInstance()) {
 		if ((platform::SurfaceType(presentMask) & platform::SurfaceType::Wayland) != platform::SurfaceType::None) {
 			auto waylandDisplay = getenv("WAYLAND_DISPLAY");
 			auto sessionType = getenv("XDG_SESSION_TYPE");
@@ -85,7 +117,7 @@ void ViewImpl::threadInit() {
 		}
 	}
 
-	if (!_view) {
+	if (!_view && !_headless) {
 		// try X11
 		if (auto xcb = XcbLibrary::getInstance()) {
 			if ((platform::SurfaceType(presentMask) & platform::SurfaceType::XCB) != platform::SurfaceType::None) {
@@ -231,6 +263,23 @@ void ViewImpl::finalize() {
 	View::finalize();
 }
 
+void ViewImpl::releaseOffscreenImage(Rc<ImageStorage> &&image) {
+	if (_captureDir.empty() || _captureInterval == 0 || (_presentedFrames ++ % _captureInterval) != 0) {
+		vk::View::releaseOffscreenImage(move(image));
+		return;
+	}
+
+	// image should not be returned into cache until it's data was read
+	auto path = filepath::merge<Interface>(_captureDir, toString("frame-", _presentedFrames - 1, ".png"));
+	auto target = image->getImage();
+	captureImage([path = move(path), loop = _loop, image = move(image)] (const gl::ImageInfo &info, BytesView view) mutable {
+		if (!saveImage(path, info, view)) {
+			log::vtext("View", "Fail to capture frame into ", path);
+		}
+		loop->releaseImage(move(image));
+	}, target, AttachmentLayout::TransferSrcOptimal);
+}
+
 }
 
 namespace stappler::xenolith::platform::graphic {
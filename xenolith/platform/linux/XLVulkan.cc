@@ -129,14 +129,22 @@ Rc<gl::Instance> createInstance(Application *app) {
 	const char *debugExt = nullptr;
 
 	SurfaceType osSurfaceType = SurfaceType::None;
-	auto xcbLib = Rc<platform::XcbLibrary>::create();
-	if (xcbLib) {
-		osSurfaceType |= SurfaceType::XCB;
-	}
+	Rc<platform::XcbLibrary> xcbLib;
+	Rc<platform::WaylandLibrary> waylandLib;
 
-	auto waylandLib = Rc<platform::WaylandLibrary>::create();
-	if (waylandLib) {
-		osSurfaceType |= SurfaceType::Wayland;
+	if (app->getData().headless) {
+		// do not touch window system, when running headless
+		osSurfaceType |= SurfaceType::Headless;
+	} else {
+		xcbLib = Rc<platform::XcbLibrary>::create();
+		if (xcbLib) {
+			osSurfaceType |= SurfaceType::XCB;
+		}
+
+		waylandLib = Rc<platform::WaylandLibrary>::create();
+		if (waylandLib) {
+			osSurfaceType |= SurfaceType::Wayland;
+		}
 	}
 
 	SurfaceType surfaceType = SurfaceType::None;
@@ -164,6 +172,10 @@ Rc<gl::Instance> createInstance(Application *app) {
 				&& (osSurfaceType & SurfaceType::Wayland) != SurfaceType::None) {
 			surfaceType |= SurfaceType::Wayland;
 			requiredExtensions.push_back(VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME);
+		} else if (strcmp(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME, extension.extensionName) == 0
+				&& (osSurfaceType & SurfaceType::Headless) != SurfaceType::None) {
+			surfaceType |= SurfaceType::Headless;
+			requiredExtensions.push_back(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME);
 		} else {
 			for (auto &it : vk::s_optionalExtension) {
 				if (it) {
@@ -195,7 +207,11 @@ Rc<gl::Instance> createInstance(Application *app) {
 	}
 
 	if (!surfaceExt || surfaceType == SurfaceType::None) {
-		log::format("Vk", "Required extension not found: %s", VK_KHR_SURFACE_EXTENSION_NAME);
+		if ((osSurfaceType & SurfaceType::Headless) != SurfaceType::None) {
+			log::format("Vk", "Required extension not found: %s", VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME);
+		} else {
+			log::format("Vk", "Required extension not found: %s", VK_KHR_SURFACE_EXTENSION_NAME);
+		}
 		completeExt = false;
 	}
 
@@ -301,6 +317,10 @@ Rc<gl::Instance> createInstance(Application *app) {
 				ret |= toInt(SurfaceType::XCB);
 			}
 		}
+		if ((surfaceType & SurfaceType::Headless) != SurfaceType::None) {
+			// headless surface has no platform query, actual support is checked with surface on swapchain creation
+			ret |= toInt(SurfaceType::Headless);
+		}
 		return ret;
 	});
 
@@ -0,0 +1,70 @@
+/**
+ Copyright (c) 2023 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "XLPosixFilesystem.h"
+
+#if LINUX || MACOS || ANDROID
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace stappler::xenolith::platform::posix {
+
+BytesView _mapFile(StringView path, void **handle) {
+	auto fullPath = path.str<Interface>();
+
+	int fd = ::open(fullPath.data(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return BytesView();
+	}
+
+	struct stat st;
+	if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+		::close(fd);
+		return BytesView();
+	}
+
+	auto ptr = ::mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd); // mapping holds its own reference to file
+
+	if (ptr == MAP_FAILED) {
+		return BytesView();
+	}
+
+	if (handle) {
+		*handle = ptr;
+	}
+
+	return BytesView((const uint8_t *)ptr, size_t(st.st_size));
+}
+
+void _unmapFile(BytesView data, void *handle) {
+	if (handle) {
+		::munmap(handle, data.size());
+	}
+}
+
+}
+
+#endif
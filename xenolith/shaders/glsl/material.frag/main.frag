@@ -9,7 +9,7 @@ layout (constant_id = 1) const int IMAGES_ARRAY_SIZE = 128;
 
 layout (push_constant) uniform pcb {
 	uint materialIdx;
-	uint padding0;
+	uint flags;
 	uint padding1;
 } pushConstants;
 
@@ -23,6 +23,7 @@ layout (set = 1, binding = 1) uniform texture2D images[IMAGES_ARRAY_SIZE];
 layout (location = 0) in vec4 fragColor;
 layout (location = 1) in vec2 fragTexCoord;
 layout (location = 2) in vec4 shadowColor;
+layout (location = 3) flat in uint fragMaterialIdx;
 
 layout (location = 0) out vec4 outColor;
 layout (location = 1) out vec4 outShadow;
@@ -30,8 +31,8 @@ layout (location = 1) out vec4 outShadow;
 void main() {
 	vec4 textureColor = texture(
 		sampler2D(
-			images[materials[pushConstants.materialIdx].samplerImageIdx & 0xFFFF],
-			immutableSamplers[materials[pushConstants.materialIdx].samplerImageIdx >> 16]
+			images[materials[fragMaterialIdx].samplerImageIdx & 0xFFFF],
+			immutableSamplers[materials[fragMaterialIdx].samplerImageIdx >> 16]
 		), fragTexCoord);
 	outColor = fragColor * textureColor;
 	outShadow = shadowColor;
@@ -8,17 +8,21 @@ layout (constant_id = 0) const int BUFFERS_ARRAY_SIZE = 16;
 
 layout (push_constant) uniform pcb {
 	uint materialIdx;
-	uint padding0;
+	uint flags; // 1 - material index comes from gl_InstanceIndex (indirect drawing), 2 - instanced vertex array
 	uint padding1;
 } pushConstants;
 
 layout (set = 0, binding = 0) readonly buffer Vertices {
 	Vertex vertices[];
-} vertexBuffer[2];
+} vertexBuffer[3];
 
 layout (set = 0, binding = 0) readonly buffer TransformObjects {
 	TransformObject objects[];
-} transformObjectBuffer[2];
+} transformObjectBuffer[3];
+
+layout (set = 0, binding = 0) readonly buffer InstanceObjects {
+	InstanceObject objects[];
+} instanceObjectBuffer[3];
 
 layout (set = 0, binding = 1) readonly buffer Materials {
 	Material materials[];
@@ -35,6 +39,7 @@ layout (set = 1, binding = 2) readonly buffer DataAtlasValueBuffer {
 layout (location = 0) out vec4 fragColor;
 layout (location = 1) out vec2 fragTexCoord;
 layout (location = 2) out vec4 shadowColor;
+layout (location = 3) flat out uint fragMaterialIdx;
 
 uint hash(uint k, uint capacity) {
 	k ^= k >> 16;
@@ -49,7 +54,8 @@ void main() {
 	const uint transformIdx = vertexBuffer[0].vertices[gl_VertexIndex].material >> 16;
 	const TransformObject transform = transformObjectBuffer[1].objects[transformIdx];
 	const Vertex vertex = vertexBuffer[0].vertices[gl_VertexIndex];
-	const Material mat = materials[pushConstants.materialIdx];
+	const uint materialIdx = ((pushConstants.flags & 1) != 0) ? uint(gl_InstanceIndex) : pushConstants.materialIdx;
+	const Material mat = materials[materialIdx];
 
 	vec4 pos = vertex.pos;
 	vec4 color = vertex.color;
@@ -80,8 +86,16 @@ void main() {
 		}
 	}
 
+	if ((pushConstants.flags & 2) != 0) {
+		const InstanceObject instance = instanceObjectBuffer[2].objects[gl_InstanceIndex];
+		pos = instance.transform * pos;
+		color = color * instance.color;
+		tex = instance.texRect.xy + tex * instance.texRect.zw;
+	}
+
 	gl_Position = transform.transform * pos * transform.mask + transform.offset;
 	fragColor = color;
 	fragTexCoord = tex;
 	shadowColor = transform.shadow;
+	fragMaterialIdx = materialIdx;
 }
@@ -70,6 +70,27 @@ struct TransformObject {
 #endif
 };
 
+// per-instance data for instanced vertex arrays, applied to vertexes before TransformObject
+struct InstanceObject {
+	mat4 transform;
+	vec4 color;
+	vec4 texRect; // xy - origin, zw - scale for texture coordinates
+
+#ifndef XL_GLSL
+	InstanceObject() :
+	transform(mat4::IDENTITY),
+	color(vec4::ONE),
+	texRect(vec4(0.0f, 0.0f, 1.0f, 1.0f))
+	{ }
+
+	InstanceObject(const mat4 &m, const vec4 &color = vec4::ONE, const vec4 &texRect = vec4(0.0f, 0.0f, 1.0f, 1.0f)) :
+	transform(m),
+	color(color),
+	texRect(texRect)
+	{ }
+#endif
+};
+
 struct DataAtlasIndex {
 	uint key;
 	uint value;